@@ -1,12 +1,39 @@
 #include "benchmark/benchmark.h"
 #include "Vector/Vector.hpp"
+#include "Vector/VectorExpression.hpp"
 #include "Matrix/Matrix.hpp"
+#include "Matrix/MatrixView.hpp"
 #include "Angle/Angle.hpp"
 
 #include "Quaternion/Quaternion.hpp"
+#include "Algorythm/Animation/Interpolation.hpp"
+#include "Random/Random.hpp"
+#include "BroadPhase/DynamicAABBTree.hpp"
+#include "BroadPhase/SweepAndPrune.hpp"
+#include "BroadPhase/SpatialHashGrid.hpp"
+#include "ShapeRelation/SegmentAABBBatch.hpp"
+#include "ShapeRelation/SegmentSphere.hpp"
+#include "ShapeRelation/SegmentPlane.hpp"
+#include "ShapeRelation/SegmentCapsule.hpp"
+#include "ShapeRelation/SegmentCylinder.hpp"
+#include "ShapeRelation/SegmentQuad.hpp"
+#include "ShapeRelation/SegmentOrientedBox.hpp"
+#include "ShapeRelation/SphereOrientedBox.hpp"
+#include "ShapeRelation/MovingSphereOrientedBox.hpp"
+#include "ShapeRelation/SeparatingAxisCache.hpp"
+#include "ShapeRelation/GJK.hpp"
+#include "ShapeRelation/EPA.hpp"
+#include "ShapeRelation/TimeOfImpact.hpp"
+#include "ShapeRelation/FrustumCulling.hpp"
 
 #include <stdlib.h>     /* std::rand, std::rand */
 #include <time.h>       /* time */
+#include <array>        /* std::array */
+#include <bitset>       /* std::bitset */
+#include <vector>       /* std::vector */
+#include <cmath>        /* std::cbrt, std::nextafter */
+#include <algorithm>    /* std::max */
+#include <limits>       /* std::numeric_limits */
 
 using namespace FoxMath;
 
@@ -20,7 +47,7 @@ static void BM_QuaternionV1(benchmark::State& state)
         Vector3<> vec {5.f, 10.f, 6.f};
         Vector3<> axis {0.f, 0.5f, 0.5f};
         axis.normalize();
-        Quaternion<>::RotateVector(vec, axis, 3_rad);
+        Quaternion<>::rotateVector(vec, axis, 3_rad);
 
         benchmark::DoNotOptimize(vec);
         benchmark::ClobberMemory();
@@ -36,7 +63,7 @@ static void BM_QuaternionV2(benchmark::State& state)
         Vector3<> vec {5.f, 10.f, 6.f};
         Vector3<> axis {0.f, 0.5f, 0.5f};
         axis.normalize();
-        Quaternion<>::RotateVector2(vec, axis, 3_rad);
+        Quaternion<>::rotateVector2(vec, axis, 3_rad);
 
         benchmark::DoNotOptimize(vec);
         benchmark::ClobberMemory();
@@ -45,6 +72,164 @@ static void BM_QuaternionV2(benchmark::State& state)
 // Register the function as a benchmark
 BENCHMARK(BM_QuaternionV2);
 
+static void BM_QuaternionHamiltonProduct(benchmark::State& state) 
+{
+  const Quaternion<> quat (Vector3<>{0.f, 0.5f, 0.5f}, 3_rad);
+
+  for (auto _ : state)
+  {
+        Vector3<> vec {5.f, 10.f, 6.f};
+        benchmark::DoNotOptimize(vec);
+        vec = (quat * vec * quat.getInverse()).getXYZ();
+
+        benchmark::DoNotOptimize(vec);
+        benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(BM_QuaternionHamiltonProduct);
+
+static void BM_QuaternionRotateVector(benchmark::State& state) 
+{
+  const Quaternion<> quat (Vector3<>{0.f, 0.5f, 0.5f}, 3_rad);
+
+  for (auto _ : state)
+  {
+        Vector3<> vec {5.f, 10.f, 6.f};
+        benchmark::DoNotOptimize(vec);
+        quat.rotateVector(vec);
+
+        benchmark::DoNotOptimize(vec);
+        benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(BM_QuaternionRotateVector);
+
+static void BM_QuaternionRotateVectorLoop(benchmark::State& state) 
+{
+  const Quaternion<> quat (Vector3<>{0.f, 0.5f, 0.5f}, 3_rad);
+  std::srand (time(NULL));
+  std::vector<Vector3<>> vecs (state.range(0));
+  for (Vector3<>& vec : vecs)
+    vec = Vector3<>(RAND_FLOAT / RAND_MAX, RAND_FLOAT / RAND_MAX, RAND_FLOAT / RAND_MAX);
+
+  for (auto _ : state)
+  {
+    for (Vector3<>& vec : vecs)
+      quat.rotateVector(vec);
+
+    benchmark::DoNotOptimize(vecs.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * vecs.size());
+}
+BENCHMARK(BM_QuaternionRotateVectorLoop)->Range(1 << 10, 1 << 16);
+
+static void BM_QuaternionRotateVectors(benchmark::State& state) 
+{
+  const Quaternion<> quat (Vector3<>{0.f, 0.5f, 0.5f}, 3_rad);
+  std::srand (time(NULL));
+  std::vector<Vector3<>> vecs (state.range(0));
+  for (Vector3<>& vec : vecs)
+    vec = Vector3<>(RAND_FLOAT / RAND_MAX, RAND_FLOAT / RAND_MAX, RAND_FLOAT / RAND_MAX);
+
+  for (auto _ : state)
+  {
+    quat.rotateVectors(vecs.data(), vecs.data(), vecs.size());
+
+    benchmark::DoNotOptimize(vecs.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * vecs.size());
+}
+BENCHMARK(BM_QuaternionRotateVectors)->Range(1 << 10, 1 << 16);
+
+#pragma region Quaternion interpolation
+
+struct QuaternionInterpolationData
+{
+  std::vector<Quaternion<>> start;
+  std::vector<Quaternion<>> end;
+  std::vector<float>        t;
+  std::vector<Quaternion<>> rst;
+};
+
+static QuaternionInterpolationData generateQuaternionInterpolationData(size_t count)
+{
+  std::srand (time(NULL));
+  QuaternionInterpolationData data {std::vector<Quaternion<>>(count), std::vector<Quaternion<>>(count), std::vector<float>(count), std::vector<Quaternion<>>(count)};
+  for (size_t i = 0; i < count; i++)
+  {
+    data.start[i] = Quaternion<>(RAND_FLOAT / RAND_MAX - 0.5f, RAND_FLOAT / RAND_MAX - 0.5f, RAND_FLOAT / RAND_MAX - 0.5f, RAND_FLOAT / RAND_MAX - 0.5f).getNormalize();
+    data.end[i]   = Quaternion<>(RAND_FLOAT / RAND_MAX - 0.5f, RAND_FLOAT / RAND_MAX - 0.5f, RAND_FLOAT / RAND_MAX - 0.5f, RAND_FLOAT / RAND_MAX - 0.5f).getNormalize();
+    data.t[i]     = RAND_FLOAT / RAND_MAX;
+  }
+  return data;
+}
+
+static void BM_QuaternionSLerp(benchmark::State& state) 
+{
+  QuaternionInterpolationData data = generateQuaternionInterpolationData(state.range(0));
+
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < data.t.size(); i++)
+      data.rst[i].sLerp(data.start[i], data.end[i], data.t[i]);
+
+    benchmark::DoNotOptimize(data.rst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * data.t.size());
+}
+BENCHMARK(BM_QuaternionSLerp)->Range(1 << 10, 1 << 16);
+
+static void BM_QuaternionApproximateSLerp(benchmark::State& state) 
+{
+  QuaternionInterpolationData data = generateQuaternionInterpolationData(state.range(0));
+
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < data.t.size(); i++)
+      data.rst[i].approximateSLerp(data.start[i], data.end[i], data.t[i]);
+
+    benchmark::DoNotOptimize(data.rst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * data.t.size());
+}
+BENCHMARK(BM_QuaternionApproximateSLerp)->Range(1 << 10, 1 << 16);
+
+static void BM_QuaternionSLerpBatch(benchmark::State& state) 
+{
+  QuaternionInterpolationData data = generateQuaternionInterpolationData(state.range(0));
+
+  for (auto _ : state)
+  {
+    Quaternion<>::sLerp(data.start.data(), data.end.data(), data.t.data(), data.rst.data(), data.t.size());
+
+    benchmark::DoNotOptimize(data.rst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * data.t.size());
+}
+BENCHMARK(BM_QuaternionSLerpBatch)->Range(1 << 10, 1 << 16);
+
+static void BM_QuaternionApproximateSLerpBatch(benchmark::State& state) 
+{
+  QuaternionInterpolationData data = generateQuaternionInterpolationData(state.range(0));
+
+  for (auto _ : state)
+  {
+    Quaternion<>::approximateSLerp(data.start.data(), data.end.data(), data.t.data(), data.rst.data(), data.t.size());
+
+    benchmark::DoNotOptimize(data.rst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * data.t.size());
+}
+BENCHMARK(BM_QuaternionApproximateSLerpBatch)->Range(1 << 10, 1 << 16);
+
+#pragma endregion //!Quaternion interpolation
+
 static void BM_NewReverseMatrixAtCompileTime(benchmark::State& state) 
 {
   for (auto _ : state)
@@ -197,5 +382,2169 @@ BENCHMARK(BM_OldAngle);
 */
 
 
+#pragma region SIMD vector
+
+/*Scalar reference : same loop than GenericVector without FOXMATH_USE_SIMD*/
+template <size_t TLength>
+static inline float scalarDot(const std::array<float, TLength>& lhs, const std::array<float, TLength>& rhs)
+{
+  float rst = 0.f;
+  for (size_t i = 0; i < TLength; i++)
+    rst += lhs[i] * rhs[i];
+  return rst;
+}
+
+template <size_t TLength>
+static inline void scalarAddScaled(std::array<float, TLength>& lhs, const std::array<float, TLength>& rhs, float scale)
+{
+  for (size_t i = 0; i < TLength; i++)
+    lhs[i] += rhs[i] * scale;
+}
+
+template <size_t TLength>
+static void BM_VectorDotScalar(benchmark::State& state)
+{
+  std::srand (time(NULL));
+  std::vector<std::array<float, TLength>> vecs (1024);
+  for (std::array<float, TLength>& vec : vecs)
+    for (float& data : vec)
+      data = RAND_FLOAT;
+
+  for (auto _ : state)
+  {
+    float rst = 0.f;
+    for (size_t i = 1; i < vecs.size(); i++)
+      rst += scalarDot<TLength>(vecs[i - 1], vecs[i]);
+
+    benchmark::DoNotOptimize(rst);
+  }
+  state.SetItemsProcessed(state.iterations() * (vecs.size() - 1));
+}
+BENCHMARK_TEMPLATE(BM_VectorDotScalar, 3);
+BENCHMARK_TEMPLATE(BM_VectorDotScalar, 4);
+
+template <size_t TLength>
+static void BM_VectorDot(benchmark::State& state)
+{
+  std::srand (time(NULL));
+  std::vector<GenericVector<TLength, float>> vecs (1024);
+  for (GenericVector<TLength, float>& vec : vecs)
+    for (size_t i = 0; i < TLength; i++)
+      vec.setDataAt(i, RAND_FLOAT);
+
+  for (auto _ : state)
+  {
+    float rst = 0.f;
+    for (size_t i = 1; i < vecs.size(); i++)
+      rst += vecs[i - 1].dot(vecs[i]);
+
+    benchmark::DoNotOptimize(rst);
+  }
+  state.SetItemsProcessed(state.iterations() * (vecs.size() - 1));
+}
+BENCHMARK_TEMPLATE(BM_VectorDot, 3);
+BENCHMARK_TEMPLATE(BM_VectorDot, 4);
+
+template <size_t TLength>
+static void BM_VectorArithmeticScalar(benchmark::State& state)
+{
+  std::srand (time(NULL));
+  std::vector<std::array<float, TLength>> vecs (1024);
+  for (std::array<float, TLength>& vec : vecs)
+    for (float& data : vec)
+      data = RAND_FLOAT;
+
+  for (auto _ : state)
+  {
+    for (size_t i = 1; i < vecs.size(); i++)
+      scalarAddScaled<TLength>(vecs[i], vecs[i - 1], 0.5f);
+
+    benchmark::DoNotOptimize(vecs.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * (vecs.size() - 1));
+}
+BENCHMARK_TEMPLATE(BM_VectorArithmeticScalar, 3);
+BENCHMARK_TEMPLATE(BM_VectorArithmeticScalar, 4);
+
+template <size_t TLength>
+static void BM_VectorArithmetic(benchmark::State& state)
+{
+  std::srand (time(NULL));
+  std::vector<GenericVector<TLength, float>> vecs (1024);
+  for (GenericVector<TLength, float>& vec : vecs)
+    for (size_t i = 0; i < TLength; i++)
+      vec.setDataAt(i, RAND_FLOAT);
+
+  for (auto _ : state)
+  {
+    for (size_t i = 1; i < vecs.size(); i++)
+    {
+      GenericVector<TLength, float> scaled = vecs[i - 1];
+      scaled *= 0.5f;
+      vecs[i] += scaled;
+    }
+
+    benchmark::DoNotOptimize(vecs.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * (vecs.size() - 1));
+}
+BENCHMARK_TEMPLATE(BM_VectorArithmetic, 3);
+BENCHMARK_TEMPLATE(BM_VectorArithmetic, 4);
+
+#pragma endregion //!SIMD vector
+
+#pragma region Vector expression
+
+/*out[i] = a[i] * s0 + b[i] * s1 - c[i] / d[i] + (a[i] - b[i]) * s2 : 4 temporaries with the free operators*/
+template <size_t TLength, bool TLazy>
+static void BM_VectorLongExpression(benchmark::State& state)
+{
+  std::srand (time(NULL));
+  std::vector<GenericVector<TLength, float>> vecs (4 * 1024);
+  for (GenericVector<TLength, float>& vec : vecs)
+    for (size_t i = 0; i < TLength; i++)
+      vec.setDataAt(i, RAND_FLOAT / RAND_MAX + 1.f);
+
+  std::vector<GenericVector<TLength, float>> outs (1024);
+  const float s0 = 0.5f, s1 = 1.5f, s2 = 0.25f;
+
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < outs.size(); i++)
+    {
+      const GenericVector<TLength, float>& a = vecs[4 * i];
+      const GenericVector<TLength, float>& b = vecs[4 * i + 1];
+      const GenericVector<TLength, float>& c = vecs[4 * i + 2];
+      const GenericVector<TLength, float>& d = vecs[4 * i + 3];
+
+      if constexpr (TLazy)
+        outs[i] = lazy(a) * s0 + lazy(b) * s1 - lazy(c) / d + (lazy(a) - b) * s2;
+      else
+        outs[i] = a * s0 + b * s1 - c / d + (a - b) * s2;
+    }
+
+    benchmark::DoNotOptimize(outs.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * outs.size());
+}
+BENCHMARK_TEMPLATE(BM_VectorLongExpression, 3, false);
+BENCHMARK_TEMPLATE(BM_VectorLongExpression, 3, true);
+BENCHMARK_TEMPLATE(BM_VectorLongExpression, 4, false);
+BENCHMARK_TEMPLATE(BM_VectorLongExpression, 4, true);
+BENCHMARK_TEMPLATE(BM_VectorLongExpression, 16, false);
+BENCHMARK_TEMPLATE(BM_VectorLongExpression, 16, true);
+
+/*Rodrigues rotation of Quaternion::rotateVector*/
+template <bool TLazy>
+static void BM_VectorRodriguesExpression(benchmark::State& state)
+{
+  std::srand (time(NULL));
+  std::vector<Vec3f> vecs (1024);
+  for (Vec3f& vec : vecs)
+    vec = Vec3f(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT);
+
+  const Vec3f unitAxis = Vec3f(1.f, 2.f, 3.f).getNormalized();
+  const float cosAngle = std::cos(0.3f);
+  const float sinAngle = std::sin(0.3f);
+
+  for (auto _ : state)
+  {
+    for (Vec3f& vec : vecs)
+    {
+      const Vec3f cross = unitAxis.getCross(vec);
+
+      if constexpr (TLazy)
+        vec = lazy(vec) * cosAngle + lazy(unitAxis) * ((1.f - cosAngle) * vec.dot(unitAxis)) + lazy(cross) * sinAngle;
+      else
+        vec = cosAngle * vec + (1.f - cosAngle) * vec.dot(unitAxis) * unitAxis + sinAngle * cross;
+    }
+
+    benchmark::DoNotOptimize(vecs.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * vecs.size());
+}
+BENCHMARK_TEMPLATE(BM_VectorRodriguesExpression, false);
+BENCHMARK_TEMPLATE(BM_VectorRodriguesExpression, true);
+
+#pragma endregion //!Vector expression
+
+#pragma region Vector batch
+
+static void BM_VectorAoSNormalize(benchmark::State& state)
+{
+  std::srand (time(NULL));
+  std::vector<Vec3f> vecs (state.range(0));
+  for (Vec3f& vec : vecs)
+    vec = Vec3f(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT);
+
+  for (auto _ : state)
+  {
+    for (Vec3f& vec : vecs)
+      vec.normalize();
+
+    benchmark::DoNotOptimize(vecs.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_VectorAoSNormalize)->RangeMultiplier(10)->Range(1000, 10000000);
+
+static void BM_VectorBatchNormalize(benchmark::State& state)
+{
+  std::srand (time(NULL));
+  Vec3fSoA batch (state.range(0));
+  for (size_t i = 0; i < batch.size(); i++)
+    batch.setVector(i, Vec3f(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT));
+
+  for (auto _ : state)
+  {
+    batch.normalize();
+
+    benchmark::DoNotOptimize(batch.getComponent(0));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_VectorBatchNormalize)->RangeMultiplier(10)->Range(1000, 10000000);
+
+static void BM_VectorAoSDotAdd(benchmark::State& state)
+{
+  std::srand (time(NULL));
+  std::vector<Vec3f> vecs (state.range(0));
+  std::vector<float> dots (state.range(0));
+  for (Vec3f& vec : vecs)
+    vec = Vec3f(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT);
+  const Vec3f offset (RAND_FLOAT, RAND_FLOAT, RAND_FLOAT);
+
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < vecs.size(); i++)
+    {
+      vecs[i] += offset;
+      dots[i] = vecs[i].dot(offset);
+    }
+
+    benchmark::DoNotOptimize(dots.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_VectorAoSDotAdd)->RangeMultiplier(10)->Range(1000, 10000000);
+
+static void BM_VectorBatchDotAdd(benchmark::State& state)
+{
+  std::srand (time(NULL));
+  Vec3fSoA batch (state.range(0));
+  std::vector<float> dots (state.range(0));
+  for (size_t i = 0; i < batch.size(); i++)
+    batch.setVector(i, Vec3f(RAND_FLOAT, RAND_FLOAT, RAND_FLOAT));
+  const Vec3f offset (RAND_FLOAT, RAND_FLOAT, RAND_FLOAT);
+
+  for (auto _ : state)
+  {
+    batch += offset;
+    batch.dot(offset, dots.data());
+
+    benchmark::DoNotOptimize(dots.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_VectorBatchDotAdd)->RangeMultiplier(10)->Range(1000, 10000000);
+
+#pragma endregion //!Vector batch
+
+#pragma region Matrix inverse
+
+template <size_t TSize>
+static void BM_MatrixReverse(benchmark::State& state)
+{
+  std::srand (time(NULL));
+  std::vector<SquareMatrix<TSize, float>> mats (256);
+  for (SquareMatrix<TSize, float>& mat : mats)
+    for (size_t i = 0; i < TSize * TSize; i++)
+      mat.getData(i) = RAND_FLOAT / RAND_MAX + ((i % (TSize + 1) == 0) ? static_cast<float>(TSize) : 0.f); //diagonal dominant to stay reversible
+
+  for (auto _ : state)
+  {
+    for (const SquareMatrix<TSize, float>& mat : mats)
+    {
+      SquareMatrix<TSize, float> rst = mat.getReverse();
+      benchmark::DoNotOptimize(rst);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * mats.size());
+}
+BENCHMARK_TEMPLATE(BM_MatrixReverse, 2);
+BENCHMARK_TEMPLATE(BM_MatrixReverse, 3);
+BENCHMARK_TEMPLATE(BM_MatrixReverse, 4);
+BENCHMARK_TEMPLATE(BM_MatrixReverse, 8);
+
+template <size_t TSize>
+static void BM_MatrixDeterminant(benchmark::State& state)
+{
+  std::srand (time(NULL));
+  std::vector<SquareMatrix<TSize, float>> mats (256);
+  for (SquareMatrix<TSize, float>& mat : mats)
+    for (size_t i = 0; i < TSize * TSize; i++)
+      mat.getData(i) = RAND_FLOAT / RAND_MAX;
+
+  for (auto _ : state)
+  {
+    for (const SquareMatrix<TSize, float>& mat : mats)
+    {
+      float rst = mat.getDeterminant();
+      benchmark::DoNotOptimize(rst);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * mats.size());
+}
+BENCHMARK_TEMPLATE(BM_MatrixDeterminant, 3);
+BENCHMARK_TEMPLATE(BM_MatrixDeterminant, 4);
+BENCHMARK_TEMPLATE(BM_MatrixDeterminant, 8);
+
+#pragma endregion //!Matrix inverse
+
+#pragma region Matrix affine inverse
+
+static std::vector<Mat4f<>> generateTRSMatrices(bool withScale)
+{
+  std::srand (time(NULL));
+  std::vector<Mat4f<>> mats (256);
+  for (Mat4f<>& mat : mats)
+  {
+    const Vec3f translation (RAND_FLOAT / RAND_MAX, RAND_FLOAT / RAND_MAX, RAND_FLOAT / RAND_MAX);
+    const Vec3f rotation    (RAND_FLOAT / RAND_MAX, RAND_FLOAT / RAND_MAX, RAND_FLOAT / RAND_MAX);
+    const Vec3f scale       = withScale ? Vec3f(1.f + RAND_FLOAT / RAND_MAX, 1.f + RAND_FLOAT / RAND_MAX, 1.f + RAND_FLOAT / RAND_MAX) : Vec3f(1.f, 1.f, 1.f);
+    mat = Mat4f<>::createTRSMatrix(translation, rotation, scale);
+  }
+  return mats;
+}
+
+static void BM_Matrix4TRSReverse(benchmark::State& state)
+{
+  const std::vector<Mat4f<>> mats = generateTRSMatrices(true);
+
+  for (auto _ : state)
+  {
+    for (const Mat4f<>& mat : mats)
+    {
+      SquareMatrix<4, float> rst = mat.getReverse();
+      benchmark::DoNotOptimize(rst);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * mats.size());
+}
+BENCHMARK(BM_Matrix4TRSReverse);
+
+static void BM_Matrix4TRSAffineInverse(benchmark::State& state)
+{
+  const std::vector<Mat4f<>> mats = generateTRSMatrices(true);
+
+  for (auto _ : state)
+  {
+    for (const Mat4f<>& mat : mats)
+    {
+      Mat4f<> rst = mat.getAffineInverse();
+      benchmark::DoNotOptimize(rst);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * mats.size());
+}
+BENCHMARK(BM_Matrix4TRSAffineInverse);
+
+static void BM_Matrix4TRRigidInverse(benchmark::State& state)
+{
+  const std::vector<Mat4f<>> mats = generateTRSMatrices(false);
+
+  for (auto _ : state)
+  {
+    for (const Mat4f<>& mat : mats)
+    {
+      Mat4f<> rst = mat.getRigidInverse();
+      benchmark::DoNotOptimize(rst);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * mats.size());
+}
+BENCHMARK(BM_Matrix4TRRigidInverse);
+
+#pragma endregion //!Matrix affine inverse
+
+#pragma region Matrix product
+
+template <size_t TSize, EMatrixConvention TMatrixConvention>
+static void BM_MatrixProduct(benchmark::State& state)
+{
+  std::srand (time(NULL));
+  std::vector<SquareMatrix<TSize, float, TMatrixConvention>> mats (64);
+  for (SquareMatrix<TSize, float, TMatrixConvention>& mat : mats)
+    for (size_t i = 0; i < TSize * TSize; i++)
+      mat.getData(i) = RAND_FLOAT / RAND_MAX;
+
+  for (auto _ : state)
+  {
+    for (size_t i = 1; i < mats.size(); i++)
+    {
+      GenericMatrix<TSize, TSize, float, TMatrixConvention> rst = mats[i - 1] * mats[i];
+      benchmark::DoNotOptimize(rst);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * (mats.size() - 1));
+}
+BENCHMARK_TEMPLATE(BM_MatrixProduct, 3, EMatrixConvention::RowMajor);
+BENCHMARK_TEMPLATE(BM_MatrixProduct, 3, EMatrixConvention::ColumnMajor);
+BENCHMARK_TEMPLATE(BM_MatrixProduct, 4, EMatrixConvention::RowMajor);
+BENCHMARK_TEMPLATE(BM_MatrixProduct, 4, EMatrixConvention::ColumnMajor);
+BENCHMARK_TEMPLATE(BM_MatrixProduct, 16, EMatrixConvention::RowMajor);
+BENCHMARK_TEMPLATE(BM_MatrixProduct, 16, EMatrixConvention::ColumnMajor);
+
+#pragma endregion //!Matrix product
+
+#pragma region Matrix view
+
+template <size_t TSize, bool TUseView>
+static void BM_MatrixProductTransposed(benchmark::State& state)
+{
+  std::srand (time(NULL));
+  std::vector<SquareMatrix<TSize, float>> mats (64);
+  for (SquareMatrix<TSize, float>& mat : mats)
+    for (size_t i = 0; i < TSize * TSize; i++)
+      mat.getData(i) = RAND_FLOAT / RAND_MAX;
+
+  for (auto _ : state)
+  {
+    for (size_t i = 1; i < mats.size(); i++)
+    {
+      if constexpr (TUseView)
+      {
+        GenericMatrix<TSize, TSize, float> rst = mats[i - 1] * getTransposedView(mats[i]);
+        benchmark::DoNotOptimize(rst);
+      }
+      else
+      {
+        GenericMatrix<TSize, TSize, float> rst = mats[i - 1] * mats[i].getTransposed();
+        benchmark::DoNotOptimize(rst);
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * (mats.size() - 1));
+}
+BENCHMARK_TEMPLATE(BM_MatrixProductTransposed, 4, false);
+BENCHMARK_TEMPLATE(BM_MatrixProductTransposed, 4, true);
+BENCHMARK_TEMPLATE(BM_MatrixProductTransposed, 16, false);
+BENCHMARK_TEMPLATE(BM_MatrixProductTransposed, 16, true);
+BENCHMARK_TEMPLATE(BM_MatrixProductTransposed, 32, false);
+BENCHMARK_TEMPLATE(BM_MatrixProductTransposed, 32, true);
+
+template <bool TUseView>
+static void BM_Matrix4LinearPartProduct(benchmark::State& state)
+{
+  const std::vector<Mat4f<>> mats = generateTRSMatrices(true);
+
+  for (auto _ : state)
+  {
+    for (size_t i = 1; i < mats.size(); i++)
+    {
+      if constexpr (TUseView)
+      {
+        GenericMatrix<3, 3, float> rst = getSubMatrixView<3, 3>(mats[i - 1], 0, 0) * getSubMatrixView<3, 3>(mats[i], 0, 0);
+        benchmark::DoNotOptimize(rst);
+      }
+      else
+      {
+        GenericMatrix<3, 3, float> lhs, rhs;
+        for (size_t row = 0; row < 3; row++)
+          for (size_t column = 0; column < 3; column++)
+          {
+            lhs.getData(row * 3 + column) = mats[i - 1].getData(row, column);
+            rhs.getData(row * 3 + column) = mats[i].getData(row, column);
+          }
+
+        GenericMatrix<3, 3, float> rst = lhs * rhs;
+        benchmark::DoNotOptimize(rst);
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * (mats.size() - 1));
+}
+BENCHMARK_TEMPLATE(BM_Matrix4LinearPartProduct, false);
+BENCHMARK_TEMPLATE(BM_Matrix4LinearPartProduct, true);
+
+#pragma endregion //!Matrix view
+
+#pragma region Constexpr math
+
+/*Compile time checks of the constexpr sqrt and trigonometry. The runtime path is the standard library*/
+namespace ConstexprMathCheck
+{
+  constexpr bool isNear(double lhs, double rhs, double epsilon = 1e-6) { return lhs - rhs <= epsilon && rhs - lhs <= epsilon; }
+
+  static_assert(Numeric::sqrt(4.0) == 2.0);
+  static_assert(Numeric::sqrt(16) == 4.0);
+  static_assert(Numeric::sqrt(0.f) == 0.f);
+  static_assert(isNear(Numeric::sqrt(2.f), 1.41421356237309504880));
+  static_assert(isNear(Numeric::sqrt(1e300), 1e150, 1e136));
+  static_assert(isNear(Numeric::sqrt(1e-300), 1e-150, 1e-164));
+  static_assert(Numeric::sqrt(-1.f) != Numeric::sqrt(-1.f)); //NaN
+  static_assert(isNear(Numeric::rsqrt(0.25f), 2.0));
+
+  static_assert(Numeric::sin(0.0) == 0.0);
+  static_assert(Numeric::cos(0.f) == 1.f);
+  static_assert(isNear(Numeric::sin(PI / 6.f), 0.5));
+  static_assert(isNear(Numeric::cos(PI / 3.f), 0.5));
+  static_assert(isNear(Numeric::sin(-3.0 * PI / 2.0), 1.0));
+  static_assert(isNear(Numeric::sin(100.0), -0.50636564110975879, 1e-14));
+  static_assert(isNear(Numeric::cos(-1000.0), 0.5623790762907029, 1e-13));
+  static_assert(isNear(Numeric::tan(PI / 4.f), 1.0));
+  static_assert(isNear(Numeric::tan(2.0), -2.18503986326151899, 1e-14));
+
+  static_assert(isNear(Numeric::atan2(1.0, 1.0), 0.78539816339744831, 1e-15));
+  static_assert(isNear(Numeric::atan2(1.0, -1.0), 2.35619449019234492, 1e-15));
+  static_assert(isNear(Numeric::atan2(-2.0, -1.0), -2.03444393579570274, 1e-15));
+  static_assert(isNear(Numeric::atan2(-1.f, 0.f), -HALF_PI));
+  static_assert(isNear(Numeric::acos(-1.0), 3.14159265358979323846, 1e-15));
+  static_assert(isNear(Numeric::acos(0.5), 1.04719755119659775, 1e-15));
+  static_assert(Numeric::acos(1.f) == 0.f);
+
+  /*Builders fold at compile time*/
+  static_assert(Vec3f(3.f, 4.f, 0.f).length() == 5.f);
+  static_assert(isNear(Vec3f(1.f, 2.f, 2.f).getNormalized()[1], 2.0 / 3.0));
+
+  constexpr Mat4f<> perspective = Mat4f<>::createPerspectiveMatrix(16.f / 9.f, 0.1f, 100.f, Angle<EAngleType::Radian, float>(HALF_PI));
+  static_assert(isNear(perspective.getData(1, 1), 1.0));
+
+  constexpr Mat4f<> rotation = Mat4f<>::createFixedAngleEulerRotationMatrix(Vec3f(0.f, HALF_PI, 0.f));
+  static_assert(isNear(rotation.getData(0, 0), 0.0) && isNear(rotation.getData(1, 1), 1.0));
+}
+
+static void BM_PerspectiveMatrixAtCompileTime(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    constexpr Mat4f<> rst = Mat4f<>::createPerspectiveMatrix(16.f / 9.f, 0.1f, 100.f, Angle<EAngleType::Radian, float>(1.2f));
+    benchmark::DoNotOptimize(rst);
+  }
+}
+BENCHMARK(BM_PerspectiveMatrixAtCompileTime);
+
+static void BM_PerspectiveMatrixAtRunTime(benchmark::State& state)
+{
+  float fov = 1.2f;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(fov);
+    Mat4f<> rst = Mat4f<>::createPerspectiveMatrix(16.f / 9.f, 0.1f, 100.f, Angle<EAngleType::Radian, float>(fov));
+    benchmark::DoNotOptimize(rst);
+  }
+}
+BENCHMARK(BM_PerspectiveMatrixAtRunTime);
+
+static void BM_EulerRotationMatrixAtCompileTime(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    constexpr Mat4f<> rst = Mat4f<>::createFixedAngleEulerRotationMatrix(Vec3f(0.3f, 1.2f, -0.7f));
+    benchmark::DoNotOptimize(rst);
+  }
+}
+BENCHMARK(BM_EulerRotationMatrixAtCompileTime);
+
+static void BM_EulerRotationMatrixAtRunTime(benchmark::State& state)
+{
+  Vec3f angles (0.3f, 1.2f, -0.7f);
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(angles);
+    Mat4f<> rst = Mat4f<>::createFixedAngleEulerRotationMatrix(angles);
+    benchmark::DoNotOptimize(rst);
+  }
+}
+BENCHMARK(BM_EulerRotationMatrixAtRunTime);
+
+static void BM_NormalizedAxisAtCompileTime(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    constexpr Vec3f rst = Vec3f(1.f, 2.f, 3.f).getNormalized();
+    benchmark::DoNotOptimize(rst);
+  }
+}
+BENCHMARK(BM_NormalizedAxisAtCompileTime);
+
+static void BM_NormalizedAxisAtRunTime(benchmark::State& state)
+{
+  Vec3f axis (1.f, 2.f, 3.f);
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(axis);
+    Vec3f rst = axis.getNormalized();
+    benchmark::DoNotOptimize(rst);
+  }
+}
+BENCHMARK(BM_NormalizedAxisAtRunTime);
+
+#pragma endregion //!Constexpr math
+
+#pragma region Precision policy
+
+/*Accuracy and speed report of the precision policies (EPrecision). maxUlp : max error in float ulp against the double standard library
+(ulp of 1 for vector, quaternion and easing results which are in [-1, 1]). time/op : time by call on random inputs*/
+
+#define BENCHMARK_PRECISION_POLICIES(function)                  \
+  BENCHMARK_TEMPLATE(function, EPrecision::Exact);              \
+  BENCHMARK_TEMPLATE(function, EPrecision::Fast);               \
+  BENCHMARK_TEMPLATE(function, EPrecision::Approximate)
+
+static constexpr size_t precisionSampleCount = 1 << 16;
+
+static double ulpError(float value, double reference, double minMagnitude = std::numeric_limits<float>::min())
+{
+  const float magnitude = static_cast<float>(std::max(std::abs(reference), minMagnitude));
+  return std::abs(static_cast<double>(value) - reference) / (std::nextafter(magnitude, std::numeric_limits<float>::infinity()) - magnitude);
+}
+
+template <typename TInput, typename TFunction>
+static void timePrecisionPolicy(benchmark::State& state, const std::vector<TInput>& inputs, TFunction function, double maxUlp)
+{
+  std::vector<decltype(function(inputs[0]))> rst (inputs.size());
+
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < inputs.size(); i++)
+      rst[i] = function(inputs[i]);
+
+    benchmark::DoNotOptimize(rst.data());
+    benchmark::ClobberMemory();
+  }
+  state.counters["maxUlp"] = maxUlp;
+  state.counters["time/op"] = benchmark::Counter(inputs.size(), benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+}
+
+/*Error on a regular sweep of [min, max], time on random inputs (quadrant and range branches are not predictable)*/
+template <typename TFunction, typename TReference>
+static void runScalarPrecisionReport(benchmark::State& state, float min, float max, TFunction function, TReference reference, double minMagnitude = std::numeric_limits<float>::min())
+{
+  double maxUlp = 0.0;
+  for (size_t i = 0; i <= precisionSampleCount; i++)
+  {
+    const float input = min + (max - min) * static_cast<float>(i) / precisionSampleCount;
+    maxUlp = std::max(maxUlp, ulpError(function(input), reference(static_cast<double>(input)), minMagnitude));
+  }
+
+  std::srand (time(NULL));
+  std::vector<float> inputs (4096);
+  for (float& input : inputs)
+    input = min + (max - min) * RAND_FLOAT / RAND_MAX;
+
+  timePrecisionPolicy(state, inputs, function, maxUlp);
+}
+
+template <EPrecision TPrecision>
+static void BM_PrecisionRsqrt(benchmark::State& state)
+{
+  runScalarPrecisionReport(state, 1e-3f, 1e3f, [](float x) { return Numeric::rsqrt<TPrecision>(x); }, [](double x) { return 1.0 / std::sqrt(x); });
+}
+BENCHMARK_PRECISION_POLICIES(BM_PrecisionRsqrt);
+
+template <EPrecision TPrecision>
+static void BM_PrecisionSin(benchmark::State& state)
+{
+  runScalarPrecisionReport(state, -10.f, 10.f, [](float x) { return Numeric::sin<TPrecision>(x); }, [](double x) { return std::sin(x); });
+}
+BENCHMARK_PRECISION_POLICIES(BM_PrecisionSin);
+
+template <EPrecision TPrecision>
+static void BM_PrecisionCos(benchmark::State& state)
+{
+  runScalarPrecisionReport(state, -10.f, 10.f, [](float x) { return Numeric::cos<TPrecision>(x); }, [](double x) { return std::cos(x); });
+}
+BENCHMARK_PRECISION_POLICIES(BM_PrecisionCos);
+
+template <EPrecision TPrecision>
+static void BM_PrecisionAcos(benchmark::State& state)
+{
+  runScalarPrecisionReport(state, -1.f, 1.f, [](float x) { return Numeric::acos<TPrecision>(x); }, [](double x) { return std::acos(x); });
+}
+BENCHMARK_PRECISION_POLICIES(BM_PrecisionAcos);
+
+template <EPrecision TPrecision>
+static void BM_PrecisionExp2(benchmark::State& state)
+{
+  runScalarPrecisionReport(state, -10.f, 10.f, [](float x) { return Numeric::exp2<TPrecision>(x); }, [](double x) { return std::exp2(x); });
+}
+BENCHMARK_PRECISION_POLICIES(BM_PrecisionExp2);
+
+template <EPrecision TPrecision>
+static void BM_PrecisionVectorNormalize(benchmark::State& state)
+{
+  std::srand (time(NULL));
+  std::vector<Vec3f> inputs (precisionSampleCount);
+  double maxUlp = 0.0;
+
+  for (Vec3f& input : inputs)
+  {
+    input = Vec3f(RAND_FLOAT / RAND_MAX - 0.5f, RAND_FLOAT / RAND_MAX - 0.5f, RAND_FLOAT / RAND_MAX - 0.5f);
+    const Vec3f rst = input.getNormalized<TPrecision>();
+    const Vec3<double> reference = Vec3<double>(static_cast<double>(input[0]), static_cast<double>(input[1]), static_cast<double>(input[2])).getNormalized<EPrecision::Exact>();
+
+    for (size_t i = 0; i < 3; i++)
+      maxUlp = std::max(maxUlp, ulpError(rst[i], reference[i], 1.0));
+  }
+
+  timePrecisionPolicy(state, inputs, [](const Vec3f& vec) { return vec.getNormalized<TPrecision>(); }, maxUlp);
+}
+BENCHMARK_PRECISION_POLICIES(BM_PrecisionVectorNormalize);
+
+template <EPrecision TPrecision>
+static void BM_PrecisionQuaternionNormalize(benchmark::State& state)
+{
+  std::srand (time(NULL));
+  std::vector<Quaternion<float>> inputs (precisionSampleCount);
+  double maxUlp = 0.0;
+
+  for (Quaternion<float>& input : inputs)
+  {
+    input = Quaternion<float>(RAND_FLOAT / RAND_MAX - 0.5f, RAND_FLOAT / RAND_MAX - 0.5f, RAND_FLOAT / RAND_MAX - 0.5f, RAND_FLOAT / RAND_MAX - 0.5f);
+    const Quaternion<float> rst = input.getNormalize<TPrecision>();
+    const Quaternion<double> reference = Quaternion<double>(input.getX(), input.getY(), input.getZ(), input.getW()).getNormalize<EPrecision::Exact>();
+
+    maxUlp = std::max({maxUlp, ulpError(rst.getX(), reference.getX(), 1.0), ulpError(rst.getY(), reference.getY(), 1.0),
+                               ulpError(rst.getZ(), reference.getZ(), 1.0), ulpError(rst.getW(), reference.getW(), 1.0)});
+  }
+
+  timePrecisionPolicy(state, inputs, [](const Quaternion<float>& quat) { return quat.getNormalize<TPrecision>(); }, maxUlp);
+}
+BENCHMARK_PRECISION_POLICIES(BM_PrecisionQuaternionNormalize);
+
+template <EPrecision TPrecision>
+static void BM_PrecisionQuaternionSLerp(benchmark::State& state)
+{
+  struct SLerpInput
+  {
+    Quaternion<float> start;
+    Quaternion<float> end;
+    float t;
+  };
+
+  QuaternionInterpolationData data = generateQuaternionInterpolationData(precisionSampleCount);
+  std::vector<SLerpInput> inputs (precisionSampleCount);
+  double maxUlp = 0.0;
+
+  for (size_t i = 0; i < inputs.size(); i++)
+  {
+    inputs[i] = {data.start[i], data.end[i], data.t[i]};
+
+    Quaternion<float> rst;
+    rst.sLerp<true, true, TPrecision>(data.start[i], data.end[i], data.t[i]);
+
+    Quaternion<double> reference;
+    reference.sLerp<true, true, EPrecision::Exact>(Quaternion<double>(data.start[i].getX(), data.start[i].getY(), data.start[i].getZ(), data.start[i].getW()),
+                                                   Quaternion<double>(data.end[i].getX(), data.end[i].getY(), data.end[i].getZ(), data.end[i].getW()), data.t[i]);
+
+    maxUlp = std::max({maxUlp, ulpError(rst.getX(), reference.getX(), 1.0), ulpError(rst.getY(), reference.getY(), 1.0),
+                               ulpError(rst.getZ(), reference.getZ(), 1.0), ulpError(rst.getW(), reference.getW(), 1.0)});
+  }
+
+  timePrecisionPolicy(state, inputs, [](const SLerpInput& input)
+  {
+    Quaternion<float> rst;
+    rst.sLerp<true, true, TPrecision>(input.start, input.end, input.t);
+    return rst;
+  }, maxUlp);
+}
+BENCHMARK_PRECISION_POLICIES(BM_PrecisionQuaternionSLerp);
+
+template <EPrecision TPrecision>
+static void BM_PrecisionEaseInOutSine(benchmark::State& state)
+{
+  runScalarPrecisionReport(state, 0.f, 1.f, [](float x) { return AnimationCurve::easeInOutSine<TPrecision>(x); },
+                           [](double x) { return AnimationCurve::easeInOutSine<EPrecision::Exact>(x); }, 1.0);
+}
+BENCHMARK_PRECISION_POLICIES(BM_PrecisionEaseInOutSine);
+
+template <EPrecision TPrecision>
+static void BM_PrecisionEaseInOutCubic(benchmark::State& state)
+{
+  runScalarPrecisionReport(state, 0.f, 1.f, [](float x) { return AnimationCurve::easeInOut<3, TPrecision>(x); },
+                           [](double x) { return AnimationCurve::easeInOut<3, EPrecision::Exact>(x); }, 1.0);
+}
+BENCHMARK_PRECISION_POLICIES(BM_PrecisionEaseInOutCubic);
+
+template <EPrecision TPrecision>
+static void BM_PrecisionEaseOutCirc(benchmark::State& state)
+{
+  runScalarPrecisionReport(state, 0.f, 1.f, [](float x) { return AnimationCurve::easeOutCirc<TPrecision>(x); },
+                           [](double x) { return AnimationCurve::easeOutCirc<EPrecision::Exact>(x); }, 1.0);
+}
+BENCHMARK_PRECISION_POLICIES(BM_PrecisionEaseOutCirc);
+
+template <EPrecision TPrecision>
+static void BM_PrecisionEaseInOutElastic(benchmark::State& state)
+{
+  runScalarPrecisionReport(state, 0.f, 1.f, [](float x) { return AnimationCurve::easeInOutElastic<TPrecision>(x); },
+                           [](double x) { return AnimationCurve::easeInOutElastic<EPrecision::Exact>(x); }, 1.0);
+}
+BENCHMARK_PRECISION_POLICIES(BM_PrecisionEaseInOutElastic);
+
+#pragma endregion //!Precision policy
+
+#pragma region Fused sincos
+
+static std::vector<Vec3f> createEulerAngles(size_t count)
+{
+  std::srand (time(NULL));
+  std::vector<Vec3f> rotations (count);
+  for (Vec3f& rotation : rotations)
+    rotation = Vec3f(RAND_FLOAT / RAND_MAX * TWO_PI - PI, RAND_FLOAT / RAND_MAX * TWO_PI - PI, RAND_FLOAT / RAND_MAX * TWO_PI - PI);
+
+  return rotations;
+}
+
+/*Same as BM_NewTRSMatrixAtRunTime without the 9 std::rand by matrix and with angles in [-pi, pi] (RAND_FLOAT angles are huge and
+use the slow reduction of the libm). Exact is the baseline : 6 sin/cos merged by the compiler in 3 sincos calls*/
+template <EPrecision TPrecision>
+static void BM_SinCosTRSMatrixAtRunTime(benchmark::State& state)
+{
+  const std::vector<Vec3f> rotations = createEulerAngles(4096);
+  const Vec3f translation  (RAND_FLOAT, RAND_FLOAT, RAND_FLOAT);
+  const Vec3f scale        (RAND_FLOAT, RAND_FLOAT, RAND_FLOAT);
+  std::vector<Mat4f<EMatrixConvention::ColumnMajor>> rst (rotations.size());
+
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < rotations.size(); i++)
+      rst[i] = Mat4f<EMatrixConvention::ColumnMajor>::createTRSMatrix<TPrecision>(translation, rotations[i], scale);
+
+    benchmark::DoNotOptimize(rst.data());
+    benchmark::ClobberMemory();
+  }
+  state.counters["time/op"] = benchmark::Counter(rotations.size(), benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+}
+BENCHMARK_PRECISION_POLICIES(BM_SinCosTRSMatrixAtRunTime);
+
+template <EPrecision TPrecision>
+static void BM_EulerRotationMatrixLoop(benchmark::State& state)
+{
+  const std::vector<Vec3f> rotations = createEulerAngles(4096);
+  std::vector<Mat4f<>> rst (rotations.size());
+
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < rotations.size(); i++)
+      rst[i] = Mat4f<>::createFixedAngleEulerRotationMatrix<TPrecision>(rotations[i]);
+
+    benchmark::DoNotOptimize(rst.data());
+    benchmark::ClobberMemory();
+  }
+  state.counters["time/op"] = benchmark::Counter(rotations.size(), benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+}
+BENCHMARK_PRECISION_POLICIES(BM_EulerRotationMatrixLoop);
+
+template <EPrecision TPrecision>
+static void BM_EulerRotationMatrixBatch(benchmark::State& state)
+{
+  const std::vector<Vec3f> rotations = createEulerAngles(4096);
+  std::vector<Mat4f<>> rst (rotations.size());
+
+  for (auto _ : state)
+  {
+    Mat4f<>::createFixedAngleEulerRotationMatrix<TPrecision>(rotations.data(), rst.data(), rotations.size());
+
+    benchmark::DoNotOptimize(rst.data());
+    benchmark::ClobberMemory();
+  }
+  state.counters["time/op"] = benchmark::Counter(rotations.size(), benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+}
+BENCHMARK_PRECISION_POLICIES(BM_EulerRotationMatrixBatch);
+
+template <EPrecision TPrecision>
+static void BM_EulerQuaternionLoop(benchmark::State& state)
+{
+  const std::vector<Vec3f> rotations = createEulerAngles(4096);
+  std::vector<Quaternion<float>> rst (rotations.size());
+
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < rotations.size(); i++)
+      rst[i] = Quaternion<float>::createFromFixedAngleEuler<TPrecision>(rotations[i]);
+
+    benchmark::DoNotOptimize(rst.data());
+    benchmark::ClobberMemory();
+  }
+  state.counters["time/op"] = benchmark::Counter(rotations.size(), benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+}
+BENCHMARK_PRECISION_POLICIES(BM_EulerQuaternionLoop);
+
+template <EPrecision TPrecision>
+static void BM_EulerQuaternionBatch(benchmark::State& state)
+{
+  const std::vector<Vec3f> rotations = createEulerAngles(4096);
+  std::vector<Quaternion<float>> rst (rotations.size());
+
+  for (auto _ : state)
+  {
+    Quaternion<float>::createFromFixedAngleEuler<TPrecision>(rotations.data(), rst.data(), rotations.size());
+
+    benchmark::DoNotOptimize(rst.data());
+    benchmark::ClobberMemory();
+  }
+  state.counters["time/op"] = benchmark::Counter(rotations.size(), benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+}
+BENCHMARK_PRECISION_POLICIES(BM_EulerQuaternionBatch);
+
+#pragma endregion //!Fused sincos
+
+#pragma region Matrix batch transform
+
+static std::vector<Vec3f> generatePoints(size_t count)
+{
+  std::srand (time(NULL));
+  std::vector<Vec3f> points (count);
+  for (Vec3f& point : points)
+    point = Vec3f(RAND_FLOAT / RAND_MAX, RAND_FLOAT / RAND_MAX, RAND_FLOAT / RAND_MAX);
+  return points;
+}
+
+static void BM_Matrix4TransformPointLoop(benchmark::State& state)
+{
+  const Mat4f<> mat = generateTRSMatrices(true).front();
+  const std::vector<Vec3f> points = generatePoints(state.range(0));
+  std::vector<Vec3f> rst (points.size());
+
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < points.size(); i++)
+    {
+      const Vec3f& p = points[i];
+      rst[i] = Vec3f( mat.getData(0) * p.getX() + mat.getData(1) * p.getY() + mat.getData(2)  * p.getZ() + mat.getData(3),
+                      mat.getData(4) * p.getX() + mat.getData(5) * p.getY() + mat.getData(6)  * p.getZ() + mat.getData(7),
+                      mat.getData(8) * p.getX() + mat.getData(9) * p.getY() + mat.getData(10) * p.getZ() + mat.getData(11));
+    }
+    benchmark::DoNotOptimize(rst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * points.size());
+}
+BENCHMARK(BM_Matrix4TransformPointLoop)->Range(1 << 10, 1 << 20);
+
+static void BM_Matrix4TransformPoints(benchmark::State& state)
+{
+  const Mat4f<> mat = generateTRSMatrices(true).front();
+  const std::vector<Vec3f> points = generatePoints(state.range(0));
+  std::vector<Vec3f> rst (points.size());
+
+  for (auto _ : state)
+  {
+    mat.transformPoints(points.data(), rst.data(), points.size());
+    benchmark::DoNotOptimize(rst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * points.size());
+}
+BENCHMARK(BM_Matrix4TransformPoints)->Range(1 << 10, 1 << 20);
+
+static void BM_Matrix4TransformPointsHomogenized(benchmark::State& state)
+{
+  const Mat4f<> mat = Mat4f<>::createPerspectiveMatrix(16.f / 9.f, 0.1f, 100.f, Angle<EAngleType::Radian, float>(1.f)) * generateTRSMatrices(true).front();
+  const std::vector<Vec3f> points = generatePoints(state.range(0));
+  std::vector<Vec3f> rst (points.size());
+
+  for (auto _ : state)
+  {
+    mat.transformPointsHomogenized(points.data(), rst.data(), points.size());
+    benchmark::DoNotOptimize(rst.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * points.size());
+}
+BENCHMARK(BM_Matrix4TransformPointsHomogenized)->Range(1 << 10, 1 << 20);
+
+#pragma endregion //!Matrix batch transform
+
+#pragma region Random
+
+static constexpr size_t randomSampleCount = 1 << 20;
+
+static void BM_RandomCRand(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    float sum = 0.f;
+    for (size_t i = 0; i < randomSampleCount; i++)
+      sum += static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX);
+
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * randomSampleCount);
+}
+BENCHMARK(BM_RandomCRand)->ThreadRange(1, 4)->UseRealTime();
+
+static void BM_RandomStaticUnitValue(benchmark::State& state)
+{
+  for (auto _ : state)
+  {
+    float sum = 0.f;
+    for (size_t i = 0; i < randomSampleCount; i++)
+      sum += Random::unitValue<float>();
+
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * randomSampleCount);
+}
+BENCHMARK(BM_RandomStaticUnitValue)->ThreadRange(1, 4)->UseRealTime();
+
+static void BM_RandomGeneratorUnitValue(benchmark::State& state)
+{
+  /*Same seed for all threads, each thread use its own sub sequence*/
+  RandomGenerator<> generator (42);
+  for (int i = 0; i < state.thread_index; i++)
+    generator.jump();
+
+  for (auto _ : state)
+  {
+    float sum = 0.f;
+    for (size_t i = 0; i < randomSampleCount; i++)
+      sum += generator.unitValue<float>();
+
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * randomSampleCount);
+}
+BENCHMARK(BM_RandomGeneratorUnitValue)->ThreadRange(1, 4)->UseRealTime();
+
+static void BM_RandomGeneratorSphericalCoordinate(benchmark::State& state)
+{
+  RandomGenerator<> generator (42);
+  for (int i = 0; i < state.thread_index; i++)
+    generator.jump();
+
+  for (auto _ : state)
+  {
+    Vec3f sum (0.f, 0.f, 0.f);
+    for (size_t i = 0; i < randomSampleCount; i++)
+      sum += generator.unitPeripheralSphericalCoordonate<float>();
+
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * randomSampleCount);
+}
+BENCHMARK(BM_RandomGeneratorSphericalCoordinate)->ThreadRange(1, 4)->UseRealTime();
+
+static void BM_RandomCubiqueCoordinateLoop(benchmark::State& state)
+{
+  RandomGenerator<> generator (42);
+  std::vector<Vec3f> particles (state.range(0));
+
+  for (auto _ : state)
+  {
+    for (Vec3f& particle : particles)
+      particle = generator.cubiqueCoordinate<float>(Vec3f(0.f, 0.f, 0.f), 10.f, 10.f, 10.f);
+
+    benchmark::DoNotOptimize(particles.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * particles.size());
+  state.SetBytesProcessed(state.iterations() * particles.size() * sizeof(Vec3f));
+}
+BENCHMARK(BM_RandomCubiqueCoordinateLoop)->Range(1 << 10, 1 << 20);
+
+static void BM_RandomFillCubiqueCoordinate(benchmark::State& state)
+{
+  RandomGenerator<> generator (42);
+  std::vector<Vec3f> particles (state.range(0));
+
+  for (auto _ : state)
+  {
+    generator.fillCubiqueCoordinate<float>(particles.data(), particles.size(), Vec3f(0.f, 0.f, 0.f), 10.f, 10.f, 10.f);
+
+    benchmark::DoNotOptimize(particles.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * particles.size());
+  state.SetBytesProcessed(state.iterations() * particles.size() * sizeof(Vec3f));
+}
+BENCHMARK(BM_RandomFillCubiqueCoordinate)->Range(1 << 10, 1 << 20);
+
+static void BM_RandomFillRanged(benchmark::State& state)
+{
+  RandomGenerator<> generator (42);
+  std::vector<float> values (state.range(0));
+
+  for (auto _ : state)
+  {
+    generator.fillRanged<float>(values.data(), values.size(), -1.f, 1.f);
+
+    benchmark::DoNotOptimize(values.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+  state.SetBytesProcessed(state.iterations() * values.size() * sizeof(float));
+}
+BENCHMARK(BM_RandomFillRanged)->Range(1 << 10, 1 << 20);
+
+static void BM_RandomFillUnitPeripheralSphericalCoordonate(benchmark::State& state)
+{
+  RandomGenerator<> generator (42);
+  std::vector<Vec3f> particles (state.range(0));
+
+  for (auto _ : state)
+  {
+    generator.fillUnitPeripheralSphericalCoordonate<float>(particles.data(), particles.size());
+
+    benchmark::DoNotOptimize(particles.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * particles.size());
+}
+BENCHMARK(BM_RandomFillUnitPeripheralSphericalCoordonate)->Range(1 << 10, 1 << 20);
+
+#pragma endregion //!Random
+
+#pragma region Broad phase
+
+/*Boxes of size 1 bouncing in a cube. The size of the cube grows with the count so each box overlaps ~0.5 box*/
+struct MovingBoxesScene
+{
+  std::vector<AABB>   boxes;
+  std::vector<Vec3f>  velocities;
+  float               halfWorldSize;
+
+  explicit MovingBoxesScene(size_t count, float speed = 0.05f)
+    : boxes (count), velocities (count), halfWorldSize (1.25f * std::cbrt(static_cast<float>(count)))
+  {
+    RandomGenerator<> generator (42);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+      boxes[i]      = AABB(generator.cubiqueCoordinate<float>(Vec3f(0.f, 0.f, 0.f), halfWorldSize, halfWorldSize, halfWorldSize), 0.5f, 0.5f, 0.5f);
+      velocities[i] = generator.cubiqueCoordinate<float>(Vec3f(0.f, 0.f, 0.f), speed, speed, speed);
+    }
+  }
+
+  void step() noexcept
+  {
+    for (size_t i = 0; i < boxes.size(); ++i)
+    {
+      Vec3f center = boxes[i].getCenter() + velocities[i];
+
+      for (size_t axis = 0; axis < 3; ++axis)
+      {
+        if (std::abs(center[axis]) > halfWorldSize)
+          velocities[i].setData(axis, -velocities[i][axis]);
+      }
+
+      boxes[i].setCenter(center);
+    }
+  }
+};
+
+static void BM_BroadPhaseBruteForcePairs(benchmark::State& state)
+{
+  MovingBoxesScene scene (state.range(0));
+  size_t pairCount = 0;
+
+  for (auto _ : state)
+  {
+    scene.step();
+    pairCount = 0;
+
+    for (size_t i = 0; i < scene.boxes.size(); ++i)
+    {
+      const Vec3f minA = scene.boxes[i].getMin();
+      const Vec3f maxA = scene.boxes[i].getMax();
+
+      for (size_t j = i + 1; j < scene.boxes.size(); ++j)
+      {
+        const Vec3f minB = scene.boxes[j].getMin();
+        const Vec3f maxB = scene.boxes[j].getMax();
+
+        pairCount +=  minA.getX() <= maxB.getX() && minB.getX() <= maxA.getX() &&
+                      minA.getY() <= maxB.getY() && minB.getY() <= maxA.getY() &&
+                      minA.getZ() <= maxB.getZ() && minB.getZ() <= maxA.getZ();
+      }
+    }
+    benchmark::DoNotOptimize(pairCount);
+  }
+  state.SetItemsProcessed(state.iterations() * scene.boxes.size());
+  state.counters["pairs"] = pairCount;
+}
+BENCHMARK(BM_BroadPhaseBruteForcePairs)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+static void BM_DynamicAABBTreeUpdatePairs(benchmark::State& state)
+{
+  MovingBoxesScene scene (state.range(0));
+  DynamicAABBTree tree (0.1f, 2.f);
+  std::vector<int> proxies (scene.boxes.size());
+
+  for (size_t i = 0; i < scene.boxes.size(); ++i)
+    proxies[i] = tree.insert(scene.boxes[i], i);
+  tree.updatePairs([](int, int){});
+
+  size_t newPairCount = 0;
+  for (auto _ : state)
+  {
+    scene.step();
+    for (size_t i = 0; i < scene.boxes.size(); ++i)
+      tree.move(proxies[i], scene.boxes[i], scene.velocities[i]);
+
+    newPairCount = 0;
+    tree.updatePairs([&](int, int){ ++newPairCount; });
+    benchmark::DoNotOptimize(newPairCount);
+  }
+  state.SetItemsProcessed(state.iterations() * scene.boxes.size());
+  state.counters["newPairs"] = newPairCount;
+  state.counters["height"] = tree.getHeight();
+}
+BENCHMARK(BM_DynamicAABBTreeUpdatePairs)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+static void BM_DynamicAABBTreeFindAllPairs(benchmark::State& state)
+{
+  MovingBoxesScene scene (state.range(0));
+  DynamicAABBTree tree (0.1f, 2.f);
+  std::vector<int> proxies (scene.boxes.size());
+
+  for (size_t i = 0; i < scene.boxes.size(); ++i)
+    proxies[i] = tree.insert(scene.boxes[i], i);
+
+  size_t pairCount = 0;
+  for (auto _ : state)
+  {
+    scene.step();
+    for (size_t i = 0; i < scene.boxes.size(); ++i)
+      tree.move(proxies[i], scene.boxes[i], scene.velocities[i]);
+
+    pairCount = 0;
+    tree.findAllPairs([&](int, int){ ++pairCount; });
+    benchmark::DoNotOptimize(pairCount);
+  }
+  state.SetItemsProcessed(state.iterations() * scene.boxes.size());
+  state.counters["fatPairs"] = pairCount;
+}
+BENCHMARK(BM_DynamicAABBTreeFindAllPairs)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+static void BM_DynamicAABBTreeRaycast(benchmark::State& state)
+{
+  MovingBoxesScene scene (state.range(0));
+  DynamicAABBTree tree (0.1f, 2.f);
+
+  for (size_t i = 0; i < scene.boxes.size(); ++i)
+    tree.insert(scene.boxes[i], i);
+
+  RandomGenerator<> generator (7);
+  const float size = scene.halfWorldSize;
+  std::vector<Segment> segments (1024);
+  for (Segment& segment : segments)
+    segment = Segment(generator.cubiqueCoordinate<float>(Vec3f(0.f, 0.f, 0.f), size, size, size), generator.cubiqueCoordinate<float>(Vec3f(0.f, 0.f, 0.f), size, size, size));
+
+  size_t hitCount = 0;
+  for (auto _ : state)
+  {
+    hitCount = 0;
+    for (const Segment& segment : segments)
+    {
+      Intersection intersection;
+      hitCount += tree.raycast(segment, intersection) != DynamicAABBTree::nullNode;
+    }
+    benchmark::DoNotOptimize(hitCount);
+  }
+  state.SetItemsProcessed(state.iterations() * segments.size());
+  state.counters["hits"] = hitCount;
+}
+BENCHMARK(BM_DynamicAABBTreeRaycast)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+/*range(0) : count, range(1) : speed in thousandth of box size by step*/
+template <size_t TAxisCount, bool TIncremental>
+static void BM_SweepAndPrune(benchmark::State& state)
+{
+  MovingBoxesScene scene (state.range(0), static_cast<float>(state.range(1)) * 0.001f);
+  SweepAndPrune<TAxisCount> sweepAndPrune;
+  std::vector<int> proxies (scene.boxes.size());
+
+  for (size_t i = 0; i < scene.boxes.size(); ++i)
+    proxies[i] = sweepAndPrune.insert(scene.boxes[i], i);
+  sweepAndPrune.rebuild();
+
+  size_t pairCount = 0;
+  for (auto _ : state)
+  {
+    scene.step();
+    for (size_t i = 0; i < scene.boxes.size(); ++i)
+      sweepAndPrune.setAABB(proxies[i], scene.boxes[i]);
+
+    if constexpr (TIncremental)
+      sweepAndPrune.update();
+    else
+      sweepAndPrune.rebuild();
+
+    pairCount = 0;
+    sweepAndPrune.forEachPair([&](int, int){ ++pairCount; });
+    benchmark::DoNotOptimize(pairCount);
+  }
+  state.SetItemsProcessed(state.iterations() * scene.boxes.size());
+  state.counters["pairs"] = pairCount;
+}
+BENCHMARK_TEMPLATE(BM_SweepAndPrune, 1, true)->Args({10000, 5})->Args({10000, 50})->Args({100000, 5})->Args({100000, 50})->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_SweepAndPrune, 1, false)->Args({10000, 5})->Args({10000, 50})->Args({100000, 5})->Args({100000, 50})->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_SweepAndPrune, 3, true)->Args({10000, 5})->Args({10000, 50})->Args({100000, 5})->Args({100000, 50})->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_SweepAndPrune, 3, false)->Args({10000, 5})->Args({10000, 50})->Args({100000, 5})->Args({100000, 50})->Unit(benchmark::kMillisecond);
+
+static void BM_BroadPhaseBruteForceSpherePairs(benchmark::State& state)
+{
+  MovingBoxesScene scene (state.range(0));
+  std::vector<Sphere> spheres (scene.boxes.size());
+  size_t pairCount = 0;
+
+  for (auto _ : state)
+  {
+    scene.step();
+    for (size_t i = 0; i < spheres.size(); ++i)
+      spheres[i] = Sphere(0.5f, scene.boxes[i].getCenter());
+
+    pairCount = 0;
+    for (size_t i = 0; i < spheres.size(); ++i)
+    {
+      const Vec3f centerA = spheres[i].getCenter();
+
+      for (size_t j = i + 1; j < spheres.size(); ++j)
+      {
+        const Vec3f delta = spheres[j].getCenter() - centerA;
+        const float radiusSum = spheres[i].getRadius() + spheres[j].getRadius();
+        pairCount += Vec3f::dot(delta, delta) <= radiusSum * radiusSum;
+      }
+    }
+    benchmark::DoNotOptimize(pairCount);
+  }
+  state.SetItemsProcessed(state.iterations() * spheres.size());
+  state.counters["pairs"] = pairCount;
+}
+BENCHMARK(BM_BroadPhaseBruteForceSpherePairs)->Arg(10000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BroadPhaseBruteForceSpherePairs)->Arg(100000)->Iterations(1)->Unit(benchmark::kMillisecond);
+
+static void BM_SpatialHashGridSpherePairs(benchmark::State& state)
+{
+  MovingBoxesScene scene (state.range(0));
+  SpatialHashGrid grid (static_cast<float>(state.range(1)) * 0.5f);
+  grid.reserve(scene.boxes.size());
+  size_t pairCount = 0;
+
+  for (auto _ : state)
+  {
+    scene.step();
+
+    grid.clear();
+    for (size_t i = 0; i < scene.boxes.size(); ++i)
+      grid.insert(Sphere(0.5f, scene.boxes[i].getCenter()), i);
+    grid.build();
+
+    pairCount = 0;
+    grid.forEachPair([&](uint32_t, uint32_t){ ++pairCount; });
+    benchmark::DoNotOptimize(pairCount);
+  }
+  state.SetItemsProcessed(state.iterations() * scene.boxes.size());
+  state.counters["pairs"] = pairCount;
+}
+BENCHMARK(BM_SpatialHashGridSpherePairs)->Args({10000, 2})->Args({100000, 2})->Args({100000, 4})->Unit(benchmark::kMillisecond);
+
+static void BM_SpatialHashGridQueryRadius(benchmark::State& state)
+{
+  MovingBoxesScene scene (state.range(0));
+  SpatialHashGrid grid (1.f);
+
+  for (size_t i = 0; i < scene.boxes.size(); ++i)
+    grid.insert(Sphere(0.5f, scene.boxes[i].getCenter()), i);
+  grid.build();
+
+  size_t neighborCount = 0;
+  for (auto _ : state)
+  {
+    neighborCount = 0;
+    for (size_t i = 0; i < scene.boxes.size(); ++i)
+      grid.queryRadius(scene.boxes[i].getCenter(), 1.5f, [&](uint32_t){ ++neighborCount; });
+    benchmark::DoNotOptimize(neighborCount);
+  }
+  state.SetItemsProcessed(state.iterations() * scene.boxes.size());
+  state.counters["neighbors"] = neighborCount;
+}
+BENCHMARK(BM_SpatialHashGridQueryRadius)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+#pragma endregion //!Broad phase
+
+#pragma region Segment AABB batch
+
+static std::vector<Segment> createSegments(size_t count, float halfWorldSize)
+{
+  RandomGenerator<> generator (7);
+  std::vector<Segment> segments (count);
+  for (Segment& segment : segments)
+  {
+    const Vec3f pt1 = generator.cubiqueCoordinate<float>(Vec3f(0.f, 0.f, 0.f), halfWorldSize, halfWorldSize, halfWorldSize);
+    segment = Segment(pt1, pt1 + generator.cubiqueCoordinate<float>(Vec3f(0.f, 0.f, 0.f), 4.f, 4.f, 4.f));
+  }
+  return segments;
+}
+
+static void BM_SegmentAABBIntersection(benchmark::State& state)
+{
+  MovingBoxesScene scene (state.range(0));
+  const std::vector<Segment> segments = createSegments(256, scene.halfWorldSize);
+
+  size_t hitCount = 0;
+  for (auto _ : state)
+  {
+    hitCount = 0;
+    for (const Segment& segment : segments)
+    {
+      for (const AABB& box : scene.boxes)
+      {
+        Intersection intersection;
+        hitCount += SegmentAABB::isSegmentAABBCollided(segment, box, intersection);
+      }
+    }
+    benchmark::DoNotOptimize(hitCount);
+  }
+  state.SetItemsProcessed(state.iterations() * segments.size() * scene.boxes.size());
+  state.counters["hits"] = hitCount;
+}
+BENCHMARK(BM_SegmentAABBIntersection)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+static void BM_SegmentAABBSlab(benchmark::State& state)
+{
+  MovingBoxesScene scene (state.range(0));
+  const std::vector<Segment> segments = createSegments(256, scene.halfWorldSize);
+
+  size_t hitCount = 0;
+  for (auto _ : state)
+  {
+    hitCount = 0;
+    for (const Segment& segment : segments)
+    {
+      const SegmentSlab slab (segment);
+      for (const AABB& box : scene.boxes)
+      {
+        float tEntry;
+        hitCount += SegmentAABBBatch::isSegmentAABBCollided(slab, box, tEntry);
+      }
+    }
+    benchmark::DoNotOptimize(hitCount);
+  }
+  state.SetItemsProcessed(state.iterations() * segments.size() * scene.boxes.size());
+  state.counters["hits"] = hitCount;
+}
+BENCHMARK(BM_SegmentAABBSlab)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+template <size_t TWidth>
+static void BM_SegmentAABBPacket(benchmark::State& state)
+{
+  MovingBoxesScene scene (state.range(0));
+  const std::vector<Segment> segments = createSegments(256, scene.halfWorldSize);
+  std::vector<AABBPacket<TWidth>> packets ((scene.boxes.size() + TWidth - 1) / TWidth);
+  SegmentAABBBatch::fillPackets(scene.boxes.data(), scene.boxes.size(), packets.data());
+
+  size_t hitCount = 0;
+  for (auto _ : state)
+  {
+    hitCount = 0;
+    for (const Segment& segment : segments)
+    {
+      const SegmentSlab slab (segment);
+      for (const AABBPacket<TWidth>& packet : packets)
+      {
+        alignas(32) float tEntry [TWidth];
+        hitCount += std::bitset<TWidth>(SegmentAABBBatch::isSegmentAABBCollided(slab, packet, tEntry)).count();
+      }
+    }
+    benchmark::DoNotOptimize(hitCount);
+  }
+  state.SetItemsProcessed(state.iterations() * segments.size() * scene.boxes.size());
+  state.counters["hits"] = hitCount;
+}
+BENCHMARK_TEMPLATE(BM_SegmentAABBPacket, 4)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_SegmentAABBPacket, 8)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+template <size_t TWidth>
+static void BM_SegmentPacketAABB(benchmark::State& state)
+{
+  MovingBoxesScene scene (state.range(0));
+  const std::vector<Segment> segments = createSegments(256, scene.halfWorldSize);
+  std::vector<SegmentPacket<TWidth>> packets ((segments.size() + TWidth - 1) / TWidth);
+  SegmentAABBBatch::fillPackets(segments.data(), segments.size(), packets.data());
+
+  size_t hitCount = 0;
+  for (auto _ : state)
+  {
+    hitCount = 0;
+    for (const AABB& box : scene.boxes)
+    {
+      for (const SegmentPacket<TWidth>& packet : packets)
+      {
+        alignas(32) float tEntry [TWidth];
+        hitCount += std::bitset<TWidth>(SegmentAABBBatch::isSegmentAABBCollided(packet, box, tEntry)).count();
+      }
+    }
+    benchmark::DoNotOptimize(hitCount);
+  }
+  state.SetItemsProcessed(state.iterations() * segments.size() * scene.boxes.size());
+  state.counters["hits"] = hitCount;
+}
+BENCHMARK_TEMPLATE(BM_SegmentPacketAABB, 4)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_SegmentPacketAABB, 8)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+static void BM_SegmentAABBPacketFindFirst(benchmark::State& state)
+{
+  MovingBoxesScene scene (state.range(0));
+  const std::vector<Segment> segments = createSegments(256, scene.halfWorldSize);
+  std::vector<AABBPacket<8>> packets ((scene.boxes.size() + 7) / 8);
+  SegmentAABBBatch::fillPackets(scene.boxes.data(), scene.boxes.size(), packets.data());
+
+  size_t hitCount = 0;
+  for (auto _ : state)
+  {
+    hitCount = 0;
+    for (const Segment& segment : segments)
+    {
+      size_t aabbIndex;
+      float tEntry;
+      hitCount += SegmentAABBBatch::findFirstAABBCollided(SegmentSlab(segment), packets.data(), packets.size(), aabbIndex, tEntry);
+    }
+    benchmark::DoNotOptimize(hitCount);
+  }
+  state.SetItemsProcessed(state.iterations() * segments.size());
+  state.counters["hits"] = hitCount;
+}
+BENCHMARK(BM_SegmentAABBPacketFindFirst)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+/*Axis aligned segments with integer end points and boxes with integer bounds : many segments are on a face or an edge of a box (null axis of the segment)*/
+static void createGridAlignedScene(std::vector<Segment>& segments, std::vector<AABB>& boxes)
+{
+  for (int x = 0; x <= 4; x += 2)
+    for (int y = 0; y <= 4; y += 2)
+      for (int z = -2; z <= 2; z += 2)
+        for (int ext = 1; ext <= 2; ++ext)
+          boxes.emplace_back(Vec3f(static_cast<float>(x + 1), static_cast<float>(y), static_cast<float>(z)), static_cast<float>(ext), 2.f, 2.f);
+
+  for (int a = -4; a <= 4; a += 2)
+  {
+    for (int b = -4; b <= 4; b += 2)
+    {
+      for (int start = -4; start <= 0; start += 4)
+      {
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+          Vec3f pt1, pt2;
+          pt1.setData((axis + 1) % 3, a);
+          pt1.setData((axis + 2) % 3, b);
+          pt1.setData(axis, start);
+          pt2 = pt1;
+          pt2.setData(axis, start + 4);
+
+          segments.emplace_back(pt1, pt2);
+          segments.emplace_back(pt2, pt1);
+        }
+      }
+    }
+  }
+}
+
+/*Cross check of the slab tests with SegmentAABB on the grid aligned scene : "mismatches" must be 0*/
+template <size_t TWidth>
+static void BM_SegmentAABBSlabGridAligned(benchmark::State& state)
+{
+  std::vector<Segment> segments;
+  std::vector<AABB> boxes;
+  createGridAlignedScene(segments, boxes);
+
+  std::vector<AABBPacket<TWidth>> aabbPackets ((boxes.size() + TWidth - 1) / TWidth);
+  std::vector<SegmentPacket<TWidth>> segmentPackets ((segments.size() + TWidth - 1) / TWidth);
+  SegmentAABBBatch::fillPackets(boxes.data(), boxes.size(), aabbPackets.data());
+  SegmentAABBBatch::fillPackets(segments.data(), segments.size(), segmentPackets.data());
+
+  size_t hitCount = 0;
+  size_t mismatchCount = 0;
+  for (auto _ : state)
+  {
+    hitCount = 0;
+    mismatchCount = 0;
+    for (size_t iSegment = 0; iSegment < segments.size(); ++iSegment)
+    {
+      const SegmentSlab slab (segments[iSegment]);
+      for (size_t iBox = 0; iBox < boxes.size(); ++iBox)
+      {
+        Intersection intersection;
+        const bool isHit = SegmentAABB::isSegmentAABBCollided(segments[iSegment], boxes[iBox], intersection);
+
+        float tEntry;
+        alignas(32) float tEntries [TWidth];
+        const bool isSlabHit          = SegmentAABBBatch::isSegmentAABBCollided(slab, boxes[iBox], tEntry);
+        const bool isAABBPacketHit    = (SegmentAABBBatch::isSegmentAABBCollided(slab, aabbPackets[iBox / TWidth], tEntries) >> (iBox % TWidth)) & 1u;
+        const bool isSegmentPacketHit = (SegmentAABBBatch::isSegmentAABBCollided(segmentPackets[iSegment / TWidth], boxes[iBox], tEntries) >> (iSegment % TWidth)) & 1u;
+
+        hitCount      += isHit;
+        mismatchCount += (isSlabHit != isHit) + (isAABBPacketHit != isHit) + (isSegmentPacketHit != isHit);
+      }
+    }
+    benchmark::DoNotOptimize(hitCount);
+  }
+  state.SetItemsProcessed(state.iterations() * segments.size() * boxes.size());
+  state.counters["hits"] = hitCount;
+  state.counters["mismatches"] = mismatchCount;
+
+  if (mismatchCount != 0)
+    state.SkipWithError("Slab test and SegmentAABB disagree on grid aligned segments");
+}
+BENCHMARK_TEMPLATE(BM_SegmentAABBSlabGridAligned, 4)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_SegmentAABBSlabGridAligned, 8)->Unit(benchmark::kMillisecond);
+
+#pragma endregion //!Segment AABB batch
+
+#pragma region Shape relation
+
+static Segment createRelationSegment(RandomGenerator<>& generator)
+{
+  return Segment(generator.cubiqueCoordinate<float>(Vec3f(0.f, 0.f, 0.f), 3.f, 3.f, 3.f), generator.cubiqueCoordinate<float>(Vec3f(0.f, 0.f, 0.f), 3.f, 3.f, 3.f));
+}
+
+static Sphere createRelationSphere(RandomGenerator<>& generator)
+{
+  return Sphere(generator.ranged(0.3f, 1.5f), generator.cubiqueCoordinate<float>(Vec3f(0.f, 0.f, 0.f), 1.f, 1.f, 1.f));
+}
+
+static Plane createRelationPlane(RandomGenerator<>& generator)
+{
+  return Plane(generator.ranged(-1.f, 1.f), generator.unitPeripheralSphericalCoordonate<float>());
+}
+
+static Capsule createRelationCapsule(RandomGenerator<>& generator)
+{
+  return Capsule(generator.cubiqueCoordinate<float>(Vec3f(0.f, 0.f, 0.f), 1.f, 1.f, 1.f), generator.unitPeripheralSphericalCoordonate<float>(), 1.5f, generator.ranged(0.2f, 0.9f));
+}
+
+static Cylinder createRelationCylinder(RandomGenerator<>& generator)
+{
+  const Vec3f pt1 = generator.cubiqueCoordinate<float>(Vec3f(0.f, 0.f, 0.f), 1.f, 1.f, 1.f);
+  return Cylinder(pt1, pt1 + generator.unitPeripheralSphericalCoordonate<float>() * 1.5f, generator.ranged(0.2f, 0.9f));
+}
+
+static OrientedBox createRelationOrientedBox(RandomGenerator<>& generator)
+{
+  return OrientedBox(generator.ranged(0.3f, 1.5f), generator.ranged(0.3f, 1.5f), generator.ranged(0.3f, 1.5f),
+                     generator.cubiqueCoordinate<float>(Vec3f(0.f, 0.f, 0.f), 1.f, 1.f, 1.f), generator.cubiqueCoordinate<float>(Vec3f(0.f, 0.f, 0.f), 3.14f, 3.14f, 3.14f));
+}
+
+static Quad createRelationQuad(RandomGenerator<>& generator)
+{
+  return Quad(createRelationOrientedBox(generator).getReferential(), generator.ranged(0.3f, 1.5f), generator.ranged(0.3f, 1.5f));
+}
+
+/*Same 1024 random pairs for the complete test (Intersection) and the overlap only test (Overlap) of a relation*/
+template <typename TShapeA, typename TShapeB, typename TTest>
+static void BM_ShapeRelation(benchmark::State& state, TShapeA (*createShapeA)(RandomGenerator<>&), TShapeB (*createShapeB)(RandomGenerator<>&), TTest test)
+{
+  RandomGenerator<> generator (11);
+  std::vector<TShapeA> shapesA;
+  std::vector<TShapeB> shapesB;
+  for (size_t i = 0; i < 1024; ++i)
+  {
+    shapesA.push_back(createShapeA(generator));
+    shapesB.push_back(createShapeB(generator));
+  }
+
+  size_t hitCount = 0;
+  for (auto _ : state)
+  {
+    hitCount = 0;
+    for (size_t i = 0; i < shapesA.size(); ++i)
+    {
+      hitCount += test(shapesA[i], shapesB[i]);
+    }
+    benchmark::DoNotOptimize(hitCount);
+  }
+  state.SetItemsProcessed(state.iterations() * shapesA.size());
+  state.counters["hits"] = hitCount;
+}
+
+BENCHMARK_CAPTURE(BM_ShapeRelation, SegmentSphereIntersection, createRelationSegment, createRelationSphere,
+  [](const Segment& seg, const Sphere& sphere) { Intersection intersection; return SegmentSphere::isSegmentSphereCollided(seg, sphere, intersection); });
+BENCHMARK_CAPTURE(BM_ShapeRelation, SegmentSphereOverlap, createRelationSegment, createRelationSphere,
+  [](const Segment& seg, const Sphere& sphere) { return SegmentSphere::isSegmentSphereCollided(seg, sphere); });
+
+BENCHMARK_CAPTURE(BM_ShapeRelation, SegmentPlaneIntersection, createRelationSegment, createRelationPlane,
+  [](const Segment& seg, const Plane& plane) { Intersection intersection; return SegmentPlane::isSegmentPlaneCollided(seg, plane, intersection); });
+BENCHMARK_CAPTURE(BM_ShapeRelation, SegmentPlaneOverlap, createRelationSegment, createRelationPlane,
+  [](const Segment& seg, const Plane& plane) { return SegmentPlane::isSegmentPlaneCollided(seg, plane); });
+
+BENCHMARK_CAPTURE(BM_ShapeRelation, SegmentSegmentIntersection, createRelationSegment, createRelationSegment,
+  [](const Segment& seg1, const Segment& seg2) { Intersection intersection; return SegmentSegment::isSegmentSegmentCollided(seg1.getPt1(), seg1.getPt2(), seg2.getPt1(), seg2.getPt2(), intersection); });
+BENCHMARK_CAPTURE(BM_ShapeRelation, SegmentSegmentOverlap, createRelationSegment, createRelationSegment,
+  [](const Segment& seg1, const Segment& seg2) { return SegmentSegment::isSegmentSegmentCollided(seg1.getPt1(), seg1.getPt2(), seg2.getPt1(), seg2.getPt2()); });
+
+/*Cross check : 1024 pairs of segments built through a common point, with coordinates and lengths scaled by state.range(0). "misses" must be 0*/
+static void BM_SegmentSegmentCrossing(benchmark::State& state)
+{
+  RandomGenerator<> generator (13);
+  const float scale = static_cast<float>(state.range(0));
+  std::vector<Segment> segmentsA;
+  std::vector<Segment> segmentsB;
+  for (size_t i = 0; i < 1024; ++i)
+  {
+    const Vec3f crossing  = generator.cubiqueCoordinate<float>(Vec3f(0.f, 0.f, 0.f), scale, scale, scale);
+    const Vec3f deltaA    = generator.cubiqueCoordinate<float>(Vec3f(0.f, 0.f, 0.f), scale, scale, scale);
+    const Vec3f deltaB    = generator.cubiqueCoordinate<float>(Vec3f(0.f, 0.f, 0.f), scale, scale, scale);
+    const float ratioA    = generator.ranged(0.05f, 0.95f);
+    const float ratioB    = generator.ranged(0.05f, 0.95f);
+
+    segmentsA.emplace_back(crossing - deltaA * ratioA, crossing + deltaA * (1.f - ratioA));
+    segmentsB.emplace_back(crossing - deltaB * ratioB, crossing + deltaB * (1.f - ratioB));
+  }
+
+  size_t hitCount = 0;
+  for (auto _ : state)
+  {
+    hitCount = 0;
+    for (size_t i = 0; i < segmentsA.size(); ++i)
+    {
+      hitCount += SegmentSegment::isSegmentSegmentCollided(segmentsA[i].getPt1(), segmentsA[i].getPt2(), segmentsB[i].getPt1(), segmentsB[i].getPt2());
+    }
+    benchmark::DoNotOptimize(hitCount);
+  }
+  state.SetItemsProcessed(state.iterations() * segmentsA.size());
+  state.counters["misses"] = segmentsA.size() - hitCount;
+
+  if (hitCount != segmentsA.size())
+    state.SkipWithError("Crossing segments are not detected");
+}
+BENCHMARK(BM_SegmentSegmentCrossing)->Arg(1)->Arg(1000)->Arg(100000);
+
+BENCHMARK_CAPTURE(BM_ShapeRelation, SegmentCapsuleIntersection, createRelationSegment, createRelationCapsule,
+  [](const Segment& seg, const Capsule& capsule) { Intersection intersection; return SegmentCapsule::isSegmentCapsuleCollided(seg, capsule, intersection); });
+BENCHMARK_CAPTURE(BM_ShapeRelation, SegmentCapsuleOverlap, createRelationSegment, createRelationCapsule,
+  [](const Segment& seg, const Capsule& capsule) { return SegmentCapsule::isSegmentCapsuleCollided(seg, capsule); });
+
+BENCHMARK_CAPTURE(BM_ShapeRelation, SegmentCylinderIntersection, createRelationSegment, createRelationCylinder,
+  [](const Segment& seg, const Cylinder& cylinder) { Intersection intersection; return SegmentCylinder::isSegmentCylinderCollided(seg, cylinder, intersection); });
+BENCHMARK_CAPTURE(BM_ShapeRelation, SegmentCylinderOverlap, createRelationSegment, createRelationCylinder,
+  [](const Segment& seg, const Cylinder& cylinder) { return SegmentCylinder::isSegmentCylinderCollided(seg, cylinder); });
+
+BENCHMARK_CAPTURE(BM_ShapeRelation, SegmentQuadIntersection, createRelationSegment, createRelationQuad,
+  [](const Segment& seg, const Quad& quad) { Intersection intersection; return SegmentQuad::isSegmentQuadCollided(seg, quad, intersection); });
+BENCHMARK_CAPTURE(BM_ShapeRelation, SegmentQuadOverlap, createRelationSegment, createRelationQuad,
+  [](const Segment& seg, const Quad& quad) { return SegmentQuad::isSegmentQuadCollided(seg, quad); });
+
+BENCHMARK_CAPTURE(BM_ShapeRelation, SegmentOrientedBoxIntersection, createRelationSegment, createRelationOrientedBox,
+  [](const Segment& seg, const OrientedBox& box) { Intersection intersection; return SegmentOrientedBox::isSegmentOrientedBoxCollided(seg, box, intersection); });
+BENCHMARK_CAPTURE(BM_ShapeRelation, SegmentOrientedBoxOverlap, createRelationSegment, createRelationOrientedBox,
+  [](const Segment& seg, const OrientedBox& box) { return SegmentOrientedBox::isSegmentOrientedBoxCollided(seg, box); });
+
+BENCHMARK_CAPTURE(BM_ShapeRelation, SphereOrientedBoxIntersection, createRelationSphere, createRelationOrientedBox,
+  [](const Sphere& sphere, const OrientedBox& box) { Intersection intersection; return SphereOrientedBox::isSphereOrientedBoxCollided(sphere, box, intersection); });
+BENCHMARK_CAPTURE(BM_ShapeRelation, SphereOrientedBoxOverlap, createRelationSphere, createRelationOrientedBox,
+  [](const Sphere& sphere, const OrientedBox& box) { return SphereOrientedBox::isSphereOrientedBoxCollided(sphere, box); });
+
+/*The segment is the path of a sphere of radius 0.5*/
+BENCHMARK_CAPTURE(BM_ShapeRelation, MovingSphereOrientedBoxIntersection, createRelationSegment, createRelationOrientedBox,
+  [](const Segment& seg, const OrientedBox& box) { Intersection intersection; return MovingSphereOrientedBox::isMovingSphereOrientedBoxCollided(Sphere(0.5f, seg.getPt1()), box, seg.getPt2() - seg.getPt1(), intersection); });
+BENCHMARK_CAPTURE(BM_ShapeRelation, MovingSphereOrientedBoxOverlap, createRelationSegment, createRelationOrientedBox,
+  [](const Segment& seg, const OrientedBox& box) { return MovingSphereOrientedBox::isMovingSphereOrientedBoxCollided(Sphere(0.5f, seg.getPt1()), box, seg.getPt2() - seg.getPt1()); });
+
+/*Pairs of near oriented boxes (as given by a broad phase), the second box of each pair moves a little each frame*/
+struct MovingOrientedBoxPairsScene
+{
+  std::vector<OrientedBox>  boxes1;
+  std::vector<OrientedBox>  boxes2;
+  std::vector<Vec3f>        velocities;
+  size_t                    frame {0};
+
+  explicit MovingOrientedBoxPairsScene(size_t count, float speed = 0.02f)
+  {
+    RandomGenerator<> generator (13);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+      boxes1.push_back(createRelationOrientedBox(generator));
+      boxes2.push_back(createRelationOrientedBox(generator));
+      boxes2.back().getReferential().origin += generator.cubiqueCoordinate<float>(Vec3f(0.f, 0.f, 0.f), 3.f, 3.f, 3.f);
+      velocities.push_back(generator.cubiqueCoordinate<float>(Vec3f(0.f, 0.f, 0.f), speed, speed, speed));
+    }
+  }
+
+  /*Go and back*/
+  void step() noexcept
+  {
+    const float direction = (frame++ / 64) % 2 ? -1.f : 1.f;
+
+    for (size_t i = 0; i < boxes2.size(); ++i)
+    {
+      boxes2[i].getReferential().origin += velocities[i] * direction;
+    }
+  }
+};
+
+/*Cold : full SAT each frame. Coherent : SAT start with the axis of the previous frame saved with the pair*/
+template <bool TCoherent, bool TPenetration>
+static void BM_OrientedBoxSAT(benchmark::State& state)
+{
+  MovingOrientedBoxPairsScene scene (state.range(0));
+  std::vector<int> separatingAxes (scene.boxes1.size(), -1);
+
+  size_t hitCount = 0;
+  for (auto _ : state)
+  {
+    scene.step();
+    hitCount = 0;
+
+    for (size_t i = 0; i < scene.boxes1.size(); ++i)
+    {
+      int coldSeparatingAxis = -1;
+      int& separatingAxis = TCoherent ? separatingAxes[i] : coldSeparatingAxis;
+      OrientedBoxPenetration penetration;
+
+      if constexpr (TPenetration)
+        hitCount += OrientedBoxOrientedBox::isBothOrientedBoxCollided(scene.boxes1[i], scene.boxes2[i], separatingAxis, penetration);
+      else
+        hitCount += OrientedBoxOrientedBox::isBothOrientedBoxCollided(scene.boxes1[i], scene.boxes2[i], separatingAxis);
+    }
+    benchmark::DoNotOptimize(hitCount);
+  }
+  state.SetItemsProcessed(state.iterations() * scene.boxes1.size());
+  state.counters["hits"] = hitCount;
+}
+BENCHMARK_TEMPLATE(BM_OrientedBoxSAT, false, false)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_OrientedBoxSAT, true, false)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_OrientedBoxSAT, false, true)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_OrientedBoxSAT, true, true)->Arg(4096);
+
+/*Coherent with the axis saved in SeparatingAxisCache by pair id*/
+static void BM_OrientedBoxSATCache(benchmark::State& state)
+{
+  MovingOrientedBoxPairsScene scene (state.range(0));
+  SeparatingAxisCache cache;
+
+  size_t hitCount = 0;
+  for (auto _ : state)
+  {
+    scene.step();
+    hitCount = 0;
+
+    for (uint32_t i = 0; i < scene.boxes1.size(); ++i)
+    {
+      hitCount += cache.isBothOrientedBoxCollided(2 * i, scene.boxes1[i], 2 * i + 1, scene.boxes2[i]);
+    }
+    benchmark::DoNotOptimize(hitCount);
+  }
+  state.SetItemsProcessed(state.iterations() * scene.boxes1.size());
+  state.counters["hits"] = hitCount;
+}
+BENCHMARK(BM_OrientedBoxSATCache)->Arg(4096);
+
+#pragma endregion //!Shape relation
+
+#pragma region GJK
+
+/*Generic GJK against the specialized overlap tests on the same pairs than Shape relation*/
+BENCHMARK_CAPTURE(BM_ShapeRelation, SegmentSphereGJK, createRelationSegment, createRelationSphere,
+  [](const Segment& seg, const Sphere& sphere) { return GJK::isOverlapped(seg, sphere); });
+BENCHMARK_CAPTURE(BM_ShapeRelation, SegmentCapsuleGJK, createRelationSegment, createRelationCapsule,
+  [](const Segment& seg, const Capsule& capsule) { return GJK::isOverlapped(seg, capsule); });
+BENCHMARK_CAPTURE(BM_ShapeRelation, SegmentOrientedBoxGJK, createRelationSegment, createRelationOrientedBox,
+  [](const Segment& seg, const OrientedBox& box) { return GJK::isOverlapped(seg, box); });
+BENCHMARK_CAPTURE(BM_ShapeRelation, SphereOrientedBoxGJK, createRelationSphere, createRelationOrientedBox,
+  [](const Sphere& sphere, const OrientedBox& box) { return GJK::isOverlapped(sphere, box); });
+BENCHMARK_CAPTURE(BM_ShapeRelation, CapsuleOrientedBoxGJK, createRelationCapsule, createRelationOrientedBox,
+  [](const Capsule& capsule, const OrientedBox& box) { return GJK::isOverlapped(capsule, box); });
+BENCHMARK_CAPTURE(BM_ShapeRelation, CylinderOrientedBoxGJK, createRelationCylinder, createRelationOrientedBox,
+  [](const Cylinder& cylinder, const OrientedBox& box) { return GJK::isOverlapped(cylinder, box); });
+
+/*Cold : empty simplex each frame. Warm : GJK start with the simplex of the previous frame saved with the pair*/
+template <bool TWarm>
+static void BM_OrientedBoxGJK(benchmark::State& state)
+{
+  MovingOrientedBoxPairsScene scene (state.range(0));
+  std::vector<GJKSimplex> simplexes (scene.boxes1.size());
+
+  size_t hitCount = 0;
+  for (auto _ : state)
+  {
+    scene.step();
+    hitCount = 0;
+
+    for (size_t i = 0; i < scene.boxes1.size(); ++i)
+    {
+      GJKSimplex coldSimplex;
+      GJKSimplex& simplex = TWarm ? simplexes[i] : coldSimplex;
+      hitCount += GJK::isOverlapped(scene.boxes1[i], scene.boxes2[i], simplex);
+    }
+    benchmark::DoNotOptimize(hitCount);
+  }
+  state.SetItemsProcessed(state.iterations() * scene.boxes1.size());
+  state.counters["hits"] = hitCount;
+}
+BENCHMARK_TEMPLATE(BM_OrientedBoxGJK, false)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_OrientedBoxGJK, true)->Arg(4096);
+
+/*Penetration of the pairs with GJK + EPA, to compare with BM_OrientedBoxSAT<false, true>*/
+static void BM_OrientedBoxEPA(benchmark::State& state)
+{
+  MovingOrientedBoxPairsScene scene (state.range(0));
+  std::vector<GJKSimplex> simplexes (scene.boxes1.size());
+
+  size_t hitCount = 0;
+  for (auto _ : state)
+  {
+    scene.step();
+    hitCount = 0;
+
+    for (size_t i = 0; i < scene.boxes1.size(); ++i)
+    {
+      ConvexPenetration penetration;
+      hitCount += EPA::getPenetration(scene.boxes1[i], scene.boxes2[i], penetration, simplexes[i]);
+    }
+    benchmark::DoNotOptimize(hitCount);
+  }
+  state.SetItemsProcessed(state.iterations() * scene.boxes1.size());
+  state.counters["hits"] = hitCount;
+}
+BENCHMARK(BM_OrientedBoxEPA)->Arg(4096);
+
+#pragma endregion //!GJK
+
+#pragma region Time of impact
+
+static RigidMotion createTranslation(RandomGenerator<>& generator)
+{
+  RigidMotion motion;
+  motion.translation = generator.cubiqueCoordinate<float>(Vec3f(0.f, 0.f, 0.f), 4.f, 4.f, 4.f);
+  return motion;
+}
+
+static RigidMotion createRigidMotion(RandomGenerator<>& generator)
+{
+  RigidMotion motion = createTranslation(generator);
+  motion.rotation = Quaternion<float>(generator.unitPeripheralSphericalCoordonate<float>(), Angle<EAngleType::Radian, float>(generator.ranged(-3.14f, 3.14f)));
+  return motion;
+}
+
+/*1024 pairs of the broad phase : pairs[i] = {i, i}. B start 6 units away on x and A move toward B*/
+template <typename TShapeA, typename TShapeB>
+static void BM_TimeOfImpact(benchmark::State& state, TShapeA (*createShapeA)(RandomGenerator<>&), TShapeB (*createShapeB)(RandomGenerator<>&), RigidMotion (*createMotion)(RandomGenerator<>&))
+{
+  RandomGenerator<> generator (17);
+  RigidMotion offset;
+  offset.translation = Vec3f(6.f, 0.f, 0.f);
+
+  std::vector<TShapeA>                        shapesA;
+  std::vector<TShapeB>                        shapesB;
+  std::vector<RigidMotion>                    motionsA;
+  std::vector<RigidMotion>                    motionsB;
+  std::vector<std::pair<uint32_t, uint32_t>>  pairs;
+  for (uint32_t i = 0; i < 1024; ++i)
+  {
+    shapesA.push_back(createShapeA(generator));
+    shapesB.push_back(TimeOfImpact::getShapeAtTime(createShapeB(generator), offset, 1.f));
+    motionsA.push_back(createMotion(generator));
+    motionsA.back().translation += offset.translation;
+    motionsB.push_back(createMotion(generator));
+    pairs.emplace_back(i, i);
+  }
+
+  std::vector<PairImpact> impacts;
+  for (auto _ : state)
+  {
+    impacts.clear();
+    TimeOfImpact::computeTimeOfImpacts(shapesA.data(), motionsA.data(), shapesB.data(), motionsB.data(), pairs.data(), pairs.size(), impacts);
+    benchmark::DoNotOptimize(impacts.data());
+  }
+  state.SetItemsProcessed(state.iterations() * pairs.size());
+  state.counters["hits"] = impacts.size();
+}
+
+BENCHMARK_CAPTURE(BM_TimeOfImpact, SphereOrientedBoxTranslation, createRelationSphere, createRelationOrientedBox, createTranslation);
+BENCHMARK_CAPTURE(BM_TimeOfImpact, SphereOrientedBoxRotation, createRelationSphere, createRelationOrientedBox, createRigidMotion);
+BENCHMARK_CAPTURE(BM_TimeOfImpact, CapsuleCapsuleRotation, createRelationCapsule, createRelationCapsule, createRigidMotion);
+BENCHMARK_CAPTURE(BM_TimeOfImpact, CapsuleOrientedBoxRotation, createRelationCapsule, createRelationOrientedBox, createRigidMotion);
+BENCHMARK_CAPTURE(BM_TimeOfImpact, OrientedBoxOrientedBoxRotation, createRelationOrientedBox, createRelationOrientedBox, createRigidMotion);
+
+#pragma endregion //!Time of impact
+
+#pragma region Frustum culling
+
+/*Camera at the center of the scene turning around y : the frustum move a little at each frame like in a game*/
+static Frustum createCameraFrustum(float yaw)
+{
+  const float cosYaw = std::cos(yaw);
+  const float sinYaw = std::sin(yaw);
+
+  const Mat4f<> view (cosYaw, 0.f, -sinYaw, 0.f,
+                      0.f,    1.f, 0.f,     0.f,
+                      sinYaw, 0.f, cosYaw,  0.f,
+                      0.f,    0.f, 0.f,     1.f);
+
+  return Frustum(Mat4f<>::createPerspectiveMatrix(16.f / 9.f, 0.1f, 60.f, Angle<EAngleType::Radian, float>(1.f)) * view);
+}
+
+static void BM_FrustumCullingAABB(benchmark::State& state)
+{
+  MovingBoxesScene scene (state.range(0));
+  std::vector<ECullingResult> results (scene.boxes.size());
+
+  float yaw = 0.f;
+  for (auto _ : state)
+  {
+    const Frustum frustum = createCameraFrustum(yaw += 0.01f);
+    for (size_t i = 0; i < scene.boxes.size(); ++i)
+    {
+      results[i] = FrustumCulling::classify(frustum, scene.boxes[i]);
+    }
+    benchmark::DoNotOptimize(results.data());
+  }
+  state.SetItemsProcessed(state.iterations() * scene.boxes.size());
+}
+BENCHMARK(BM_FrustumCullingAABB)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+static void BM_FrustumCullingAABBCoherent(benchmark::State& state)
+{
+  MovingBoxesScene scene (state.range(0));
+  std::vector<ECullingResult> results     (scene.boxes.size());
+  std::vector<uint8_t>        lastPlanes  (scene.boxes.size(), 0);
+
+  float yaw = 0.f;
+  for (auto _ : state)
+  {
+    const Frustum frustum = createCameraFrustum(yaw += 0.01f);
+    for (size_t i = 0; i < scene.boxes.size(); ++i)
+    {
+      results[i] = FrustumCulling::classify(frustum, scene.boxes[i], lastPlanes[i]);
+    }
+    benchmark::DoNotOptimize(results.data());
+  }
+  state.SetItemsProcessed(state.iterations() * scene.boxes.size());
+}
+BENCHMARK(BM_FrustumCullingAABBCoherent)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+template <size_t TWidth, bool TCoherent>
+static void BM_FrustumCullingAABBPacket(benchmark::State& state)
+{
+  MovingBoxesScene scene (state.range(0));
+  std::vector<AABBPacket<TWidth>> packets     ((scene.boxes.size() + TWidth - 1) / TWidth);
+  std::vector<ECullingResult>     results     (scene.boxes.size());
+  std::vector<uint8_t>            lastPlanes  (scene.boxes.size(), 0);
+  SegmentAABBBatch::fillPackets(scene.boxes.data(), scene.boxes.size(), packets.data());
+
+  float yaw = 0.f;
+  size_t visibleCount = 0;
+  for (auto _ : state)
+  {
+    const Frustum frustum = createCameraFrustum(yaw += 0.01f);
+    FrustumCulling::classify(frustum, packets.data(), scene.boxes.size(), results.data(), TCoherent ? lastPlanes.data() : nullptr);
+    benchmark::DoNotOptimize(results.data());
+  }
+
+  for (ECullingResult result : results)
+  {
+    visibleCount += result != ECullingResult::Outside;
+  }
+  state.SetItemsProcessed(state.iterations() * scene.boxes.size());
+  state.counters["visible"] = visibleCount;
+}
+BENCHMARK_TEMPLATE(BM_FrustumCullingAABBPacket, 4, false)->Arg(100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_FrustumCullingAABBPacket, 4, true)->Arg(100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_FrustumCullingAABBPacket, 8, false)->Arg(100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_FrustumCullingAABBPacket, 8, true)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+#pragma endregion //!Frustum culling
+
+#pragma region Hit buffer
+
+struct SegmentSpheresScene
+{
+  std::vector<Sphere>   spheres;
+  std::vector<Segment>  segments;
+
+  explicit SegmentSpheresScene(size_t count)
+    : spheres (count), segments (createSegments(256, 1.25f * std::cbrt(static_cast<float>(count))))
+  {
+    RandomGenerator<> generator (23);
+    const float halfWorldSize = 1.25f * std::cbrt(static_cast<float>(count));
+
+    for (Sphere& sphere : spheres)
+    {
+      sphere = Sphere(generator.ranged(0.3f, 1.5f), generator.cubiqueCoordinate<float>(Vec3f(0.f, 0.f, 0.f), halfWorldSize, halfWorldSize, halfWorldSize));
+    }
+  }
+};
+
+/*Historical result : one Intersection (points and normals) stored by hit*/
+static void BM_SegmentSphereHitsIntersection(benchmark::State& state)
+{
+  SegmentSpheresScene scene (state.range(0));
+  std::vector<std::pair<uint32_t, Intersection>> hits;
+
+  for (auto _ : state)
+  {
+    hits.clear();
+    for (const Segment& segment : scene.segments)
+    {
+      for (size_t i = 0; i < scene.spheres.size(); ++i)
+      {
+        Intersection intersection;
+        if (SegmentSphere::isSegmentSphereCollided(segment, scene.spheres[i], intersection))
+          hits.emplace_back(static_cast<uint32_t>(i), intersection);
+      }
+    }
+    benchmark::DoNotOptimize(hits.data());
+  }
+  state.SetItemsProcessed(state.iterations() * scene.segments.size() * scene.spheres.size());
+  state.counters["hits"] = hits.size();
+  state.counters["bytes"] = hits.size() * sizeof(hits[0]);
+}
+BENCHMARK(BM_SegmentSphereHitsIntersection)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+static void BM_SegmentSphereHitsBuffer(benchmark::State& state)
+{
+  SegmentSpheresScene scene (state.range(0));
+  HitBuffer hits;
+
+  for (auto _ : state)
+  {
+    hits.clear();
+    for (const Segment& segment : scene.segments)
+    {
+      SegmentSphere::findAllSegmentSphereCollided(segment, scene.spheres.data(), scene.spheres.size(), hits);
+    }
+    benchmark::DoNotOptimize(hits.data());
+  }
+  state.SetItemsProcessed(state.iterations() * scene.segments.size() * scene.spheres.size());
+  state.counters["hits"] = hits.size();
+  state.counters["bytes"] = hits.size() * sizeof(HitRecord);
+}
+BENCHMARK(BM_SegmentSphereHitsBuffer)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+static void BM_SegmentAABBHitsBuffer(benchmark::State& state)
+{
+  MovingBoxesScene scene (state.range(0));
+  const std::vector<Segment> segments = createSegments(256, scene.halfWorldSize);
+  std::vector<AABBPacket<4>> packets ((scene.boxes.size() + 3) / 4);
+  SegmentAABBBatch::fillPackets(scene.boxes.data(), scene.boxes.size(), packets.data());
+  HitBuffer hits;
+
+  for (auto _ : state)
+  {
+    hits.clear();
+    for (const Segment& segment : segments)
+    {
+      SegmentAABBBatch::findAllAABBCollided(SegmentSlab(segment), packets.data(), packets.size(), hits);
+    }
+    benchmark::DoNotOptimize(hits.data());
+  }
+  state.SetItemsProcessed(state.iterations() * segments.size() * scene.boxes.size());
+  state.counters["hits"] = hits.size();
+}
+BENCHMARK(BM_SegmentAABBHitsBuffer)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+#pragma endregion //!Hit buffer
+
 BENCHMARK_MAIN();
 
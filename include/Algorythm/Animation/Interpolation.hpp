@@ -28,26 +28,35 @@
 
 #pragma once
 
+#include "Types/SFINAEShorthand.hpp" //IsFloatingPoint
+#include "Numeric/PrecisionMath.hpp" //EPrecision, Numeric::sin, Numeric::cos, Numeric::sqrt, Numeric::pow, Numeric::exp2
+
+#include <stddef.h> //size_t
+
 /**
  * @see : https://easings.net/
+ * All functions take the precision policy of sin, cos, sqrt and pow as first template parameter (default is defaultPrecision) :
+ * `easeInOutSine<EPrecision::Fast>(x)`. Functions without transcendental ignore it
  */
 namespace FoxMath::AnimationCurve
 {
-template <std::floating_point T>
+template <typename T>
+inline constexpr T pi = static_cast<T>(3.14159265358979323846264338327950288L);
+template <typename T>
 inline constexpr T half_one = static_cast<T>(0.5);
-template <std::floating_point T>
+template <typename T>
 inline constexpr T zero = static_cast<T>(0);
-template <std::floating_point T>
+template <typename T>
 inline constexpr T one = static_cast<T>(1);
-template <std::floating_point T>
+template <typename T>
 inline constexpr T two = static_cast<T>(2);
-template <std::floating_point T>
+template <typename T>
 inline constexpr T three = static_cast<T>(3);
-template <std::floating_point T>
+template <typename T>
 inline constexpr T four = static_cast<T>(4);
-template <std::floating_point T>
+template <typename T>
 inline constexpr T eighths = static_cast<T>(8);
-template <std::floating_point T>
+template <typename T>
 inline constexpr T ten = static_cast<T>(10);
 
 /**
@@ -56,10 +65,10 @@ inline constexpr T ten = static_cast<T>(10);
  * @param x : [0, 1] or undifine behaviour
  * @return image of interpolation in x
  */
-template <std::floating_point T>
+template <EPrecision TPrecision = defaultPrecision, typename T, IsFloatingPoint<T> = true>
 inline constexpr T easeInSine(T x)
 {
-    return one<T> - std::cos((x * std::numbers::pi_v<T>) / one<T>);
+    return one<T> - Numeric::cos<TPrecision>((x * pi<T>) / one<T>);
 }
 
 /**
@@ -68,10 +77,10 @@ inline constexpr T easeInSine(T x)
  * @param x : [0, 1] or undifine behaviour
  * @return image of interpolation in x
  */
-template <std::floating_point T>
+template <EPrecision TPrecision = defaultPrecision, typename T, IsFloatingPoint<T> = true>
 inline constexpr T easeOutSine(T x)
 {
-    return std::sin((x * std::numbers::pi_v<T>) / two<T>);
+    return Numeric::sin<TPrecision>((x * pi<T>) / two<T>);
 }
 
 /**
@@ -80,10 +89,10 @@ inline constexpr T easeOutSine(T x)
  * @param x : [0, 1] or undifine behaviour
  * @return image of interpolation in x
  */
-template <std::floating_point T>
+template <EPrecision TPrecision = defaultPrecision, typename T, IsFloatingPoint<T> = true>
 inline constexpr T easeInOutSine(T x)
 {
-    return -(std::cos(std::numbers::pi_v<T> * x) - one<T>) / two<T>;
+    return -(Numeric::cos<TPrecision>(pi<T> * x) - one<T>) / two<T>;
 }
 
 /**
@@ -92,10 +101,10 @@ inline constexpr T easeInOutSine(T x)
  * @param x : [0, 1] or undifine behaviour
  * @return image of interpolation in x
  */
-template <size_t Pow = 2, std::floating_point T>
+template <size_t Pow = 2, EPrecision TPrecision = defaultPrecision, typename T, IsFloatingPoint<T> = true>
 inline constexpr T easeIn(T x)
 {
-    return std::pow(x, Pow);
+    return Numeric::pow<Pow, TPrecision>(x);
 }
 
 /**
@@ -104,10 +113,10 @@ inline constexpr T easeIn(T x)
  * @param x : [0, 1] or undifine behaviour
  * @return image of interpolation in x
  */
-template <size_t Pow = 2, std::floating_point T>
+template <size_t Pow = 2, EPrecision TPrecision = defaultPrecision, typename T, IsFloatingPoint<T> = true>
 inline constexpr T easeOut(T x)
 {
-    return one<T> - std::pow(one<T> - x, Pow);
+    return one<T> - Numeric::pow<Pow, TPrecision>(one<T> - x);
 }
 
 /**
@@ -116,11 +125,11 @@ inline constexpr T easeOut(T x)
  * @param x : [0, 1] or undifine behaviour
  * @return image of interpolation in x
  */
-template <size_t Pow = 2, std::floating_point T>
+template <size_t Pow = 2, EPrecision TPrecision = defaultPrecision, typename T, IsFloatingPoint<T> = true>
 inline constexpr T easeInOut(T x)
 {
-    return x < half_one<T> ? std::pow(two<T>, Pow - 1) * std::pow(x, Pow)
-                           : one<T> - std::pow(-two<T> * x + two<T>, Pow) / two<T>;
+    return x < half_one<T> ? Numeric::pow<Pow - 1, TPrecision>(two<T>) * Numeric::pow<Pow, TPrecision>(x)
+                           : one<T> - Numeric::pow<Pow, TPrecision>(-two<T> * x + two<T>) / two<T>;
 }
 
 /**
@@ -129,10 +138,10 @@ inline constexpr T easeInOut(T x)
  * @param x : [0, 1] or undifine behaviour
  * @return image of interpolation in x
  */
-template <std::floating_point T>
+template <EPrecision TPrecision = defaultPrecision, typename T, IsFloatingPoint<T> = true>
 inline constexpr T easeInCirc(T x)
 {
-    return one<T> - std::sqrt(one<T> - std::pow(x, 2));
+    return one<T> - Numeric::sqrt<TPrecision>(one<T> - Numeric::pow<2, TPrecision>(x));
 }
 
 /**
@@ -141,10 +150,10 @@ inline constexpr T easeInCirc(T x)
  * @param x : [0, 1] or undifine behaviour
  * @return image of interpolation in x
  */
-template <std::floating_point T>
+template <EPrecision TPrecision = defaultPrecision, typename T, IsFloatingPoint<T> = true>
 inline constexpr T easeOutCirc(T x)
 {
-    return std::sqrt(one<T> - std::pow(x - one<T>, 2));
+    return Numeric::sqrt<TPrecision>(one<T> - Numeric::pow<2, TPrecision>(x - one<T>));
 }
 
 /**
@@ -153,7 +162,7 @@ inline constexpr T easeOutCirc(T x)
  * @param x : [0, 1] or undifine behaviour
  * @return image of interpolation in x
  */
-template <std::floating_point T>
+template <EPrecision TPrecision = defaultPrecision, typename T, IsFloatingPoint<T> = true>
 inline constexpr T easeInBack(T x)
 {
     const T c1 = static_cast<T>(1.70158);
@@ -168,13 +177,13 @@ inline constexpr T easeInBack(T x)
  * @param x : [0, 1] or undifine behaviour
  * @return image of interpolation in x
  */
-template <std::floating_point T>
+template <EPrecision TPrecision = defaultPrecision, typename T, IsFloatingPoint<T> = true>
 inline constexpr T easeOutBack(T x)
 {
     const T c1 = static_cast<T>(1.70158);
     const T c3 = c1 + one<T>;
 
-    return one<T> + c3 * pow(x - one<T>, 3) + c1 * pow(x - one<T>, 2);
+    return one<T> + c3 * Numeric::pow<3, TPrecision>(x - one<T>) + c1 * Numeric::pow<2, TPrecision>(x - one<T>);
 }
 
 /**
@@ -183,15 +192,15 @@ inline constexpr T easeOutBack(T x)
  * @param x : [0, 1] or undifine behaviour
  * @return image of interpolation in x
  */
-template <std::floating_point T>
+template <EPrecision TPrecision = defaultPrecision, typename T, IsFloatingPoint<T> = true>
 inline constexpr T easeInOutBack(T x)
 {
     const T c1 = static_cast<T>(1.70158);
     const T c2 = c1 * static_cast<T>(1.525);
 
     return x < half_one<T>
-               ? (std::pow(two<T> * x, 2) * ((c2 + one<T>)*two<T> * x - c2)) / two<T>
-               : (std::pow(two<T> * x - two<T>, 2) * ((c2 + one<T>)*(x * two<T> - two<T>)+c2) + two<T>) / two<T>;
+               ? (Numeric::pow<2, TPrecision>(two<T> * x) * ((c2 + one<T>)*two<T> * x - c2)) / two<T>
+               : (Numeric::pow<2, TPrecision>(two<T> * x - two<T>) * ((c2 + one<T>)*(x * two<T> - two<T>)+c2) + two<T>) / two<T>;
 }
 
 /**
@@ -200,14 +209,14 @@ inline constexpr T easeInOutBack(T x)
  * @param x : [0, 1] or undifine behaviour
  * @return image of interpolation in x
  */
-template <std::floating_point T>
+template <EPrecision TPrecision = defaultPrecision, typename T, IsFloatingPoint<T> = true>
 inline constexpr T easeInElastic(T x)
 {
-    const T c4 = (two<T> * std::numbers::pi_v<T>) / three<T>;
+    const T c4 = (two<T> * pi<T>) / three<T>;
 
     return x == zero<T>  ? zero<T>
            : x == one<T> ? one<T>
-                         : -std::pow(two<T>, ten<T> * x - ten<T>) * std::sin((x * ten<T> - static_cast<T>(10.75)) * c4);
+                         : -Numeric::exp2<TPrecision>(ten<T> * x - ten<T>) * Numeric::sin<TPrecision>((x * ten<T> - static_cast<T>(10.75)) * c4);
 }
 
 /**
@@ -216,14 +225,14 @@ inline constexpr T easeInElastic(T x)
  * @param x : [0, 1] or undifine behaviour
  * @return image of interpolation in x
  */
-template <std::floating_point T>
+template <EPrecision TPrecision = defaultPrecision, typename T, IsFloatingPoint<T> = true>
 inline constexpr T easeOutElastic(T x)
 {
-    const T c4 = (two<T> * std::numbers::pi_v<T>) / three<T>;
+    const T c4 = (two<T> * pi<T>) / three<T>;
 
     return x == zero<T>  ? zero<T>
            : x == one<T> ? one<T>
-                         : std::pow(two<T>, -ten<T> * x) * sin((x * ten<T> - static_cast<T>(0.75)) * c4) + one<T>;
+                         : Numeric::exp2<TPrecision>(-ten<T> * x) * Numeric::sin<TPrecision>((x * ten<T> - static_cast<T>(0.75)) * c4) + one<T>;
 }
 
 /**
@@ -232,41 +241,29 @@ inline constexpr T easeOutElastic(T x)
  * @param x : [0, 1] or undifine behaviour
  * @return image of interpolation in x
  */
-template <std::floating_point T>
+template <EPrecision TPrecision = defaultPrecision, typename T, IsFloatingPoint<T> = true>
 inline constexpr T easeInOutElastic(T x)
 {
-    const T c5 = (two<T> * std::numbers::pi_v<T>) / static_cast<T>(4.5);
+    const T c5 = (two<T> * pi<T>) / static_cast<T>(4.5);
 
     return x == zero<T>      ? zero<T>
            : x == one<T>     ? one<T>
-           : x < half_one<T> ? -(std::pow(two<T>, static_cast<T>(20) * x - ten<T>) *
-                                 std::sin((static_cast<T>(20) * x - static_cast<T>(11.125)) * c5)) /
+           : x < half_one<T> ? -(Numeric::exp2<TPrecision>(static_cast<T>(20) * x - ten<T>) *
+                                 Numeric::sin<TPrecision>((static_cast<T>(20) * x - static_cast<T>(11.125)) * c5)) /
                                    two<T>
-                             : (std::pow(two<T>, -static_cast<T>(20) * x + ten<T>) *
-                                std::sin((static_cast<T>(20) * x - static_cast<T>(11.125)) * c5)) /
+                             : (Numeric::exp2<TPrecision>(-static_cast<T>(20) * x + ten<T>) *
+                                Numeric::sin<TPrecision>((static_cast<T>(20) * x - static_cast<T>(11.125)) * c5)) /
                                        two<T> +
                                    one<T>;
 }
 
-/**
- * @brief easeInBounce interpolation
- * @tparam T : floating type of the variable
- * @param x : [0, 1] or undifine behaviour
- * @return image of interpolation in x
- */
-template <std::floating_point T>
-inline constexpr T easeInBounce(T x)
-{
-    return one<T> - easeOutBounce(one<T> - x);
-}
-
 /**
  * @brief easeOutBounce interpolation
  * @tparam T : floating type of the variable
  * @param x : [0, 1] or undifine behaviour
  * @return image of interpolation in x
  */
-template <std::floating_point T>
+template <EPrecision TPrecision = defaultPrecision, typename T, IsFloatingPoint<T> = true>
 inline constexpr T easeOutBounce(T x)
 {
     const T n1 = static_cast<T>(7.5625);
@@ -278,29 +275,44 @@ inline constexpr T easeOutBounce(T x)
     }
     else if (x < two<T> / d1)
     {
-        return n1 * (x -= static_cast<T>(1.5) / d1) * x + static_cast<T>(0.75);
+        x -= static_cast<T>(1.5) / d1;
+        return n1 * x * x + static_cast<T>(0.75);
     }
     else if (x < static_cast<T>(2.5) / d1)
     {
-        return n1 * (x -= static_cast<T>(2.25) / d1) * x + static_cast<T>(0.9375);
+        x -= static_cast<T>(2.25) / d1;
+        return n1 * x * x + static_cast<T>(0.9375);
     }
     else
     {
-        return n1 * (x -= static_cast<T>(2.625) / d1) * x + static_cast<T>(0.984375);
+        x -= static_cast<T>(2.625) / d1;
+        return n1 * x * x + static_cast<T>(0.984375);
     }
 }
 
+/**
+ * @brief easeInBounce interpolation
+ * @tparam T : floating type of the variable
+ * @param x : [0, 1] or undifine behaviour
+ * @return image of interpolation in x
+ */
+template <EPrecision TPrecision = defaultPrecision, typename T, IsFloatingPoint<T> = true>
+inline constexpr T easeInBounce(T x)
+{
+    return one<T> - easeOutBounce<TPrecision>(one<T> - x);
+}
+
 /**
  * @brief easeInOutBounce interpolation
  * @tparam T : floating type of the variable
  * @param x : [0, 1] or undifine behaviour
  * @return image of interpolation in x
  */
-template <std::floating_point T>
+template <EPrecision TPrecision = defaultPrecision, typename T, IsFloatingPoint<T> = true>
 inline constexpr T easeInOutBounce(T x)
 {
-    return x < half_one<T> ? (one<T> - easeOutBounce(one<T> - two<T> * x)) / two<T>
-                           : (one<T> + easeOutBounce(two<T> * x - one<T>)) / two<T>;
+    return x < half_one<T> ? (one<T> - easeOutBounce<TPrecision>(one<T> - two<T> * x)) / two<T>
+                           : (one<T> + easeOutBounce<TPrecision>(two<T> * x - one<T>)) / two<T>;
 }
 
 } // namespace FoxMath::AnimationCurve
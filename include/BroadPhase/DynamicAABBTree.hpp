@@ -0,0 +1,351 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 15 h 20
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <vector> //std::vector
+#include <array> //std::array
+#include <utility> //std::pair, std::forward
+#include <limits> //std::numeric_limits
+#include <algorithm> //std::min, std::max
+#include <cmath> //std::isinf
+#include <assert.h> //assert
+
+#include "Vector/Vector3.hpp"
+#include "Shape3D/AABB.hpp"
+#include "Shape3D/OrientedBox.hpp"
+#include "Shape3D/Segment.hpp"
+#include "ShapeRelation/Intersection.hpp"
+#include "ShapeRelation/SegmentAABB.hpp"
+
+namespace FoxMath
+{
+    /**
+     * @brief Dynamic bounding volume hierarchy of fat AABB for broad phase. Each proxy store a tight AABB and a fat AABB enlarged by a margin
+     * (and by the displacement of the object). Moving a proxy inside its fat AABB don't touch the tree so coherent scene are cheap to update.
+     * Insertion use the surface area heuristic and the tree is balanced with rotations (AVL like) so the height stay in O(log(n)).
+     * @note Proxy id are stable until remove. userData can store an index or a pointer to the owner of the volume
+     */
+    class DynamicAABBTree
+    {
+        public:
+
+        #pragma region static attribut
+
+        static constexpr int nullNode = -1;
+
+        #pragma endregion //!static attribut
+
+        protected:
+
+        struct Node
+        {
+            Vec3f   min;
+            Vec3f   max;
+
+            size_t  userData;
+
+            /*Parent in the tree or next free node in the free list*/
+            int     parent;
+            int     child1;
+            int     child2;
+
+            /*leaf = 0, free node = -1*/
+            int     height;
+
+            /*Fat AABB changed since the last updatePairs*/
+            bool    moved;
+
+            bool isLeaf () const noexcept { return child1 == nullNode; }
+        };
+
+        /**
+         * @brief Stack of node used by the traversals. Stay on the call stack for balanced tree and use the heap only for very deep tree
+         * 
+         */
+        template <typename T, size_t TCapacity = 128>
+        class TraversalStack
+        {
+            protected:
+
+            std::array<T, TCapacity>    m_array;
+            std::vector<T>              m_heap;
+            T*                          m_data      {m_array.data()};
+            size_t                      m_count     {0};
+            size_t                      m_capacity  {TCapacity};
+
+            public:
+
+            TraversalStack () noexcept = default;
+            TraversalStack (const TraversalStack& other) = delete;
+            TraversalStack& operator=(TraversalStack const& other) = delete;
+
+            void push (const T& value)
+            {
+                if (m_count == m_capacity)
+                {
+                    /*Copy the inline array only on the first spill : after, resize keep the heap content*/
+                    if (m_data == m_array.data())
+                        m_heap.assign(m_array.begin(), m_array.end());
+
+                    m_heap.resize(m_capacity *= 2);
+                    m_data = m_heap.data();
+                }
+                m_data[m_count++] = value;
+            }
+
+            T       pop     () noexcept         { return m_data[--m_count]; }
+            bool    empty   () const noexcept   { return m_count == 0; }
+        };
+
+        #pragma region attribut
+
+        std::vector<Node>   m_nodes;
+        std::vector<AABB>   m_tightAABBs;   /*Indexed by proxy id. Used by the narrow phase dispatch (raycast)*/
+        std::vector<int>    m_moveBuffer;   /*Proxies to process by the next updatePairs*/
+
+        int                 m_root          {nullNode};
+        int                 m_freeList      {nullNode};
+        size_t              m_proxyCount    {0};
+
+        float               m_fatMargin;
+        float               m_displacementMultiplier;
+
+        #pragma endregion //!attribut
+
+        #pragma region methods
+
+        inline int  allocateNode    ();
+        inline void freeNode        (int nodeId) noexcept;
+
+        inline void insertLeaf      (int leaf) noexcept;
+        inline void removeLeaf      (int leaf) noexcept;
+
+        /**
+         * @brief Rotate the tree around iA if it is unbalanced and return the new root of this sub tree
+         * 
+         * @param iA 
+         * @return int 
+         */
+        inline int  balance         (int iA) noexcept;
+
+        /**
+         * @brief Set the fat AABB of the node with the margin and the predicted displacement
+         * 
+         * @param node 
+         * @param aabb 
+         * @param displacement 
+         */
+        inline void setFatAABB      (Node& node, const AABB& aabb, const Vec3f& displacement) const noexcept;
+
+        /**
+         * @brief Call callback(proxyId) for each proxy with fat AABB that overlap [min, max]. Return false in callback to stop the query
+         * 
+         * @tparam TCallback : bool(int proxyId)
+         * @param min 
+         * @param max 
+         * @param callback 
+         */
+        template <typename TCallback>
+        inline void queryBounds     (const Vec3f& min, const Vec3f& max, TCallback&& callback) const;
+
+        #pragma endregion //!methods
+
+        #pragma region static methods
+
+        [[nodiscard]] static inline
+        bool    isOverlapped    (const Vec3f& minA, const Vec3f& maxA, const Vec3f& minB, const Vec3f& maxB) noexcept;
+
+        [[nodiscard]] static inline
+        bool    isContained     (const Vec3f& minA, const Vec3f& maxA, const Vec3f& minB, const Vec3f& maxB) noexcept;
+
+        [[nodiscard]] static inline
+        float   getSurfaceArea  (const Vec3f& min, const Vec3f& max) noexcept;
+
+        [[nodiscard]] static inline
+        float   getMergedSurfaceArea  (const Vec3f& minA, const Vec3f& maxA, const Vec3f& minB, const Vec3f& maxB) noexcept;
+
+        static inline
+        void    merge           (const Node& nodeA, const Node& nodeB, Node& out) noexcept;
+
+        /**
+         * @brief Slab test of the segment [origin, origin + tMax * direction] with the box
+         * 
+         * @param origin 
+         * @param invDirection : 1 / direction. Infinite on null component
+         * @param tMax 
+         * @return true if the segment touch the box
+         */
+        [[nodiscard]] static inline
+        bool    isSegmentOverlapped (const Vec3f& origin, const Vec3f& invDirection, float tMax, const Vec3f& min, const Vec3f& max) noexcept;
+
+        #pragma endregion //!static methods
+
+        public:
+
+        #pragma region constructor/destructor
+
+        /**
+         * @brief Construct a new Dynamic AABB Tree object
+         * 
+         * @param fatMargin : margin added on each side of the tight AABB. Bigger margin reduce reinsertion but increase false positive
+         * @param displacementMultiplier : the fat AABB is extended in the direction of the displacement given to move (times this factor)
+         */
+        explicit inline
+        DynamicAABBTree (float fatMargin = 0.1f, float displacementMultiplier = 2.f) noexcept;
+
+        DynamicAABBTree (const DynamicAABBTree& other)              = default;
+        DynamicAABBTree (DynamicAABBTree&& other) noexcept          = default;
+        ~DynamicAABBTree ()                                         = default;
+        DynamicAABBTree& operator=(DynamicAABBTree const& other)    = default;
+        DynamicAABBTree& operator=(DynamicAABBTree && other)        = default;
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Create a proxy for the volume and return its id
+         * 
+         * @param aabb 
+         * @param userData 
+         * @return int : proxy id
+         */
+        inline int  insert  (const AABB& aabb, size_t userData = 0);
+
+        /**
+         * @brief Create a proxy for the AABB of the oriented box and return its id
+         * 
+         * @param orientedBox 
+         * @param userData 
+         * @return int : proxy id
+         */
+        inline int  insert  (const OrientedBox& orientedBox, size_t userData = 0);
+
+        /**
+         * @brief Destroy the proxy. Its id can be reused by the next insert
+         * 
+         * @param proxyId 
+         */
+        inline void remove  (int proxyId) noexcept;
+
+        /**
+         * @brief Update the volume of the proxy. The tree is only updated if the new AABB leave the fat AABB
+         * 
+         * @param proxyId 
+         * @param aabb : new tight AABB
+         * @param displacement : displacement of the object during the step, used to predict the fat AABB
+         * @return true if the proxy was reinserted
+         */
+        inline bool move    (int proxyId, const AABB& aabb, const Vec3f& displacement = Vec3f::zero) noexcept;
+
+        inline bool move    (int proxyId, const OrientedBox& orientedBox, const Vec3f& displacement = Vec3f::zero) noexcept;
+
+        /**
+         * @brief Call callback(proxyId) for each proxy with fat AABB that overlap aabb. Return false in callback to stop the query
+         * 
+         * @tparam TCallback : bool(int proxyId)
+         * @param aabb 
+         * @param callback 
+         */
+        template <typename TCallback>
+        inline void query   (const AABB& aabb, TCallback&& callback) const;
+
+        /**
+         * @brief Call callback(proxyIdA, proxyIdB) with proxyIdA < proxyIdB for each overlapping fat AABB with at least one proxy moved (or inserted)
+         * since the last call. Each pair is reported once. Keep the pair set of the previous steps to get all the contacts
+         * 
+         * @tparam TCallback : void(int proxyIdA, int proxyIdB)
+         * @param callback 
+         */
+        template <typename TCallback>
+        inline void updatePairs (TCallback&& callback);
+
+        /**
+         * @brief Call callback(proxyIdA, proxyIdB) with proxyIdA < proxyIdB for each overlapping fat AABB. Each pair is reported once.
+         * The tree is collided with itself so disjoint sub trees are rejected with one test
+         * 
+         * @tparam TCallback : void(int proxyIdA, int proxyIdB)
+         * @param callback 
+         */
+        template <typename TCallback>
+        inline void findAllPairs (TCallback&& callback) const;
+
+        /**
+         * @brief Call callback(proxyId, segment) for each proxy with fat AABB crossed by the segment. The callback return the ratio in [0, 1] of the segment
+         * to keep : 0 stop the query, the ratio of its hit clip the segment (closest hit), 1 continue.
+         * Use the callback to dispatch the proxy to the narrow phase (SegmentAABB, SegmentOrientedBox, SegmentSphere...)
+         * 
+         * @tparam TCallback : float(int proxyId, const Segment& segment)
+         * @param segment 
+         * @param callback 
+         */
+        template <typename TCallback>
+        inline void segmentQuery (const Segment& segment, TCallback&& callback) const;
+
+        /**
+         * @brief Return the proxy with the closest hit of the segment (SegmentAABB test on the tight AABB) or nullNode
+         * 
+         * @param segment 
+         * @param intersection : intersection of the closest hit
+         * @return int 
+         */
+        inline int  raycast (const Segment& segment, Intersection& intersection) const;
+
+        /**
+         * @brief Check the structure of the tree (parent link, height, bounding volume). Debug purpose
+         * 
+         * @return true if the tree is valid
+         */
+        [[nodiscard]] inline
+        bool    isValid () const noexcept;
+
+        #pragma endregion //!methods
+
+        #pragma region accessor
+
+        [[nodiscard]] inline size_t        getUserData     (int proxyId) const noexcept { return m_nodes[proxyId].userData; }
+        [[nodiscard]] inline const AABB&   getTightAABB    (int proxyId) const noexcept { return m_tightAABBs[proxyId]; }
+        [[nodiscard]] inline AABB          getFatAABB      (int proxyId) const noexcept;
+        [[nodiscard]] inline size_t        getProxyCount   () const noexcept { return m_proxyCount; }
+        [[nodiscard]] inline int           getHeight       () const noexcept { return m_root == nullNode ? 0 : m_nodes[m_root].height; }
+        [[nodiscard]] inline float         getFatMargin    () const noexcept { return m_fatMargin; }
+
+        #pragma endregion //!accessor
+
+        #pragma region mutator
+
+        inline void setUserData (int proxyId, size_t userData) noexcept { m_nodes[proxyId].userData = userData; }
+
+        #pragma endregion //!mutator
+    };
+
+    #include "DynamicAABBTree.inl"
+
+} /*namespace FoxMath*/
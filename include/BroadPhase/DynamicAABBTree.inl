@@ -0,0 +1,734 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 15 h 20
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+inline
+DynamicAABBTree::DynamicAABBTree (float fatMargin, float displacementMultiplier) noexcept
+    :   m_fatMargin                 {fatMargin},
+        m_displacementMultiplier    {displacementMultiplier}
+{}
+
+inline
+bool DynamicAABBTree::isOverlapped (const Vec3f& minA, const Vec3f& maxA, const Vec3f& minB, const Vec3f& maxB) noexcept
+{
+    return  minA.getX() <= maxB.getX() && minB.getX() <= maxA.getX() &&
+            minA.getY() <= maxB.getY() && minB.getY() <= maxA.getY() &&
+            minA.getZ() <= maxB.getZ() && minB.getZ() <= maxA.getZ();
+}
+
+inline
+bool DynamicAABBTree::isContained (const Vec3f& minA, const Vec3f& maxA, const Vec3f& minB, const Vec3f& maxB) noexcept
+{
+    return  minA.getX() <= minB.getX() && maxB.getX() <= maxA.getX() &&
+            minA.getY() <= minB.getY() && maxB.getY() <= maxA.getY() &&
+            minA.getZ() <= minB.getZ() && maxB.getZ() <= maxA.getZ();
+}
+
+inline
+float DynamicAABBTree::getSurfaceArea (const Vec3f& min, const Vec3f& max) noexcept
+{
+    const float dx = max.getX() - min.getX();
+    const float dy = max.getY() - min.getY();
+    const float dz = max.getZ() - min.getZ();
+    return 2.f * (dx * dy + dy * dz + dz * dx);
+}
+
+inline
+float DynamicAABBTree::getMergedSurfaceArea (const Vec3f& minA, const Vec3f& maxA, const Vec3f& minB, const Vec3f& maxB) noexcept
+{
+    const float dx = std::max(maxA.getX(), maxB.getX()) - std::min(minA.getX(), minB.getX());
+    const float dy = std::max(maxA.getY(), maxB.getY()) - std::min(minA.getY(), minB.getY());
+    const float dz = std::max(maxA.getZ(), maxB.getZ()) - std::min(minA.getZ(), minB.getZ());
+    return 2.f * (dx * dy + dy * dz + dz * dx);
+}
+
+inline
+void DynamicAABBTree::merge (const Node& nodeA, const Node& nodeB, Node& out) noexcept
+{
+    out.min = Vec3f{std::min(nodeA.min.getX(), nodeB.min.getX()), std::min(nodeA.min.getY(), nodeB.min.getY()), std::min(nodeA.min.getZ(), nodeB.min.getZ())};
+    out.max = Vec3f{std::max(nodeA.max.getX(), nodeB.max.getX()), std::max(nodeA.max.getY(), nodeB.max.getY()), std::max(nodeA.max.getZ(), nodeB.max.getZ())};
+}
+
+inline
+bool DynamicAABBTree::isSegmentOverlapped (const Vec3f& origin, const Vec3f& invDirection, float tMax, const Vec3f& min, const Vec3f& max) noexcept
+{
+    float tEnter = 0.f;
+    float tExit = tMax;
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+        if (std::isinf(invDirection[i]))
+        {
+            /*Segment parallel to the slab*/
+            if (origin[i] < min[i] || origin[i] > max[i])
+                return false;
+
+            continue;
+        }
+
+        float t1 = (min[i] - origin[i]) * invDirection[i];
+        float t2 = (max[i] - origin[i]) * invDirection[i];
+
+        if (t1 > t2)
+            std::swap(t1, t2);
+
+        tEnter  = std::max(tEnter, t1);
+        tExit   = std::min(tExit, t2);
+
+        if (tEnter > tExit)
+            return false;
+    }
+
+    return true;
+}
+
+inline
+int DynamicAABBTree::allocateNode ()
+{
+    int nodeId;
+
+    if (m_freeList == nullNode)
+    {
+        nodeId = static_cast<int>(m_nodes.size());
+        m_nodes.emplace_back();
+        m_tightAABBs.emplace_back();
+    }
+    else
+    {
+        nodeId = m_freeList;
+        m_freeList = m_nodes[nodeId].parent;
+    }
+
+    Node& node      = m_nodes[nodeId];
+    node.userData   = 0;
+    node.parent     = nullNode;
+    node.child1     = nullNode;
+    node.child2     = nullNode;
+    node.height     = 0;
+    node.moved      = false;
+    return nodeId;
+}
+
+inline
+void DynamicAABBTree::freeNode (int nodeId) noexcept
+{
+    m_nodes[nodeId].parent = m_freeList;
+    m_nodes[nodeId].height = -1;
+    m_freeList = nodeId;
+}
+
+inline
+void DynamicAABBTree::setFatAABB (Node& node, const AABB& aabb, const Vec3f& displacement) const noexcept
+{
+    Vec3f min = aabb.getMin();
+    Vec3f max = aabb.getMax();
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+        const float predicted = displacement[i] * m_displacementMultiplier;
+
+        min.setData(i, min[i] - m_fatMargin + std::min(predicted, 0.f));
+        max.setData(i, max[i] + m_fatMargin + std::max(predicted, 0.f));
+    }
+
+    node.min = min;
+    node.max = max;
+}
+
+inline
+void DynamicAABBTree::insertLeaf (int leaf) noexcept
+{
+    if (m_root == nullNode)
+    {
+        m_root = leaf;
+        m_nodes[m_root].parent = nullNode;
+        return;
+    }
+
+    /*Step 1 : find the best sibling with the surface area heuristic*/
+    const Vec3f leafMin = m_nodes[leaf].min;
+    const Vec3f leafMax = m_nodes[leaf].max;
+    int index = m_root;
+
+    while (!m_nodes[index].isLeaf())
+    {
+        const Node& node    = m_nodes[index];
+        const Node& child1  = m_nodes[node.child1];
+        const Node& child2  = m_nodes[node.child2];
+
+        const float area            = getSurfaceArea(node.min, node.max);
+        const float combinedArea    = getMergedSurfaceArea(node.min, node.max, leafMin, leafMax);
+
+        /*Cost of creating a new parent for this node and the new leaf*/
+        const float cost = 2.f * combinedArea;
+
+        /*Minimum cost of pushing the leaf further down the tree*/
+        const float inheritanceCost = 2.f * (combinedArea - area);
+
+        float cost1 = getMergedSurfaceArea(child1.min, child1.max, leafMin, leafMax) + inheritanceCost;
+        if (!child1.isLeaf())
+            cost1 -= getSurfaceArea(child1.min, child1.max);
+
+        float cost2 = getMergedSurfaceArea(child2.min, child2.max, leafMin, leafMax) + inheritanceCost;
+        if (!child2.isLeaf())
+            cost2 -= getSurfaceArea(child2.min, child2.max);
+
+        if (cost < cost1 && cost < cost2)
+            break;
+
+        index = cost1 < cost2 ? node.child1 : node.child2;
+    }
+
+    const int sibling = index;
+
+    /*Step 2 : create a new parent (allocate can reallocate the nodes)*/
+    const int oldParent = m_nodes[sibling].parent;
+    const int newParent = allocateNode();
+
+    m_nodes[newParent].parent   = oldParent;
+    m_nodes[newParent].height   = m_nodes[sibling].height + 1;
+    m_nodes[newParent].child1   = sibling;
+    m_nodes[newParent].child2   = leaf;
+    merge(m_nodes[leaf], m_nodes[sibling], m_nodes[newParent]);
+
+    if (oldParent != nullNode)
+    {
+        if (m_nodes[oldParent].child1 == sibling)
+            m_nodes[oldParent].child1 = newParent;
+        else
+            m_nodes[oldParent].child2 = newParent;
+    }
+    else
+    {
+        m_root = newParent;
+    }
+
+    m_nodes[sibling].parent = newParent;
+    m_nodes[leaf].parent    = newParent;
+
+    /*Step 3 : walk back up the tree fixing heights and AABBs*/
+    index = m_nodes[leaf].parent;
+    while (index != nullNode)
+    {
+        index = balance(index);
+
+        Node& node = m_nodes[index];
+        node.height = 1 + std::max(m_nodes[node.child1].height, m_nodes[node.child2].height);
+        merge(m_nodes[node.child1], m_nodes[node.child2], node);
+
+        index = node.parent;
+    }
+}
+
+inline
+void DynamicAABBTree::removeLeaf (int leaf) noexcept
+{
+    if (leaf == m_root)
+    {
+        m_root = nullNode;
+        return;
+    }
+
+    const int parent        = m_nodes[leaf].parent;
+    const int grandParent   = m_nodes[parent].parent;
+    const int sibling       = m_nodes[parent].child1 == leaf ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+    if (grandParent != nullNode)
+    {
+        /*Destroy parent and connect sibling to grand parent*/
+        if (m_nodes[grandParent].child1 == parent)
+            m_nodes[grandParent].child1 = sibling;
+        else
+            m_nodes[grandParent].child2 = sibling;
+
+        m_nodes[sibling].parent = grandParent;
+        freeNode(parent);
+
+        /*Adjust ancestor bounds*/
+        int index = grandParent;
+        while (index != nullNode)
+        {
+            index = balance(index);
+
+            Node& node = m_nodes[index];
+            node.height = 1 + std::max(m_nodes[node.child1].height, m_nodes[node.child2].height);
+            merge(m_nodes[node.child1], m_nodes[node.child2], node);
+
+            index = node.parent;
+        }
+    }
+    else
+    {
+        m_root = sibling;
+        m_nodes[sibling].parent = nullNode;
+        freeNode(parent);
+    }
+}
+
+inline
+int DynamicAABBTree::balance (int iA) noexcept
+{
+    Node& A = m_nodes[iA];
+    if (A.isLeaf() || A.height < 2)
+        return iA;
+
+    const int iB = A.child1;
+    const int iC = A.child2;
+    Node& B = m_nodes[iB];
+    Node& C = m_nodes[iC];
+
+    const int balanceFactor = C.height - B.height;
+
+    /*Rotate C up*/
+    if (balanceFactor > 1)
+    {
+        const int iF = C.child1;
+        const int iG = C.child2;
+        Node& F = m_nodes[iF];
+        Node& G = m_nodes[iG];
+
+        /*Swap A and C*/
+        C.child1 = iA;
+        C.parent = A.parent;
+        A.parent = iC;
+
+        /*A's old parent should point to C*/
+        if (C.parent != nullNode)
+        {
+            if (m_nodes[C.parent].child1 == iA)
+                m_nodes[C.parent].child1 = iC;
+            else
+                m_nodes[C.parent].child2 = iC;
+        }
+        else
+        {
+            m_root = iC;
+        }
+
+        /*Rotate*/
+        if (F.height > G.height)
+        {
+            C.child2 = iF;
+            A.child2 = iG;
+            G.parent = iA;
+            merge(B, G, A);
+            merge(A, F, C);
+
+            A.height = 1 + std::max(B.height, G.height);
+            C.height = 1 + std::max(A.height, F.height);
+        }
+        else
+        {
+            C.child2 = iG;
+            A.child2 = iF;
+            F.parent = iA;
+            merge(B, F, A);
+            merge(A, G, C);
+
+            A.height = 1 + std::max(B.height, F.height);
+            C.height = 1 + std::max(A.height, G.height);
+        }
+
+        return iC;
+    }
+
+    /*Rotate B up*/
+    if (balanceFactor < -1)
+    {
+        const int iD = B.child1;
+        const int iE = B.child2;
+        Node& D = m_nodes[iD];
+        Node& E = m_nodes[iE];
+
+        /*Swap A and B*/
+        B.child1 = iA;
+        B.parent = A.parent;
+        A.parent = iB;
+
+        /*A's old parent should point to B*/
+        if (B.parent != nullNode)
+        {
+            if (m_nodes[B.parent].child1 == iA)
+                m_nodes[B.parent].child1 = iB;
+            else
+                m_nodes[B.parent].child2 = iB;
+        }
+        else
+        {
+            m_root = iB;
+        }
+
+        /*Rotate*/
+        if (D.height > E.height)
+        {
+            B.child2 = iD;
+            A.child1 = iE;
+            E.parent = iA;
+            merge(C, E, A);
+            merge(A, D, B);
+
+            A.height = 1 + std::max(C.height, E.height);
+            B.height = 1 + std::max(A.height, D.height);
+        }
+        else
+        {
+            B.child2 = iE;
+            A.child1 = iD;
+            D.parent = iA;
+            merge(C, D, A);
+            merge(A, E, B);
+
+            A.height = 1 + std::max(C.height, D.height);
+            B.height = 1 + std::max(A.height, E.height);
+        }
+
+        return iB;
+    }
+
+    return iA;
+}
+
+inline
+int DynamicAABBTree::insert (const AABB& aabb, size_t userData)
+{
+    const int proxyId = allocateNode();
+
+    Node& node = m_nodes[proxyId];
+    setFatAABB(node, aabb, Vec3f::zero);
+    node.userData   = userData;
+    node.height     = 0;
+    node.moved      = true;
+    m_tightAABBs[proxyId] = aabb;
+
+    insertLeaf(proxyId);
+    m_moveBuffer.push_back(proxyId);
+    ++m_proxyCount;
+
+    return proxyId;
+}
+
+inline
+int DynamicAABBTree::insert (const OrientedBox& orientedBox, size_t userData)
+{
+    return insert(orientedBox.getAABB(), userData);
+}
+
+inline
+void DynamicAABBTree::remove (int proxyId) noexcept
+{
+    assert(proxyId >= 0 && static_cast<size_t>(proxyId) < m_nodes.size() && m_nodes[proxyId].isLeaf());
+
+    if (m_nodes[proxyId].moved)
+    {
+        std::replace(m_moveBuffer.begin(), m_moveBuffer.end(), proxyId, nullNode);
+    }
+
+    removeLeaf(proxyId);
+    freeNode(proxyId);
+    --m_proxyCount;
+}
+
+inline
+bool DynamicAABBTree::move (int proxyId, const AABB& aabb, const Vec3f& displacement) noexcept
+{
+    assert(proxyId >= 0 && static_cast<size_t>(proxyId) < m_nodes.size() && m_nodes[proxyId].isLeaf());
+
+    m_tightAABBs[proxyId] = aabb;
+
+    if (isContained(m_nodes[proxyId].min, m_nodes[proxyId].max, aabb.getMin(), aabb.getMax()))
+        return false;
+
+    removeLeaf(proxyId);
+    setFatAABB(m_nodes[proxyId], aabb, displacement);
+    insertLeaf(proxyId);
+
+    if (!m_nodes[proxyId].moved)
+    {
+        m_nodes[proxyId].moved = true;
+        m_moveBuffer.push_back(proxyId);
+    }
+
+    return true;
+}
+
+inline
+bool DynamicAABBTree::move (int proxyId, const OrientedBox& orientedBox, const Vec3f& displacement) noexcept
+{
+    return move(proxyId, orientedBox.getAABB(), displacement);
+}
+
+template <typename TCallback>
+inline
+void DynamicAABBTree::queryBounds (const Vec3f& min, const Vec3f& max, TCallback&& callback) const
+{
+    TraversalStack<int> stack;
+    stack.push(m_root);
+
+    while (!stack.empty())
+    {
+        const int nodeId = stack.pop();
+        if (nodeId == nullNode)
+            continue;
+
+        const Node& node = m_nodes[nodeId];
+        if (!isOverlapped(node.min, node.max, min, max))
+            continue;
+
+        if (node.isLeaf())
+        {
+            if (!callback(nodeId))
+                return;
+        }
+        else
+        {
+            stack.push(node.child1);
+            stack.push(node.child2);
+        }
+    }
+}
+
+template <typename TCallback>
+inline
+void DynamicAABBTree::query (const AABB& aabb, TCallback&& callback) const
+{
+    queryBounds(aabb.getMin(), aabb.getMax(), std::forward<TCallback>(callback));
+}
+
+template <typename TCallback>
+inline
+void DynamicAABBTree::updatePairs (TCallback&& callback)
+{
+    for (const int queryProxyId : m_moveBuffer)
+    {
+        if (queryProxyId == nullNode)
+            continue;
+
+        const Node& queryNode = m_nodes[queryProxyId];
+        queryBounds(queryNode.min, queryNode.max, [&](int proxyId)
+        {
+            /*Both proxies are moving : the pair is reported by the query of the greater id*/
+            if (proxyId == queryProxyId || (m_nodes[proxyId].moved && proxyId > queryProxyId))
+                return true;
+
+            callback(std::min(proxyId, queryProxyId), std::max(proxyId, queryProxyId));
+            return true;
+        });
+    }
+
+    for (const int proxyId : m_moveBuffer)
+    {
+        if (proxyId != nullNode)
+            m_nodes[proxyId].moved = false;
+    }
+
+    m_moveBuffer.clear();
+}
+
+template <typename TCallback>
+inline
+void DynamicAABBTree::findAllPairs (TCallback&& callback) const
+{
+    TraversalStack<int>                 selfStack;
+    TraversalStack<std::pair<int, int>> pairStack;
+
+    selfStack.push(m_root);
+
+    while (!selfStack.empty())
+    {
+        const int nodeId = selfStack.pop();
+        if (nodeId == nullNode || m_nodes[nodeId].isLeaf())
+            continue;
+
+        /*Pairs inside each child are found later, here only pairs between the two children*/
+        const Node& node = m_nodes[nodeId];
+        selfStack.push(node.child1);
+        selfStack.push(node.child2);
+        pairStack.push({node.child1, node.child2});
+
+        while (!pairStack.empty())
+        {
+            const auto [idA, idB] = pairStack.pop();
+            const Node& nodeA = m_nodes[idA];
+            const Node& nodeB = m_nodes[idB];
+
+            if (!isOverlapped(nodeA.min, nodeA.max, nodeB.min, nodeB.max))
+                continue;
+
+            if (nodeA.isLeaf() && nodeB.isLeaf())
+            {
+                callback(std::min(idA, idB), std::max(idA, idB));
+            }
+            else if (nodeB.isLeaf() || (!nodeA.isLeaf() && nodeA.height >= nodeB.height))
+            {
+                pairStack.push({nodeA.child1, idB});
+                pairStack.push({nodeA.child2, idB});
+            }
+            else
+            {
+                pairStack.push({idA, nodeB.child1});
+                pairStack.push({idA, nodeB.child2});
+            }
+        }
+    }
+}
+
+template <typename TCallback>
+inline
+void DynamicAABBTree::segmentQuery (const Segment& segment, TCallback&& callback) const
+{
+    const Vec3f origin      = segment.getPt1();
+    const Vec3f direction   = segment.getPt2() - segment.getPt1();
+    const float infinity    = std::numeric_limits<float>::infinity();
+
+    const Vec3f invDirection {  direction.getX() == 0.f ? infinity : 1.f / direction.getX(),
+                                direction.getY() == 0.f ? infinity : 1.f / direction.getY(),
+                                direction.getZ() == 0.f ? infinity : 1.f / direction.getZ()};
+    float tMax = 1.f;
+
+    TraversalStack<int> stack;
+    stack.push(m_root);
+
+    while (!stack.empty())
+    {
+        const int nodeId = stack.pop();
+        if (nodeId == nullNode)
+            continue;
+
+        const Node& node = m_nodes[nodeId];
+        if (!isSegmentOverlapped(origin, invDirection, tMax, node.min, node.max))
+            continue;
+
+        if (node.isLeaf())
+        {
+            const float ratio = callback(nodeId, segment);
+
+            if (ratio <= 0.f)
+                return;
+
+            tMax = std::min(tMax, ratio);
+        }
+        else
+        {
+            stack.push(node.child1);
+            stack.push(node.child2);
+        }
+    }
+}
+
+inline
+int DynamicAABBTree::raycast (const Segment& segment, Intersection& intersection) const
+{
+    const Vec3f direction   = segment.getPt2() - segment.getPt1();
+    const float sqrLength   = Vec3f::dot(direction, direction);
+
+    int     closestProxyId  = nullNode;
+    float   closestRatio    = std::numeric_limits<float>::max();
+
+    segmentQuery(segment, [&](int proxyId, const Segment& seg) -> float
+    {
+        Intersection hit;
+        if (!SegmentAABB::isSegmentAABBCollided(seg, m_tightAABBs[proxyId], hit))
+            return 1.f;
+
+        /*Segment inside the box : nothing can be closer*/
+        float ratio = 0.f;
+        if (hit.intersectionType != EIntersectionType::InfinyIntersection && sqrLength > 0.f)
+            ratio = Vec3f::dot(hit.intersection1 - seg.getPt1(), direction) / sqrLength;
+
+        if (ratio < closestRatio)
+        {
+            closestRatio    = ratio;
+            closestProxyId  = proxyId;
+            intersection    = hit;
+        }
+
+        return ratio;
+    });
+
+    if (closestProxyId == nullNode)
+        intersection.setNotIntersection();
+
+    return closestProxyId;
+}
+
+inline
+AABB DynamicAABBTree::getFatAABB (int proxyId) const noexcept
+{
+    const Node& node = m_nodes[proxyId];
+    const Vec3f center  = (node.min + node.max) * 0.5f;
+    const Vec3f ext     = (node.max - node.min) * 0.5f;
+    return AABB{center, ext.getX(), ext.getY(), ext.getZ()};
+}
+
+inline
+bool DynamicAABBTree::isValid () const noexcept
+{
+    if (m_root == nullNode)
+        return m_proxyCount == 0;
+
+    if (m_nodes[m_root].parent != nullNode)
+        return false;
+
+    size_t leafCount = 0;
+    TraversalStack<int> stack;
+    stack.push(m_root);
+
+    while (!stack.empty())
+    {
+        const int nodeId = stack.pop();
+        const Node& node = m_nodes[nodeId];
+
+        if (node.isLeaf())
+        {
+            ++leafCount;
+
+            if (node.height != 0 || !isContained(node.min, node.max, m_tightAABBs[nodeId].getMin(), m_tightAABBs[nodeId].getMax()))
+                return false;
+
+            continue;
+        }
+
+        const Node& child1 = m_nodes[node.child1];
+        const Node& child2 = m_nodes[node.child2];
+
+        if (child1.parent != nodeId || child2.parent != nodeId ||
+            node.height != 1 + std::max(child1.height, child2.height) ||
+            !isContained(node.min, node.max, child1.min, child1.max) ||
+            !isContained(node.min, node.max, child2.min, child2.max))
+        {
+            return false;
+        }
+
+        stack.push(node.child1);
+        stack.push(node.child2);
+    }
+
+    return leafCount == m_proxyCount;
+}
@@ -0,0 +1,232 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 17 h 10
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <vector> //std::vector
+#include <algorithm> //std::max, std::clamp
+#include <cmath> //std::floor
+#include <stdint.h> //uint32_t
+#include <assert.h> //assert
+
+#include "Vector/Vector3.hpp"
+#include "Shape3D/AABB.hpp"
+#include "Shape3D/Sphere.hpp"
+#include "Shape3D/Plane.hpp"
+#include "Shape3D/OrientedBox.hpp"
+#include "ShapeRelation/Intersection.hpp"
+#include "ShapeRelation/SpherePlane.hpp"
+#include "ShapeRelation/SphereOrientedBox.hpp"
+#include "ShapeRelation/OrientedBoxOrientedBox.hpp"
+
+namespace FoxMath
+{
+    /**
+     * @brief Uniform grid for dense scene of small spheres and AABB (particles...). Each object is stored in the cell of its center
+     * and the cells are hashed in a fixed number of buckets. build sort the objects by bucket with a counting sort in flat arrays :
+     * after the first frame, clear/insert/build and the queries don't allocate.
+     * @note Queries are extended by the biggest object extent so the cell size should be close to the diameter of the objects
+     */
+    class SpatialHashGrid
+    {
+        protected:
+
+        struct Object
+        {
+            Vec3f       center;
+            Vec3f       halfExtents;    /*radius on each axis for sphere*/
+            float       radius;         /*negative for AABB*/
+            int         cell [3];
+            uint32_t    index;          /*insertion index*/
+        };
+
+        #pragma region attribut
+
+        std::vector<Object>     m_objects;          /*Insertion order*/
+        std::vector<size_t>     m_userData;         /*Insertion order*/
+        std::vector<Object>     m_sortedObjects;    /*Bucket order*/
+        std::vector<uint32_t>   m_objectBuckets;
+        std::vector<uint32_t>   m_bucketStarts;     /*Objects of bucket b are in [m_bucketStarts[b], m_bucketStarts[b + 1][*/
+
+        float                   m_cellSize;
+        float                   m_invCellSize;
+        size_t                  m_bucketCount;      /*0 : 2 buckets by object (power of 2)*/
+        uint32_t                m_bucketMask        {0};
+        float                   m_maxHalfExtent     {0.f};
+        bool                    m_isBuilt           {false};
+
+        #pragma endregion //!attribut
+
+        #pragma region methods
+
+        [[nodiscard]] inline
+        int         getCellCoordinate   (float value) const noexcept { return static_cast<int>(std::floor(value * m_invCellSize)); }
+
+        [[nodiscard]] inline
+        uint32_t    getBucket           (int x, int y, int z) const noexcept;
+
+        inline Object& pushObject       (size_t userData);
+
+        /**
+         * @brief Call callback(sortedIndex) for each object stored in cells overlapped by [min, max] extended by the biggest object extent
+         * 
+         * @tparam TCallback : void(uint32_t sortedIndex)
+         * @param min 
+         * @param max 
+         * @param callback 
+         */
+        template <typename TCallback>
+        inline void forEachCandidate    (const Vec3f& min, const Vec3f& max, TCallback&& callback) const;
+
+        #pragma endregion //!methods
+
+        #pragma region static methods
+
+        [[nodiscard]] static inline
+        bool    isOverlapped            (const Object& objectA, const Object& objectB) noexcept;
+
+        #pragma endregion //!static methods
+
+        public:
+
+        #pragma region constructor/destructor
+
+        /**
+         * @brief Construct a new Spatial Hash Grid object
+         * 
+         * @param cellSize : side of a cell. Should be close to the diameter of the objects
+         * @param bucketCount : number of bucket rounded to the next power of 2. 0 to use 2 buckets by object
+         */
+        explicit inline
+        SpatialHashGrid (float cellSize, size_t bucketCount = 0) noexcept;
+
+        SpatialHashGrid (const SpatialHashGrid& other)              = default;
+        SpatialHashGrid (SpatialHashGrid&& other) noexcept          = default;
+        ~SpatialHashGrid ()                                         = default;
+        SpatialHashGrid& operator=(SpatialHashGrid const& other)    = default;
+        SpatialHashGrid& operator=(SpatialHashGrid && other)        = default;
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Remove all the objects. Memory is kept for the next frame
+         * 
+         */
+        inline void     clear   () noexcept;
+
+        inline void     reserve (size_t count);
+
+        /**
+         * @brief Add the sphere and return its object index (insertion order). Call build before the queries
+         * 
+         * @param sphere 
+         * @param userData 
+         * @return uint32_t 
+         */
+        inline uint32_t insert  (const Sphere& sphere, size_t userData = 0);
+
+        inline uint32_t insert  (const AABB& aabb, size_t userData = 0);
+
+        /**
+         * @brief Sort the objects in the buckets with a counting sort. O(n + bucket count)
+         * 
+         */
+        inline void     build   ();
+
+        /**
+         * @brief Call callback(objectIndex) for each object that overlap the sphere (center, radius)
+         * 
+         * @tparam TCallback : void(uint32_t objectIndex)
+         * @param center 
+         * @param radius 
+         * @param callback 
+         */
+        template <typename TCallback>
+        inline void queryRadius (const Vec3f& center, float radius, TCallback&& callback) const;
+
+        /**
+         * @brief Call callback(objectIndex) for each object that overlap the AABB
+         * 
+         * @tparam TCallback : void(uint32_t objectIndex)
+         * @param aabb 
+         * @param callback 
+         */
+        template <typename TCallback>
+        inline void query       (const AABB& aabb, TCallback&& callback) const;
+
+        /**
+         * @brief Call callback(objectIndexA, objectIndexB) with objectIndexA < objectIndexB for each pair of overlapping objects. Each pair is reported once.
+         * If the cell size is at least twice the greatest half extent, only the forward half of the neighborhood of each cell is visited
+         * 
+         * @tparam TCallback : void(uint32_t objectIndexA, uint32_t objectIndexB)
+         * @param callback 
+         */
+        template <typename TCallback>
+        inline void forEachPair (TCallback&& callback) const;
+
+        /**
+         * @brief Call callback(objectIndex, intersection) for each object colliding the box. Spheres use SphereOrientedBox.
+         * AABB overlapping the AABB of the box use OrientedBoxOrientedBox and report an unknow intersection
+         * 
+         * @tparam TCallback : void(uint32_t objectIndex, const Intersection& intersection)
+         * @param box 
+         * @param callback 
+         */
+        template <typename TCallback>
+        inline void queryOrientedBox (const OrientedBox& box, TCallback&& callback) const;
+
+        /**
+         * @brief Call callback(objectIndex) for each object on or forward the plane (SpherePlane). AABB use their extents projected on the normal of the plane.
+         * The plane is not bounded so the grid is not used : all the objects are tested (build is not needed)
+         * 
+         * @tparam TCallback : void(uint32_t objectIndex)
+         * @param plane 
+         * @param callback 
+         */
+        template <typename TCallback>
+        inline void queryPlane  (const Plane& plane, TCallback&& callback) const;
+
+        #pragma endregion //!methods
+
+        #pragma region accessor
+
+        [[nodiscard]] inline size_t    getObjectCount  () const noexcept { return m_objects.size(); }
+        [[nodiscard]] inline size_t    getUserData     (uint32_t objectIndex) const noexcept { return m_userData[objectIndex]; }
+        [[nodiscard]] inline Vec3f     getCenter       (uint32_t objectIndex) const noexcept { return m_objects[objectIndex].center; }
+        [[nodiscard]] inline float     getCellSize     () const noexcept { return m_cellSize; }
+        [[nodiscard]] inline size_t    getBucketCount  () const noexcept { return static_cast<size_t>(m_bucketMask) + 1; }
+
+        #pragma endregion //!accessor
+    };
+
+    #include "SpatialHashGrid.inl"
+
+} /*namespace FoxMath*/
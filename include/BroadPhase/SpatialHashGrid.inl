@@ -0,0 +1,355 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 17 h 10
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+inline
+SpatialHashGrid::SpatialHashGrid (float cellSize, size_t bucketCount) noexcept
+    :   m_cellSize      {cellSize},
+        m_invCellSize   {1.f / cellSize},
+        m_bucketCount   {bucketCount}
+{
+    assert(cellSize > 0.f);
+}
+
+inline
+uint32_t SpatialHashGrid::getBucket (int x, int y, int z) const noexcept
+{
+    /*Teschner et al. spatial hash*/
+    return ((static_cast<uint32_t>(x) * 73856093u) ^ (static_cast<uint32_t>(y) * 19349663u) ^ (static_cast<uint32_t>(z) * 83492791u)) & m_bucketMask;
+}
+
+inline
+bool SpatialHashGrid::isOverlapped (const Object& objectA, const Object& objectB) noexcept
+{
+    const Vec3f delta = objectB.center - objectA.center;
+
+    if (objectA.radius >= 0.f && objectB.radius >= 0.f)
+    {
+        const float radiusSum = objectA.radius + objectB.radius;
+        return Vec3f::dot(delta, delta) <= radiusSum * radiusSum;
+    }
+
+    if (objectA.radius < 0.f && objectB.radius < 0.f)
+    {
+        return  std::abs(delta.getX()) <= objectA.halfExtents.getX() + objectB.halfExtents.getX() &&
+                std::abs(delta.getY()) <= objectA.halfExtents.getY() + objectB.halfExtents.getY() &&
+                std::abs(delta.getZ()) <= objectA.halfExtents.getZ() + objectB.halfExtents.getZ();
+    }
+
+    /*Sphere and AABB : distance from the sphere center to the nearest point of the box*/
+    const Object& sphere    = objectA.radius >= 0.f ? objectA : objectB;
+    const Object& box       = objectA.radius >= 0.f ? objectB : objectA;
+    const Vec3f local       = sphere.center - box.center;
+    const Vec3f nearest     {   std::clamp(local.getX(), -box.halfExtents.getX(), box.halfExtents.getX()),
+                                std::clamp(local.getY(), -box.halfExtents.getY(), box.halfExtents.getY()),
+                                std::clamp(local.getZ(), -box.halfExtents.getZ(), box.halfExtents.getZ())};
+    const Vec3f gap         = local - nearest;
+    return Vec3f::dot(gap, gap) <= sphere.radius * sphere.radius;
+}
+
+inline
+void SpatialHashGrid::clear () noexcept
+{
+    m_objects.clear();
+    m_userData.clear();
+    m_isBuilt = false;
+}
+
+inline
+void SpatialHashGrid::reserve (size_t count)
+{
+    m_objects.reserve(count);
+    m_userData.reserve(count);
+    m_sortedObjects.reserve(count);
+    m_objectBuckets.reserve(count);
+}
+
+inline
+SpatialHashGrid::Object& SpatialHashGrid::pushObject (size_t userData)
+{
+    m_isBuilt = false;
+    m_userData.push_back(userData);
+
+    Object& object  = m_objects.emplace_back();
+    object.index    = static_cast<uint32_t>(m_objects.size() - 1);
+    return object;
+}
+
+inline
+uint32_t SpatialHashGrid::insert (const Sphere& sphere, size_t userData)
+{
+    Object& object      = pushObject(userData);
+    object.center       = sphere.getCenter();
+    object.radius       = sphere.getRadius();
+    object.halfExtents  = Vec3f{object.radius, object.radius, object.radius};
+    return object.index;
+}
+
+inline
+uint32_t SpatialHashGrid::insert (const AABB& aabb, size_t userData)
+{
+    Object& object      = pushObject(userData);
+    object.center       = aabb.getCenter();
+    object.radius       = -1.f;
+    object.halfExtents  = Vec3f{aabb.getExtI(), aabb.getExtJ(), aabb.getExtK()};
+    return object.index;
+}
+
+inline
+void SpatialHashGrid::build ()
+{
+    const size_t count = m_objects.size();
+
+    /*Power of 2 bucket count for a mask instead of a modulo*/
+    size_t bucketCount = 16;
+    while (bucketCount < (m_bucketCount ? m_bucketCount : 2 * count))
+        bucketCount *= 2;
+
+    m_bucketMask = static_cast<uint32_t>(bucketCount - 1);
+    m_bucketStarts.assign(bucketCount + 1, 0);
+    m_objectBuckets.resize(count);
+    m_sortedObjects.resize(count);
+    m_maxHalfExtent = 0.f;
+
+    /*Step 1 : cell and bucket of each object, count by bucket*/
+    for (size_t i = 0; i < count; ++i)
+    {
+        Object& object = m_objects[i];
+        object.cell[0] = getCellCoordinate(object.center.getX());
+        object.cell[1] = getCellCoordinate(object.center.getY());
+        object.cell[2] = getCellCoordinate(object.center.getZ());
+
+        const uint32_t bucket = getBucket(object.cell[0], object.cell[1], object.cell[2]);
+        m_objectBuckets[i] = bucket;
+        ++m_bucketStarts[bucket];
+
+        m_maxHalfExtent = std::max({m_maxHalfExtent, object.halfExtents.getX(), object.halfExtents.getY(), object.halfExtents.getZ()});
+    }
+
+    /*Step 2 : inclusive prefix sum, m_bucketStarts[b] is the end of the bucket b*/
+    for (size_t bucket = 1; bucket < bucketCount; ++bucket)
+    {
+        m_bucketStarts[bucket] += m_bucketStarts[bucket - 1];
+    }
+    m_bucketStarts[bucketCount] = static_cast<uint32_t>(count);
+
+    /*Step 3 : scatter from the end so the sort is stable and m_bucketStarts[b] become the begin of the bucket b*/
+    for (size_t i = count; i-- > 0;)
+    {
+        m_sortedObjects[--m_bucketStarts[m_objectBuckets[i]]] = m_objects[i];
+    }
+
+    m_isBuilt = true;
+}
+
+template <typename TCallback>
+inline
+void SpatialHashGrid::forEachCandidate (const Vec3f& min, const Vec3f& max, TCallback&& callback) const
+{
+    assert(m_isBuilt);
+
+    const int minX = getCellCoordinate(min.getX() - m_maxHalfExtent);
+    const int minY = getCellCoordinate(min.getY() - m_maxHalfExtent);
+    const int minZ = getCellCoordinate(min.getZ() - m_maxHalfExtent);
+    const int maxX = getCellCoordinate(max.getX() + m_maxHalfExtent);
+    const int maxY = getCellCoordinate(max.getY() + m_maxHalfExtent);
+    const int maxZ = getCellCoordinate(max.getZ() + m_maxHalfExtent);
+
+    for (int z = minZ; z <= maxZ; ++z)
+    {
+        for (int y = minY; y <= maxY; ++y)
+        {
+            for (int x = minX; x <= maxX; ++x)
+            {
+                const uint32_t bucket = getBucket(x, y, z);
+                const uint32_t end = m_bucketStarts[bucket + 1];
+
+                for (uint32_t sortedIndex = m_bucketStarts[bucket]; sortedIndex < end; ++sortedIndex)
+                {
+                    /*Other cells can share the bucket*/
+                    const Object& object = m_sortedObjects[sortedIndex];
+                    if (object.cell[0] == x && object.cell[1] == y && object.cell[2] == z)
+                        callback(sortedIndex);
+                }
+            }
+        }
+    }
+}
+
+template <typename TCallback>
+inline
+void SpatialHashGrid::queryRadius (const Vec3f& center, float radius, TCallback&& callback) const
+{
+    Object querySphere;
+    querySphere.center = center;
+    querySphere.radius = radius;
+
+    const Vec3f extents {radius, radius, radius};
+    forEachCandidate(center - extents, center + extents, [&](uint32_t sortedIndex)
+    {
+        if (isOverlapped(querySphere, m_sortedObjects[sortedIndex]))
+            callback(m_sortedObjects[sortedIndex].index);
+    });
+}
+
+template <typename TCallback>
+inline
+void SpatialHashGrid::query (const AABB& aabb, TCallback&& callback) const
+{
+    Object queryBox;
+    queryBox.center         = aabb.getCenter();
+    queryBox.halfExtents    = Vec3f{aabb.getExtI(), aabb.getExtJ(), aabb.getExtK()};
+    queryBox.radius         = -1.f;
+
+    forEachCandidate(aabb.getMin(), aabb.getMax(), [&](uint32_t sortedIndex)
+    {
+        if (isOverlapped(queryBox, m_sortedObjects[sortedIndex]))
+            callback(m_sortedObjects[sortedIndex].index);
+    });
+}
+
+template <typename TCallback>
+inline
+void SpatialHashGrid::forEachPair (TCallback&& callback) const
+{
+    assert(m_isBuilt);
+
+    if (2.f * m_maxHalfExtent <= m_cellSize)
+    {
+        /*Overlapping objects are in the same cell or in neighbor cells : only the cell of the object and the 13 cells
+        of the forward half of its neighborhood are visited, so each pair of cells is visited once*/
+        constexpr int forwardNeighbors [13][3] = {{1, 0, 0},
+                                                  {-1, 1, 0}, {0, 1, 0}, {1, 1, 0},
+                                                  {-1, -1, 1}, {0, -1, 1}, {1, -1, 1},
+                                                  {-1, 0, 1}, {0, 0, 1}, {1, 0, 1},
+                                                  {-1, 1, 1}, {0, 1, 1}, {1, 1, 1}};
+
+        for (uint32_t sortedIndexA = 0; sortedIndexA < m_sortedObjects.size(); ++sortedIndexA)
+        {
+            const Object& objectA = m_sortedObjects[sortedIndexA];
+
+            /*Same cell : the objects of the cell are in the bucket of A*/
+            const uint32_t bucketA = getBucket(objectA.cell[0], objectA.cell[1], objectA.cell[2]);
+            for (uint32_t sortedIndexB = sortedIndexA + 1; sortedIndexB < m_bucketStarts[bucketA + 1]; ++sortedIndexB)
+            {
+                const Object& objectB = m_sortedObjects[sortedIndexB];
+                if (objectB.cell[0] == objectA.cell[0] && objectB.cell[1] == objectA.cell[1] && objectB.cell[2] == objectA.cell[2] && isOverlapped(objectA, objectB))
+                    callback(std::min(objectA.index, objectB.index), std::max(objectA.index, objectB.index));
+            }
+
+            for (const int (&offset)[3] : forwardNeighbors)
+            {
+                const int x = objectA.cell[0] + offset[0];
+                const int y = objectA.cell[1] + offset[1];
+                const int z = objectA.cell[2] + offset[2];
+                const uint32_t bucket = getBucket(x, y, z);
+                const uint32_t end = m_bucketStarts[bucket + 1];
+
+                for (uint32_t sortedIndexB = m_bucketStarts[bucket]; sortedIndexB < end; ++sortedIndexB)
+                {
+                    const Object& objectB = m_sortedObjects[sortedIndexB];
+                    if (objectB.cell[0] == x && objectB.cell[1] == y && objectB.cell[2] == z && isOverlapped(objectA, objectB))
+                        callback(std::min(objectA.index, objectB.index), std::max(objectA.index, objectB.index));
+                }
+            }
+        }
+        return;
+    }
+
+    for (uint32_t sortedIndexA = 0; sortedIndexA < m_sortedObjects.size(); ++sortedIndexA)
+    {
+        const Object& objectA = m_sortedObjects[sortedIndexA];
+
+        forEachCandidate(objectA.center - objectA.halfExtents, objectA.center + objectA.halfExtents, [&](uint32_t sortedIndexB)
+        {
+            /*The pair is reported by the object with the lower sorted index*/
+            if (sortedIndexB <= sortedIndexA)
+                return;
+
+            const Object& objectB = m_sortedObjects[sortedIndexB];
+            if (isOverlapped(objectA, objectB))
+                callback(std::min(objectA.index, objectB.index), std::max(objectA.index, objectB.index));
+        });
+    }
+}
+
+template <typename TCallback>
+inline
+void SpatialHashGrid::queryOrientedBox (const OrientedBox& box, TCallback&& callback) const
+{
+    const AABB boxAABB = box.getAABB();
+
+    Object queryBox;
+    queryBox.center         = boxAABB.getCenter();
+    queryBox.halfExtents    = Vec3f{boxAABB.getExtI(), boxAABB.getExtJ(), boxAABB.getExtK()};
+    queryBox.radius         = -1.f;
+
+    forEachCandidate(boxAABB.getMin(), boxAABB.getMax(), [&](uint32_t sortedIndex)
+    {
+        const Object& object = m_sortedObjects[sortedIndex];
+        Intersection intersection;
+
+        if (object.radius >= 0.f)
+        {
+            if (SphereOrientedBox::isSphereOrientedBoxCollided(Sphere(object.radius, object.center), box, intersection))
+                callback(object.index, intersection);
+        }
+        else if (isOverlapped(queryBox, object))
+        {
+            /*AABB of the box is only the broad phase : AABB is an oriented box with the global axis for the SAT*/
+            Referentialf referential;
+            referential.origin = object.center;
+
+            if (OrientedBoxOrientedBox::isBothOrientedBoxCollided(box, OrientedBox(referential, object.halfExtents.getX(), object.halfExtents.getY(), object.halfExtents.getZ())))
+            {
+                intersection.setUnKnowIntersection();
+                callback(object.index, intersection);
+            }
+        }
+    });
+}
+
+template <typename TCallback>
+inline
+void SpatialHashGrid::queryPlane (const Plane& plane, TCallback&& callback) const
+{
+    const Vec3f& normal = plane.getNormal();
+
+    for (const Object& object : m_objects)
+    {
+        /*Radius of the AABB projected on the normal : the corner the most behind the plane is tested*/
+        const float radius = object.radius >= 0.f ? object.radius : std::abs(normal.getX()) * object.halfExtents.getX()
+                                                                  + std::abs(normal.getY()) * object.halfExtents.getY()
+                                                                  + std::abs(normal.getZ()) * object.halfExtents.getZ();
+
+        if (SpherePlane::isSphereOnOrForwardPlanCollided(Sphere(radius, object.center), plane))
+            callback(object.index);
+    }
+}
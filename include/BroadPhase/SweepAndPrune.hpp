@@ -0,0 +1,251 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 16 h 05
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <vector> //std::vector
+#include <unordered_set> //std::unordered_set
+#include <algorithm> //std::sort, std::remove_if, std::min, std::max
+#include <stdint.h> //uint32_t, uint64_t
+#include <assert.h> //assert
+
+#include "Vector/Vector3.hpp"
+#include "Shape3D/AABB.hpp"
+#include "ShapeRelation/Intersection.hpp"
+#include "ShapeRelation/AabbAabb.hpp"
+
+namespace FoxMath
+{
+    /**
+     * @brief Sweep and prune broad phase. The min/max endpoints of the AABB are kept sorted on the axes and update sort them again
+     * with an insertion sort : with coherent motion each endpoint only swap with its few neighbors.
+     * With one axis, pairs are found by a sweep on the sorted axis. With three axis, the swaps of min and max endpoints
+     * add and remove pairs of a persistent pair set, so forEachPair cost is only the number of pairs.
+     * @note Call update (or rebuild) after insert/remove/setAABB and before reading the pairs
+     * 
+     * @tparam TAxisCount : 1 or 3
+     */
+    template <size_t TAxisCount = 1>
+    class SweepAndPrune
+    {
+        static_assert(TAxisCount == 1 || TAxisCount == 3, "Sweep and prune use one or three axis");
+
+        public:
+
+        #pragma region static attribut
+
+        static constexpr int nullProxy = -1;
+
+        #pragma endregion //!static attribut
+
+        protected:
+
+        struct Proxy
+        {
+            AABB    aabb;
+            Vec3f   min;
+            Vec3f   max;
+            size_t  userData;
+
+            /*Next free proxy in the free list or nullProxy when used*/
+            int     nextFree;
+            bool    isUsed;
+        };
+
+        struct Endpoint
+        {
+            float       value;
+            uint32_t    data; /*proxyId << 1 | isMax*/
+
+            uint32_t    getProxyId  () const noexcept { return data >> 1; }
+            bool        isMax       () const noexcept { return data & 1u; }
+
+            /*At equal value, min are before max so touching boxes overlap*/
+            bool operator<(const Endpoint& other) const noexcept
+            {
+                return value < other.value || (value == other.value && (data & 1u) < (other.data & 1u));
+            }
+        };
+
+        #pragma region attribut
+
+        std::vector<Proxy>                          m_proxies;
+        std::vector<Endpoint>                       m_endpoints [TAxisCount];
+        std::unordered_set<uint64_t>                m_pairs;        /*Three axis only : key = min proxyId << 32 | max proxyId*/
+        mutable std::vector<int>                    m_activeProxies;/*Single axis sweep scratch*/
+        mutable std::vector<int>                    m_activePositions;
+
+        size_t                                      m_sweepAxis;    /*Axis of endpoints[0] with single axis*/
+        int                                         m_freeList  {nullProxy};
+        size_t                                      m_proxyCount{0};
+
+        #pragma endregion //!attribut
+
+        #pragma region methods
+
+        /**
+         * @brief Read the new bounds of the proxies in the endpoints
+         * 
+         */
+        inline void refreshEndpoints    () noexcept;
+
+        /**
+         * @brief Insertion sort of the axis. With three axis, each swap of a min with a max endpoint add or remove a pair
+         * 
+         * @param axisIndex : index in m_endpoints
+         */
+        inline void insertionSort       (size_t axisIndex);
+
+        [[nodiscard]] inline
+        size_t      getWorldAxis        (size_t axisIndex) const noexcept { return TAxisCount == 1 ? m_sweepAxis : axisIndex; }
+
+        [[nodiscard]] inline
+        bool        isOverlapped        (uint32_t proxyIdA, uint32_t proxyIdB) const noexcept;
+
+        #pragma endregion //!methods
+
+        #pragma region static methods
+
+        [[nodiscard]] static inline
+        uint64_t    getPairKey          (uint32_t proxyIdA, uint32_t proxyIdB) noexcept;
+
+        #pragma endregion //!static methods
+
+        public:
+
+        #pragma region constructor/destructor
+
+        /**
+         * @brief Construct a new Sweep And Prune object
+         * 
+         * @param sweepAxis : sorted axis with single axis (0 : x, 1 : y, 2 : z). Ignored with three axis
+         */
+        explicit inline
+        SweepAndPrune (size_t sweepAxis = 0) noexcept;
+
+        SweepAndPrune (const SweepAndPrune& other)              = default;
+        SweepAndPrune (SweepAndPrune&& other) noexcept          = default;
+        ~SweepAndPrune ()                                       = default;
+        SweepAndPrune& operator=(SweepAndPrune const& other)    = default;
+        SweepAndPrune& operator=(SweepAndPrune && other)        = default;
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Add the AABB and return its proxy id
+         * 
+         * @param aabb 
+         * @param userData 
+         * @return int 
+         */
+        inline int  insert      (const AABB& aabb, size_t userData = 0);
+
+        /**
+         * @brief Remove the proxy with its endpoints and its pairs. O(n)
+         * 
+         * @param proxyId 
+         */
+        inline void remove      (int proxyId);
+
+        /**
+         * @brief Incremental update : read the AABB of the proxies and sort the endpoints with an insertion sort.
+         * Cost is O(n + swaps) so it is cheap when the objects move a little frame to frame
+         * 
+         */
+        inline void update      ();
+
+        /**
+         * @brief Full rebuild : read the AABB of the proxies and sort the endpoints with std::sort (and recompute the pair set with three axis).
+         * Cost is O(n log(n)) whatever the motion. Use it after teleportation of many objects
+         * 
+         */
+        inline void rebuild     ();
+
+        /**
+         * @brief Choose the axis with the greatest variance of the centers and rebuild. Single axis only
+         * 
+         */
+        inline void chooseSweepAxis ();
+
+        /**
+         * @brief Call callback(proxyIdA, proxyIdB) with proxyIdA < proxyIdB for each pair of overlapping AABB. Each pair is reported once
+         * 
+         * @tparam TCallback : void(int proxyIdA, int proxyIdB)
+         * @param callback 
+         */
+        template <typename TCallback>
+        inline void forEachPair (TCallback&& callback) const;
+
+        /**
+         * @brief Call callback(proxyIdA, proxyIdB, intersection) for each overlapping pair with the intersection of AabbAabb::isBothAABBCollided
+         * 
+         * @tparam TCallback : void(int proxyIdA, int proxyIdB, const Intersection& intersection)
+         * @param callback 
+         */
+        template <typename TCallback>
+        inline void forEachCollision (TCallback&& callback) const;
+
+        #pragma endregion //!methods
+
+        #pragma region accessor
+
+        [[nodiscard]] inline const AABB&   getAABB         (int proxyId) const noexcept { return m_proxies[proxyId].aabb; }
+        [[nodiscard]] inline size_t        getUserData     (int proxyId) const noexcept { return m_proxies[proxyId].userData; }
+        [[nodiscard]] inline size_t        getProxyCount   () const noexcept { return m_proxyCount; }
+        [[nodiscard]] inline size_t        getSweepAxis    () const noexcept { return m_sweepAxis; }
+
+        /**
+         * @brief Number of pairs of the persistent pair set. Three axis only
+         * 
+         * @return size_t 
+         */
+        [[nodiscard]] inline size_t        getPairCount    () const noexcept { return m_pairs.size(); }
+
+        #pragma endregion //!accessor
+
+        #pragma region mutator
+
+        /**
+         * @brief Set the new AABB of the proxy. Endpoints are sorted by the next update
+         * 
+         * @param proxyId 
+         * @param aabb 
+         */
+        inline void setAABB     (int proxyId, const AABB& aabb) noexcept;
+
+        inline void setUserData (int proxyId, size_t userData) noexcept { m_proxies[proxyId].userData = userData; }
+
+        #pragma endregion //!mutator
+    };
+
+    #include "SweepAndPrune.inl"
+
+} /*namespace FoxMath*/
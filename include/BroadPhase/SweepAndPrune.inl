@@ -0,0 +1,345 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 16 h 05
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <size_t TAxisCount>
+inline
+SweepAndPrune<TAxisCount>::SweepAndPrune (size_t sweepAxis) noexcept
+    :   m_sweepAxis {sweepAxis}
+{
+    assert(sweepAxis < 3);
+}
+
+template <size_t TAxisCount>
+inline
+uint64_t SweepAndPrune<TAxisCount>::getPairKey (uint32_t proxyIdA, uint32_t proxyIdB) noexcept
+{
+    return (static_cast<uint64_t>(std::min(proxyIdA, proxyIdB)) << 32) | static_cast<uint64_t>(std::max(proxyIdA, proxyIdB));
+}
+
+template <size_t TAxisCount>
+inline
+bool SweepAndPrune<TAxisCount>::isOverlapped (uint32_t proxyIdA, uint32_t proxyIdB) const noexcept
+{
+    const Proxy& proxyA = m_proxies[proxyIdA];
+    const Proxy& proxyB = m_proxies[proxyIdB];
+
+    return  proxyA.min.getX() <= proxyB.max.getX() && proxyB.min.getX() <= proxyA.max.getX() &&
+            proxyA.min.getY() <= proxyB.max.getY() && proxyB.min.getY() <= proxyA.max.getY() &&
+            proxyA.min.getZ() <= proxyB.max.getZ() && proxyB.min.getZ() <= proxyA.max.getZ();
+}
+
+template <size_t TAxisCount>
+inline
+void SweepAndPrune<TAxisCount>::refreshEndpoints () noexcept
+{
+    for (size_t axisIndex = 0; axisIndex < TAxisCount; ++axisIndex)
+    {
+        const size_t axis = getWorldAxis(axisIndex);
+
+        for (Endpoint& endpoint : m_endpoints[axisIndex])
+        {
+            const Proxy& proxy = m_proxies[endpoint.getProxyId()];
+            endpoint.value = endpoint.isMax() ? proxy.max[axis] : proxy.min[axis];
+        }
+    }
+}
+
+template <size_t TAxisCount>
+inline
+void SweepAndPrune<TAxisCount>::insertionSort (size_t axisIndex)
+{
+    std::vector<Endpoint>& endpoints = m_endpoints[axisIndex];
+
+    for (size_t i = 1; i < endpoints.size(); ++i)
+    {
+        const Endpoint endpoint = endpoints[i];
+        size_t j = i;
+
+        while (j > 0 && endpoint < endpoints[j - 1])
+        {
+            const Endpoint& previous = endpoints[j - 1];
+
+            if constexpr (TAxisCount == 3)
+            {
+                if (endpoint.isMax() != previous.isMax() && endpoint.getProxyId() != previous.getProxyId())
+                {
+                    if (endpoint.isMax())
+                    {
+                        /*Max go before a min : the proxies stop overlapping on this axis*/
+                        m_pairs.erase(getPairKey(endpoint.getProxyId(), previous.getProxyId()));
+                    }
+                    else if (isOverlapped(endpoint.getProxyId(), previous.getProxyId()))
+                    {
+                        /*Min go before a max : the proxies start overlapping on this axis and may overlap on the others*/
+                        m_pairs.insert(getPairKey(endpoint.getProxyId(), previous.getProxyId()));
+                    }
+                }
+            }
+
+            endpoints[j] = previous;
+            --j;
+        }
+
+        endpoints[j] = endpoint;
+    }
+}
+
+template <size_t TAxisCount>
+inline
+int SweepAndPrune<TAxisCount>::insert (const AABB& aabb, size_t userData)
+{
+    int proxyId;
+
+    if (m_freeList == nullProxy)
+    {
+        proxyId = static_cast<int>(m_proxies.size());
+        m_proxies.emplace_back();
+    }
+    else
+    {
+        proxyId = m_freeList;
+        m_freeList = m_proxies[proxyId].nextFree;
+    }
+
+    Proxy& proxy    = m_proxies[proxyId];
+    proxy.userData  = userData;
+    proxy.nextFree  = nullProxy;
+    proxy.isUsed    = true;
+    setAABB(proxyId, aabb);
+
+    /*Endpoints are pushed at the end and find their place (and their pairs) during the next update*/
+    for (size_t axisIndex = 0; axisIndex < TAxisCount; ++axisIndex)
+    {
+        const size_t axis = getWorldAxis(axisIndex);
+        m_endpoints[axisIndex].push_back(Endpoint{proxy.min[axis], static_cast<uint32_t>(proxyId) << 1});
+        m_endpoints[axisIndex].push_back(Endpoint{proxy.max[axis], (static_cast<uint32_t>(proxyId) << 1) | 1u});
+    }
+
+    ++m_proxyCount;
+    return proxyId;
+}
+
+template <size_t TAxisCount>
+inline
+void SweepAndPrune<TAxisCount>::remove (int proxyId)
+{
+    assert(proxyId >= 0 && static_cast<size_t>(proxyId) < m_proxies.size() && m_proxies[proxyId].isUsed);
+
+    const uint32_t id = static_cast<uint32_t>(proxyId);
+
+    for (std::vector<Endpoint>& endpoints : m_endpoints)
+    {
+        endpoints.erase(std::remove_if(endpoints.begin(), endpoints.end(), [id](const Endpoint& endpoint) { return endpoint.getProxyId() == id; }), endpoints.end());
+    }
+
+    if constexpr (TAxisCount == 3)
+    {
+        for (auto it = m_pairs.begin(); it != m_pairs.end();)
+        {
+            if ((*it >> 32) == id || (*it & 0xFFFFFFFFu) == id)
+                it = m_pairs.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    m_proxies[proxyId].isUsed   = false;
+    m_proxies[proxyId].nextFree = m_freeList;
+    m_freeList = proxyId;
+    --m_proxyCount;
+}
+
+template <size_t TAxisCount>
+inline
+void SweepAndPrune<TAxisCount>::setAABB (int proxyId, const AABB& aabb) noexcept
+{
+    Proxy& proxy = m_proxies[proxyId];
+    proxy.aabb  = aabb;
+    proxy.min   = aabb.getMin();
+    proxy.max   = aabb.getMax();
+}
+
+template <size_t TAxisCount>
+inline
+void SweepAndPrune<TAxisCount>::update ()
+{
+    /*All the axis must be refreshed before the sort : the pair test of a swap use the final bounds of the proxies*/
+    refreshEndpoints();
+
+    for (size_t axisIndex = 0; axisIndex < TAxisCount; ++axisIndex)
+    {
+        insertionSort(axisIndex);
+    }
+}
+
+template <size_t TAxisCount>
+inline
+void SweepAndPrune<TAxisCount>::rebuild ()
+{
+    refreshEndpoints();
+
+    for (std::vector<Endpoint>& endpoints : m_endpoints)
+    {
+        std::sort(endpoints.begin(), endpoints.end());
+    }
+
+    if constexpr (TAxisCount == 3)
+    {
+        m_pairs.clear();
+
+        /*Sweep on the first axis. Sorted endpoints is also the state the insertion sort maintains*/
+        std::vector<int>& active = m_activeProxies;
+        active.clear();
+        m_activePositions.resize(m_proxies.size());
+
+        for (const Endpoint& endpoint : m_endpoints[0])
+        {
+            const int proxyId = static_cast<int>(endpoint.getProxyId());
+
+            if (endpoint.isMax())
+            {
+                const int position = m_activePositions[proxyId];
+                active[position] = active.back();
+                m_activePositions[active[position]] = position;
+                active.pop_back();
+            }
+            else
+            {
+                for (const int other : active)
+                {
+                    if (isOverlapped(proxyId, other))
+                        m_pairs.insert(getPairKey(proxyId, other));
+                }
+
+                m_activePositions[proxyId] = static_cast<int>(active.size());
+                active.push_back(proxyId);
+            }
+        }
+    }
+}
+
+template <size_t TAxisCount>
+inline
+void SweepAndPrune<TAxisCount>::chooseSweepAxis ()
+{
+    static_assert(TAxisCount == 1, "Sweep axis is only used by single axis sweep and prune");
+
+    float sum [3]       = {0.f, 0.f, 0.f};
+    float squareSum [3] = {0.f, 0.f, 0.f};
+
+    for (const Proxy& proxy : m_proxies)
+    {
+        if (!proxy.isUsed)
+            continue;
+
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+            const float center = (proxy.min[axis] + proxy.max[axis]) * 0.5f;
+            sum[axis]       += center;
+            squareSum[axis] += center * center;
+        }
+    }
+
+    /*n * variance = sum(x²) - sum(x)² / n*/
+    const float count = static_cast<float>(std::max<size_t>(m_proxyCount, 1));
+    float bestVariance = -1.f;
+
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        const float variance = squareSum[axis] - sum[axis] * sum[axis] / count;
+
+        if (variance > bestVariance)
+        {
+            bestVariance = variance;
+            m_sweepAxis = axis;
+        }
+    }
+
+    rebuild();
+}
+
+template <size_t TAxisCount>
+template <typename TCallback>
+inline
+void SweepAndPrune<TAxisCount>::forEachPair (TCallback&& callback) const
+{
+    if constexpr (TAxisCount == 3)
+    {
+        for (const uint64_t key : m_pairs)
+        {
+            callback(static_cast<int>(key >> 32), static_cast<int>(key & 0xFFFFFFFFu));
+        }
+    }
+    else
+    {
+        /*Sweep : each min endpoint is tested with the proxies opened before it on the axis*/
+        std::vector<int>& active = m_activeProxies;
+        active.clear();
+        m_activePositions.resize(m_proxies.size());
+
+        for (const Endpoint& endpoint : m_endpoints[0])
+        {
+            const int proxyId = static_cast<int>(endpoint.getProxyId());
+
+            if (endpoint.isMax())
+            {
+                const int position = m_activePositions[proxyId];
+                active[position] = active.back();
+                m_activePositions[active[position]] = position;
+                active.pop_back();
+            }
+            else
+            {
+                for (const int other : active)
+                {
+                    if (isOverlapped(proxyId, other))
+                        callback(std::min(proxyId, other), std::max(proxyId, other));
+                }
+
+                m_activePositions[proxyId] = static_cast<int>(active.size());
+                active.push_back(proxyId);
+            }
+        }
+    }
+}
+
+template <size_t TAxisCount>
+template <typename TCallback>
+inline
+void SweepAndPrune<TAxisCount>::forEachCollision (TCallback&& callback) const
+{
+    forEachPair([&](int proxyIdA, int proxyIdB)
+    {
+        Intersection intersection;
+        if (AabbAabb::isBothAABBCollided(m_proxies[proxyIdA].aabb, m_proxies[proxyIdB].aabb, intersection))
+            callback(proxyIdA, proxyIdB, intersection);
+    });
+}
@@ -0,0 +1,65 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 13 h 05
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+namespace FoxMath
+{
+    /*How a vector is transformed by a matrix in batch transform API*/
+    enum class ETransformMode
+    {
+        Point,              //w = 1, translation is applied
+        Direction,          //w = 0, translation is ignored
+        Homogeneous,        //w is read from the vector and written back
+        PointHomogenized    //w = 1, then the result is divided by its w (perspective divide, like GenericVector::homogenize)
+    };
+
+    [[nodiscard]] constexpr inline
+    const char* transformModeToString (ETransformMode transformMode) noexcept
+    {
+        switch (transformMode)
+        {
+        case ETransformMode::Point:
+            return "Point";
+
+        case ETransformMode::Direction:
+            return "Direction";
+
+        case ETransformMode::Homogeneous:
+            return "Homogeneous";
+
+        case ETransformMode::PointHomogenized:
+            return "Point homogenized";
+        
+        default:
+            return "Unknow";
+        }
+    }
+
+} /*namespace FoxMath*/
@@ -34,6 +34,7 @@
 #include "Vector/GenericVector.hpp" //GenericVector
 #include "Types/Implicit.hpp" //implicit
 #include "Numeric/Limits.hpp" //isSameAsZero
+#include "Matrix/MatrixMultiplication.hpp" //multiplyRowMajor
 
 #include <iostream> //ostream, istream
 #include <array> //std::array
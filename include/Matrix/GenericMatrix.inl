@@ -717,24 +717,15 @@ inline constexpr
 GenericMatrix<TRowSize, TColumnSizeOther, TType, TMatrixConvention> operator*(const GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention>& lhs, const GenericMatrix<TRowSizeOther, TColumnSizeOther, TType, TMatrixConvention>& rhs) noexcept
 {
     GenericMatrix<TRowSize, TColumnSizeOther, TType, TMatrixConvention> mRst;
-    mRst.fill(0);
 
-    for ( size_t i = 0; i < mRst.numberOfInternalVector() ; i++ )
+    if constexpr (TMatrixConvention == EMatrixConvention::ColumnMajor)
     {
-        for ( size_t j = 0; j < mRst.vectorLength(); j++ )
-        {
-            for ( size_t index = 0; index < TRowSizeOther; index++)
-            {
-                if constexpr (TMatrixConvention == EMatrixConvention::ColumnMajor)
-                {
-                    mRst.getData(i, j) += lhs.getData(index, j) * rhs.getData(i, index);
-                }
-                else
-                {
-                    mRst.getData(i, j) += lhs.getData(i, index) * rhs.getData(index, j);         
-                }
-            }
-        }
+        //column major storage is the row major storage of the transposed matrix : (AB)ᵀ = BᵀAᵀ
+        multiplyRowMajor<TColumnSizeOther, TRowSizeOther, TRowSize>(rhs[0], lhs[0], mRst[0]);
+    }
+    else
+    {
+        multiplyRowMajor<TRowSize, TColumnSize, TColumnSizeOther>(lhs[0], rhs[0], mRst[0]);
     }
 
     return mRst;
@@ -30,6 +30,7 @@
 #pragma once
 
 #include "Matrix/SquareMatrix.hpp"
+#include "Vector/Vector2.hpp"
 #include "Vector/Vector3.hpp"
 #include "Macro/CrossInheritanceCompatibility.hpp"
 #include "Matrix/EMatrixConvention.hpp" //EMatrixConvention
@@ -52,6 +53,55 @@ namespace FoxMath
         #pragma endregion //! static attribut
 
         #pragma region methods
+
+        /**
+         * @brief return the index in data of the element at row/column of the mathematical matrix (same order than the scalar constructor)
+         * 
+         * @param row 
+         * @param column 
+         * @return constexpr size_t 
+         */
+        [[nodiscard]] static constexpr inline
+        size_t getElementIndex (size_t row, size_t column) noexcept
+        {
+            if constexpr (TMatrixConvention == EMatrixConvention::ColumnMajor)
+            {
+                return column * 3 + row;
+            }
+            else
+            {
+                return row * 3 + column;
+            }
+        }
+
+        /**
+         * @brief out[i] = M * (in[i], w) for count 2D vectors. Matrix is hoisted before the loop, in and out can be the same array
+         * 
+         * @param in 
+         * @param out 
+         * @param count 
+         * @param w : 1 for point, 0 for direction
+         */
+        constexpr inline
+        void transformBulk (const Vec2<TType>* in, Vec2<TType>* out, size_t count, TType w) const noexcept
+        {
+            const TType a00 = Parent::getData(getElementIndex(0, 0));
+            const TType a01 = Parent::getData(getElementIndex(0, 1));
+            const TType a02 = Parent::getData(getElementIndex(0, 2)) * w;
+            const TType a10 = Parent::getData(getElementIndex(1, 0));
+            const TType a11 = Parent::getData(getElementIndex(1, 1));
+            const TType a12 = Parent::getData(getElementIndex(1, 2)) * w;
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                const TType x = in[i][0];
+                const TType y = in[i][1];
+
+                out[i].setData(0, a00 * x + a01 * y + a02);
+                out[i].setData(1, a10 * x + a11 * y + a12);
+            }
+        }
+
         #pragma endregion //!methods
 
         public:
@@ -81,6 +131,68 @@ namespace FoxMath
         #pragma endregion //!constructor/destructor
 
         #pragma region methods
+
+        /**
+         * @brief out[i] = M * (in[i], 1) for count 2D points. Translation (last column) is applied
+         * @note in and out can be the same array
+         * 
+         * @param in 
+         * @param out 
+         * @param count 
+         */
+        constexpr inline
+        void transformPoints (const Vec2<TType>* in, Vec2<TType>* out, size_t count) const noexcept
+        {
+            transformBulk(in, out, count, static_cast<TType>(1));
+        }
+
+        /**
+         * @brief out[i] = M * (in[i], 0) for count 2D directions. Translation is ignored
+         * @note in and out can be the same array
+         * 
+         * @param in 
+         * @param out 
+         * @param count 
+         */
+        constexpr inline
+        void transformDirections (const Vec2<TType>* in, Vec2<TType>* out, size_t count) const noexcept
+        {
+            transformBulk(in, out, count, static_cast<TType>(0));
+        }
+
+        /**
+         * @brief out[i] = M * in[i] for count 3D vectors (or homogeneous 2D vectors)
+         * @note in and out can be the same array
+         * 
+         * @param in 
+         * @param out 
+         * @param count 
+         */
+        constexpr inline
+        void transformHomogeneous (const Vec3<TType>* in, Vec3<TType>* out, size_t count) const noexcept
+        {
+            const TType a00 = Parent::getData(getElementIndex(0, 0));
+            const TType a01 = Parent::getData(getElementIndex(0, 1));
+            const TType a02 = Parent::getData(getElementIndex(0, 2));
+            const TType a10 = Parent::getData(getElementIndex(1, 0));
+            const TType a11 = Parent::getData(getElementIndex(1, 1));
+            const TType a12 = Parent::getData(getElementIndex(1, 2));
+            const TType a20 = Parent::getData(getElementIndex(2, 0));
+            const TType a21 = Parent::getData(getElementIndex(2, 1));
+            const TType a22 = Parent::getData(getElementIndex(2, 2));
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                const TType x = in[i][0];
+                const TType y = in[i][1];
+                const TType z = in[i][2];
+
+                out[i].setData(0, a00 * x + a01 * y + a02 * z);
+                out[i].setData(1, a10 * x + a11 * y + a12 * z);
+                out[i].setData(2, a20 * x + a21 * y + a22 * z);
+            }
+        }
+
         #pragma endregion //!methods
 
         #pragma region static metods
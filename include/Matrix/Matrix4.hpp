@@ -31,8 +31,16 @@
 
 #include "Matrix/SquareMatrix.hpp"
 #include "Vector/Vector3.hpp"
+#include "Vector/Vector4.hpp"
+#include "Matrix/ETransformMode.hpp" //ETransformMode
 #include "Macro/CrossInheritanceCompatibility.hpp"
 #include "Angle/Angle.hpp"
+#include "Numeric/Limits.hpp" //isSameAsZero, isSame
+#include "Numeric/ConstexprMath.hpp" //Numeric::tan
+#include "Numeric/PrecisionMath.hpp" //EPrecision, Numeric::sinCos<EPrecision>
+
+#include <cassert> //assert
+#include <algorithm> //std::min
 
 namespace FoxMath
 {
@@ -49,6 +57,128 @@ namespace FoxMath
         #pragma endregion //!attribut
 
         #pragma region methods
+
+        /**
+         * @brief return the index in data of the element at row/column of the mathematical matrix (same order than the scalar constructor)
+         * 
+         * @param row 
+         * @param column 
+         * @return constexpr size_t 
+         */
+        [[nodiscard]] static constexpr inline
+        size_t getElementIndex (size_t row, size_t column) noexcept
+        {
+            if constexpr (TMatrixConvention == EMatrixConvention::ColumnMajor)
+            {
+                return column * 4 + row;
+            }
+            else
+            {
+                return row * 4 + column;
+            }
+        }
+
+        /**
+         * @brief out[i] = M * in[i] for count vectors. Matrix is hoisted in register before the loop and all components of a vector are read before
+         * it is written, so in and out can be the same array
+         * @note Float matrix with FOXMATH_USE_SIMD use SSE and process 4 vectors per iteration
+         * 
+         * @tparam TMode : how the 4th component is handled
+         * @tparam TVectorIn : Vec3 or Vec4
+         * @tparam TVectorOut : Vec3 or Vec4
+         * @param in 
+         * @param out 
+         * @param count 
+         */
+        template <ETransformMode TMode, typename TVectorIn, typename TVectorOut>
+        constexpr inline
+        void transformBulk (const TVectorIn* in, TVectorOut* out, size_t count) const noexcept
+        {
+#ifdef FOXMATH_SIMD_SSE
+            if constexpr (std::is_same_v<TType, float> && std::is_same_v<TVectorIn, TVectorOut>)
+            {
+                if (!FOXMATH_IS_CONSTANT_EVALUATED())
+                {
+                    float columns[16] {};
+                    for (size_t column = 0; column < 4; ++column)
+                    {
+                        for (size_t row = 0; row < 4; ++row)
+                        {
+                            columns[column * 4 + row] = Parent::getData(getElementIndex(row, column));
+                        }
+                    }
+
+                    /*GenericVector storage is its only member : vector address is the address of its first component*/
+                    SIMD::transformBulk<TMode, sizeof(TVectorIn) / sizeof(float)>(columns, reinterpret_cast<const float*>(in), reinterpret_cast<float*>(out), count);
+                    return;
+                }
+            }
+#endif
+
+            const TType zero    {static_cast<TType>(0)};
+            const TType one     {static_cast<TType>(1)};
+
+            const TType a00 = Parent::getData(getElementIndex(0, 0));
+            const TType a01 = Parent::getData(getElementIndex(0, 1));
+            const TType a02 = Parent::getData(getElementIndex(0, 2));
+            const TType a03 = Parent::getData(getElementIndex(0, 3));
+            const TType a10 = Parent::getData(getElementIndex(1, 0));
+            const TType a11 = Parent::getData(getElementIndex(1, 1));
+            const TType a12 = Parent::getData(getElementIndex(1, 2));
+            const TType a13 = Parent::getData(getElementIndex(1, 3));
+            const TType a20 = Parent::getData(getElementIndex(2, 0));
+            const TType a21 = Parent::getData(getElementIndex(2, 1));
+            const TType a22 = Parent::getData(getElementIndex(2, 2));
+            const TType a23 = Parent::getData(getElementIndex(2, 3));
+            const TType a30 = Parent::getData(getElementIndex(3, 0));
+            const TType a31 = Parent::getData(getElementIndex(3, 1));
+            const TType a32 = Parent::getData(getElementIndex(3, 2));
+            const TType a33 = Parent::getData(getElementIndex(3, 3));
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                const TType x = in[i][0];
+                const TType y = in[i][1];
+                const TType z = in[i][2];
+                TType       w = zero;
+
+                if constexpr (TMode == ETransformMode::Point || TMode == ETransformMode::PointHomogenized)
+                {
+                    w = one;
+                }
+                else if constexpr (TMode == ETransformMode::Homogeneous)
+                {
+                    w = in[i][3];
+                }
+
+                TType rstX = a00 * x + a01 * y + a02 * z + a03 * w;
+                TType rstY = a10 * x + a11 * y + a12 * z + a13 * w;
+                TType rstZ = a20 * x + a21 * y + a22 * z + a23 * w;
+                TType rstW = a30 * x + a31 * y + a32 * z + a33 * w;
+
+                if constexpr (TMode == ETransformMode::PointHomogenized)
+                {
+                    /*Same behaviour than GenericVector::homogenize*/
+                    if (rstW != zero)
+                    {
+                        rstX /= rstW;
+                        rstY /= rstW;
+                        rstZ /= rstW;
+                        rstW = one;
+                    }
+                }
+
+                out[i].setData(0, rstX);
+                out[i].setData(1, rstY);
+                out[i].setData(2, rstZ);
+
+                if constexpr (TMode == ETransformMode::Homogeneous)
+                {
+                    out[i].setData(3, rstW);
+                }
+            }
+        }
+
         #pragma endregion //!methods
 
         public:
@@ -78,6 +208,178 @@ namespace FoxMath
         #pragma endregion //!constructor/destructor
 
         #pragma region methods
+
+        /**
+         * @brief return true if the last row is 0 0 0 1. Matrix is a transformation [M|t] like created by createTRSMatrix or createLookAtView
+         * 
+         * @return true 
+         * @return false 
+         */
+        [[nodiscard]] constexpr inline
+        bool isAffine () const noexcept
+        {
+            return  isSameAsZero<TType>(Parent::getData(getElementIndex(3, 0))) &&
+                    isSameAsZero<TType>(Parent::getData(getElementIndex(3, 1))) &&
+                    isSameAsZero<TType>(Parent::getData(getElementIndex(3, 2))) &&
+                    isSame<TType>(Parent::getData(getElementIndex(3, 3)), static_cast<TType>(1));
+        }
+
+        /**
+         * @brief Reverse affine matrix [M|t] with M⁻¹ and -M⁻¹t. Faster than getReverse for transformation matrix (TRS, view...)
+         * @note Last row must be 0 0 0 1 (checked by assert). Float matrix use SSE with FOXMATH_USE_SIMD
+         * 
+         * @return constexpr Matrix4 : empty matrix if M is not reversible
+         */
+        [[nodiscard]] constexpr inline
+        Matrix4 getAffineInverse () const noexcept
+        {
+            assert(isAffine());
+
+#ifdef FOXMATH_SIMD_SSE
+            if constexpr (std::is_same_v<TType, float>)
+            {
+                if (!FOXMATH_IS_CONSTANT_EVALUATED())
+                {
+                    Matrix4 rst;
+                    if (isSameAsZero<TType>(SIMD::inverseAffineMat4<TMatrixConvention == EMatrixConvention::ColumnMajor>(Parent::m_data.data(), &rst.getData(0))))
+                        return Parent::zero();
+
+                    return rst;
+                }
+            }
+#endif
+
+            const TType a00 = Parent::getData(getElementIndex(0, 0));
+            const TType a01 = Parent::getData(getElementIndex(0, 1));
+            const TType a02 = Parent::getData(getElementIndex(0, 2));
+            const TType a10 = Parent::getData(getElementIndex(1, 0));
+            const TType a11 = Parent::getData(getElementIndex(1, 1));
+            const TType a12 = Parent::getData(getElementIndex(1, 2));
+            const TType a20 = Parent::getData(getElementIndex(2, 0));
+            const TType a21 = Parent::getData(getElementIndex(2, 1));
+            const TType a22 = Parent::getData(getElementIndex(2, 2));
+            const TType tx  = Parent::getData(getElementIndex(0, 3));
+            const TType ty  = Parent::getData(getElementIndex(1, 3));
+            const TType tz  = Parent::getData(getElementIndex(2, 3));
+
+            const TType c00 = a11 * a22 - a12 * a21;
+            const TType c01 = a12 * a20 - a10 * a22;
+            const TType c02 = a10 * a21 - a11 * a20;
+
+            const TType determinant = a00 * c00 + a01 * c01 + a02 * c02;
+
+            if (isSameAsZero<TType>(determinant))
+                return Parent::zero();
+
+            const TType zero    {static_cast<TType>(0)};
+            const TType one     {static_cast<TType>(1)};
+            const TType invDet  {one / determinant};
+
+            const TType i00 = c00 * invDet;
+            const TType i01 = (a02 * a21 - a01 * a22) * invDet;
+            const TType i02 = (a01 * a12 - a02 * a11) * invDet;
+            const TType i10 = c01 * invDet;
+            const TType i11 = (a00 * a22 - a02 * a20) * invDet;
+            const TType i12 = (a02 * a10 - a00 * a12) * invDet;
+            const TType i20 = c02 * invDet;
+            const TType i21 = (a01 * a20 - a00 * a21) * invDet;
+            const TType i22 = (a00 * a11 - a01 * a10) * invDet;
+
+            return Matrix4( i00,    i01,    i02,    -(i00 * tx + i01 * ty + i02 * tz),
+                            i10,    i11,    i12,    -(i10 * tx + i11 * ty + i12 * tz),
+                            i20,    i21,    i22,    -(i20 * tx + i21 * ty + i22 * tz),
+                            zero,   zero,   zero,   one);
+        }
+
+        /**
+         * @brief Reverse rigid matrix [R|t] (rotation and translation only) with Rᵀ and -Rᵀt.
+         * @note Last row must be 0 0 0 1 (checked by assert) and R must be orthonormal (no scale). Use getAffineInverse with scale
+         * 
+         * @return constexpr Matrix4 
+         */
+        [[nodiscard]] constexpr inline
+        Matrix4 getRigidInverse () const noexcept
+        {
+            assert(isAffine());
+
+            const TType a00 = Parent::getData(getElementIndex(0, 0));
+            const TType a01 = Parent::getData(getElementIndex(0, 1));
+            const TType a02 = Parent::getData(getElementIndex(0, 2));
+            const TType a10 = Parent::getData(getElementIndex(1, 0));
+            const TType a11 = Parent::getData(getElementIndex(1, 1));
+            const TType a12 = Parent::getData(getElementIndex(1, 2));
+            const TType a20 = Parent::getData(getElementIndex(2, 0));
+            const TType a21 = Parent::getData(getElementIndex(2, 1));
+            const TType a22 = Parent::getData(getElementIndex(2, 2));
+            const TType tx  = Parent::getData(getElementIndex(0, 3));
+            const TType ty  = Parent::getData(getElementIndex(1, 3));
+            const TType tz  = Parent::getData(getElementIndex(2, 3));
+
+            const TType zero    {static_cast<TType>(0)};
+            const TType one     {static_cast<TType>(1)};
+
+            return Matrix4( a00,    a10,    a20,    -(a00 * tx + a10 * ty + a20 * tz),
+                            a01,    a11,    a21,    -(a01 * tx + a11 * ty + a21 * tz),
+                            a02,    a12,    a22,    -(a02 * tx + a12 * ty + a22 * tz),
+                            zero,   zero,   zero,   one);
+        }
+
+        /**
+         * @brief out[i] = M * (in[i], 1) for count points. Translation is applied, w is not used (use transformPointsHomogenized with projection matrix)
+         * @note in and out can be the same array. Float matrix use SSE with FOXMATH_USE_SIMD
+         * 
+         * @param in 
+         * @param out 
+         * @param count 
+         */
+        constexpr inline
+        void transformPoints (const Vec3<TType>* in, Vec3<TType>* out, size_t count) const noexcept
+        {
+            transformBulk<ETransformMode::Point>(in, out, count);
+        }
+
+        /**
+         * @brief out[i] = M * (in[i], 0) for count directions. Translation is ignored
+         * @note in and out can be the same array. Float matrix use SSE with FOXMATH_USE_SIMD
+         * 
+         * @param in 
+         * @param out 
+         * @param count 
+         */
+        constexpr inline
+        void transformDirections (const Vec3<TType>* in, Vec3<TType>* out, size_t count) const noexcept
+        {
+            transformBulk<ETransformMode::Direction>(in, out, count);
+        }
+
+        /**
+         * @brief out[i] = M * in[i] for count homogeneous vectors
+         * @note in and out can be the same array. Float matrix use SSE
+         * 
+         * @param in 
+         * @param out 
+         * @param count 
+         */
+        constexpr inline
+        void transformHomogeneous (const Vec4<TType>* in, Vec4<TType>* out, size_t count) const noexcept
+        {
+            transformBulk<ETransformMode::Homogeneous>(in, out, count);
+        }
+
+        /**
+         * @brief out[i] = M * (in[i], 1) divided by its w (perspective divide) for count points. Result is not divided if w is null like GenericVector::homogenize
+         * @note in and out can be the same array. Float matrix use SSE with FOXMATH_USE_SIMD
+         * 
+         * @param in 
+         * @param out 
+         * @param count 
+         */
+        constexpr inline
+        void transformPointsHomogenized (const Vec3<TType>* in, Vec3<TType>* out, size_t count) const noexcept
+        {
+            transformBulk<ETransformMode::PointHomogenized>(in, out, count);
+        }
+
         #pragma endregion //!methods
 
         #pragma region static methods
@@ -155,7 +457,7 @@ namespace FoxMath
             const TType one     {static_cast<TType>(1)};
             const TType two     {static_cast<TType>(2)};
 
-            const TType scale = std::tan(static_cast<TType>(fov) / two) * near;
+            const TType scale = Numeric::tan(static_cast<TType>(fov) / two) * near;
             const TType rigth = aspect * scale;
 
             const TType left   = -rigth;
@@ -199,14 +501,18 @@ namespace FoxMath
         /**
          * @brief Create rotation on X axis only
          * 
+         * @tparam TPrecision : precision of the fused sin and cos (see Numeric::sinCos)
          * @param rotRadz 
          * @return constexpr Matrix4 
          */
+        template <EPrecision TPrecision = defaultPrecision>
         [[nodiscard]] static constexpr inline 
         Matrix4 createXRotationMatrix		(Angle<EAngleType::Radian, TType> rotRadx) //rot of axis Y to axis Z arround X
         {
-            const TType cosT = std::cos(static_cast<TType>(rotRadx));
-            const TType sinT = std::sin(static_cast<TType>(rotRadx));
+            TType sinT {};
+            TType cosT {};
+            Numeric::sinCos<TPrecision>(static_cast<TType>(rotRadx), sinT, cosT);
+
             const TType zero  = static_cast<TType>(0);
             const TType one  = static_cast<TType>(1);
 
@@ -219,14 +525,18 @@ namespace FoxMath
         /**
          * @brief Create rotation on Y axis only
          * 
+         * @tparam TPrecision : precision of the fused sin and cos (see Numeric::sinCos)
          * @param rotRadz 
          * @return constexpr Matrix4 
          */
+        template <EPrecision TPrecision = defaultPrecision>
         [[nodiscard]] static constexpr inline 
         Matrix4 createYRotationMatrix		(Angle<EAngleType::Radian, TType> rotRady) //rot of axis Z to axis X arround Y
         {
-            const TType cosT = std::cos(static_cast<TType>(rotRady));
-            const TType sinT = std::sin(static_cast<TType>(rotRady));
+            TType sinT {};
+            TType cosT {};
+            Numeric::sinCos<TPrecision>(static_cast<TType>(rotRady), sinT, cosT);
+
             const TType zero  = static_cast<TType>(0);
             const TType one  = static_cast<TType>(1);
 
@@ -239,14 +549,18 @@ namespace FoxMath
         /**
          * @brief Create rotation on Z axis only
          * 
+         * @tparam TPrecision : precision of the fused sin and cos (see Numeric::sinCos)
          * @param rotRadz 
          * @return constexpr Matrix4 
          */
+        template <EPrecision TPrecision = defaultPrecision>
         [[nodiscard]] static constexpr inline 
         Matrix4 createZRotationMatrix		(Angle<EAngleType::Radian, TType> rotRadz) //rot of axis X to axis Y arround Z
         {
-            const TType cosT = std::cos(static_cast<TType>(rotRadz));
-            const TType sinT = std::sin(static_cast<TType>(rotRadz));
+            TType sinT {};
+            TType cosT {};
+            Numeric::sinCos<TPrecision>(static_cast<TType>(rotRadz), sinT, cosT);
+
             const TType zero  = static_cast<TType>(0);
             const TType one  = static_cast<TType>(1);
 
@@ -259,18 +573,25 @@ namespace FoxMath
         /**
          * @brief Create a Fixed Angle Euler Rotation Matrix object
          * 
+         * @tparam TPrecision : precision of the sin and cos of the 3 angles, evaluated in one pass (see GenericVector::getSinCos)
          * @param rVec 
          * @return constexpr Matrix4 
          */
+        template <EPrecision TPrecision = defaultPrecision>
         [[nodiscard]] static constexpr inline //TODO: Transform (space an right and and left hand referential!)
         Matrix4 createFixedAngleEulerRotationMatrix	(const Vec3<TType>& rVec)
         {
-            const TType cosTX = std::cos(static_cast<TType>(rVec.getX()));
-            const TType sinTX = std::sin(static_cast<TType>(rVec.getX()));
-            const TType cosTY = std::cos(static_cast<TType>(rVec.getY()));
-            const TType sinTY = std::sin(static_cast<TType>(rVec.getY()));
-            const TType cosTZ = std::cos(static_cast<TType>(rVec.getZ()));
-            const TType sinTZ = std::sin(static_cast<TType>(rVec.getZ()));
+            /*Sin and cos of the 3 angles in one pass*/
+            Vec3<TType> sinT;
+            Vec3<TType> cosT;
+            rVec.template getSinCos<TPrecision>(sinT, cosT);
+
+            const TType cosTX = cosT.getX();
+            const TType sinTX = sinT.getX();
+            const TType cosTY = cosT.getY();
+            const TType sinTY = sinT.getY();
+            const TType cosTZ = cosT.getZ();
+            const TType sinTZ = sinT.getZ();
             const TType zero  = static_cast<TType>(0);
             const TType one  = static_cast<TType>(1);
 
@@ -291,26 +612,85 @@ namespace FoxMath
                             zero, zero, zero, one};
         }
 
+        /**
+         * @brief Create count Fixed Angle Euler Rotation Matrix : out[i] = createFixedAngleEulerRotationMatrix(rotations[i]).
+         * Angles are gathered by block in one array and their sin and cos are evaluated with one Numeric::sinCos on arrays (SIMD for float with Fast and Approximate)
+         * 
+         * @tparam TPrecision : see Numeric::sinCos
+         * @param rotations : count Euler angles in radian
+         * @param out 
+         * @param count 
+         */
+        template <EPrecision TPrecision = defaultPrecision>
+        static inline
+        void createFixedAngleEulerRotationMatrix	(const Vec3<TType>* rotations, Matrix4* out, size_t count) noexcept
+        {
+            constexpr size_t blockSize = 64;
+
+            /*Structure of arrays : n x, then n y, then n z*/
+            TType angles    [3 * blockSize];
+            TType sinAngles [3 * blockSize];
+            TType cosAngles [3 * blockSize];
+
+            for (size_t blockStart = 0; blockStart < count; blockStart += blockSize)
+            {
+                const size_t n = std::min(blockSize, count - blockStart);
+
+                for (size_t i = 0; i < n; i++)
+                {
+                    angles[i]                   = rotations[blockStart + i].getX();
+                    angles[n + i]               = rotations[blockStart + i].getY();
+                    angles[2 * n + i]           = rotations[blockStart + i].getZ();
+                }
+
+                Numeric::sinCos<TPrecision>(angles, sinAngles, cosAngles, 3 * n);
+
+                for (size_t i = 0; i < n; i++)
+                {
+                    const TType cosTX = cosAngles[i];
+                    const TType sinTX = sinAngles[i];
+                    const TType cosTY = cosAngles[n + i];
+                    const TType sinTY = sinAngles[n + i];
+                    const TType cosTZ = cosAngles[2 * n + i];
+                    const TType sinTZ = sinAngles[2 * n + i];
+                    const TType zero  = static_cast<TType>(0);
+                    const TType one  = static_cast<TType>(1);
+
+                    /*Same as createFixedAngleEulerRotationMatrix*/
+                    out[blockStart + i] = Matrix4{  cosTY * cosTZ,  -cosTX * sinTZ + sinTX * sinTY * cosTZ,     sinTX * sinTZ + cosTX * sinTY * cosTZ,  zero,
+                                                    cosTY * sinTZ,  cosTX * cosTZ + sinTX * sinTY * sinTZ,      -sinTX * cosTZ + cosTX * sinTY * sinTZ, zero,
+                                                    -sinTY,         sinTX * cosTY,                              cosTX * cosTY,                          zero,
+                                                    zero,           zero,                                       zero,                                   one};
+                }
+            }
+        }
+
         /**
          * @brief Create TRS matrix based on translation/rotation/Scale step. This matrix is differente than SRT
          * 
+         * @tparam TPrecision : precision of the sin and cos of the 3 angles, evaluated in one pass (see GenericVector::getSinCos)
          * @param translVec 
          * @param rotVec 
          * @param scaleVec 
          * @return constexpr Matrix4 
          */
+        template <EPrecision TPrecision = defaultPrecision>
         [[nodiscard]] static constexpr inline
         Matrix4 createTRSMatrix(const Vec3<TType>& translVec, const Vec3<TType>& rotVec, const Vec3<TType>& scaleVec)
         {
             if constexpr (TMatrixConvention == EMatrixConvention::ColumnMajor)
             {
-                const TType cosTX = std::cos(static_cast<TType>(rotVec.getX()));
-                const TType cosTY = std::cos(static_cast<TType>(rotVec.getY()));
-                const TType cosTZ = std::cos(static_cast<TType>(rotVec.getZ()));
+                Vec3<TType> sinT;
+                Vec3<TType> cosT;
+                rotVec.template getSinCos<TPrecision>(sinT, cosT);
+
+                const TType cosTX = cosT.getX();
+                const TType cosTY = cosT.getY();
+                const TType cosTZ = cosT.getZ();
 
-                const TType sinTX = std::sin(static_cast<TType>(rotVec.getX()));
-                const TType sinTY = std::sin(static_cast<TType>(rotVec.getY()));
-                const TType sinTZ = std::sin(static_cast<TType>(rotVec.getZ()));
+                const TType sinTX = sinT.getX();
+                const TType sinTY = sinT.getY();
+                const TType sinTZ = sinT.getZ();
 
                 const TType zero  = static_cast<TType>(0);
                 const TType one  = static_cast<TType>(1);
@@ -336,13 +716,17 @@ namespace FoxMath
             }
             else
             {
-                const TType cosTX = std::cos(static_cast<TType>(rotVec.getX()));
-                const TType cosTY = std::cos(static_cast<TType>(rotVec.getY()));
-                const TType cosTZ = std::cos(static_cast<TType>(rotVec.getZ()));
+                Vec3<TType> sinT;
+                Vec3<TType> cosT;
+                rotVec.template getSinCos<TPrecision>(sinT, cosT);
 
-                const TType sinTX = std::sin(static_cast<TType>(rotVec.getX()));
-                const TType sinTY = std::sin(static_cast<TType>(rotVec.getY()));
-                const TType sinTZ = std::sin(static_cast<TType>(rotVec.getZ()));
+                const TType cosTX = cosT.getX();
+                const TType cosTY = cosT.getY();
+                const TType cosTZ = cosT.getZ();
+
+                const TType sinTX = sinT.getX();
+                const TType sinTY = sinT.getY();
+                const TType sinTZ = sinT.getZ();
 
                 const TType zero  = static_cast<TType>(0);
                 const TType one  = static_cast<TType>(1);
@@ -364,18 +748,23 @@ namespace FoxMath
             }
         }
 
+        template <EPrecision TPrecision = defaultPrecision>
         [[nodiscard]] static constexpr inline
         Matrix4 createSRTMatrix(const Vec3<TType>& scaleVec, const Vec3<TType>& rotVec, const Vec3<TType>& translVec)
         {
             if constexpr (TMatrixConvention == EMatrixConvention::ColumnMajor)
             {
-                const TType cosTX = std::cos(static_cast<TType>(rotVec.getX()));
-                const TType cosTY = std::cos(static_cast<TType>(rotVec.getY()));
-                const TType cosTZ = std::cos(static_cast<TType>(rotVec.getZ()));
+                Vec3<TType> sinT;
+                Vec3<TType> cosT;
+                rotVec.template getSinCos<TPrecision>(sinT, cosT);
+
+                const TType cosTX = cosT.getX();
+                const TType cosTY = cosT.getY();
+                const TType cosTZ = cosT.getZ();
 
-                const TType sinTX = std::sin(static_cast<TType>(rotVec.getX()));
-                const TType sinTY = std::sin(static_cast<TType>(rotVec.getY()));
-                const TType sinTZ = std::sin(static_cast<TType>(rotVec.getZ()));
+                const TType sinTX = sinT.getX();
+                const TType sinTY = sinT.getY();
+                const TType sinTZ = sinT.getZ();
 
                 const TType zero  = static_cast<TType>(0);
                 const TType one  = static_cast<TType>(1);
@@ -397,13 +786,17 @@ namespace FoxMath
             }
             else
             {
-                const TType cosTX = std::cos(static_cast<TType>(rotVec.getX()));
-                const TType cosTY = std::cos(static_cast<TType>(rotVec.getY()));
-                const TType cosTZ = std::cos(static_cast<TType>(rotVec.getZ()));
+                Vec3<TType> sinT;
+                Vec3<TType> cosT;
+                rotVec.template getSinCos<TPrecision>(sinT, cosT);
+
+                const TType cosTX = cosT.getX();
+                const TType cosTY = cosT.getY();
+                const TType cosTZ = cosT.getZ();
 
-                const TType sinTX = std::sin(static_cast<TType>(rotVec.getX()));
-                const TType sinTY = std::sin(static_cast<TType>(rotVec.getY()));
-                const TType sinTZ = std::sin(static_cast<TType>(rotVec.getZ()));
+                const TType sinTX = sinT.getX();
+                const TType sinTY = sinT.getY();
+                const TType sinTZ = sinT.getZ();
 
                 const TType zero  = static_cast<TType>(0);
                 const TType one  = static_cast<TType>(1);
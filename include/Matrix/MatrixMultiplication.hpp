@@ -0,0 +1,143 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 11 h 47
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "SIMD/SIMD.hpp" //SIMD::mulMat4, FOXMATH_IS_CONSTANT_EVALUATED
+
+#include <stddef.h> //sizt_t
+#include <type_traits> //std::is_same_v
+
+namespace FoxMath
+{
+    /**
+     * @brief dst = lhs * rhs on contiguous row major storage : dst[i][j] = sum of lhs[i][k] * rhs[k][j].
+     * Column major matrix use it with swapped operands because its storage is the row major storage of the transposed matrix : (AB)ᵀ = BᵀAᵀ.
+     * 
+     * @note With FOXMATH_USE_SIMD, float matrix with at least 4 columns use SSE kernels : fully unrolled 4x4 (SIMD::mulMat4) or register blocked for other sizes (SIMD::mulMat).
+     * Else the product is a dot product per element with direct index (the compiler unroll it for small matrix)
+     * 
+     * @tparam TRowSize : number of row of lhs and dst
+     * @tparam TSharedSize : number of column of lhs and number of row of rhs
+     * @tparam TColumnSize : number of column of rhs and dst
+     * @tparam TType 
+     * @param lhs 
+     * @param rhs 
+     * @param dst : must not overlap lhs or rhs
+     */
+    template <size_t TRowSize, size_t TSharedSize, size_t TColumnSize, typename TType>
+    inline constexpr
+    void multiplyRowMajor (const TType* lhs, const TType* rhs, TType* dst) noexcept
+    {
+#ifdef FOXMATH_SIMD_SSE
+        if constexpr (std::is_same_v<TType, float> && TColumnSize >= 4) //narrow matrix stay on the scalar path
+        {
+            if (!FOXMATH_IS_CONSTANT_EVALUATED())
+            {
+                if constexpr (TRowSize == 4 && TSharedSize == 4 && TColumnSize == 4)
+                {
+                    SIMD::mulMat4(lhs, rhs, dst);
+                }
+                else
+                {
+                    SIMD::mulMat(lhs, rhs, dst, TRowSize, TSharedSize, TColumnSize);
+                }
+                return;
+            }
+        }
+#endif
+        for (size_t i = 0; i < TRowSize; i++)
+        {
+            for (size_t j = 0; j < TColumnSize; j++)
+            {
+                TType acc {static_cast<TType>(0)};
+
+                for (size_t k = 0; k < TSharedSize; k++)
+                {
+                    acc += lhs[i * TSharedSize + k] * rhs[k * TColumnSize + j];
+                }
+
+                dst[i * TColumnSize + j] = acc;
+            }
+        }
+    }
+
+    /**
+     * @brief dst = lhs * transpose(rhsTransposed) on contiguous row major storage : dst[i][j] = sum of lhs[i][k] * rhsTransposed[j][k].
+     * Used for the product by a transposed matrix read in place (the rows of rhsTransposed are the columns of rhs)
+     * 
+     * @note With FOXMATH_USE_SIMD, float matrix with a shared size of at least 4 use SSE kernels : 4x4 transposed in registers (SIMD::mulMat4Transposed)
+     * or dot products by 4 floats for other sizes (SIMD::mulMatTransposed)
+     * 
+     * @tparam TRowSize : number of row of lhs and dst
+     * @tparam TSharedSize : number of column of lhs and rhsTransposed
+     * @tparam TColumnSize : number of row of rhsTransposed and number of column of dst
+     * @tparam TType 
+     * @param lhs 
+     * @param rhsTransposed 
+     * @param dst : must not overlap lhs or rhsTransposed
+     */
+    template <size_t TRowSize, size_t TSharedSize, size_t TColumnSize, typename TType>
+    inline constexpr
+    void multiplyRowMajorTransposed (const TType* lhs, const TType* rhsTransposed, TType* dst) noexcept
+    {
+#ifdef FOXMATH_SIMD_SSE
+        if constexpr (std::is_same_v<TType, float> && TSharedSize >= 4)
+        {
+            if (!FOXMATH_IS_CONSTANT_EVALUATED())
+            {
+                if constexpr (TRowSize == 4 && TSharedSize == 4 && TColumnSize == 4)
+                {
+                    SIMD::mulMat4Transposed(lhs, rhsTransposed, dst);
+                }
+                else
+                {
+                    SIMD::mulMatTransposed(lhs, rhsTransposed, dst, TRowSize, TSharedSize, TColumnSize);
+                }
+                return;
+            }
+        }
+#endif
+        for (size_t i = 0; i < TRowSize; i++)
+        {
+            for (size_t j = 0; j < TColumnSize; j++)
+            {
+                TType acc {static_cast<TType>(0)};
+
+                for (size_t k = 0; k < TSharedSize; k++)
+                {
+                    acc += lhs[i * TSharedSize + k] * rhsTransposed[j * TSharedSize + k];
+                }
+
+                dst[i * TColumnSize + j] = acc;
+            }
+        }
+    }
+
+} /*namespace FoxMath*/
@@ -0,0 +1,324 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 02 h 40
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Matrix/GenericMatrix.hpp" //GenericMatrix
+#include "Matrix/EMatrixConvention.hpp" //EMatrixConvention
+#include "Matrix/MatrixMultiplication.hpp" //multiplyRowMajor
+
+#include <stddef.h> //sizt_t
+#include <type_traits> //std::enable_if_t, std::is_base_of_v, std::is_arithmetic_v
+#include <cassert> //assert
+
+/**
+ * Non owning views on the storage of a GenericMatrix (or a child class like Matrix4) : transposed, row, column, strided
+ * sub matrix and convention flipping views only keep a pointer on the first element, sizes and strides are known at compile time.
+ * The arithmetic operators accept views and matrices and only allocate the result.
+ * A view reference the matrix : never keep it after the end of the matrix lifetime.
+ * 
+ * @example `GenericMatrix<16, 16, float> rst = lhs * getTransposedView(rhs);`
+ */
+
+namespace FoxMath
+{
+    /**
+     * @brief Distance between two consecutive rows and between two consecutive columns in the storage of a GenericMatrix
+     */
+    template <size_t TRowSize, size_t TColumnSize, EMatrixConvention TMatrixConvention>
+    struct MatrixStorageStride
+    {
+        static constexpr size_t row     = TMatrixConvention == EMatrixConvention::RowMajor ? TColumnSize : 1;
+        static constexpr size_t column  = TMatrixConvention == EMatrixConvention::RowMajor ? 1 : TRowSize;
+    };
+
+    /**
+     * @brief Base of all matrix views (used to detect them)
+     */
+    struct MatrixViewTag {};
+
+    /**
+     * @brief Read only strided view of TRowSize x TColumnSize elements. Element (row, column) is data[row * TRowStride + column * TColumnStride]
+     * 
+     * @tparam TRowSize 
+     * @tparam TColumnSize 
+     * @tparam TRowStride : distance between two rows in the storage
+     * @tparam TColumnStride : distance between two columns in the storage
+     * @tparam TType 
+     * @tparam TMatrixConvention : convention of the matrices created from the view
+     */
+    template <size_t TRowSize, size_t TColumnSize, size_t TRowStride, size_t TColumnStride, typename TType, EMatrixConvention TMatrixConvention = EMatrixConvention::RowMajor>
+    class MatrixView : public MatrixViewTag
+    {
+        static_assert(TRowSize != 0 && TColumnSize != 0, "Matrix view size cannot be null");
+
+        protected:
+
+        #pragma region attribut
+
+        const TType* m_data;
+
+        #pragma endregion //!attribut
+
+        public:
+
+        using Type = TType;
+
+        static constexpr size_t rowStride       = TRowStride;
+        static constexpr size_t columnStride    = TColumnStride;
+
+        #pragma region constructor/destructor
+
+        /**
+         * @brief Construct a view on data. data must contain the element ((TRowSize - 1) * TRowStride + (TColumnSize - 1) * TColumnStride)
+         * 
+         * @param data : address of the element (0, 0)
+         */
+        explicit constexpr inline
+        MatrixView (const TType* data) noexcept
+            : m_data {data}
+        {}
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region accessor
+
+        [[nodiscard]] static inline constexpr
+        size_t              getRowSize          () noexcept { return TRowSize; }
+
+        [[nodiscard]] static inline constexpr
+        size_t              getColumnSize       () noexcept { return TColumnSize; }
+
+        [[nodiscard]] static inline constexpr
+        EMatrixConvention   getMatrixConvention () noexcept { return TMatrixConvention; }
+
+        /**
+         * @brief True if the view is the row major storage of a TRowSize x TColumnSize matrix (can be read with multiplyRowMajor)
+         */
+        [[nodiscard]] static inline constexpr
+        bool                isRowMajorContiguous    () noexcept { return (TColumnStride == 1 || TColumnSize == 1) && (TRowStride == TColumnSize || TRowSize == 1); }
+
+        /**
+         * @brief True if the view is the column major storage of a TRowSize x TColumnSize matrix
+         */
+        [[nodiscard]] static inline constexpr
+        bool                isColumnMajorContiguous () noexcept { return (TRowStride == 1 || TRowSize == 1) && (TColumnStride == TRowSize || TColumnSize == 1); }
+
+        [[nodiscard]] inline constexpr
+        const TType*        data                () const noexcept { return m_data; }
+
+        /**
+         * @brief Element at the row and the column of the view. No bound check
+         * 
+         * @param row 
+         * @param column 
+         * @return constexpr TType 
+         */
+        [[nodiscard]] inline constexpr
+        TType               getElement          (size_t row, size_t column) const noexcept { return m_data[row * TRowStride + column * TColumnStride]; }
+
+        #pragma endregion //!accessor
+
+        #pragma region methods
+
+        /**
+         * @brief Copy the view in a new matrix
+         * 
+         * @tparam TOtherMatrixConvention 
+         * @return constexpr GenericMatrix<TRowSize, TColumnSize, TType, TOtherMatrixConvention> 
+         */
+        template <EMatrixConvention TOtherMatrixConvention = TMatrixConvention>
+        [[nodiscard]] inline constexpr
+        GenericMatrix<TRowSize, TColumnSize, TType, TOtherMatrixConvention> toMatrix () const noexcept;
+
+        #pragma endregion //!methods
+    };
+
+    #pragma region alias
+
+    /**
+     * @brief View on the whole matrix
+     */
+    template <size_t TRowSize, size_t TColumnSize, typename TType, EMatrixConvention TMatrixConvention>
+    using GenericMatrixView     = MatrixView<   TRowSize, TColumnSize, 
+                                                MatrixStorageStride<TRowSize, TColumnSize, TMatrixConvention>::row, MatrixStorageStride<TRowSize, TColumnSize, TMatrixConvention>::column, 
+                                                TType, TMatrixConvention>;
+
+    /**
+     * @brief Transposed matrix without copy : rows and strides are swapped
+     */
+    template <size_t TRowSize, size_t TColumnSize, typename TType, EMatrixConvention TMatrixConvention>
+    using TransposedMatrixView  = MatrixView<   TColumnSize, TRowSize, 
+                                                MatrixStorageStride<TRowSize, TColumnSize, TMatrixConvention>::column, MatrixStorageStride<TRowSize, TColumnSize, TMatrixConvention>::row, 
+                                                TType, TMatrixConvention>;
+
+    /**
+     * @brief Storage of a row major matrix read as a column major matrix (and vice versa) : it is the transposed matrix in the other convention
+     */
+    template <size_t TRowSize, size_t TColumnSize, typename TType, EMatrixConvention TMatrixConvention>
+    using ConventionMatrixView  = MatrixView<   TColumnSize, TRowSize, 
+                                                MatrixStorageStride<TRowSize, TColumnSize, TMatrixConvention>::column, MatrixStorageStride<TRowSize, TColumnSize, TMatrixConvention>::row, 
+                                                TType, TMatrixConvention == EMatrixConvention::RowMajor ? EMatrixConvention::ColumnMajor : EMatrixConvention::RowMajor>;
+
+    template <size_t TRowSize, size_t TColumnSize, typename TType, EMatrixConvention TMatrixConvention>
+    using RowMatrixView         = MatrixView<   1, TColumnSize, 
+                                                MatrixStorageStride<TRowSize, TColumnSize, TMatrixConvention>::row, MatrixStorageStride<TRowSize, TColumnSize, TMatrixConvention>::column, 
+                                                TType, TMatrixConvention>;
+
+    template <size_t TRowSize, size_t TColumnSize, typename TType, EMatrixConvention TMatrixConvention>
+    using ColumnMatrixView      = MatrixView<   TRowSize, 1, 
+                                                MatrixStorageStride<TRowSize, TColumnSize, TMatrixConvention>::row, MatrixStorageStride<TRowSize, TColumnSize, TMatrixConvention>::column, 
+                                                TType, TMatrixConvention>;
+
+    #pragma endregion //!alias
+
+    #pragma region traits
+
+    template <typename T>
+    inline constexpr bool isMatrixView = std::is_base_of_v<MatrixViewTag, T>;
+
+    /**
+     * @brief True for GenericMatrix and its child classes (SquareMatrix, Matrix4...)
+     */
+    template <typename T>
+    struct IsGenericMatrixType
+    {
+        private:
+
+        template <size_t TRowSize, size_t TColumnSize, typename TType, EMatrixConvention TMatrixConvention>
+        static std::true_type   test (const GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention>*);
+        static std::false_type  test (...);
+
+        public:
+
+        static constexpr bool value = decltype(test(std::declval<const T*>()))::value;
+    };
+
+    /**
+     * @brief True if one operand is a view and the other one a view or a GenericMatrix
+     */
+    template <typename TLhs, typename TRhs>
+    inline constexpr bool isMatrixViewOperands =    (isMatrixView<TLhs> && (isMatrixView<TRhs> || IsGenericMatrixType<TRhs>::value)) ||
+                                                    (isMatrixView<TRhs> && IsGenericMatrixType<TLhs>::value);
+
+    #pragma endregion //!traits
+
+    #pragma region functions
+
+    template <size_t TRowSize, size_t TColumnSize, typename TType, EMatrixConvention TMatrixConvention>
+    [[nodiscard]] constexpr inline
+    GenericMatrixView<TRowSize, TColumnSize, TType, TMatrixConvention> getView (const GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention>& matrix) noexcept;
+
+    template <size_t TRowSize, size_t TColumnSize, typename TType, EMatrixConvention TMatrixConvention>
+    [[nodiscard]] constexpr inline
+    TransposedMatrixView<TRowSize, TColumnSize, TType, TMatrixConvention> getTransposedView (const GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention>& matrix) noexcept;
+
+    template <size_t TRowSize, size_t TColumnSize, size_t TRowStride, size_t TColumnStride, typename TType, EMatrixConvention TMatrixConvention>
+    [[nodiscard]] constexpr inline
+    MatrixView<TColumnSize, TRowSize, TColumnStride, TRowStride, TType, TMatrixConvention> getTransposedView (const MatrixView<TRowSize, TColumnSize, TRowStride, TColumnStride, TType, TMatrixConvention>& view) noexcept;
+
+    /**
+     * @brief Reinterpret the storage of matrix in the other convention. A row major matrix become its column major transposed
+     * and keep a contiguous storage : it can be used on the fast path of the product with column major matrices
+     */
+    template <size_t TRowSize, size_t TColumnSize, typename TType, EMatrixConvention TMatrixConvention>
+    [[nodiscard]] constexpr inline
+    ConventionMatrixView<TRowSize, TColumnSize, TType, TMatrixConvention> getConventionView (const GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention>& matrix) noexcept;
+
+    template <size_t TRowSize, size_t TColumnSize, typename TType, EMatrixConvention TMatrixConvention>
+    [[nodiscard]] constexpr inline
+    RowMatrixView<TRowSize, TColumnSize, TType, TMatrixConvention> getRowView (const GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention>& matrix, size_t row) noexcept;
+
+    template <size_t TRowSize, size_t TColumnSize, size_t TRowStride, size_t TColumnStride, typename TType, EMatrixConvention TMatrixConvention>
+    [[nodiscard]] constexpr inline
+    MatrixView<1, TColumnSize, TRowStride, TColumnStride, TType, TMatrixConvention> getRowView (const MatrixView<TRowSize, TColumnSize, TRowStride, TColumnStride, TType, TMatrixConvention>& view, size_t row) noexcept;
+
+    template <size_t TRowSize, size_t TColumnSize, typename TType, EMatrixConvention TMatrixConvention>
+    [[nodiscard]] constexpr inline
+    ColumnMatrixView<TRowSize, TColumnSize, TType, TMatrixConvention> getColumnView (const GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention>& matrix, size_t column) noexcept;
+
+    template <size_t TRowSize, size_t TColumnSize, size_t TRowStride, size_t TColumnStride, typename TType, EMatrixConvention TMatrixConvention>
+    [[nodiscard]] constexpr inline
+    MatrixView<TRowSize, 1, TRowStride, TColumnStride, TType, TMatrixConvention> getColumnView (const MatrixView<TRowSize, TColumnSize, TRowStride, TColumnStride, TType, TMatrixConvention>& view, size_t column) noexcept;
+
+    /**
+     * @brief Sub matrix of TSubRowSize x TSubColumnSize elements from (firstRow, firstColumn), taking one row every TRowStep and one column every TColumnStep
+     * 
+     * @tparam TSubRowSize 
+     * @tparam TSubColumnSize 
+     * @tparam TRowStep 
+     * @tparam TColumnStep 
+     * @param matrix 
+     * @param firstRow 
+     * @param firstColumn 
+     * @example `getSubMatrixView<3, 3>(mat4, 0, 0)` is the linear part of an affine transformation
+     */
+    template <size_t TSubRowSize, size_t TSubColumnSize, size_t TRowStep = 1, size_t TColumnStep = 1, size_t TRowSize, size_t TColumnSize, typename TType, EMatrixConvention TMatrixConvention>
+    [[nodiscard]] constexpr inline
+    auto getSubMatrixView (const GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention>& matrix, size_t firstRow, size_t firstColumn) noexcept;
+
+    template <size_t TSubRowSize, size_t TSubColumnSize, size_t TRowStep = 1, size_t TColumnStep = 1, size_t TRowSize, size_t TColumnSize, size_t TRowStride, size_t TColumnStride, typename TType, EMatrixConvention TMatrixConvention>
+    [[nodiscard]] constexpr inline
+    MatrixView<TSubRowSize, TSubColumnSize, TRowStride * TRowStep, TColumnStride * TColumnStep, TType, TMatrixConvention> getSubMatrixView (const MatrixView<TRowSize, TColumnSize, TRowStride, TColumnStride, TType, TMatrixConvention>& view, size_t firstRow, size_t firstColumn) noexcept;
+
+    #pragma endregion //!functions
+
+    #pragma region arithmetic operators
+
+    /*Result of the operators is a GenericMatrix in the convention of lhs*/
+
+    template <typename TLhs, typename TRhs, std::enable_if_t<isMatrixViewOperands<TLhs, TRhs>, bool> = true>
+    [[nodiscard]] constexpr inline
+    auto operator+ (const TLhs& lhs, const TRhs& rhs) noexcept;
+
+    template <typename TLhs, typename TRhs, std::enable_if_t<isMatrixViewOperands<TLhs, TRhs>, bool> = true>
+    [[nodiscard]] constexpr inline
+    auto operator- (const TLhs& lhs, const TRhs& rhs) noexcept;
+
+    /**
+     * @brief Matrix product. Contiguous operands in the convention of the result use multiplyRowMajor (SSE for float),
+     * strided operands are read in place without transposed copy
+     */
+    template <typename TLhs, typename TRhs, std::enable_if_t<isMatrixViewOperands<TLhs, TRhs>, bool> = true>
+    [[nodiscard]] constexpr inline
+    auto operator* (const TLhs& lhs, const TRhs& rhs) noexcept;
+
+    template <typename TView, typename TTypeScalar, std::enable_if_t<isMatrixView<TView> && std::is_arithmetic_v<TTypeScalar>, bool> = true>
+    [[nodiscard]] constexpr inline
+    auto operator* (const TView& view, TTypeScalar scalar) noexcept;
+
+    template <typename TView, typename TTypeScalar, std::enable_if_t<isMatrixView<TView> && std::is_arithmetic_v<TTypeScalar>, bool> = true>
+    [[nodiscard]] constexpr inline
+    auto operator* (TTypeScalar scalar, const TView& view) noexcept;
+
+    #pragma endregion //!arithmetic operators
+
+    #include "MatrixView.inl"
+
+} /*namespace FoxMath*/
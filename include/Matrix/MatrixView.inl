@@ -0,0 +1,289 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 02 h 40
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <size_t TRowSize, size_t TColumnSize, size_t TRowStride, size_t TColumnStride, typename TType, EMatrixConvention TMatrixConvention>
+template <EMatrixConvention TOtherMatrixConvention>
+inline constexpr
+GenericMatrix<TRowSize, TColumnSize, TType, TOtherMatrixConvention> MatrixView<TRowSize, TColumnSize, TRowStride, TColumnStride, TType, TMatrixConvention>::toMatrix () const noexcept
+{
+    GenericMatrix<TRowSize, TColumnSize, TType, TOtherMatrixConvention> rst;
+
+    for (size_t row = 0; row < TRowSize; row++)
+    {
+        for (size_t column = 0; column < TColumnSize; column++)
+        {
+            if constexpr (TOtherMatrixConvention == EMatrixConvention::RowMajor)
+                rst.getData(row * TColumnSize + column) = getElement(row, column);
+            else
+                rst.getData(column * TRowSize + row) = getElement(row, column);
+        }
+    }
+
+    return rst;
+}
+
+/**
+ * @brief Operand of the view operators : view is kept, GenericMatrix become a view on its whole storage
+ */
+template <typename TOperand>
+[[nodiscard]] constexpr inline
+auto toMatrixView (const TOperand& operand) noexcept
+{
+    if constexpr (isMatrixView<TOperand>)
+        return operand;
+    else
+        return getView(operand);
+}
+
+/**
+ * @brief Reference on the element (row, column) of a GenericMatrix following its convention
+ */
+template <size_t TRowSize, size_t TColumnSize, typename TType, EMatrixConvention TMatrixConvention>
+[[nodiscard]] constexpr inline
+TType& getMatrixElement (GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention>& matrix, size_t row, size_t column) noexcept
+{
+    return matrix.getData(row * MatrixStorageStride<TRowSize, TColumnSize, TMatrixConvention>::row + column * MatrixStorageStride<TRowSize, TColumnSize, TMatrixConvention>::column);
+}
+
+template <size_t TRowSize, size_t TColumnSize, typename TType, EMatrixConvention TMatrixConvention>
+inline constexpr
+GenericMatrixView<TRowSize, TColumnSize, TType, TMatrixConvention> getView (const GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention>& matrix) noexcept
+{
+    return GenericMatrixView<TRowSize, TColumnSize, TType, TMatrixConvention>(matrix[0]);
+}
+
+template <size_t TRowSize, size_t TColumnSize, typename TType, EMatrixConvention TMatrixConvention>
+inline constexpr
+TransposedMatrixView<TRowSize, TColumnSize, TType, TMatrixConvention> getTransposedView (const GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention>& matrix) noexcept
+{
+    return TransposedMatrixView<TRowSize, TColumnSize, TType, TMatrixConvention>(matrix[0]);
+}
+
+template <size_t TRowSize, size_t TColumnSize, size_t TRowStride, size_t TColumnStride, typename TType, EMatrixConvention TMatrixConvention>
+inline constexpr
+MatrixView<TColumnSize, TRowSize, TColumnStride, TRowStride, TType, TMatrixConvention> getTransposedView (const MatrixView<TRowSize, TColumnSize, TRowStride, TColumnStride, TType, TMatrixConvention>& view) noexcept
+{
+    return MatrixView<TColumnSize, TRowSize, TColumnStride, TRowStride, TType, TMatrixConvention>(view.data());
+}
+
+template <size_t TRowSize, size_t TColumnSize, typename TType, EMatrixConvention TMatrixConvention>
+inline constexpr
+ConventionMatrixView<TRowSize, TColumnSize, TType, TMatrixConvention> getConventionView (const GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention>& matrix) noexcept
+{
+    return ConventionMatrixView<TRowSize, TColumnSize, TType, TMatrixConvention>(matrix[0]);
+}
+
+template <size_t TRowSize, size_t TColumnSize, typename TType, EMatrixConvention TMatrixConvention>
+inline constexpr
+RowMatrixView<TRowSize, TColumnSize, TType, TMatrixConvention> getRowView (const GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention>& matrix, size_t row) noexcept
+{
+    assert(row < TRowSize);
+
+    return RowMatrixView<TRowSize, TColumnSize, TType, TMatrixConvention>(matrix[0] + row * MatrixStorageStride<TRowSize, TColumnSize, TMatrixConvention>::row);
+}
+
+template <size_t TRowSize, size_t TColumnSize, size_t TRowStride, size_t TColumnStride, typename TType, EMatrixConvention TMatrixConvention>
+inline constexpr
+MatrixView<1, TColumnSize, TRowStride, TColumnStride, TType, TMatrixConvention> getRowView (const MatrixView<TRowSize, TColumnSize, TRowStride, TColumnStride, TType, TMatrixConvention>& view, size_t row) noexcept
+{
+    assert(row < TRowSize);
+
+    return MatrixView<1, TColumnSize, TRowStride, TColumnStride, TType, TMatrixConvention>(view.data() + row * TRowStride);
+}
+
+template <size_t TRowSize, size_t TColumnSize, typename TType, EMatrixConvention TMatrixConvention>
+inline constexpr
+ColumnMatrixView<TRowSize, TColumnSize, TType, TMatrixConvention> getColumnView (const GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention>& matrix, size_t column) noexcept
+{
+    assert(column < TColumnSize);
+
+    return ColumnMatrixView<TRowSize, TColumnSize, TType, TMatrixConvention>(matrix[0] + column * MatrixStorageStride<TRowSize, TColumnSize, TMatrixConvention>::column);
+}
+
+template <size_t TRowSize, size_t TColumnSize, size_t TRowStride, size_t TColumnStride, typename TType, EMatrixConvention TMatrixConvention>
+inline constexpr
+MatrixView<TRowSize, 1, TRowStride, TColumnStride, TType, TMatrixConvention> getColumnView (const MatrixView<TRowSize, TColumnSize, TRowStride, TColumnStride, TType, TMatrixConvention>& view, size_t column) noexcept
+{
+    assert(column < TColumnSize);
+
+    return MatrixView<TRowSize, 1, TRowStride, TColumnStride, TType, TMatrixConvention>(view.data() + column * TColumnStride);
+}
+
+template <size_t TSubRowSize, size_t TSubColumnSize, size_t TRowStep, size_t TColumnStep, size_t TRowSize, size_t TColumnSize, typename TType, EMatrixConvention TMatrixConvention>
+inline constexpr
+auto getSubMatrixView (const GenericMatrix<TRowSize, TColumnSize, TType, TMatrixConvention>& matrix, size_t firstRow, size_t firstColumn) noexcept
+{
+    return getSubMatrixView<TSubRowSize, TSubColumnSize, TRowStep, TColumnStep>(getView(matrix), firstRow, firstColumn);
+}
+
+template <size_t TSubRowSize, size_t TSubColumnSize, size_t TRowStep, size_t TColumnStep, size_t TRowSize, size_t TColumnSize, size_t TRowStride, size_t TColumnStride, typename TType, EMatrixConvention TMatrixConvention>
+inline constexpr
+MatrixView<TSubRowSize, TSubColumnSize, TRowStride * TRowStep, TColumnStride * TColumnStep, TType, TMatrixConvention> getSubMatrixView (const MatrixView<TRowSize, TColumnSize, TRowStride, TColumnStride, TType, TMatrixConvention>& view, size_t firstRow, size_t firstColumn) noexcept
+{
+    static_assert(TRowStep != 0 && TColumnStep != 0, "Step cannot be null");
+    static_assert((TSubRowSize - 1) * TRowStep < TRowSize && (TSubColumnSize - 1) * TColumnStep < TColumnSize, "Sub matrix is bigger than the matrix");
+    assert(firstRow + (TSubRowSize - 1) * TRowStep < TRowSize && firstColumn + (TSubColumnSize - 1) * TColumnStep < TColumnSize);
+
+    return MatrixView<TSubRowSize, TSubColumnSize, TRowStride * TRowStep, TColumnStride * TColumnStep, TType, TMatrixConvention>(view.data() + firstRow * TRowStride + firstColumn * TColumnStride);
+}
+
+/**
+ * @brief rst(row, column) = operation(lhs(row, column), rhs(row, column)) in a new matrix in the convention of lhs
+ */
+template <typename TLhsView, typename TRhsView, typename TOperation>
+[[nodiscard]] constexpr inline
+auto applyMatrixViewElementWise (const TLhsView& lhs, const TRhsView& rhs, TOperation operation) noexcept
+{
+    static_assert(TLhsView::getRowSize() == TRhsView::getRowSize() && TLhsView::getColumnSize() == TRhsView::getColumnSize(), "Operands must have the same size");
+
+    GenericMatrix<TLhsView::getRowSize(), TLhsView::getColumnSize(), typename TLhsView::Type, TLhsView::getMatrixConvention()> rst;
+
+    for (size_t row = 0; row < TLhsView::getRowSize(); row++)
+    {
+        for (size_t column = 0; column < TLhsView::getColumnSize(); column++)
+        {
+            getMatrixElement(rst, row, column) = operation(lhs.getElement(row, column), static_cast<typename TLhsView::Type>(rhs.getElement(row, column)));
+        }
+    }
+
+    return rst;
+}
+
+template <typename TLhs, typename TRhs, std::enable_if_t<isMatrixViewOperands<TLhs, TRhs>, bool>>
+inline constexpr
+auto operator+ (const TLhs& lhs, const TRhs& rhs) noexcept
+{
+    using TType = typename decltype(toMatrixView(lhs))::Type;
+    return applyMatrixViewElementWise(toMatrixView(lhs), toMatrixView(rhs), [](TType lhsElement, TType rhsElement) constexpr { return lhsElement + rhsElement; });
+}
+
+template <typename TLhs, typename TRhs, std::enable_if_t<isMatrixViewOperands<TLhs, TRhs>, bool>>
+inline constexpr
+auto operator- (const TLhs& lhs, const TRhs& rhs) noexcept
+{
+    using TType = typename decltype(toMatrixView(lhs))::Type;
+    return applyMatrixViewElementWise(toMatrixView(lhs), toMatrixView(rhs), [](TType lhsElement, TType rhsElement) constexpr { return lhsElement - rhsElement; });
+}
+
+template <typename TLhs, typename TRhs, std::enable_if_t<isMatrixViewOperands<TLhs, TRhs>, bool>>
+inline constexpr
+auto operator* (const TLhs& lhs, const TRhs& rhs) noexcept
+{
+    const auto lhsView = toMatrixView(lhs);
+    const auto rhsView = toMatrixView(rhs);
+
+    using TLhsView = decltype(lhsView);
+    using TRhsView = decltype(rhsView);
+    using TType = typename TLhsView::Type;
+
+    constexpr size_t rowSize      = TLhsView::getRowSize();
+    constexpr size_t sharedSize   = TLhsView::getColumnSize();
+    constexpr size_t columnSize   = TRhsView::getColumnSize();
+    constexpr EMatrixConvention convention = TLhsView::getMatrixConvention();
+
+    static_assert(sharedSize == TRhsView::getRowSize(), "Column size of lhs must be equal to the row size of rhs");
+    static_assert(std::is_same_v<TType, typename TRhsView::Type>, "Operands must have the same type");
+
+    GenericMatrix<rowSize, columnSize, TType, convention> rst;
+
+    if constexpr (convention == EMatrixConvention::RowMajor && TLhsView::isRowMajorContiguous() && TRhsView::isRowMajorContiguous())
+    {
+        multiplyRowMajor<rowSize, sharedSize, columnSize>(lhsView.data(), rhsView.data(), rst[0]);
+    }
+    else if constexpr (convention == EMatrixConvention::ColumnMajor && TLhsView::isColumnMajorContiguous() && TRhsView::isColumnMajorContiguous())
+    {
+        //column major storage is the row major storage of the transposed matrix : (AB)ᵀ = BᵀAᵀ
+        multiplyRowMajor<columnSize, sharedSize, rowSize>(rhsView.data(), lhsView.data(), rst[0]);
+    }
+    else if constexpr (convention == EMatrixConvention::RowMajor && TLhsView::isRowMajorContiguous() && TRhsView::isColumnMajorContiguous())
+    {
+        //the columns of rhs are contiguous (transposed view of a row major matrix) : each element is the dot product of two contiguous rows
+        multiplyRowMajorTransposed<rowSize, sharedSize, columnSize>(lhsView.data(), rhsView.data(), rst[0]);
+    }
+    else if constexpr (convention == EMatrixConvention::ColumnMajor && TLhsView::isRowMajorContiguous() && TRhsView::isColumnMajorContiguous())
+    {
+        //(AB)ᵀ = BᵀAᵀ : rows of Bᵀ are the contiguous columns of rhs, columns of Aᵀ are the contiguous rows of lhs
+        multiplyRowMajorTransposed<columnSize, sharedSize, rowSize>(rhsView.data(), lhsView.data(), rst[0]);
+    }
+    else if constexpr (TRhsView::columnStride == 1)
+    {
+        //rows of rhs are contiguous : each row of the result accumulate the rows of rhs
+        rst.fill(static_cast<TType>(0));
+
+        for (size_t row = 0; row < rowSize; row++)
+        {
+            for (size_t shared = 0; shared < sharedSize; shared++)
+            {
+                const TType lhsElement = lhsView.getElement(row, shared);
+
+                for (size_t column = 0; column < columnSize; column++)
+                {
+                    getMatrixElement(rst, row, column) += lhsElement * rhsView.getElement(shared, column);
+                }
+            }
+        }
+    }
+    else
+    {
+        //each element is the dot product of a row of lhs and a column of rhs
+        for (size_t row = 0; row < rowSize; row++)
+        {
+            for (size_t column = 0; column < columnSize; column++)
+            {
+                TType sum = static_cast<TType>(0);
+
+                for (size_t shared = 0; shared < sharedSize; shared++)
+                {
+                    sum += lhsView.getElement(row, shared) * rhsView.getElement(shared, column);
+                }
+
+                getMatrixElement(rst, row, column) = sum;
+            }
+        }
+    }
+
+    return rst;
+}
+
+template <typename TView, typename TTypeScalar, std::enable_if_t<isMatrixView<TView> && std::is_arithmetic_v<TTypeScalar>, bool>>
+inline constexpr
+auto operator* (const TView& view, TTypeScalar scalar) noexcept
+{
+    auto rst = view.toMatrix();
+    return rst *= static_cast<typename TView::Type>(scalar);
+}
+
+template <typename TView, typename TTypeScalar, std::enable_if_t<isMatrixView<TView> && std::is_arithmetic_v<TTypeScalar>, bool>>
+inline constexpr
+auto operator* (TTypeScalar scalar, const TView& view) noexcept
+{
+    return view * scalar;
+}
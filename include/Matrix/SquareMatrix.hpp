@@ -35,6 +35,11 @@
 #include "Angle/Angle.hpp"
 #include "Macro/CrossInheritanceCompatibility.hpp"
 #include "Algorythm/Numeric.hpp" //powSigned
+#include "Numeric/PrecisionMath.hpp" //EPrecision, Numeric::sinCos<EPrecision>
+#include "SIMD/SIMD.hpp" //SIMD::inverseMat4
+
+#include <array> //std::array
+#include <type_traits> //std::conditional_t
 
 namespace FoxMath
 {
@@ -49,6 +54,10 @@ namespace FoxMath
         protected:
     
         #pragma region attribut
+
+        /*Integer matrix are decomposed in double to keep the pivot division exact enough*/
+        using LUType = std::conditional_t<std::is_floating_point_v<TType>, TType, double>;
+
         #pragma endregion //!attribut
     
         #pragma region static attribut
@@ -56,8 +65,43 @@ namespace FoxMath
     
         #pragma region methods
 
+        /**
+         * @brief LU decomposition with partial pivoting (Doolittle). Use for matrix bigger than 4x4 in O(n^3).
+         * L and U are stored in the same array, L diagonal (always 1) is not stored.
+         * 
+         * @param lu : output decomposition. lu[i * TSize + j] follow the same layout as the matrix data
+         * @param permutation : output row permutation. permutation[i] is the source row of the row i
+         * @return constexpr signed char : sign of the permutation (1 or -1) or 0 if the matrix is singular
+         */
+        [[nodiscard]] inline constexpr
+        signed char	decomposeLU		(std::array<LUType, TSize * TSize>& lu, std::array<size_t, TSize>& permutation) const noexcept;
+
+        /**
+         * @brief Compute the reverse matrix in rst. Closed form for size <= 4 (SSE for float 4x4), LU decomposition else.
+         * @note Inverse of transposed matrix is transposed inverse, so the computation is the same for the both conventions
+         * 
+         * @param rst : output, content is unspecified if the matrix is singular
+         * @return true if the matrix is reversible
+         */
+        [[nodiscard]] inline constexpr
+        bool		computeReverse	(SquareMatrix& rst) const noexcept;
+
+        /**
+         * @brief Closed form determinant of the TSubSize x TSubSize matrix (TSubSize <= 4) read in place with element(i, j).
+         * Used by getDeterminant and by getMinor to avoid the copy of the sub matrix
+         * 
+         * @tparam TSubSize 
+         * @tparam TElementAccessor : TType(size_t i, size_t j)
+         * @param element 
+         * @return constexpr TType 
+         */
+        template <size_t TSubSize, typename TElementAccessor>
+        [[nodiscard]] static inline constexpr
+        TType		computeClosedFormDeterminant	(TElementAccessor element) noexcept;
+
         /**
          * @brief return the determinant of minor element in function of M aij.
+         * @note Sub matrix up to 4x4 is read in place, bigger one is copied for the LU decomposition
          * 
          * @param i : start to 0 just to n - 1 
          * @param j : start to 0 just to n - 1
@@ -149,6 +193,7 @@ namespace FoxMath
         /**
          * @brief Calcul the derteminant of square matrix X*X.
          *		  If determinant is geometrical area betwen eache vector in matrix.
+         * @note Closed form for size <= 4, LU decomposition in O(n^3) else
          * 
          * @return constexpr TType 
          */
@@ -157,7 +202,7 @@ namespace FoxMath
 
         /**
          * @brief reserse matrix if it's possible, else return false. 
-         * If function if orthogonal, this function return the transposate of matrix.
+         * Closed form for size <= 4 (SSE for float 4x4 with FOXMATH_USE_SIMD), LU decomposition in O(n^3) else.
          * or empty
          * 
          * @return Matrix return empty matrix if reverse is not possible
@@ -167,7 +212,7 @@ namespace FoxMath
 
         /**
          * @brief reserse matrix if it's possible, else return false.
-         * If function if orthogonal, matrix will be transpose.
+         * Closed form for size <= 4 (SSE for float 4x4 with FOXMATH_USE_SIMD), LU decomposition in O(n^3) else.
          * or empty
          * 
          */
@@ -207,10 +252,12 @@ namespace FoxMath
         /**
          * @brief Create a Rotation Arround Axis Matrix object
          * 
+         * @tparam TPrecision : precision of the fused sin and cos of angle (see Numeric::sinCos)
          * @param unitAxis : Vector to use. Must be unit
          * @param angleRad 
          * @return SquareMatrix 
          */
+        template <EPrecision TPrecision = defaultPrecision>
         [[nodiscard]] static inline constexpr
         SquareMatrix createRotationArroundAxisMatrix (const GenericVector<TSize, TType>& unitAxis, Angle<EAngleType::Radian, TType> angle) noexcept
         {
@@ -218,8 +265,9 @@ namespace FoxMath
 
             SquareMatrix rst;
 
-            const TType s = std::sin(static_cast<TType>(angle));
-            const TType c = std::cos(static_cast<TType>(angle));
+            TType s {};
+            TType c {};
+            Numeric::sinCos<TPrecision>(static_cast<TType>(angle), s, c);
             const TType t = (static_cast<TType>(1) - c);
 
             for (size_t i = 0; i < TSize; i++)
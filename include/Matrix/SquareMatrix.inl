@@ -29,39 +29,87 @@
 
 #pragma once
 
+template <size_t TSize, typename TType, EMatrixConvention TMatrixConvention>
+template <size_t TSubSize, typename TElementAccessor>
+inline constexpr
+TType		SquareMatrix<TSize, TType, TMatrixConvention>::computeClosedFormDeterminant	(TElementAccessor element) noexcept
+{
+    static_assert(TSubSize <= 4, "Closed form is only used up to 4x4");
+
+    if constexpr (TSubSize == 1)
+    {
+        return element(0, 0);
+    }
+    else if constexpr (TSubSize == 2)
+    {
+        return element(0, 0) * element(1, 1) - element(0, 1) * element(1, 0);
+    }
+    else if constexpr (TSubSize == 3)
+    {
+        return  element(0, 0) * (element(1, 1) * element(2, 2) - element(1, 2) * element(2, 1)) +
+                element(0, 1) * (element(1, 2) * element(2, 0) - element(1, 0) * element(2, 2)) +
+                element(0, 2) * (element(1, 0) * element(2, 1) - element(1, 1) * element(2, 0));
+    }
+    else
+    {
+        //Laplace expansion on the two first rows : each 2x2 sub determinant is computed only once
+        const TType s0 = element(0, 0) * element(1, 1) - element(0, 1) * element(1, 0);
+        const TType s1 = element(0, 0) * element(1, 2) - element(0, 2) * element(1, 0);
+        const TType s2 = element(0, 0) * element(1, 3) - element(0, 3) * element(1, 0);
+        const TType s3 = element(0, 1) * element(1, 2) - element(0, 2) * element(1, 1);
+        const TType s4 = element(0, 1) * element(1, 3) - element(0, 3) * element(1, 1);
+        const TType s5 = element(0, 2) * element(1, 3) - element(0, 3) * element(1, 2);
+
+        const TType c0 = element(2, 0) * element(3, 1) - element(2, 1) * element(3, 0);
+        const TType c1 = element(2, 0) * element(3, 2) - element(2, 2) * element(3, 0);
+        const TType c2 = element(2, 0) * element(3, 3) - element(2, 3) * element(3, 0);
+        const TType c3 = element(2, 1) * element(3, 2) - element(2, 2) * element(3, 1);
+        const TType c4 = element(2, 1) * element(3, 3) - element(2, 3) * element(3, 1);
+        const TType c5 = element(2, 2) * element(3, 3) - element(2, 3) * element(3, 2);
+
+        return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+    }
+}
+
 template <size_t TSize, typename TType, EMatrixConvention TMatrixConvention>
 inline constexpr  
 TType		SquareMatrix<TSize, TType, TMatrixConvention>::getMinor		(size_t i, size_t j) const noexcept
 {
     const size_t newSizesubMatrix = TSize - 1;
-	SquareMatrix<newSizesubMatrix, TType, TMatrixConvention> subMatrix;
-	//fill submatrix
-	bool coefLineFound = false;
-	bool coefRowFound = false;
+    const auto& m = Parent::m_data;
 
-	for (size_t iSubMatrix = 0; iSubMatrix < newSizesubMatrix; iSubMatrix++)
-	{
-		if (iSubMatrix == i)
-			coefLineFound = true;
+    //skip the line i and the row j of the matrix
+    const auto element = [&m, i, j](size_t iSubMatrix, size_t jSubMatrix) constexpr noexcept -> TType
+    {
+        return m[(iSubMatrix + (iSubMatrix >= i)) * TSize + jSubMatrix + (jSubMatrix >= j)];
+    };
 
-		for (size_t jSubMatrix = 0; jSubMatrix < newSizesubMatrix; jSubMatrix++)
-		{
-			if (jSubMatrix == j)
-				coefRowFound = true;
+    if constexpr (newSizesubMatrix <= 4)
+    {
+        return computeClosedFormDeterminant<newSizesubMatrix>(element);
+    }
+    else
+    {
+        //LU decomposition need its own storage : fill the sub matrix once
+        SquareMatrix<newSizesubMatrix, TType, TMatrixConvention> subMatrix;
 
-			subMatrix.getData(iSubMatrix * newSizesubMatrix + jSubMatrix) = Parent::m_data[(iSubMatrix + coefLineFound) * TSize + jSubMatrix + coefRowFound];
-		}
-		coefRowFound = false;
-	}
+        for (size_t iSubMatrix = 0; iSubMatrix < newSizesubMatrix; iSubMatrix++)
+        {
+            for (size_t jSubMatrix = 0; jSubMatrix < newSizesubMatrix; jSubMatrix++)
+            {
+                subMatrix.getData(iSubMatrix * newSizesubMatrix + jSubMatrix) = element(iSubMatrix, jSubMatrix);
+            }
+        }
 
-	return subMatrix.getDeterminant();
+        return subMatrix.getDeterminant();
+    }
 }
 
 template <size_t TSize, typename TType, EMatrixConvention TMatrixConvention>
 inline constexpr  
 TType		SquareMatrix<TSize, TType, TMatrixConvention>::getCofactor		(size_t i, size_t j) const noexcept
 {
-	return std::pow(-1, i + j) * getMinor(i, j);
+	return powSign(i + j) * getMinor(i, j);
 }
 
 template <size_t TSize, typename TType, EMatrixConvention TMatrixConvention>
@@ -88,6 +136,222 @@ void		SquareMatrix<TSize, TType, TMatrixConvention>::tranformCoMatToAdjointMat
 	transpose();
 }
 
+template <size_t TSize, typename TType, EMatrixConvention TMatrixConvention>
+inline constexpr
+signed char	SquareMatrix<TSize, TType, TMatrixConvention>::decomposeLU		(std::array<LUType, TSize * TSize>& lu, std::array<size_t, TSize>& permutation) const noexcept
+{
+    for (size_t i = 0; i < TSize * TSize; i++)
+    {
+        lu[i] = static_cast<LUType>(Parent::m_data[i]);
+    }
+
+    for (size_t i = 0; i < TSize; i++)
+    {
+        permutation[i] = i;
+    }
+
+    signed char sign = 1;
+
+    for (size_t k = 0; k < TSize; k++)
+    {
+        //found the biggest pivot in column k to limit the rounding error
+        size_t pivotRow = k;
+        LUType pivotAbs = lu[k * TSize + k] < static_cast<LUType>(0) ? -lu[k * TSize + k] : lu[k * TSize + k];
+
+        for (size_t i = k + 1; i < TSize; i++)
+        {
+            const LUType coefAbs = lu[i * TSize + k] < static_cast<LUType>(0) ? -lu[i * TSize + k] : lu[i * TSize + k];
+
+            if (coefAbs > pivotAbs)
+            {
+                pivotAbs = coefAbs;
+                pivotRow = i;
+            }
+        }
+
+        if (pivotAbs == static_cast<LUType>(0))
+            return 0;
+
+        if (pivotRow != k)
+        {
+            for (size_t j = 0; j < TSize; j++)
+            {
+                const LUType temp = lu[k * TSize + j];
+                lu[k * TSize + j] = lu[pivotRow * TSize + j];
+                lu[pivotRow * TSize + j] = temp;
+            }
+
+            const size_t tempIndex = permutation[k];
+            permutation[k] = permutation[pivotRow];
+            permutation[pivotRow] = tempIndex;
+
+            sign = -sign;
+        }
+
+        const LUType invPivot = static_cast<LUType>(1) / lu[k * TSize + k];
+
+        for (size_t i = k + 1; i < TSize; i++)
+        {
+            const LUType factor = lu[i * TSize + k] * invPivot;
+            lu[i * TSize + k] = factor;
+
+            for (size_t j = k + 1; j < TSize; j++)
+            {
+                lu[i * TSize + j] -= factor * lu[k * TSize + j];
+            }
+        }
+    }
+
+    return sign;
+}
+
+template <size_t TSize, typename TType, EMatrixConvention TMatrixConvention>
+inline constexpr
+bool		SquareMatrix<TSize, TType, TMatrixConvention>::computeReverse	(SquareMatrix& rst) const noexcept
+{
+    const auto& m = Parent::m_data;
+
+    if constexpr (TSize > 4)
+    {
+        std::array<LUType, TSize * TSize> lu {};
+        std::array<size_t, TSize> permutation {};
+
+        const signed char sign = decomposeLU(lu, permutation);
+
+        if (sign == 0)
+            return false;
+
+        LUType determinant = static_cast<LUType>(sign);
+        for (size_t i = 0; i < TSize; i++)
+        {
+            determinant *= lu[i * TSize + i];
+        }
+
+        if (isSameAsZero<LUType>(determinant))
+            return false;
+
+        //solve L * U * x = P * e for each column e of identity
+        for (size_t col = 0; col < TSize; col++)
+        {
+            std::array<LUType, TSize> x {};
+
+            for (size_t i = 0; i < TSize; i++)
+            {
+                LUType sum = (permutation[i] == col) ? static_cast<LUType>(1) : static_cast<LUType>(0);
+
+                for (size_t j = 0; j < i; j++)
+                {
+                    sum -= lu[i * TSize + j] * x[j];
+                }
+                x[i] = sum;
+            }
+
+            for (size_t i = TSize; i-- > 0;)
+            {
+                LUType sum = x[i];
+
+                for (size_t j = i + 1; j < TSize; j++)
+                {
+                    sum -= lu[i * TSize + j] * x[j];
+                }
+                x[i] = sum / lu[i * TSize + i];
+            }
+
+            for (size_t i = 0; i < TSize; i++)
+            {
+                rst.getData(i * TSize + col) = static_cast<TType>(x[i]);
+            }
+        }
+
+        return true;
+    }
+    else
+    {
+#ifdef FOXMATH_SIMD_SSE
+        if constexpr (TSize == 4 && std::is_same_v<TType, float>)
+        {
+            if (!FOXMATH_IS_CONSTANT_EVALUATED())
+            {
+                return !isSameAsZero<TType>(SIMD::inverseMat4(m.data(), &rst.getData(0)));
+            }
+        }
+#endif
+        const TType determinant = getDeterminant();
+
+        if (isSameAsZero<TType>(determinant)) //in two step for more perform
+            return false;
+
+        //adjugate matrix
+        if constexpr (TSize == 1)
+        {
+            rst.getData(0) = static_cast<TType>(1);
+        }
+        else if constexpr (TSize == 2)
+        {
+            rst.getData(0) = m[3];
+            rst.getData(1) = -m[1];
+            rst.getData(2) = -m[2];
+            rst.getData(3) = m[0];
+        }
+        else if constexpr (TSize == 3)
+        {
+            rst.getData(0) = m[4] * m[8] - m[5] * m[7];
+            rst.getData(1) = m[2] * m[7] - m[1] * m[8];
+            rst.getData(2) = m[1] * m[5] - m[2] * m[4];
+            rst.getData(3) = m[5] * m[6] - m[3] * m[8];
+            rst.getData(4) = m[0] * m[8] - m[2] * m[6];
+            rst.getData(5) = m[2] * m[3] - m[0] * m[5];
+            rst.getData(6) = m[3] * m[7] - m[4] * m[6];
+            rst.getData(7) = m[1] * m[6] - m[0] * m[7];
+            rst.getData(8) = m[0] * m[4] - m[1] * m[3];
+        }
+        else
+        {
+            //2x2 sub determinants of the two first and two last rows are shared by all cofactors
+            const TType s0 = m[0] * m[5] - m[1] * m[4];
+            const TType s1 = m[0] * m[6] - m[2] * m[4];
+            const TType s2 = m[0] * m[7] - m[3] * m[4];
+            const TType s3 = m[1] * m[6] - m[2] * m[5];
+            const TType s4 = m[1] * m[7] - m[3] * m[5];
+            const TType s5 = m[2] * m[7] - m[3] * m[6];
+
+            const TType c0 = m[8] * m[13] - m[9] * m[12];
+            const TType c1 = m[8] * m[14] - m[10] * m[12];
+            const TType c2 = m[8] * m[15] - m[11] * m[12];
+            const TType c3 = m[9] * m[14] - m[10] * m[13];
+            const TType c4 = m[9] * m[15] - m[11] * m[13];
+            const TType c5 = m[10] * m[15] - m[11] * m[14];
+
+            rst.getData(0)  =  m[5] * c5 - m[6] * c4 + m[7] * c3;
+            rst.getData(1)  = -m[1] * c5 + m[2] * c4 - m[3] * c3;
+            rst.getData(2)  =  m[13] * s5 - m[14] * s4 + m[15] * s3;
+            rst.getData(3)  = -m[9] * s5 + m[10] * s4 - m[11] * s3;
+            rst.getData(4)  = -m[4] * c5 + m[6] * c2 - m[7] * c1;
+            rst.getData(5)  =  m[0] * c5 - m[2] * c2 + m[3] * c1;
+            rst.getData(6)  = -m[12] * s5 + m[14] * s2 - m[15] * s1;
+            rst.getData(7)  =  m[8] * s5 - m[10] * s2 + m[11] * s1;
+            rst.getData(8)  =  m[4] * c4 - m[5] * c2 + m[7] * c0;
+            rst.getData(9)  = -m[0] * c4 + m[1] * c2 - m[3] * c0;
+            rst.getData(10) =  m[12] * s4 - m[13] * s2 + m[15] * s0;
+            rst.getData(11) = -m[8] * s4 + m[9] * s2 - m[11] * s0;
+            rst.getData(12) = -m[4] * c3 + m[5] * c1 - m[6] * c0;
+            rst.getData(13) =  m[0] * c3 - m[1] * c1 + m[2] * c0;
+            rst.getData(14) = -m[12] * s3 + m[13] * s1 - m[14] * s0;
+            rst.getData(15) =  m[8] * s3 - m[9] * s1 + m[10] * s0;
+        }
+
+        if constexpr (std::is_floating_point_v<TType>)
+        {
+            rst *= static_cast<TType>(1) / determinant;
+        }
+        else
+        {
+            rst /= determinant;
+        }
+
+        return true;
+    }
+}
 
 template <size_t TSize, typename TType, EMatrixConvention TMatrixConvention>
 inline constexpr  
@@ -152,48 +416,36 @@ template <size_t TSize, typename TType, EMatrixConvention TMatrixConvention>
 inline constexpr  
 TType		SquareMatrix<TSize, TType, TMatrixConvention>::getDeterminant		() const noexcept
 {
-    if constexpr (TSize * TSize == 1) //Check if matrix 1*1
+    if constexpr (TSize <= 4)
     {
-        return Parent::getData(0);
+        const auto& m = Parent::m_data;
+        return computeClosedFormDeterminant<TSize>([&m](size_t i, size_t j) constexpr noexcept -> TType { return m[i * TSize + j]; });
     }
     else
     {
-        TType result = static_cast<TType>(0);
-        
-        for (size_t i = 0; i < TSize; i++)
-        {
-            //found signe
-            signed char signe = powSign(0 + i);
+        std::array<LUType, TSize * TSize> lu {};
+        std::array<size_t, TSize> permutation {};
 
-            //found coef
-            TType coef = signe * Parent::m_data[i * TSize];
-        
-            //create submatrix
-            const size_t subMatrixSize = TSize - 1;
-            SquareMatrix<subMatrixSize, TType, TMatrixConvention> subMatrix;
+        const signed char sign = decomposeLU(lu, permutation);
 
-            //fill submatrix
-            bool coefLineFound = false;
+        if (sign == 0)
+            return static_cast<TType>(0);
 
-            for (size_t iSubMatrix = 0; iSubMatrix < subMatrixSize; iSubMatrix++)
-            {
-                if (iSubMatrix == i)
-                    coefLineFound = true;
-
-                for (size_t jSubMatrix = 0; jSubMatrix < subMatrixSize; jSubMatrix++)
-                { 
-                    subMatrix.getData(iSubMatrix * subMatrixSize + jSubMatrix) = Parent::m_data[(iSubMatrix + coefLineFound) * TSize + jSubMatrix + 1];
-                }
-            }
-
-            //found determinant
-            TType determinant = subMatrix.getDeterminant();
+        LUType result = static_cast<LUType>(sign);
+        for (size_t i = 0; i < TSize; i++)
+        {
+            result *= lu[i * TSize + i];
+        }
 
-            //found result
-            result += coef * determinant;
+        if constexpr (std::is_floating_point_v<TType>)
+        {
+            return result;
+        }
+        else
+        {
+            //round to nearest integer, the decomposition can add little error
+            return static_cast<TType>(result < static_cast<LUType>(0) ? result - static_cast<LUType>(0.5) : result + static_cast<LUType>(0.5));
         }
-        
-        return result;
     }
 }
 
@@ -203,22 +455,11 @@ SquareMatrix<TSize, TType, TMatrixConvention>		SquareMatrix<TSize, TType, TMatri
 {
 	assert ((*this) != static_cast<TType>(0));
 
-	if (isOrtho() == true)
-	{
-		return Parent::getTransposed();
-	}
+	SquareMatrix<TSize, TType, TMatrixConvention> reversedMatrix;
 
-	const TType determinant = getDeterminant();
-	
-	if (isSameAsZero<TType>(determinant)) //in two step for more perform
+	if (!computeReverse(reversedMatrix))
 		return SquareMatrix<TSize, TType, TMatrixConvention>::zero();
 
-	SquareMatrix<TSize, TType, TMatrixConvention> reversedMatrix = getCoMatrix();
-
-	reversedMatrix.tranformCoMatToAdjointMat();
-
-	reversedMatrix /= determinant;
-
 	return reversedMatrix;
 }
 
@@ -228,23 +469,15 @@ SquareMatrix<TSize, TType, TMatrixConvention>&		SquareMatrix<TSize, TType, TMatr
 {
 	assert ((*this) != static_cast<TType>(0));
 
-	if (isOrtho() == true)
-	{
-        transpose();
-		return *this;
-	}
+	SquareMatrix<TSize, TType, TMatrixConvention> reversedMatrix;
 
-	const TType determinant = getDeterminant();
-	
-	if (isSameAsZero<TType>(determinant)) //in two step for more perform
+	if (!computeReverse(reversedMatrix))
     {
         Parent::fill(static_cast<TType>(0));
 		return *this;
     }
 
-	(*this) = getCoMatrix();
-	tranformCoMatToAdjointMat();
-	(*this) /= determinant;
+	(*this) = reversedMatrix;
 
     return *this;
 }
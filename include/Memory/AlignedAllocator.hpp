@@ -0,0 +1,105 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 11 h 03
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stddef.h> //sizt_t
+#include <new> //std::align_val_t
+
+namespace FoxMath
+{
+    /**
+     * @brief Minimal allocator that return memory aligned on TAlignment bytes. Use it with std::vector to keep SIMD friendly buffers
+     * @example `std::vector<float, AlignedAllocator<float, 32>> buffer (1024)`
+     * 
+     * @tparam TType 
+     * @tparam TAlignment : must be a power of 2
+     */
+    template <typename TType, size_t TAlignment = 32>
+    class AlignedAllocator
+    {
+        static_assert((TAlignment & (TAlignment - 1)) == 0, "Alignment must be a power of 2");
+
+        public:
+
+        using value_type = TType;
+
+        template <typename TTypeOther>
+        struct rebind
+        {
+            using other = AlignedAllocator<TTypeOther, TAlignment>;
+        };
+
+        #pragma region constructor/destructor
+
+        constexpr inline
+        AlignedAllocator () noexcept                                            = default;
+
+        constexpr inline
+        AlignedAllocator (const AlignedAllocator& other) noexcept               = default;
+
+        template <typename TTypeOther>
+        constexpr inline
+        AlignedAllocator (const AlignedAllocator<TTypeOther, TAlignment>&) noexcept
+        {}
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        [[nodiscard]] inline
+        TType*  allocate    (size_t count)
+        {
+            return static_cast<TType*>(::operator new(count * sizeof(TType), std::align_val_t(TAlignment)));
+        }
+
+        inline
+        void    deallocate  (TType* ptr, size_t) noexcept
+        {
+            ::operator delete(ptr, std::align_val_t(TAlignment));
+        }
+
+        #pragma endregion //!methods
+    };
+
+    template <typename TType, typename TTypeOther, size_t TAlignment>
+    [[nodiscard]] inline constexpr
+    bool operator==(const AlignedAllocator<TType, TAlignment>&, const AlignedAllocator<TTypeOther, TAlignment>&) noexcept
+    {
+        return true;
+    }
+
+    template <typename TType, typename TTypeOther, size_t TAlignment>
+    [[nodiscard]] inline constexpr
+    bool operator!=(const AlignedAllocator<TType, TAlignment>&, const AlignedAllocator<TTypeOther, TAlignment>&) noexcept
+    {
+        return false;
+    }
+
+} /*namespace FoxMath*/
@@ -0,0 +1,166 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 03 h 30
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Types/SFINAEShorthand.hpp" //IsArithmetic
+#include "Macro/ConstantEvaluated.hpp" //FOXMATH_IS_CONSTANT_EVALUATED
+
+#include <cmath> //std::sqrt, std::sin, std::cos, std::tan, std::atan2, std::acos
+#include <limits> //std::numeric_limits
+#include <type_traits> //std::conditional_t, std::is_integral_v
+
+/**
+ * sqrt, rsqrt and trigonometric functions usable in constant expressions. At compile time (FOXMATH_IS_CONSTANT_EVALUATED)
+ * they use the constexpr algorithms below, at runtime they call the standard library (hardware sqrt, libm trigonometry) :
+ * runtime results are the same as std functions.
+ * Constexpr algorithms compute float in double and are accurate to a few ulp of double (trigonometry only for |value| < 2^23).
+ * 
+ * @example `constexpr Mat4f<> projection = Mat4f<>::createPerspectiveMatrix(16.f / 9.f, 0.1f, 100.f, 70_deg);`
+ */
+
+namespace FoxMath::Numeric
+{
+    /**
+     * @brief Result type of the functions : integral arguments are computed in double as std functions
+     */
+    template <typename T>
+    using FloatingType = std::conditional_t<std::is_integral_v<T>, double, T>;
+
+    #pragma region constexpr algorithms
+
+    /**
+     * @brief Square root by Newton-Raphson after exponent scaling in [1, 4[. NaN for negative value
+     * 
+     * @tparam T 
+     * @param value 
+     * @return constexpr FloatingType<T> 
+     */
+    template <typename T, IsArithmetic<T> = true>
+    [[nodiscard]] inline constexpr
+    FloatingType<T> constexprSqrt   (T value) noexcept;
+
+    /**
+     * @brief Sinus with Cody-Waite reduction in [-pi/4, pi/4] and Taylor polynomial. Within 4 ulp of double for |value| < 2^23
+     * @note Farther angles are not reduced exactly : absolute error grows with |value| (~1e-9 at 2^24, ~1e-2 at 2^47).
+     * NaN if |value| >= 2^50
+     * 
+     * @tparam T 
+     * @param value : angle in radian
+     * @return constexpr FloatingType<T> 
+     */
+    template <typename T, IsArithmetic<T> = true>
+    [[nodiscard]] inline constexpr
+    FloatingType<T> constexprSin    (T value) noexcept;
+
+    /**
+     * @brief Cosinus with the same reduction and accuracy as constexprSin
+     * 
+     * @tparam T 
+     * @param value : angle in radian
+     * @return constexpr FloatingType<T> 
+     */
+    template <typename T, IsArithmetic<T> = true>
+    [[nodiscard]] inline constexpr
+    FloatingType<T> constexprCos    (T value) noexcept;
+
+    /**
+     * @brief Tangent as sin / cos of the same reduction. Within 7 ulp of double for |value| < 2^23, same range as constexprSin
+     * 
+     * @tparam T 
+     * @param value : angle in radian
+     * @return constexpr FloatingType<T> 
+     */
+    template <typename T, IsArithmetic<T> = true>
+    [[nodiscard]] inline constexpr
+    FloatingType<T> constexprTan    (T value) noexcept;
+
+    /**
+     * @brief Arc tangent of y / x in [-pi, pi] with the quadrant of (x, y). atan2(0, 0) is 0
+     * 
+     * @tparam T 
+     * @param y 
+     * @param x 
+     * @return constexpr FloatingType<T> 
+     */
+    template <typename T, IsArithmetic<T> = true>
+    [[nodiscard]] inline constexpr
+    FloatingType<T> constexprAtan2  (T y, T x) noexcept;
+
+    /**
+     * @brief Arc cosinus in [0, pi] computed with 2 * atan2(sqrt(1 - value), sqrt(1 + value)) to stay accurate near -1 and 1. NaN out of [-1, 1]
+     * 
+     * @tparam T 
+     * @param value 
+     * @return constexpr FloatingType<T> 
+     */
+    template <typename T, IsArithmetic<T> = true>
+    [[nodiscard]] inline constexpr
+    FloatingType<T> constexprAcos   (T value) noexcept;
+
+    #pragma endregion //!constexpr algorithms
+
+    #pragma region functions
+
+    template <typename T, IsArithmetic<T> = true>
+    [[nodiscard]] inline constexpr
+    FloatingType<T> sqrt    (T value) noexcept;
+
+    /**
+     * @brief 1 / sqrt(value). Runtime path is exact (no approximation like _mm_rsqrt_ps)
+     */
+    template <typename T, IsArithmetic<T> = true>
+    [[nodiscard]] inline constexpr
+    FloatingType<T> rsqrt   (T value) noexcept;
+
+    template <typename T, IsArithmetic<T> = true>
+    [[nodiscard]] inline constexpr
+    FloatingType<T> sin     (T value) noexcept;
+
+    template <typename T, IsArithmetic<T> = true>
+    [[nodiscard]] inline constexpr
+    FloatingType<T> cos     (T value) noexcept;
+
+    template <typename T, IsArithmetic<T> = true>
+    [[nodiscard]] inline constexpr
+    FloatingType<T> tan     (T value) noexcept;
+
+    template <typename T, IsArithmetic<T> = true>
+    [[nodiscard]] inline constexpr
+    FloatingType<T> atan2   (T y, T x) noexcept;
+
+    template <typename T, IsArithmetic<T> = true>
+    [[nodiscard]] inline constexpr
+    FloatingType<T> acos    (T value) noexcept;
+
+    #pragma endregion //!functions
+
+    #include "ConstexprMath.inl"
+
+} /*namespace FoxMath::Numeric*/
@@ -0,0 +1,352 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 03 h 30
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+/**
+ * @brief Type used by the constexpr algorithms : double (long double for long double)
+ */
+template <typename T>
+using ComputeType = std::conditional_t<std::is_same_v<T, long double>, long double, double>;
+
+/**
+ * @brief sin on [-pi/4, pi/4] : Taylor polynomial to x^19 (last term < 1e-19)
+ */
+template <typename T>
+[[nodiscard]] inline constexpr
+T sinPolynomial (T x) noexcept
+{
+    const T x2 = x * x;
+    T term = x;
+    T sum = x;
+
+    for (int n = 1; n <= 9; n++)
+    {
+        term *= -x2 / static_cast<T>((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+
+    return sum;
+}
+
+/**
+ * @brief cos on [-pi/4, pi/4] : Taylor polynomial to x^20
+ */
+template <typename T>
+[[nodiscard]] inline constexpr
+T cosPolynomial (T x) noexcept
+{
+    const T x2 = x * x;
+    T term = static_cast<T>(1);
+    T sum = static_cast<T>(1);
+
+    for (int n = 1; n <= 10; n++)
+    {
+        term *= -x2 / static_cast<T>((2 * n - 1) * (2 * n));
+        sum += term;
+    }
+
+    return sum;
+}
+
+/**
+ * @brief reduced = value - k * pi/2 in [-pi/4, pi/4] with quadrant = k mod 4. pi/2 is split in 33 bits parts (Cody-Waite, fdlibm constants)
+ * so k * part is exact for |k| < 2^20. The reduction stays within an ulp up to |value| < 2^23, farther angles lose
+ * precision linearly with |value|
+ * 
+ * @return false if value is NaN, infinite or too big to be reduced
+ */
+template <typename T>
+[[nodiscard]] inline constexpr
+bool reduceHalfPi (T value, T& reduced, int& quadrant) noexcept
+{
+    constexpr T twoOverPi = static_cast<T>(0.636619772367581343075535053490057448L);
+    constexpr T halfPi1   = static_cast<T>(1.57079632673412561417e+00L);
+    constexpr T halfPi2   = static_cast<T>(6.07710050630396597660e-11L);
+    constexpr T halfPi3   = static_cast<T>(2.02226624871116645580e-21L);
+    constexpr T halfPi3t  = static_cast<T>(8.47842766036889956997e-32L);
+
+    if (!(value - value == static_cast<T>(0)) || value >= static_cast<T>(1ull << 50) || value <= -static_cast<T>(1ull << 50))
+        return false;
+
+    const T kApprox = value * twoOverPi;
+    const long long k = static_cast<long long>(kApprox >= static_cast<T>(0) ? kApprox + static_cast<T>(0.5) : kApprox - static_cast<T>(0.5));
+    const T kReal = static_cast<T>(k);
+
+    reduced = (((value - kReal * halfPi1) - kReal * halfPi2) - kReal * halfPi3) - kReal * halfPi3t;
+    quadrant = static_cast<int>(k & 3);
+    return true;
+}
+
+/**
+ * @brief atan on all the real line : |x| > 1 use pi/2 - atan(1/x), |x| > tan(pi/12) use pi/6 + atan((x * sqrt(3) - 1) / (x + sqrt(3))),
+ * then Taylor series on |x| <= tan(pi/12)
+ */
+template <typename T>
+[[nodiscard]] inline constexpr
+T atanReduced (T x) noexcept
+{
+    constexpr T halfPi      = static_cast<T>(1.57079632679489661923132169163975144L);
+    constexpr T sixthPi     = static_cast<T>(0.523598775598298873077107230546583814L);
+    constexpr T sqrt3       = static_cast<T>(1.73205080756887729352744634150587237L);
+    constexpr T tanTwelfthPi = static_cast<T>(0.267949192431122706472553658494127633L);
+
+    const bool isNegative = x < static_cast<T>(0);
+    x = isNegative ? -x : x;
+
+    const bool isInverted = x > static_cast<T>(1);
+    x = isInverted ? static_cast<T>(1) / x : x;
+
+    const bool isShifted = x > tanTwelfthPi;
+    x = isShifted ? (x * sqrt3 - static_cast<T>(1)) / (x + sqrt3) : x;
+
+    /*|x| <= 0.268 : x^(2n+1) / (2n+1) < 1e-20 for n >= 17*/
+    const T x2 = x * x;
+    T power = x;
+    T sum = x;
+    for (int n = 1; n <= 17; n++)
+    {
+        power *= -x2;
+        sum += power / static_cast<T>(2 * n + 1);
+    }
+
+    sum = isShifted ? sum + sixthPi : sum;
+    sum = isInverted ? halfPi - sum : sum;
+    return isNegative ? -sum : sum;
+}
+
+template <typename T, IsArithmetic<T>>
+inline constexpr
+FloatingType<T> constexprSqrt (T value) noexcept
+{
+    using TCompute = ComputeType<FloatingType<T>>;
+    TCompute x = static_cast<TCompute>(value);
+
+    if (!(x >= static_cast<TCompute>(0)))
+        return std::numeric_limits<FloatingType<T>>::quiet_NaN();
+
+    if (x == static_cast<TCompute>(0) || x == std::numeric_limits<TCompute>::infinity())
+        return static_cast<FloatingType<T>>(x);
+
+    /*x = m * 4^e with m in [1, 4[ : sqrt(x) = sqrt(m) * 2^e. Powers of 2 keep the scaling exact*/
+    constexpr TCompute big = static_cast<TCompute>(1ull << 32) * static_cast<TCompute>(1ull << 32);
+    TCompute scale = static_cast<TCompute>(1);
+
+    while (x >= big)                        { x /= big; scale *= static_cast<TCompute>(1ull << 32); }
+    while (x * big < static_cast<TCompute>(1)) { x *= big; scale /= static_cast<TCompute>(1ull << 32); }
+    while (x >= static_cast<TCompute>(4))   { x /= static_cast<TCompute>(4); scale *= static_cast<TCompute>(2); }
+    while (x < static_cast<TCompute>(1))    { x *= static_cast<TCompute>(4); scale /= static_cast<TCompute>(2); }
+
+    /*Relative error of the first guess is < 0.25 and squared by iteration*/
+    TCompute root = (x + static_cast<TCompute>(1)) / static_cast<TCompute>(2);
+    for (int i = 0; i < 7; i++)
+    {
+        root = (root + x / root) / static_cast<TCompute>(2);
+    }
+
+    return static_cast<FloatingType<T>>(root * scale);
+}
+
+template <typename T, IsArithmetic<T>>
+inline constexpr
+FloatingType<T> constexprSin (T value) noexcept
+{
+    using TCompute = ComputeType<FloatingType<T>>;
+    TCompute reduced {};
+    int quadrant {};
+
+    if (!reduceHalfPi(static_cast<TCompute>(value), reduced, quadrant))
+        return std::numeric_limits<FloatingType<T>>::quiet_NaN();
+
+    switch (quadrant)
+    {
+        case 0:  return static_cast<FloatingType<T>>(sinPolynomial(reduced));
+        case 1:  return static_cast<FloatingType<T>>(cosPolynomial(reduced));
+        case 2:  return static_cast<FloatingType<T>>(-sinPolynomial(reduced));
+        default: return static_cast<FloatingType<T>>(-cosPolynomial(reduced));
+    }
+}
+
+template <typename T, IsArithmetic<T>>
+inline constexpr
+FloatingType<T> constexprCos (T value) noexcept
+{
+    using TCompute = ComputeType<FloatingType<T>>;
+    TCompute reduced {};
+    int quadrant {};
+
+    if (!reduceHalfPi(static_cast<TCompute>(value), reduced, quadrant))
+        return std::numeric_limits<FloatingType<T>>::quiet_NaN();
+
+    switch (quadrant)
+    {
+        case 0:  return static_cast<FloatingType<T>>(cosPolynomial(reduced));
+        case 1:  return static_cast<FloatingType<T>>(-sinPolynomial(reduced));
+        case 2:  return static_cast<FloatingType<T>>(-cosPolynomial(reduced));
+        default: return static_cast<FloatingType<T>>(sinPolynomial(reduced));
+    }
+}
+
+template <typename T, IsArithmetic<T>>
+inline constexpr
+FloatingType<T> constexprTan (T value) noexcept
+{
+    using TCompute = ComputeType<FloatingType<T>>;
+    TCompute reduced {};
+    int quadrant {};
+
+    if (!reduceHalfPi(static_cast<TCompute>(value), reduced, quadrant))
+        return std::numeric_limits<FloatingType<T>>::quiet_NaN();
+
+    /*tan(r + pi/2) = -cos(r) / sin(r)*/
+    return static_cast<FloatingType<T>>((quadrant & 1) ? -cosPolynomial(reduced) / sinPolynomial(reduced) : sinPolynomial(reduced) / cosPolynomial(reduced));
+}
+
+template <typename T, IsArithmetic<T>>
+inline constexpr
+FloatingType<T> constexprAtan2 (T y, T x) noexcept
+{
+    using TCompute = ComputeType<FloatingType<T>>;
+    constexpr TCompute pi     = static_cast<TCompute>(3.14159265358979323846264338327950288L);
+    constexpr TCompute halfPi = static_cast<TCompute>(1.57079632679489661923132169163975144L);
+
+    const TCompute yCompute = static_cast<TCompute>(y);
+    const TCompute xCompute = static_cast<TCompute>(x);
+
+    if (yCompute != yCompute || xCompute != xCompute)
+        return std::numeric_limits<FloatingType<T>>::quiet_NaN();
+
+    if (xCompute == static_cast<TCompute>(0))
+    {
+        return static_cast<FloatingType<T>>(yCompute > static_cast<TCompute>(0) ? halfPi : (yCompute < static_cast<TCompute>(0) ? -halfPi : static_cast<TCompute>(0)));
+    }
+
+    const TCompute absY = yCompute < static_cast<TCompute>(0) ? -yCompute : yCompute;
+    const TCompute absX = xCompute < static_cast<TCompute>(0) ? -xCompute : xCompute;
+
+    /*Divide the smallest by the biggest to never overflow*/
+    if (absY > absX)
+    {
+        const TCompute angle = atanReduced(xCompute / yCompute);
+        return static_cast<FloatingType<T>>(yCompute > static_cast<TCompute>(0) ? halfPi - angle : -halfPi - angle);
+    }
+
+    const TCompute angle = atanReduced(yCompute / xCompute);
+
+    if (xCompute > static_cast<TCompute>(0))
+        return static_cast<FloatingType<T>>(angle);
+
+    return static_cast<FloatingType<T>>(yCompute >= static_cast<TCompute>(0) ? angle + pi : angle - pi);
+}
+
+template <typename T, IsArithmetic<T>>
+inline constexpr
+FloatingType<T> constexprAcos (T value) noexcept
+{
+    using TCompute = ComputeType<FloatingType<T>>;
+    const TCompute x = static_cast<TCompute>(value);
+
+    if (!(x >= static_cast<TCompute>(-1) && x <= static_cast<TCompute>(1)))
+        return std::numeric_limits<FloatingType<T>>::quiet_NaN();
+
+    return static_cast<FloatingType<T>>(static_cast<TCompute>(2) * constexprAtan2(constexprSqrt(static_cast<TCompute>(1) - x), constexprSqrt(static_cast<TCompute>(1) + x)));
+}
+
+template <typename T, IsArithmetic<T>>
+inline constexpr
+FloatingType<T> sqrt (T value) noexcept
+{
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+    if (FOXMATH_IS_CONSTANT_EVALUATED())
+        return constexprSqrt(value);
+#endif
+    return std::sqrt(value);
+}
+
+template <typename T, IsArithmetic<T>>
+inline constexpr
+FloatingType<T> rsqrt (T value) noexcept
+{
+    return static_cast<FloatingType<T>>(1) / Numeric::sqrt(value);
+}
+
+template <typename T, IsArithmetic<T>>
+inline constexpr
+FloatingType<T> sin (T value) noexcept
+{
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+    if (FOXMATH_IS_CONSTANT_EVALUATED())
+        return constexprSin(value);
+#endif
+    return std::sin(value);
+}
+
+template <typename T, IsArithmetic<T>>
+inline constexpr
+FloatingType<T> cos (T value) noexcept
+{
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+    if (FOXMATH_IS_CONSTANT_EVALUATED())
+        return constexprCos(value);
+#endif
+    return std::cos(value);
+}
+
+template <typename T, IsArithmetic<T>>
+inline constexpr
+FloatingType<T> tan (T value) noexcept
+{
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+    if (FOXMATH_IS_CONSTANT_EVALUATED())
+        return constexprTan(value);
+#endif
+    return std::tan(value);
+}
+
+template <typename T, IsArithmetic<T>>
+inline constexpr
+FloatingType<T> atan2 (T y, T x) noexcept
+{
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+    if (FOXMATH_IS_CONSTANT_EVALUATED())
+        return constexprAtan2(y, x);
+#endif
+    return std::atan2(y, x);
+}
+
+template <typename T, IsArithmetic<T>>
+inline constexpr
+FloatingType<T> acos (T value) noexcept
+{
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+    if (FOXMATH_IS_CONSTANT_EVALUATED())
+        return constexprAcos(value);
+#endif
+    return std::acos(value);
+}
@@ -0,0 +1,77 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 15 h 05
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+/**
+ * Default precision of the functions with a precision policy (GenericVector::normalize, Quaternion::sLerp, easing functions...).
+ * Define FOXMATH_DEFAULT_PRECISION to Exact, Fast or Approximate before including FoxMath (or with -DFOXMATH_DEFAULT_PRECISION=Fast)
+ * to change it in the whole project. Each function can still be called with an explicit policy : `vec.normalize<EPrecision::Fast>()`
+ */
+#ifndef FOXMATH_DEFAULT_PRECISION
+    #define FOXMATH_DEFAULT_PRECISION Exact
+#endif
+
+namespace FoxMath
+{
+    /**
+     * @brief Exact : same result as the standard library.
+     * Fast : few ulp of error (rsqrt with Newton step, reciprocal multiply, minimax polynomial). Functions without faster
+     * way to stay in few ulp use the exact path (double rsqrt and acos...).
+     * Approximate : relative error lower than 1e-3, cheapest path (raw rsqrt, low degree polynomial)
+     */
+    enum class EPrecision
+    {
+        Exact,
+        Fast,
+        Approximate
+    };
+
+    inline constexpr EPrecision defaultPrecision = EPrecision::FOXMATH_DEFAULT_PRECISION;
+
+    [[nodiscard]] constexpr inline
+    const char* precisionToString (EPrecision precision) noexcept
+    {
+        switch (precision)
+        {
+        case EPrecision::Exact:
+            return "Exact";
+
+        case EPrecision::Fast:
+            return "Fast";
+
+        case EPrecision::Approximate:
+            return "Approximate";
+        
+        default:
+            return "Unknow";
+        }
+    }
+
+} /*namespace FoxMath*/
@@ -0,0 +1,137 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 15 h 20
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Types/SFINAEShorthand.hpp" //IsFloatingPoint, IsArithmetic
+#include "Numeric/EPrecision.hpp" //EPrecision
+#include "Numeric/ConstexprMath.hpp" //Numeric::sqrt, Numeric::rsqrt, Numeric::sin, Numeric::cos, Numeric::acos
+#include "SIMD/SIMD.hpp" //FOXMATH_SIMD_SSE, SIMD::sinCosBulk
+
+#include <cmath> //std::exp2, std::pow, std::nearbyint
+#include <cstring> //std::memcpy
+#include <stdint.h> //uint32_t, uint64_t
+#include <type_traits> //std::is_same_v
+#include <limits> //std::numeric_limits
+
+/**
+ * Functions with a compile time precision policy (see EPrecision). Exact call the Numeric functions (standard library at runtime).
+ * Fast and Approximate have a path for float and double, other types use the exact path. At compile time (FOXMATH_IS_CONSTANT_EVALUATED)
+ * all policies use the exact constexpr algorithms.
+ * 
+ * @example `const float angle = Numeric::acos<EPrecision::Fast>(cosAngle);`
+ */
+
+namespace FoxMath::Numeric
+{
+    #pragma region functions
+
+    /**
+     * @brief 1 / sqrt(value). Value must be positive and normal for Fast and Approximate.
+     * Fast : float use _mm_rsqrt_ss with one Newton step (FOXMATH_USE_SIMD), else the exact path.
+     * Approximate : float use raw _mm_rsqrt_ss (magic number with one Newton step without SIMD), double use magic number with two Newton steps.
+     */
+    template <EPrecision TPrecision, typename T, IsFloatingPoint<T> = true>
+    [[nodiscard]] inline constexpr
+    T rsqrt (T value) noexcept;
+
+    /**
+     * @brief Exact and Fast use the hardware square root. Approximate is value * rsqrt<Approximate>(value)
+     */
+    template <EPrecision TPrecision, typename T, IsFloatingPoint<T> = true>
+    [[nodiscard]] inline constexpr
+    T sqrt  (T value) noexcept;
+
+    /**
+     * @brief Reduction in [-pi/4, pi/4] and minimax polynomial without branch (loops can be vectorized).
+     * Fast and Approximate keep their error for |value| < 8192 (float) or 2^20 (double), reduction lose precision upper
+     * 
+     * @param value : angle in radian
+     */
+    template <EPrecision TPrecision, typename T, IsFloatingPoint<T> = true>
+    [[nodiscard]] inline constexpr
+    T sin   (T value) noexcept;
+
+    template <EPrecision TPrecision, typename T, IsFloatingPoint<T> = true>
+    [[nodiscard]] inline constexpr
+    T cos   (T value) noexcept;
+
+    /**
+     * @brief sin and cos of the same angle with one reduction and one evaluation of each polynomial.
+     * Exact call Numeric::sin and Numeric::cos (compilers merge them in one sincos call)
+     * 
+     * @param value : angle in radian
+     * @param sinValue 
+     * @param cosValue 
+     */
+    template <EPrecision TPrecision, typename T, IsFloatingPoint<T> = true>
+    inline constexpr
+    void sinCos (T value, T& sinValue, T& cosValue) noexcept;
+
+    /**
+     * @brief sinCos on arrays : sinValues[i] = sin(values[i]) and cosValues[i] = cos(values[i]).
+     * Float (Fast and Approximate) use SIMD::sinCosBulk with FOXMATH_USE_SIMD
+     * 
+     * @param values : count angles in radian
+     * @param sinValues 
+     * @param cosValues 
+     * @param count 
+     */
+    template <EPrecision TPrecision, typename T, IsFloatingPoint<T> = true>
+    inline
+    void sinCos (const T* values, T* sinValues, T* cosValues, size_t count) noexcept;
+
+    /**
+     * @brief Fast (float) use asin polynomial with acos(x) = 2 * asin(sqrt((1 - x) / 2)) near to 1, double use the exact path.
+     * Approximate use sqrt(1 - x) * polynomial (absolute error lower than 7e-5)
+     */
+    template <EPrecision TPrecision, typename T, IsFloatingPoint<T> = true>
+    [[nodiscard]] inline constexpr
+    T acos  (T value) noexcept;
+
+    /**
+     * @brief 2^value. Exact and Fast are std::exp2 (a few ulp polynomial is not faster than the libm). Approximate use polynomial on [-0.5, 0.5]
+     * scaled by exponent bits. Out of the normal exponent range, it return 0 (subnormal results are flushed) or infinity
+     */
+    template <EPrecision TPrecision, typename T, IsFloatingPoint<T> = true>
+    [[nodiscard]] inline
+    T exp2  (T value) noexcept;
+
+    /**
+     * @brief value^TExponent. Exact is std::pow, Fast and Approximate multiply by squaring (log2(TExponent) multiplications)
+     */
+    template <size_t TExponent, EPrecision TPrecision, typename T, IsArithmetic<T> = true>
+    [[nodiscard]] inline constexpr
+    T pow   (T value) noexcept;
+
+    #pragma endregion //!functions
+
+    #include "PrecisionMath.inl"
+
+} /*namespace FoxMath::Numeric*/
@@ -0,0 +1,417 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 15 h 20
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+/**
+ * @brief Float and double have Fast and Approximate paths, other types (long double) use the exact path
+ */
+template <typename T>
+inline constexpr bool hasPrecisionPath = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+/**
+ * @brief reduced = value - quadrant * pi/2 in [-pi/4, pi/4] with quadrant the nearest integer, without branch so loops can be vectorized.
+ * pi/2 is split in 3 parts (Cephes constants for float, fdlibm for double) so quadrant * part stays exact for |value| < 8192 (float) or 2^20 (double).
+ * quadrant is rounded with nearbyint and stay floating point (roundps/roundpd with SSE4.1) : no conversion to int to clamp and NaN propagate
+ */
+template <typename T>
+inline
+void reduceHalfPiFast (T value, T& reduced, T& quadrant) noexcept
+{
+    constexpr T twoOverPi = static_cast<T>(0.636619772367581343075535053490057448L);
+    constexpr T halfPi1   = std::is_same_v<T, float> ? static_cast<T>(1.5703125L) : static_cast<T>(1.57079632673412561417e+00L);
+    constexpr T halfPi2   = std::is_same_v<T, float> ? static_cast<T>(4.837512969970703125e-4L) : static_cast<T>(6.07710050630396597660e-11L);
+    constexpr T halfPi3   = std::is_same_v<T, float> ? static_cast<T>(7.54978995489188216e-8L) : static_cast<T>(2.02226624871116645580e-21L);
+
+    quadrant = std::nearbyint(value * twoOverPi);
+    reduced  = ((value - quadrant * halfPi1) - quadrant * halfPi2) - quadrant * halfPi3;
+}
+
+/**
+ * @brief sin on [-pi/4, pi/4]. Fast use Cephes minimax coefficients (degree 7 for float, 13 for double).
+ * Approximate is a degree 3 minimax (relative error 4.1e-4)
+ */
+template <EPrecision TPrecision, typename T>
+[[nodiscard]] inline constexpr
+T sinMinimax (T x) noexcept
+{
+    const T x2 = x * x;
+
+    if constexpr (TPrecision == EPrecision::Approximate)
+    {
+        return x * (static_cast<T>(0.9995915742153391) + x2 * static_cast<T>(-0.16153509933200558));
+    }
+    else if constexpr (std::is_same_v<T, float>)
+    {
+        return x + x * x2 * (-1.6666654611e-1f + x2 * (8.3321608736e-3f + x2 * -1.9515295891e-4f));
+    }
+    else
+    {
+        return x + x * x2 * (-1.66666666666666307295e-1 + x2 * (8.33333333332211858878e-3 + x2 * (-1.98412698295895385996e-4 +
+                   x2 * (2.75573136213857245213e-6 + x2 * (-2.50507477628578072866e-8 + x2 * 1.58962301576546568060e-10)))));
+    }
+}
+
+/**
+ * @brief cos on [-pi/4, pi/4]. Fast use Cephes minimax coefficients (degree 8 for float, 14 for double).
+ * Approximate is a degree 4 minimax with exact cos(0) (absolute error 1.3e-5)
+ */
+template <EPrecision TPrecision, typename T>
+[[nodiscard]] inline constexpr
+T cosMinimax (T x) noexcept
+{
+    const T x2 = x * x;
+
+    if constexpr (TPrecision == EPrecision::Approximate)
+    {
+        return static_cast<T>(1) + x2 * (static_cast<T>(-0.49977630707616877) + x2 * static_cast<T>(0.04048893584359353));
+    }
+    else if constexpr (std::is_same_v<T, float>)
+    {
+        return 1.f - 0.5f * x2 + x2 * x2 * (4.166664568298827e-2f + x2 * (-1.388731625493765e-3f + x2 * 2.443315711809948e-5f));
+    }
+    else
+    {
+        return 1. - 0.5 * x2 + x2 * x2 * (4.16666666666665929218e-2 + x2 * (-1.38888888888730564116e-3 + x2 * (2.48015872888517045348e-5 +
+                   x2 * (-2.75573141792967388112e-7 + x2 * (2.08757008419747316778e-9 + x2 * -1.13585365213876817300e-11)))));
+    }
+}
+
+/**
+ * @brief value * 2^exponent by building the exponent bits. Exponent must be in normal range ([-126, 127] for float, [-1022, 1023] for double)
+ */
+template <typename T>
+[[nodiscard]] inline
+T scaleByPowerOfTwo (T value, int exponent) noexcept
+{
+    T scale;
+
+    if constexpr (std::is_same_v<T, float>)
+    {
+        const uint32_t bits = static_cast<uint32_t>(exponent + 127) << 23;
+        std::memcpy(&scale, &bits, sizeof(T));
+    }
+    else
+    {
+        const uint64_t bits = static_cast<uint64_t>(exponent + 1023) << 52;
+        std::memcpy(&scale, &bits, sizeof(T));
+    }
+
+    return value * scale;
+}
+
+/**
+ * @brief Magic number first guess and Newton steps (Moroz et al. modified step for float : relative error 6.5e-4, two classic steps for double : 4.7e-6)
+ */
+template <typename T>
+[[nodiscard]] inline
+T rsqrtMagicNumber (T value) noexcept
+{
+    if constexpr (std::is_same_v<T, float>)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(T));
+        bits = 0x5F1FFFF9u - (bits >> 1);
+
+        float guess;
+        std::memcpy(&guess, &bits, sizeof(T));
+        return 0.703952253f * guess * (2.38924456f - value * guess * guess);
+    }
+    else
+    {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(T));
+        bits = 0x5FE6EB50C7B537A9ull - (bits >> 1);
+
+        double guess;
+        std::memcpy(&guess, &bits, sizeof(T));
+        guess *= 1.5 - 0.5 * value * guess * guess;
+        return guess * (1.5 - 0.5 * value * guess * guess);
+    }
+}
+
+template <EPrecision TPrecision, typename T, IsFloatingPoint<T>>
+inline constexpr
+T rsqrt (T value) noexcept
+{
+#if defined(FOXMATH_SIMD_SSE)
+    constexpr bool hasFastPath = std::is_same_v<T, float>;
+#else
+    constexpr bool hasFastPath = false;
+#endif
+
+    if constexpr (TPrecision == EPrecision::Exact || !hasPrecisionPath<T> || (TPrecision == EPrecision::Fast && !hasFastPath))
+    {
+        return Numeric::rsqrt(value);
+    }
+    else
+    {
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+        if (FOXMATH_IS_CONSTANT_EVALUATED())
+            return Numeric::rsqrt(value);
+
+    #if defined(FOXMATH_SIMD_SSE)
+        if constexpr (std::is_same_v<T, float>)
+        {
+            const float guess = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(value)));
+
+            if constexpr (TPrecision == EPrecision::Approximate)
+                return guess;
+            else
+                return guess * (1.5f - 0.5f * value * guess * guess); //Newton step
+        }
+        else
+    #endif
+        {
+            return rsqrtMagicNumber(value);
+        }
+#else
+        return Numeric::rsqrt(value);
+#endif
+    }
+}
+
+template <EPrecision TPrecision, typename T, IsFloatingPoint<T>>
+inline constexpr
+T sqrt (T value) noexcept
+{
+    if constexpr (TPrecision != EPrecision::Approximate || !hasPrecisionPath<T>)
+    {
+        return Numeric::sqrt(value);
+    }
+    else
+    {
+        return value > static_cast<T>(0) ? value * Numeric::rsqrt<TPrecision>(value) : Numeric::sqrt(value);
+    }
+}
+
+/**
+ * @brief sin(reduced + quadrant * pi/2) for integer valued quadrant from sin(reduced) and cos(reduced). With quadrant = 2h + d and d in {-1, 0, 1} :
+ * sin(r + quadrant * pi/2) = (-1)^h * ((1 - d^2) * sin(r) + d * cos(r)).
+ * Quadrant is not predictable : both polynomials and the sign are selected by multiplication (exact).
+ * Only nearbyint is used (floor is not vectorized when floating point exceptions are observable)
+ */
+template <typename T>
+[[nodiscard]] inline
+T selectByQuadrant (T sinReduced, T cosReduced, T quadrant) noexcept
+{
+    const T h = std::nearbyint(quadrant * static_cast<T>(0.5));
+    const T d = quadrant - static_cast<T>(2) * h;
+    const T e = h - static_cast<T>(2) * std::nearbyint(h * static_cast<T>(0.5));
+
+    const T rst = sinReduced * (static_cast<T>(1) - d * d) + cosReduced * d;
+    return rst * (static_cast<T>(1) - static_cast<T>(2) * e * e);
+}
+
+template <EPrecision TPrecision, typename T, IsFloatingPoint<T>>
+inline constexpr
+T sin (T value) noexcept
+{
+    if constexpr (TPrecision == EPrecision::Exact || !hasPrecisionPath<T>)
+    {
+        return Numeric::sin(value);
+    }
+    else
+    {
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+        if (FOXMATH_IS_CONSTANT_EVALUATED())
+            return Numeric::sin(value);
+#endif
+        T reduced {};
+        T quadrant {};
+
+        reduceHalfPiFast(value, reduced, quadrant);
+        return selectByQuadrant(sinMinimax<TPrecision>(reduced), cosMinimax<TPrecision>(reduced), quadrant);
+    }
+}
+
+template <EPrecision TPrecision, typename T, IsFloatingPoint<T>>
+inline constexpr
+T cos (T value) noexcept
+{
+    if constexpr (TPrecision == EPrecision::Exact || !hasPrecisionPath<T>)
+    {
+        return Numeric::cos(value);
+    }
+    else
+    {
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+        if (FOXMATH_IS_CONSTANT_EVALUATED())
+            return Numeric::cos(value);
+#endif
+        T reduced {};
+        T quadrant {};
+
+        /*cos(x) = sin(x + pi/2)*/
+        reduceHalfPiFast(value, reduced, quadrant);
+        return selectByQuadrant(sinMinimax<TPrecision>(reduced), cosMinimax<TPrecision>(reduced), quadrant + static_cast<T>(1));
+    }
+}
+
+template <EPrecision TPrecision, typename T, IsFloatingPoint<T>>
+inline constexpr
+void sinCos (T value, T& sinValue, T& cosValue) noexcept
+{
+    if constexpr (TPrecision == EPrecision::Exact || !hasPrecisionPath<T>)
+    {
+        sinValue = Numeric::sin(value);
+        cosValue = Numeric::cos(value);
+    }
+    else
+    {
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+        if (FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            sinValue = Numeric::sin(value);
+            cosValue = Numeric::cos(value);
+            return;
+        }
+#endif
+        T reduced {};
+        T quadrant {};
+
+        /*One reduction and one evaluation of each polynomial for both results*/
+        reduceHalfPiFast(value, reduced, quadrant);
+        const T sinReduced = sinMinimax<TPrecision>(reduced);
+        const T cosReduced = cosMinimax<TPrecision>(reduced);
+
+        sinValue = selectByQuadrant(sinReduced, cosReduced, quadrant);
+        cosValue = selectByQuadrant(sinReduced, cosReduced, quadrant + static_cast<T>(1));
+    }
+}
+
+template <EPrecision TPrecision, typename T, IsFloatingPoint<T>>
+inline
+void sinCos (const T* values, T* sinValues, T* cosValues, size_t count) noexcept
+{
+#ifdef FOXMATH_SIMD_SSE
+    if constexpr (TPrecision != EPrecision::Exact && std::is_same_v<T, float>)
+    {
+        SIMD::sinCosBulk<TPrecision>(values, sinValues, cosValues, count);
+        return;
+    }
+#endif
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        sinCos<TPrecision>(values[i], sinValues[i], cosValues[i]);
+    }
+}
+
+template <EPrecision TPrecision, typename T, IsFloatingPoint<T>>
+inline constexpr
+T acos (T value) noexcept
+{
+    if constexpr (TPrecision == EPrecision::Exact || !hasPrecisionPath<T> || (TPrecision == EPrecision::Fast && !std::is_same_v<T, float>))
+    {
+        return Numeric::acos(value);
+    }
+    else
+    {
+#ifdef FOXMATH_IS_CONSTANT_EVALUATED
+        if (FOXMATH_IS_CONSTANT_EVALUATED())
+            return Numeric::acos(value);
+#endif
+        constexpr T pi      = static_cast<T>(3.14159265358979323846264338327950288L);
+        constexpr T halfPi  = static_cast<T>(1.57079632679489661923132169163975144L);
+        const T absValue    = value < static_cast<T>(0) ? -value : value;
+
+        if constexpr (TPrecision == EPrecision::Approximate)
+        {
+            /*Abramowitz and Stegun 4.4.45*/
+            const T rst = Numeric::sqrt(static_cast<T>(1) - absValue) * (static_cast<T>(1.5707288) + absValue * (static_cast<T>(-0.2121144) +
+                          absValue * (static_cast<T>(0.0742610) + absValue * static_cast<T>(-0.0187293))));
+
+            return value < static_cast<T>(0) ? pi - rst : rst;
+        }
+        else
+        {
+            /*Cephes asinf : asin(s) = s + s * z * P(z) with z = s^2 for |value| <= 0.5, s = sqrt((1 - |value|) / 2) upper*/
+            const bool isNearToOne  = absValue > 0.5f;
+            const float z           = isNearToOne ? 0.5f * (1.f - absValue) : absValue * absValue;
+            const float s           = isNearToOne ? Numeric::sqrt(z) : absValue;
+            const float asinS       = s + s * z * ((((4.2163199048e-2f * z + 2.4181311049e-2f) * z + 4.5470025998e-2f) * z + 7.4953002686e-2f) * z + 1.6666752422e-1f);
+
+            if (!isNearToOne)
+                return halfPi - (value < 0.f ? -asinS : asinS);
+
+            return value < 0.f ? pi - 2.f * asinS : 2.f * asinS;
+        }
+    }
+}
+
+template <EPrecision TPrecision, typename T, IsFloatingPoint<T>>
+inline
+T exp2 (T value) noexcept
+{
+    if constexpr (TPrecision != EPrecision::Approximate || !hasPrecisionPath<T>)
+    {
+        return std::exp2(value);
+    }
+    else
+    {
+        constexpr T minExponent = std::is_same_v<T, float> ? static_cast<T>(-126) : static_cast<T>(-1022);
+        constexpr T maxExponent = std::is_same_v<T, float> ? static_cast<T>(127) : static_cast<T>(1023);
+
+        const bool isInRange = value >= minExponent && value <= maxExponent;
+        const T safeValue = isInRange ? value : static_cast<T>(0);
+
+        /*2^value = 2^n * 2^f with n the nearest integer and f in [-0.5, 0.5]*/
+        const T nReal = std::nearbyint(safeValue);
+        const int n   = static_cast<int>(nReal);
+        const T f     = safeValue - nReal;
+
+        /*Degree 3 minimax with exact 2^0 (relative error 4.4e-4)*/
+        const T rst = static_cast<T>(1) + f * (static_cast<T>(0.6957668310384431) + f * (static_cast<T>(0.2420305119163569) + f * static_cast<T>(0.041698749374846994)));
+
+        if (isInRange) [[likely]]
+            return scaleByPowerOfTwo(rst, n);
+
+        return value < minExponent ? static_cast<T>(0) : (value > maxExponent ? std::numeric_limits<T>::infinity() : value);
+    }
+}
+
+template <size_t TExponent, EPrecision TPrecision, typename T, IsArithmetic<T>>
+inline constexpr
+T pow (T value) noexcept
+{
+    if constexpr (TPrecision == EPrecision::Exact)
+    {
+        return static_cast<T>(std::pow(value, TExponent));
+    }
+    else if constexpr (TExponent == 0)
+    {
+        return static_cast<T>(1);
+    }
+    else
+    {
+        const T halfPow = Numeric::pow<TExponent / 2, TPrecision>(value);
+        return (TExponent & 1) ? halfPow * halfPow * value : halfPow * halfPow;
+    }
+}
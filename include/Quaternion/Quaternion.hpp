@@ -36,6 +36,8 @@
 #include "Vector/Vector3.hpp" //Vector3<TType>
 #include "Matrix/Matrix3.hpp" //Matrix3
 #include "Numeric/Limits.hpp" //Vector3<TType>
+#include "Numeric/ConstexprMath.hpp" //Numeric::sqrt, Numeric::sin, Numeric::acos
+#include "Numeric/PrecisionMath.hpp" //EPrecision, Numeric::rsqrt<EPrecision>, Numeric::sin<EPrecision>, Numeric::acos<EPrecision>, Numeric::sinCos<EPrecision>
 #include "Angle/Angle.hpp" //Angle<EAngleType::Radian, TType>
 
 namespace FoxMath
@@ -70,17 +72,51 @@ namespace FoxMath
         #pragma endregion //!attribut
     
         #pragma region static attribut
+
+        /*Upper this cos of angle between quaternions, sLerp use nLerp (sin of angle is too small to divide by it)*/
+        static constexpr TType sLerpThreshold = static_cast<TType>(0.9995);
+
         #pragma endregion //! static attribut
     
         #pragma region methods
 
+        /**
+         * @brief Rotate vector with q * v * q^-1 expanded as v + s * (w(u×v) + u×(u×v)), with u the vector part of the quaternion.
+         *        No intermediate quaternion is created
+         * 
+         * @param vec 
+         * @param scale : 2 / squared magnitude of the quaternion (2 if quaternion is unit)
+         */
+        template <typename TTypeVector>
+        inline constexpr
+        void rotateVectorScaled(Vector3<TTypeVector>& vec, TType scale) const noexcept;
+
+        /**
+         * @brief sLerp between nearly opposite quaternions (cos of angle lower than -sLerpThreshold) : start * cos(t * angle) + orthogonal * sin(t * angle),
+         *        with orthogonal the unit part of end orthogonal to start. Exactly opposite quaternions are joined by every great circle :
+         *        orthogonal is the perpendicular quaternion (-y, x, -w, z) of start
+         * 
+         * @tparam TPrecision : precision of acos, sinCos and reciprocal square root
+         * @param startQuat 
+         * @param endQuat 
+         * @param cosAngle : dot product of start and end
+         * @param t 
+         */
+        template <EPrecision TPrecision>
+        inline constexpr
+        void sLerpOpposite(const Quaternion<TType>& startQuat, const Quaternion<TType>& endQuat, TType cosAngle, TType t) noexcept;
+
         #pragma endregion //!methods
     
         public:
     
         #pragma region constructor/destructor
     
-        Quaternion () noexcept				                        = default;
+        /*Not defaulted : Vector3 member of the union make the default constructor deleted*/
+        inline constexpr
+        Quaternion () noexcept
+            :   m_data {}
+        {}
 
         Quaternion (const Quaternion& other) noexcept				= default;
 
@@ -93,7 +129,7 @@ namespace FoxMath
         Quaternion& operator=(Quaternion && other) noexcept         = default;
 
         /**
-         * @brief Create quaternion based on axis and angle
+         * @brief Create quaternion based on axis and angle. Sin and cos of the half angle are fused (Numeric::sinCos<defaultPrecision>)
          * 
          */
         explicit inline constexpr
@@ -139,16 +175,20 @@ namespace FoxMath
         /**
          * @brief Normalize the quaternion it self
          * 
+         * @tparam TPrecision : Exact divide by magnitude. Fast and Approximate multiply by rsqrt<TPrecision> of the squared magnitude
          * @return constexpr Quaternion& 
          */
+        template <EPrecision TPrecision = defaultPrecision>
         inline constexpr
         Quaternion& normalize() noexcept;
 
         /**
          * @brief get the normalize quaternion
          * 
+         * @tparam TPrecision : see normalize
          * @return constexpr Quaternion& 
          */
+        template <EPrecision TPrecision = defaultPrecision>
         [[nodiscard]] inline constexpr
         Quaternion getNormalize() const noexcept;
 
@@ -221,8 +261,9 @@ namespace FoxMath
         TType dot(const Quaternion<TType>& other) const noexcept;
 
         /**
-         * @brief Rotate vector with current quaternion. Is optimized only for 1 vector, else use RotateVectos that use matricial forme.
-         *          Use Rodrigues formula and not q * v * q^-1 for optimization raison.
+         * @brief Rotate vector with current unit quaternion. Use v + 2w(u×v) + 2u×(u×v) (u the vector part of the quaternion) and not q * v * q^-1
+         *        for optimization raison : no intermediate quaternion, inverse or trigonometric function.
+         * @note Quaternion must be unit (see isRotation)
          * 
          * @param vec
          */
@@ -230,6 +271,18 @@ namespace FoxMath
         inline constexpr
         void rotateVector(Vector3<TTypeVector>& vec) const noexcept;
 
+        /**
+         * @brief Rotate count vectors with current unit quaternion. Same formula than rotateVector with quaternion hoisted out of the loop.
+         * @note Quaternion must be unit. in and out can be the same array. Float vectors use SSE with FOXMATH_USE_SIMD and are processed 4 by iteration
+         * 
+         * @param in 
+         * @param out 
+         * @param count 
+         */
+        template <typename TTypeVector>
+        inline constexpr
+        void rotateVectors(const Vector3<TTypeVector>* in, Vector3<TTypeVector>* out, size_t count) const noexcept;
+
         /**
          * @brief Perform the rotation of the vector with the formula : (q1 * q2) * v * (q1 * q2)^-1.
          *        Rotation is firstly on q2 and then on q1
@@ -272,17 +325,35 @@ namespace FoxMath
          * @brief Perform a cyllindric interpolation rotation between start and end.
          *        cyllindric interpolation is better than lerp for exigute rotaion but more expensive.
          *        Furthermore cyllindric interpolation maintain constante angular speed
+         * @note When quaternions are nearly equal (cos of angle upper than sLerpThreshold) sin(angle) tends to 0 : nLerp is used instead.
+         *       Without shortest path, sin(angle) of nearly opposite quaternions (cos of angle lower than -sLerpThreshold) is computed without 1 - cos² (see sLerpOpposite)
          * 
          * @tparam TShortestPath : true if the ratio must use the shotedt path. Else more optimized but can go with the largest path to goal 
          * @tparam TClampedRatio : true if the ratio must be clamped between 0 and 1. Else more optimized but can create erronate rotation if ratio is incorrect
+         * @tparam TPrecision : precision of acos, sin, reciprocal square root and normalize
          * @param startQuat 
          * @param endQuat 
          * @param t 
          */
-        template <bool TShortestPath = true, bool TClampedRatio = true>
+        template <bool TShortestPath = true, bool TClampedRatio = true, EPrecision TPrecision = defaultPrecision>
         inline constexpr
         void sLerp(const Quaternion<TType>& startQuat, const Quaternion<TType>& endQuat, TType t) noexcept;
 
+        /**
+         * @brief Approximation of sLerp without trigonometric function : nLerp with the ratio corrected by a polynomial of t and cos of angle
+         *        to restore a nearly constant angular speed. Angular error is lower than 0.001 rad, cost is near to nLerp
+         * @note Polynomial is fitted for the shortest path
+         * 
+         * @tparam TShortestPath : true if the ratio must use the shotedt path. Else more optimized but can go with the largest path to goal 
+         * @tparam TClampedRatio : true if the ratio must be clamped between 0 and 1. Else more optimized but can create erronate rotation if ratio is incorrect
+         * @param startQuat 
+         * @param endQuat 
+         * @param t 
+         */
+        template <bool TShortestPath = true, bool TClampedRatio = true>
+        inline constexpr
+        void approximateSLerp(const Quaternion<TType>& startQuat, const Quaternion<TType>& endQuat, TType t) noexcept;
+
         /**
          * @brief Perform a linear interpolation rotation between start and end. Angulare speed and rotation is not safe
          * 
@@ -317,26 +388,35 @@ namespace FoxMath
         /**
          * @brief Rotate vector with current quaternion. Is optimized only for 1 vector, else use RotateVectos that use matricial forme
          * 
+         * @tparam TPrecision : precision of the fused sin and cos of angle (see Numeric::sinCos)
          * @param vec 
          * @param unitAxis 
          * @param angle 
          */
-        template <typename TTypeVector, typename TTypeAxis>
+        template <EPrecision TPrecision = defaultPrecision, typename TTypeVector, typename TTypeAxis>
         static inline constexpr
         void rotateVector(Vector3<TTypeVector>& vec, const Vector3<TTypeAxis>& unitAxis, Angle<EAngleType::Radian, TType> angle) noexcept
         {
+            TType sinAngle {};
+            TType cosAngle {};
+            Numeric::sinCos<TPrecision>(static_cast<TType>(angle), sinAngle, cosAngle);
+
             //Rodrigues formula with quaternion is better than quat * vec * quat.getInverse()
-            const TType cosAngle = std::cos(static_cast<TType>(angle));
-            vec = cosAngle * vec + (static_cast<TType>(1) - cosAngle) * vec.dot(unitAxis) * unitAxis + std::sin(static_cast<TType>(angle)) * unitAxis.getCross(vec);
+            vec = cosAngle * vec + (static_cast<TType>(1) - cosAngle) * vec.dot(unitAxis) * unitAxis + sinAngle * unitAxis.getCross(vec);
         }
 
+        /**
+         * @brief Rotate vector with the quaternion created from axis and angle. Use rotateVector on the quaternion
+         * 
+         * @param vec 
+         * @param unitAxis 
+         * @param angle 
+         */
         template <typename TTypeVector, typename TTypeAxis>
         static inline constexpr
         void rotateVector2(Vector3<TTypeVector>& vec, const Vector3<TTypeAxis>& unitAxis, Angle<EAngleType::Radian, TType> angle) noexcept
         {
-            Quaternion<TType> quat (unitAxis, angle);
-            quat = quat * vec * quat.getInverse();
-            vec = quat.getXYZ();
+            Quaternion<TType>(unitAxis, angle).rotateVector(vec);
         }
 
         /**
@@ -370,10 +450,10 @@ namespace FoxMath
          * @param vec
          */
         template <typename TTypeVector>
-        inline constexpr
+        static inline constexpr
         void globalRotateVector(const Quaternion<TType>& q1, const Quaternion<TType>& q2, Vector3<TTypeVector>& vec) noexcept
         {
-            q1.GlobalRotateVector(q2, vec);
+            q1.globalRotateVector(q2, vec);
         }
 
         /**
@@ -383,12 +463,69 @@ namespace FoxMath
          * @param vec
          */
         template <typename TTypeVector>
-        inline constexpr
+        static inline constexpr
         void localRotateVector(const Quaternion<TType>& q1, const Quaternion<TType>& q2, Vector3<TTypeVector>& vec) noexcept
         {
-            q1.LocalRotateVector(q2, vec);
+            q1.localRotateVector(q2, vec);
         }
 
+        /**
+         * @brief Create the quaternion of the Fixed Angle Euler rotation : rotation on X, then on Y, then on Z around fixed axis.
+         * Same rotation as Matrix4::createFixedAngleEulerRotationMatrix. Sin and cos of the 3 half angles are evaluated in one pass (see GenericVector::getSinCos)
+         * 
+         * @tparam TPrecision : see Numeric::sinCos
+         * @param rotation : Euler angles in radian
+         * @return constexpr Quaternion<TType> 
+         */
+        template <EPrecision TPrecision = defaultPrecision>
+        [[nodiscard]] static inline constexpr
+        Quaternion<TType> createFromFixedAngleEuler(const Vector3<TType>& rotation) noexcept;
+
+        /**
+         * @brief Create count quaternions : out[i] = createFromFixedAngleEuler(rotations[i]). Half angles are gathered by block in one array and
+         * their sin and cos are evaluated with one Numeric::sinCos on arrays (SIMD for float with Fast and Approximate)
+         * 
+         * @tparam TPrecision : see Numeric::sinCos
+         * @param rotations : count Euler angles in radian
+         * @param out 
+         * @param count 
+         */
+        template <EPrecision TPrecision = defaultPrecision>
+        static inline
+        void createFromFixedAngleEuler(const Vector3<TType>* rotations, Quaternion<TType>* out, size_t count) noexcept;
+
+        /**
+         * @brief Perform sLerp on arrays : out[i] = sLerp(startQuats[i], endQuats[i], t[i]). Quaternions must be unit
+         * @note out can be startQuats or endQuats. Float quaternions use SSE with FOXMATH_USE_SIMD and are interpolated 4 by iteration
+         * 
+         * @tparam TShortestPath : true if the ratio must use the shotedt path.
+         * @tparam TClampedRatio : true if the ratio must be clamped between 0 and 1.
+         * @param startQuats 
+         * @param endQuats 
+         * @param t 
+         * @param out 
+         * @param count 
+         */
+        template <bool TShortestPath = true, bool TClampedRatio = true>
+        static inline constexpr
+        void sLerp(const Quaternion<TType>* startQuats, const Quaternion<TType>* endQuats, const TType* t, Quaternion<TType>* out, size_t count) noexcept;
+
+        /**
+         * @brief Perform approximateSLerp on arrays : out[i] = approximateSLerp(startQuats[i], endQuats[i], t[i])
+         * @note out can be startQuats or endQuats. Float quaternions use SSE with FOXMATH_USE_SIMD and are interpolated 4 by iteration
+         * 
+         * @tparam TShortestPath : true if the ratio must use the shotedt path.
+         * @tparam TClampedRatio : true if the ratio must be clamped between 0 and 1.
+         * @param startQuats 
+         * @param endQuats 
+         * @param t 
+         * @param out 
+         * @param count 
+         */
+        template <bool TShortestPath = true, bool TClampedRatio = true>
+        static inline constexpr
+        void approximateSLerp(const Quaternion<TType>* startQuats, const Quaternion<TType>* endQuats, const TType* t, Quaternion<TType>* out, size_t count) noexcept;
+
         #pragma endregion //!static methods
 
         #pragma region accessor
@@ -34,8 +34,9 @@ inline constexpr
 Quaternion<TType>::Quaternion (Vector3<TType> axis, Angle<EAngleType::Radian, TType> angle) noexcept
 {
     const TType halfAngle    = static_cast<TType>(angle) / static_cast<TType>(2);
-    const TType halfSinAngle = std::sin(halfAngle);
-    const TType halfCosAngle = std::cos(halfAngle);
+    TType halfSinAngle {};
+    TType halfCosAngle {};
+    Numeric::sinCos<defaultPrecision>(halfAngle, halfSinAngle, halfCosAngle);
 
     axis.normalize();
 
@@ -59,7 +60,7 @@ template <typename TType>
 inline constexpr
 TType Quaternion<TType>::getMagnitude() const noexcept
 {
-    return std::sqrt(getSquaredMagnitude());
+    return Numeric::sqrt(getSquaredMagnitude());
 }
 
 template <typename TType>
@@ -70,21 +71,32 @@ bool Quaternion<TType>::isRotation(TType epsilon) const noexcept
 }
 
 template <typename TType>
+template <EPrecision TPrecision>
 inline constexpr
 Quaternion<TType>& Quaternion<TType>::normalize() noexcept
 {
-    const TType magnitude = getMagnitude();
-    m_xyz /= magnitude;
-    m_w /= magnitude;
+    if constexpr (TPrecision == EPrecision::Exact)
+    {
+        const TType magnitude = getMagnitude();
+        m_xyz /= magnitude;
+        m_w /= magnitude;
+    }
+    else
+    {
+        const TType invMagnitude = Numeric::rsqrt<TPrecision>(getSquaredMagnitude());
+        m_xyz *= invMagnitude;
+        m_w *= invMagnitude;
+    }
     return *this;
 }
 
 template <typename TType>
+template <EPrecision TPrecision>
 inline constexpr
 Quaternion<TType> Quaternion<TType>::getNormalize() const noexcept
 {
     Quaternion<TType> rst (*this);
-    rst.normalize();
+    rst.template normalize<TPrecision>();
     return rst;
 }
 
@@ -126,7 +138,7 @@ template <typename TType>
 inline constexpr
 Angle<EAngleType::Radian, TType> Quaternion<TType>::getAngle() const noexcept
 {
-    return Angle<EAngleType::Radian, TType>(std::acos(m_w) * static_cast<TType>(2));
+    return Angle<EAngleType::Radian, TType>(Numeric::acos(m_w) * static_cast<TType>(2));
 }
 
 
@@ -134,7 +146,7 @@ template <typename TType>
 inline constexpr
 Vector3<TType> Quaternion<TType>::getAxis() const noexcept
 {
-    return m_xyz / (std::sin(static_cast<TType>(getAngle()) / static_cast<TType>(2)));
+    return m_xyz / (Numeric::sin(static_cast<TType>(getAngle()) / static_cast<TType>(2)));
 }
 
 template <typename TType>
@@ -172,17 +184,93 @@ TType Quaternion<TType>::dot(const Quaternion<TType>& other) const noexcept
     return m_w * other.getW() + m_x * other.getX() + m_y * other.getY() + m_z * other.getZ(); 
 }
 
+template <typename TType>
+template <typename TTypeVector>
+inline constexpr
+void Quaternion<TType>::rotateVectorScaled(Vector3<TTypeVector>& vec, TType scale) const noexcept
+{
+    const TType x = static_cast<TType>(vec[0]);
+    const TType y = static_cast<TType>(vec[1]);
+    const TType z = static_cast<TType>(vec[2]);
+
+    //t = s * (u x v)
+    const TType tx = scale * (m_y * z - m_z * y);
+    const TType ty = scale * (m_z * x - m_x * z);
+    const TType tz = scale * (m_x * y - m_y * x);
+
+    //v + w * t + u x t
+    vec.setData(0, static_cast<TTypeVector>(x + m_w * tx + (m_y * tz - m_z * ty)));
+    vec.setData(1, static_cast<TTypeVector>(y + m_w * ty + (m_z * tx - m_x * tz)));
+    vec.setData(2, static_cast<TTypeVector>(z + m_w * tz + (m_x * ty - m_y * tx)));
+}
+
+template <typename TType>
+template <EPrecision TPrecision>
+inline constexpr
+void Quaternion<TType>::sLerpOpposite(const Quaternion<TType>& startQuat, const Quaternion<TType>& endQuat, TType cosAngle, TType t) noexcept
+{
+    const TType one {static_cast<TType>(1)};
+
+    /*Part of end orthogonal to start : its length is sin(angle) without the cancellation of 1 - cos²*/
+    std::array<TType, 4> orthogonal {   endQuat.getX() - cosAngle * startQuat.getX(),
+                                        endQuat.getY() - cosAngle * startQuat.getY(),
+                                        endQuat.getZ() - cosAngle * startQuat.getZ(),
+                                        endQuat.getW() - cosAngle * startQuat.getW()};
+
+    const TType squareSin = orthogonal[0] * orthogonal[0] + orthogonal[1] * orthogonal[1] + orthogonal[2] * orthogonal[2] + orthogonal[3] * orthogonal[3];
+    TType invSin = one;
+
+    /*Exactly opposite : every great circle join them, use the perpendicular quaternion (-y, x, -w, z) of start*/
+    if (squareSin <= std::numeric_limits<TType>::epsilon())
+        orthogonal = {-startQuat.getY(), startQuat.getX(), -startQuat.getW(), startQuat.getZ()};
+    else
+        invSin = Numeric::rsqrt<TPrecision>(squareSin);
+
+    TType sinValue {};
+    TType cosValue {};
+    Numeric::sinCos<TPrecision>(t * Numeric::acos<TPrecision>(std::max<TType>(cosAngle, -one)), sinValue, cosValue);
+
+    const TType orthogonalRatio = sinValue * invSin;
+
+    m_data = {  cosValue * startQuat.getX() + orthogonalRatio * orthogonal[0],
+                cosValue * startQuat.getY() + orthogonalRatio * orthogonal[1],
+                cosValue * startQuat.getZ() + orthogonalRatio * orthogonal[2],
+                cosValue * startQuat.getW() + orthogonalRatio * orthogonal[3]};
+}
+
 template <typename TType>
 template <typename TTypeVector>
 inline constexpr
 void Quaternion<TType>::rotateVector(Vector3<TTypeVector>& vec) const noexcept
 {
-    //Rodrigues formula with quaternion is better than quat * vec * quat.getInverse()
-    TType angle = static_cast<TType>(getAngle());
-    Vector3<TType> unitAxis = getAxis();
+    rotateVectorScaled(vec, static_cast<TType>(2));
+}
 
-    const TType cosAngle = std::cos(static_cast<TType>(angle));
-    vec = cosAngle * vec + (static_cast<TType>(1) - cosAngle) * vec.dot(unitAxis) * unitAxis + std::sin(static_cast<TType>(angle)) * unitAxis.getCross(vec);
+template <typename TType>
+template <typename TTypeVector>
+inline constexpr
+void Quaternion<TType>::rotateVectors(const Vector3<TTypeVector>* in, Vector3<TTypeVector>* out, size_t count) const noexcept
+{
+#ifdef FOXMATH_SIMD_SSE
+    if constexpr (std::is_same_v<TType, float> && std::is_same_v<TTypeVector, float>)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            /*GenericVector storage is its only member : vector address is the address of its first component*/
+            SIMD::rotateVectorsBulk(m_data.data(), reinterpret_cast<const float*>(in), reinterpret_cast<float*>(out), count);
+            return;
+        }
+    }
+#endif
+
+    const Quaternion<TType> quat (*this);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        Vector3<TTypeVector> vec (in[i]);
+        quat.rotateVectorScaled(vec, static_cast<TType>(2));
+        out[i] = vec;
+    }
 }
 
 template <typename TType>
@@ -190,8 +278,9 @@ template <typename TTypeVector>
 inline constexpr
 void Quaternion<TType>::globalRotateVector(const Quaternion<TType>& otherQuat, Vector3<TTypeVector>& vec) const noexcept
 {
+    //Same result than q1q2 * vec * q1q2.getInverse() without intermediate quaternion
     const Quaternion<TType> q1q2 = (*this) * otherQuat;
-    vec = (q1q2 * vec * q1q2.getInverse()).getXYZ();
+    q1q2.rotateVectorScaled(vec, static_cast<TType>(2) / q1q2.getSquaredMagnitude());
 }
 
 template <typename TType>
@@ -199,8 +288,9 @@ template <typename TTypeVector>
 inline constexpr
 void Quaternion<TType>::localRotateVector(const Quaternion<TType>& otherQuat, Vector3<TTypeVector>& vec) const noexcept
 {
+    //Same result than q2q1 * vec * q2q1.getInverse() without intermediate quaternion
     const Quaternion<TType> q2q1 = otherQuat * (*this);
-    vec = (q2q1 * vec * q2q1.getInverse()).getXYZ();
+    q2q1.rotateVectorScaled(vec, static_cast<TType>(2) / q2q1.getSquaredMagnitude());
 }
 
 template <typename TType>
@@ -218,26 +308,217 @@ Quaternion<TType> Quaternion<TType>::getLocalSmallestDiffenceWithOther(const Qua
 }
 
 template <typename TType>
-template <bool TShortestPath, bool TClampedRatio>
+template <bool TShortestPath, bool TClampedRatio, EPrecision TPrecision>
 inline constexpr
 void Quaternion<TType>::sLerp(const Quaternion<TType>& startQuat, const Quaternion<TType>& endQuat, TType t) noexcept
 {
+    const TType zero    {static_cast<TType>(0)};
+    const TType one     {static_cast<TType>(1)};
+
     if constexpr (TClampedRatio)
-        t = std::clamp<TType>(t, static_cast<TType>(0), static_cast<TType>(1));
+        t = std::clamp<TType>(t, zero, one);
 
-    const TType dotQaQb = startQuat.dot(endQuat);
+    TType cosAngle  = startQuat.dot(endQuat);
+    TType endSign   = one;
 
     if constexpr (TShortestPath)
     {
-        const TType angle = std::acos(std::abs(dotQaQb));
-        const float sign = (dotQaQb >= static_cast<TType>(0)) * static_cast<TType>(2) - static_cast<TType>(1); //Hack to avoid branch (2x - 1) with x is bool
-        *this = (startQuat * sign * std::sin((static_cast<TType>(1) - t) * angle) + endQuat * std::sin(t * angle)) / std::sin(angle);
+        endSign     = (cosAngle >= zero) * static_cast<TType>(2) - one; //Hack to avoid branch (2x - 1) with x is bool
+        cosAngle    *= endSign;
     }
-    else
+
+    TType startRatio    = one - t;
+    TType endRatio      = t;
+
+    /*Near to 0 angle sin(angle) tends to 0 : keep lerp ratio and normalize (nLerp)*/
+    const bool isNearlyEqual = cosAngle >= sLerpThreshold;
+
+    if (!isNearlyEqual)
+    {
+        cosAngle = std::clamp<TType>(cosAngle, -one, one);
+
+        if constexpr (!TShortestPath)
+        {
+            /*Near to opposite quaternions sin(angle) tends to 0 too : 1 - cos² lose its precision*/
+            if (cosAngle <= -sLerpThreshold)
+            {
+                sLerpOpposite<TPrecision>(startQuat, endQuat, cosAngle, t);
+                return;
+            }
+        }
+
+        const TType angle       = Numeric::acos<TPrecision>(cosAngle);
+        const TType invSinAngle = Numeric::rsqrt<TPrecision>(one - cosAngle * cosAngle);
+
+        startRatio  = Numeric::sin<TPrecision>(startRatio * angle) * invSinAngle;
+        endRatio    = Numeric::sin<TPrecision>(endRatio * angle) * invSinAngle;
+    }
+
+    endRatio *= endSign;
+
+    m_data = {  startRatio * startQuat.getX() + endRatio * endQuat.getX(),
+                startRatio * startQuat.getY() + endRatio * endQuat.getY(),
+                startRatio * startQuat.getZ() + endRatio * endQuat.getZ(),
+                startRatio * startQuat.getW() + endRatio * endQuat.getW()};
+
+    if (isNearlyEqual)
+        normalize<TPrecision>();
+}
+
+template <typename TType>
+template <bool TShortestPath, bool TClampedRatio>
+inline constexpr
+void Quaternion<TType>::approximateSLerp(const Quaternion<TType>& startQuat, const Quaternion<TType>& endQuat, TType t) noexcept
+{
+    const TType zero    {static_cast<TType>(0)};
+    const TType one     {static_cast<TType>(1)};
+    const TType half    {static_cast<TType>(0.5)};
+
+    if constexpr (TClampedRatio)
+        t = std::clamp<TType>(t, zero, one);
+
+    TType cosAngle  = startQuat.dot(endQuat);
+    TType endSign   = one;
+
+    if constexpr (TShortestPath)
+    {
+        endSign     = (cosAngle >= zero) * static_cast<TType>(2) - one; //Hack to avoid branch (2x - 1) with x is bool
+        cosAngle    *= endSign;
+    }
+
+    if constexpr (!TShortestPath)
     {
-        const TType angle = std::acos(dotQaQb);
-        *this = (startQuat * std::sin((static_cast<TType>(1) - t) * angle) + endQuat * std::sin(t * angle)) / std::sin(angle);
-    }   
+        /*Near to opposite quaternions nLerp cross the null quaternion*/
+        if (cosAngle <= -sLerpThreshold)
+        {
+            sLerpOpposite<EPrecision::Approximate>(startQuat, endQuat, cosAngle, t);
+            return;
+        }
+    }
+
+    /*nLerp is too fast in the middle of interpolation and too slow at extremities : correct t with k * t(t - 0.5)(t - 1), k depend of angle*/
+    const TType a = static_cast<TType>(1.0904)   + cosAngle * (static_cast<TType>(-3.2452) + cosAngle * (static_cast<TType>(3.55645) - cosAngle * static_cast<TType>(1.43519)));
+    const TType b = static_cast<TType>(0.848013) + cosAngle * (static_cast<TType>(-1.06021) + cosAngle * static_cast<TType>(0.215638));
+    const TType k = a * (t - half) * (t - half) + b;
+
+    const TType endRatio    = t + t * (t - half) * (t - one) * k;
+    const TType startRatio  = one - endRatio;
+    const TType signedEnd   = endRatio * endSign;
+
+    m_data = {  startRatio * startQuat.getX() + signedEnd * endQuat.getX(),
+                startRatio * startQuat.getY() + signedEnd * endQuat.getY(),
+                startRatio * startQuat.getZ() + signedEnd * endQuat.getZ(),
+                startRatio * startQuat.getW() + signedEnd * endQuat.getW()};
+
+    normalize();
+}
+
+template <typename TType>
+template <EPrecision TPrecision>
+inline constexpr
+Quaternion<TType> Quaternion<TType>::createFromFixedAngleEuler(const Vector3<TType>& rotation) noexcept
+{
+    const Vector3<TType> halfRotation = rotation * static_cast<TType>(0.5);
+
+    Vector3<TType> halfSin;
+    Vector3<TType> halfCos;
+    halfRotation.template getSinCos<TPrecision>(halfSin, halfCos);
+
+    /*qz * qy * qx*/
+    const TType cxcy = halfCos.getX() * halfCos.getY();
+    const TType sxsy = halfSin.getX() * halfSin.getY();
+    const TType sxcy = halfSin.getX() * halfCos.getY();
+    const TType cxsy = halfCos.getX() * halfSin.getY();
+
+    return Quaternion<TType>(sxcy * halfCos.getZ() - cxsy * halfSin.getZ(),
+                             cxsy * halfCos.getZ() + sxcy * halfSin.getZ(),
+                             cxcy * halfSin.getZ() - sxsy * halfCos.getZ(),
+                             cxcy * halfCos.getZ() + sxsy * halfSin.getZ());
+}
+
+template <typename TType>
+template <EPrecision TPrecision>
+inline
+void Quaternion<TType>::createFromFixedAngleEuler(const Vector3<TType>* rotations, Quaternion<TType>* out, size_t count) noexcept
+{
+    constexpr size_t blockSize = 64;
+
+    /*Structure of arrays : n x, then n y, then n z*/
+    TType halfAngles    [3 * blockSize];
+    TType halfSin       [3 * blockSize];
+    TType halfCos       [3 * blockSize];
+
+    for (size_t blockStart = 0; blockStart < count; blockStart += blockSize)
+    {
+        const size_t n = std::min(blockSize, count - blockStart);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            halfAngles[i]           = rotations[blockStart + i].getX() * static_cast<TType>(0.5);
+            halfAngles[n + i]       = rotations[blockStart + i].getY() * static_cast<TType>(0.5);
+            halfAngles[2 * n + i]   = rotations[blockStart + i].getZ() * static_cast<TType>(0.5);
+        }
+
+        Numeric::sinCos<TPrecision>(halfAngles, halfSin, halfCos, 3 * n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            const TType cxcy = halfCos[i] * halfCos[n + i];
+            const TType sxsy = halfSin[i] * halfSin[n + i];
+            const TType sxcy = halfSin[i] * halfCos[n + i];
+            const TType cxsy = halfCos[i] * halfSin[n + i];
+            const TType sz   = halfSin[2 * n + i];
+            const TType cz   = halfCos[2 * n + i];
+
+            out[blockStart + i] = Quaternion<TType>(sxcy * cz - cxsy * sz, cxsy * cz + sxcy * sz, cxcy * sz - sxsy * cz, cxcy * cz + sxsy * sz);
+        }
+    }
+}
+
+template <typename TType>
+template <bool TShortestPath, bool TClampedRatio>
+inline constexpr
+void Quaternion<TType>::sLerp(const Quaternion<TType>* startQuats, const Quaternion<TType>* endQuats, const TType* t, Quaternion<TType>* out, size_t count) noexcept
+{
+#ifdef FOXMATH_SIMD_SSE
+    if constexpr (std::is_same_v<TType, float>)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            /*Quaternion storage is its only member : quaternion address is the address of x*/
+            SIMD::sLerpBulk<TShortestPath, TClampedRatio, false>(reinterpret_cast<const float*>(startQuats), reinterpret_cast<const float*>(endQuats), t, reinterpret_cast<float*>(out), count);
+            return;
+        }
+    }
+#endif
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        out[i].template sLerp<TShortestPath, TClampedRatio>(Quaternion<TType>(startQuats[i]), Quaternion<TType>(endQuats[i]), t[i]);
+    }
+}
+
+template <typename TType>
+template <bool TShortestPath, bool TClampedRatio>
+inline constexpr
+void Quaternion<TType>::approximateSLerp(const Quaternion<TType>* startQuats, const Quaternion<TType>* endQuats, const TType* t, Quaternion<TType>* out, size_t count) noexcept
+{
+#ifdef FOXMATH_SIMD_SSE
+    if constexpr (std::is_same_v<TType, float>)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            /*Quaternion storage is its only member : quaternion address is the address of x*/
+            SIMD::sLerpBulk<TShortestPath, TClampedRatio, true>(reinterpret_cast<const float*>(startQuats), reinterpret_cast<const float*>(endQuats), t, reinterpret_cast<float*>(out), count);
+            return;
+        }
+    }
+#endif
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        out[i].template approximateSLerp<TShortestPath, TClampedRatio>(Quaternion<TType>(startQuats[i]), Quaternion<TType>(endQuats[i]), t[i]);
+    }
 }
 
 template <typename TType>
@@ -346,7 +627,7 @@ template <typename TType>
 inline constexpr
 Quaternion<TType> operator-(const Quaternion<TType>& quat) noexcept
 {
-    return Quaternion<TType>(-quat.GetX(), -quat.GetY(), -quat.GetZ(), -quat.GetW());
+    return Quaternion<TType>(-quat.getX(), -quat.getY(), -quat.getZ(), -quat.getW());
 }
 
 template <typename TType, typename TTypeOther>
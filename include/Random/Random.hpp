@@ -2,17 +2,20 @@
 //Editing by Gavelle Anthony, Nisi Guillaume, Six Jonathan
 //Date : 2020-05-13 - 17 h 14
 
-#ifndef _RANDOM_H
-#define _RANDOM_H
+#ifndef _FOXMATH_RANDOM_H
+#define _FOXMATH_RANDOM_H
 
 #include <cstdlib>
 #include <time.h>
 #include <type_traits>
 #include <algorithm>
 #include <limits>
+#include <thread> //std::this_thread::get_id
+#include <functional> //std::hash
 
 #include "Vector/Vector.hpp"
 #include "Macro/Constants.hpp"
+#include "Random/RandomGenerator.hpp"
 
 namespace FoxMath
 {
@@ -34,17 +37,25 @@ namespace FoxMath
         #pragma region methods
 
         /**
-         * @brief Init random seed with the current time
+         * @brief Generator used by the static functions. Each thread has its own generator (no lock, no data race),
+         * seeded with the current time and the thread id. Use RandomGenerator directly for reproducible parallel streams
          * 
+         * @return RandomGenerator<>& 
          */
-        static void initSeed();
+        static inline RandomGenerator<>& getThreadGenerator();
 
         /**
-         * @brief Initialize random number generator
+         * @brief Init random seed of the calling thread with the current time
+         * 
+         */
+        static inline void initSeed();
+
+        /**
+         * @brief Initialize random number generator of the calling thread
          * 
          * @param seed The pseudo-random number generator is initialized using the argument passed as seed.
          */
-        static void initSeed(float seed);
+        static inline void initSeed(float seed);
 
         /**
          * @brief This will generate a number from 0.0 to 1.0, inclusive.
@@ -53,7 +64,7 @@ namespace FoxMath
          * @return T 
          */
         template<typename T = float> 
-        static auto unitValue() -> std::enable_if_t<std::is_floating_point<T>::value, T>;
+        static inline auto unitValue() -> std::enable_if_t<std::is_floating_point<T>::value, T>;
 
 
         /**
@@ -63,7 +74,7 @@ namespace FoxMath
          * @return T 
          */
         template<typename T = int> 
-        static auto unitValue() -> std::enable_if_t<std::is_integral<T>::value, T>;
+        static inline auto unitValue() -> std::enable_if_t<std::is_integral<T>::value, T>;
 
         /**
          * @brief This will generate a number from 0.0 to some arbitrary float, max:
@@ -73,10 +84,10 @@ namespace FoxMath
          * @return T 
          */
         template<typename T = float>
-        static auto ranged(const T& max) -> std::enable_if_t<std::is_floating_point<T>::value, T>;
+        static inline auto ranged(const T& max) -> std::enable_if_t<std::is_floating_point<T>::value, T>;
 
         template<typename T = int>
-        static auto ranged(const T& max) -> std::enable_if_t<std::is_integral<T>::value, T>;
+        static inline auto ranged(const T& max) -> std::enable_if_t<std::is_integral<T>::value, T>;
 
         /**
          * @brief This will generate a number from some arbitrary min to some arbitrary max:
@@ -87,7 +98,7 @@ namespace FoxMath
          * @return T 
          */
         template<typename T = float>
-        static auto ranged(const T& min, const T& max) -> std::enable_if_t<std::is_floating_point<T>::value, T>;
+        static inline auto ranged(const T& min, const T& max) -> std::enable_if_t<std::is_floating_point<T>::value, T>;
 
         template<typename T = int>
         static inline auto ranged(const T& min, const T& max) -> std::enable_if_t<std::is_integral<T>::value, T>;
@@ -95,26 +106,26 @@ namespace FoxMath
 #pragma region Cicular
 
         template<typename T = float>
-        static Vec2<T> circularCoordinate(const Vec2<T>& center, const T& range);
+        static inline Vec2<T> circularCoordinate(const Vec2<T>& center, const T& range);
 
         template<typename T = float>
-        static Vec2<T> peripheralCircularCoordinate(const Vec2<T>& center, const T& range);
+        static inline Vec2<T> peripheralCircularCoordinate(const Vec2<T>& center, const T& range);
 
         template<typename T = float>
-        static Vec2<T> unitPeripheralCircularCoordinate();
+        static inline Vec2<T> unitPeripheralCircularCoordinate();
 
 #pragma endregion //!Cicular
 
 #pragma region Spherique
 
         template<typename T = float>
-        static Vec3<T> unitPeripheralSphericalCoordonate();
+        static inline Vec3<T> unitPeripheralSphericalCoordonate();
 
         template<typename T = float>
-        static Vec3<T> sphericalCoordinate(const Vec3<T>& center, const T& range);
+        static inline Vec3<T> sphericalCoordinate(const Vec3<T>& center, const T& range);
 
         template<typename T = float>
-        static Vec3<T> peripheralSphericalCoordinate(const Vec3<T>& center, const T& range);
+        static inline Vec3<T> peripheralSphericalCoordinate(const Vec3<T>& center, const T& range);
 
 
 #pragma endregion //!Spherique
@@ -122,7 +133,7 @@ namespace FoxMath
 #pragma region Square
 
        template<typename T = float>
-        static Vec2<T> peripheralSquareCoordinate(const Vec2<T>& center, const T& extX, const T& extY);
+        static inline Vec2<T> peripheralSquareCoordinate(const Vec2<T>& center, const T& extX, const T& extY);
 
         /**
          * @brief return square coordonate
@@ -134,7 +145,7 @@ namespace FoxMath
          * @return Vec2<T> 
          */
         template<typename T = float>
-        static Vec2<T> squareCoordinate(const Vec2<T>& center, const T& extX, const T& extY);
+        static inline Vec2<T> squareCoordinate(const Vec2<T>& center, const T& extX, const T& extY);
 
         /**
          * @brief return unit sqare with value between 0 and 1
@@ -143,7 +154,7 @@ namespace FoxMath
          * @return Vec2<T> 
          */
         template<typename T = float>
-        static Vec2<T> unitPeripheralSquareCoordinate();
+        static inline Vec2<T> unitPeripheralSquareCoordinate();
 
 #pragma endregion //!Square
 
@@ -151,7 +162,7 @@ namespace FoxMath
         
 
         template<typename T = float>
-        static Vec3<T> peripheralCubiqueCoordinate(const Vec3<T>& center, const T& extX, const T& extY, const T& extZ);
+        static inline Vec3<T> peripheralCubiqueCoordinate(const Vec3<T>& center, const T& extX, const T& extY, const T& extZ);
         
         /**
          * @brief return cubique coordonate
@@ -164,7 +175,7 @@ namespace FoxMath
          * @return Vec3<T> 
          */
         template<typename T = float>
-        static Vec3<T> cubiqueCoordinate(const Vec3<T>& center, const T& extX, const T& extY, const T& extZ);
+        static inline Vec3<T> cubiqueCoordinate(const Vec3<T>& center, const T& extX, const T& extY, const T& extZ);
 
         /**
          * @brief return unit cubic with value between 0 and 1
@@ -173,10 +184,44 @@ namespace FoxMath
          * @return Vec3<T> 
          */
         template<typename T = float>
-        static Vec3<T> unitPeripheralCubiqueCoordinate();
+        static inline Vec3<T> unitPeripheralCubiqueCoordinate();
 
 #pragma endregion //!Cubique
 
+#pragma region Bulk
+
+        /**
+         * @brief Fill out with count values from 0.0 to 1.0 (see RandomGenerator::fillUnitValue)
+         */
+        template<typename T = float>
+        static inline void fillUnitValue(T* out, size_t count);
+
+        /**
+         * @brief Fill out with count values from min to max (see RandomGenerator::fillRanged)
+         */
+        template<typename T = float>
+        static inline void fillRanged(T* out, size_t count, const T& min, const T& max);
+
+        /**
+         * @brief Fill out with count squareCoordinate (see RandomGenerator::fillSquareCoordinate)
+         */
+        template<typename T = float>
+        static inline void fillSquareCoordinate(Vec2<T>* out, size_t count, const Vec2<T>& center, const T& extX, const T& extY);
+
+        /**
+         * @brief Fill out with count cubiqueCoordinate (see RandomGenerator::fillCubiqueCoordinate)
+         */
+        template<typename T = float>
+        static inline void fillCubiqueCoordinate(Vec3<T>* out, size_t count, const Vec3<T>& center, const T& extX, const T& extY, const T& extZ);
+
+        /**
+         * @brief Fill out with count unitPeripheralSphericalCoordonate (see RandomGenerator::fillUnitPeripheralSphericalCoordonate)
+         */
+        template<typename T = float>
+        static inline void fillUnitPeripheralSphericalCoordonate(Vec3<T>* out, size_t count);
+
+#pragma endregion //!Bulk
+
         /**
          * @brief return if purcent value is respect in randome case. Inclusive test
          * 
@@ -186,7 +231,7 @@ namespace FoxMath
          * @return false 
          */
         template<typename T = float>
-        static bool ranPercentProba(const T& percent);
+        static inline bool ranPercentProba(const T& percent);
 
         #pragma endregion //!methods
     };
@@ -195,4 +240,4 @@ namespace FoxMath
 
 } //namespace FoxMath
 
-#endif //_RANDOM_H
\ No newline at end of file
+#endif //_FOXMATH_RANDOM_H
\ No newline at end of file
@@ -1,167 +1,161 @@
 #include "Random/Random.hpp"
 
+RandomGenerator<>& Random::getThreadGenerator()
+{
+    thread_local RandomGenerator<> generator (static_cast<uint64_t>(time(NULL)) ^ static_cast<uint64_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())));
+    return generator;
+}
+
 void Random::initSeed()
 {
-    std::srand(time(NULL));
+    getThreadGenerator().seed(static_cast<uint64_t>(time(NULL)) ^ static_cast<uint64_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())));
 }
 
 void Random::initSeed(float seed)
 {
-    srand(seed);
+    getThreadGenerator().seed(static_cast<uint64_t>(seed));
 }
 
-template<typename T = float> 
+template<typename T> 
 auto Random::unitValue() -> std::enable_if_t<std::is_floating_point<T>::value, T>
 {
-    return static_cast <T> (rand()) / static_cast <T> (RAND_MAX);
+    return getThreadGenerator().unitValue<T>();
 } 
 
-template<typename T = int> 
+template<typename T> 
 auto Random::unitValue() -> std::enable_if_t<std::is_integral<T>::value, T>
 {
-    return static_cast<T>(rand() % static_cast<T>(2));
+    return getThreadGenerator().unitValue<T>();
 }
 
-template<typename T = float>
+template<typename T>
 auto Random::ranged(const T& max) -> std::enable_if_t<std::is_floating_point<T>::value, T>
 {
-    return max <= std::numeric_limits<T>::epsilon() ? static_cast<T>(0) : static_cast <T> (rand()) / (static_cast <T> (RAND_MAX / max));
+    return getThreadGenerator().ranged<T>(max);
 }
 
-template<typename T = int>
+template<typename T>
 auto Random::ranged(const T& max) -> std::enable_if_t<std::is_integral<T>::value, T>
 {
-    return max <= std::numeric_limits<T>::epsilon() ? static_cast<T>(0) : ranged<T>(0, max);
+    return getThreadGenerator().ranged<T>(max);
 }
 
 template<typename T>
 auto Random::ranged(const T& min, const T& max)  -> std::enable_if_t<std::is_floating_point<T>::value, T>
 {
-    return max - min <= std::numeric_limits<T>::epsilon() ? max : min + static_cast <T> (rand()) /( static_cast <T> (RAND_MAX/(max - min)));
+    return getThreadGenerator().ranged<T>(min, max);
 }
 
 template<typename T>
 auto Random::ranged(const T& min, const T& max) -> std::enable_if_t<std::is_integral<T>::value, T>
 {
-    return max - min <= std::numeric_limits<T>::epsilon() ? max : min + static_cast <T> (rand()) / (static_cast <T> (RAND_MAX/((max + static_cast<T>(1)) - min)));
+    return getThreadGenerator().ranged<T>(min, max);
 }
 
-template<typename T = float>
+template<typename T>
 Vec2<T> Random::circularCoordinate(const Vec2<T>& center, const T& range)
 {
-    T randValue = static_cast<T>(rand());
-    T scale = unitValue<T>();
-    return Vec2<T>{center.x + range * std::cos(randValue) * scale, center.y + range * std::sin(randValue) * scale};
+    return getThreadGenerator().circularCoordinate<T>(center, range);
 }
 
-template<typename T = float>
+template<typename T>
 Vec2<T> Random::peripheralCircularCoordinate(const Vec2<T>& center, const T& range)
 {
-    T randValue = static_cast<T>(rand());
-    return Vec2<T>{center.x + range * std::cos(randValue), center.y + range * std::sin(randValue)};
+    return getThreadGenerator().peripheralCircularCoordinate<T>(center, range);
 }
 
-template<typename T = float>
+template<typename T>
 Vec2<T> Random::unitPeripheralCircularCoordinate()
 {
-    T randValue = static_cast<T>(rand());
-    return Vec2<T>{std::cos(randValue), std::sin(randValue)};
+    return getThreadGenerator().unitPeripheralCircularCoordinate<T>();
 }
 
-template<typename T = float>
+template<typename T>
 Vec3<T> Random::unitPeripheralSphericalCoordonate()
 {
-    T phi = ranged<T>(static_cast<T>(0), static_cast<T>(PI * static_cast<T>(2)));
-    T theta = ranged<T>(static_cast<T>(0), static_cast<T>(PI * static_cast<T>(2)));
-    return Vec3<T>{std::sin(phi) * std::cos(theta), std::sin(phi) * std::sin(theta), std::cos(phi)};
+    return getThreadGenerator().unitPeripheralSphericalCoordonate<T>();
 }
 
-template<typename T = float>
+template<typename T>
 Vec3<T> Random::sphericalCoordinate(const Vec3<T>& center, const T& range)
 {
-    return (center + unitPeripheralSphericalCoordonate()) * unitValue<T>() * range;
+    return getThreadGenerator().sphericalCoordinate<T>(center, range);
 }
 
-template<typename T = float>
+template<typename T>
 Vec3<T> Random::peripheralSphericalCoordinate(const Vec3<T>& center, const T& range)
 {
-    return (center + unitPeripheralSphericalCoordonate()) * range;
+    return getThreadGenerator().peripheralSphericalCoordinate<T>(center, range);
 }
 
-template<typename T = float>
+template<typename T>
 Vec2<T> Random::peripheralSquareCoordinate(const Vec2<T>& center, const T& extX, const T& extY)
 {           
-    if (unitValue<bool>())
-    {
-        if (unitValue<bool>())
-        {
-            return Vec2<T>{center.x -extX, center.y + ranged<T>(-extY, extY)};
-        }
-        return Vec2<T>{center.x + extX, center.y + ranged<T>(-extY, extY)};
-    }
-
-    if (unitValue<bool>())
-    {
-        return Vec2<T>{center.x + ranged<T>(-extX, extX), center.y - extY};
-    }
-    return Vec2<T>{center.x + ranged<T>(-extX, extX), center.y + extY};
-}
-
-template<typename T = float>
+    return getThreadGenerator().peripheralSquareCoordinate<T>(center, extX, extY);
+}
+
+template<typename T>
 Vec2<T> Random::squareCoordinate(const Vec2<T>& center, const T& extX, const T& extY)
 {           
-    return Vec2<T>{center.x + ranged<T>(-extX, extX), center.y + ranged<T>(-extY, extY)};
+    return getThreadGenerator().squareCoordinate<T>(center, extX, extY);
 }
 
-template<typename T = float>
+template<typename T>
 Vec2<T> Random::unitPeripheralSquareCoordinate()
 {
-    return Vec2<T>{unitValue<T>(), unitValue<T>()};
+    return getThreadGenerator().unitPeripheralSquareCoordinate<T>();
 }       
 
-template<typename T = float>
+template<typename T>
 Vec3<T> Random::peripheralCubiqueCoordinate(const Vec3<T>& center, const T& extX, const T& extY, const T& extZ)
 {    
-    if (unitValue<bool>())
-    {
-        if (unitValue<bool>())
-        {
-            return Vec3<T>{center.x -extX, center.y + ranged<T>(-extY, extY), center.z + ranged<T>(-extZ, extZ)};
-        }
-        return Vec3<T>{center.x + extX, center.y + ranged<T>(-extY, extY), center.z + ranged<T>(-extZ, extZ)};
-    }
-
-    if (unitValue<bool>())
-    {
-        if (unitValue<bool>())
-        {
-            return Vec3<T>{center.x + ranged<T>(-extX, extX), center.y -extY, center.z + ranged<T>(-extZ, extZ)};
-        }
-        return Vec3<T>{center.x + ranged<T>(-extX, extX), center.y + extY, center.z + ranged<T>(-extZ, extZ)};
-    }
-
-    if (unitValue<bool>())
-    {
-        return Vec3<T>{center.x + ranged<T>(-extX, extX), center.y + ranged<T>(-extY, extY), center.z -extZ};
-    }
-    return Vec3<T>{center.x + ranged<T>(-extX, extX), center.y + ranged<T>(-extY, extY), center.z + extZ};
-}
-
-
-template<typename T = float>
+    return getThreadGenerator().peripheralCubiqueCoordinate<T>(center, extX, extY, extZ);
+}
+
+template<typename T>
 Vec3<T> Random::cubiqueCoordinate(const Vec3<T>& center, const T& extX, const T& extY, const T& extZ)
 {           
-    return Vec3<T>{center.x + ranged<T>(-extX, extX), center.y + ranged<T>(-extY, extY), center.z + ranged<T>(-extZ, extZ)};
+    return getThreadGenerator().cubiqueCoordinate<T>(center, extX, extY, extZ);
 }
 
-template<typename T = float>
+template<typename T>
 Vec3<T> Random::unitPeripheralCubiqueCoordinate()
 {
-    return Vec3<T>{unitValue<T>(), unitValue<T>(), unitValue<T>()};
+    return getThreadGenerator().unitPeripheralCubiqueCoordinate<T>();
 }
 
-template<typename T = float>
+template<typename T>
+void Random::fillUnitValue(T* out, size_t count)
+{
+    getThreadGenerator().fillUnitValue<T>(out, count);
+}
+
+template<typename T>
+void Random::fillRanged(T* out, size_t count, const T& min, const T& max)
+{
+    getThreadGenerator().fillRanged<T>(out, count, min, max);
+}
+
+template<typename T>
+void Random::fillSquareCoordinate(Vec2<T>* out, size_t count, const Vec2<T>& center, const T& extX, const T& extY)
+{
+    getThreadGenerator().fillSquareCoordinate<T>(out, count, center, extX, extY);
+}
+
+template<typename T>
+void Random::fillCubiqueCoordinate(Vec3<T>* out, size_t count, const Vec3<T>& center, const T& extX, const T& extY, const T& extZ)
+{
+    getThreadGenerator().fillCubiqueCoordinate<T>(out, count, center, extX, extY, extZ);
+}
+
+template<typename T>
+void Random::fillUnitPeripheralSphericalCoordonate(Vec3<T>* out, size_t count)
+{
+    getThreadGenerator().fillUnitPeripheralSphericalCoordonate<T>(out, count);
+}
+
+template<typename T>
 bool Random::ranPercentProba(const T& percent)
 { 
-    return ranged<T>(static_cast<T>(0), static_cast<T>(100)) <= percent;
-}
\ No newline at end of file
+    return getThreadGenerator().ranPercentProba<T>(percent);
+}
@@ -0,0 +1,364 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 14 h 40
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h> //uint64_t
+#include <type_traits> //std::enable_if_t, std::is_floating_point, std::is_integral
+#include <limits> //std::numeric_limits
+#include <cmath> //std::cos, std::sin, std::sqrt
+#include <algorithm> //std::max
+#include <array> //std::array
+
+#include "Random/Xoshiro256PlusPlus.hpp"
+#include "Vector/Vector2.hpp"
+#include "Vector/Vector3.hpp"
+#include "Macro/Constants.hpp" //TWO_PI
+#include "SIMD/SIMD.hpp" //SIMD::uniformBulk
+
+namespace FoxMath
+{
+    /**
+     * @brief Instantiable random generator. Same functions than Random without global state : use one instance by thread
+     * (split a main generator to create independent streams) and seed it to get reproducible sequences
+     * 
+     * @tparam TEngine : 64 bits UniformRandomBitGenerator on full range (Xoshiro256PlusPlus, std::mt19937_64...)
+     */
+    template <typename TEngine = Xoshiro256PlusPlus>
+    class RandomGenerator
+    {
+        static_assert(TEngine::min() == 0 && TEngine::max() == std::numeric_limits<uint64_t>::max(), "Engine must generate 64 bits values");
+
+        protected:
+
+        #pragma region attribut
+
+        TEngine m_engine;
+
+        #pragma endregion //!attribut
+
+        #pragma region methods
+
+        /**
+         * @brief out[i] = min[i % TPatternLength] + u * range[i % TPatternLength] with u uniform in [0, 1[. Vec2, Vec3 and Vec4 arrays are filled as scalar arrays with a pattern
+         * @note Float with FOXMATH_USE_SIMD use 4 xoshiro128+ streams (SIMD::uniformBulk) seeded by the engine
+         * 
+         * @tparam TPatternLength : 4, or 12 for Vec3 arrays
+         * @param out 
+         * @param count : number of scalars
+         * @param min 
+         * @param range 
+         */
+        template<typename T, size_t TPatternLength = 4>
+        inline void fillPattern(T* out, size_t count, const std::array<T, TPatternLength>& min, const std::array<T, TPatternLength>& range) noexcept;
+
+        #pragma endregion //!methods
+
+        public:
+
+        #pragma region constructor/destructor
+
+        /**
+         * @brief Deterministic seeding : the same seed always give the same sequence
+         * 
+         * @param seed 
+         */
+        explicit inline
+        RandomGenerator (uint64_t seed = 0) noexcept;
+
+        explicit inline
+        RandomGenerator (const TEngine& engine) noexcept;
+
+        inline
+        RandomGenerator (const RandomGenerator& other) noexcept             = default;
+
+        inline
+        RandomGenerator (RandomGenerator&& other) noexcept                  = default;
+
+        inline
+        ~RandomGenerator () noexcept                                        = default;
+
+        inline
+        RandomGenerator& operator=(RandomGenerator const& other) noexcept   = default;
+
+        inline
+        RandomGenerator& operator=(RandomGenerator && other) noexcept       = default;
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Reset the engine with seed
+         * 
+         * @param seed 
+         */
+        inline
+        void seed (uint64_t seed) noexcept;
+
+        /**
+         * @brief Jump the engine on the next non overlapping sub sequence
+         * 
+         */
+        inline
+        void jump () noexcept;
+
+        /**
+         * @brief Return a generator on the current sub sequence and jump this one on the next sub sequence.
+         * Call it n times on a main generator to create n independent streams (one by thread)
+         * 
+         * @return RandomGenerator 
+         */
+        [[nodiscard]] inline
+        RandomGenerator split () noexcept;
+
+        /**
+         * @brief This will generate a number from 0.0 to 1.0, inclusive.
+         * 
+         * @tparam floating point type 
+         * @return T 
+         */
+        template<typename T = float> 
+        inline auto unitValue() noexcept -> std::enable_if_t<std::is_floating_point<T>::value, T>;
+
+        /**
+         * @brief This will generate a number from 0 to 1, inclusive.
+         * 
+         * @tparam integral type 
+         * @return T 
+         */
+        template<typename T = int> 
+        inline auto unitValue() noexcept -> std::enable_if_t<std::is_integral<T>::value, T>;
+
+        /**
+         * @brief This will generate a number from 0.0 to some arbitrary float, max:
+         * 
+         * @tparam float 
+         * @param max 
+         * @return T 
+         */
+        template<typename T = float>
+        inline auto ranged(const T& max) noexcept -> std::enable_if_t<std::is_floating_point<T>::value, T>;
+
+        template<typename T = int>
+        inline auto ranged(const T& max) noexcept -> std::enable_if_t<std::is_integral<T>::value, T>;
+
+        /**
+         * @brief This will generate a number from some arbitrary min to some arbitrary max, inclusive:
+         * 
+         * @tparam float 
+         * @param min 
+         * @param max 
+         * @return T 
+         */
+        template<typename T = float>
+        inline auto ranged(const T& min, const T& max) noexcept -> std::enable_if_t<std::is_floating_point<T>::value, T>;
+
+        template<typename T = int>
+        inline auto ranged(const T& min, const T& max) noexcept -> std::enable_if_t<std::is_integral<T>::value, T>;
+
+#pragma region Cicular
+
+        template<typename T = float>
+        inline Vec2<T> circularCoordinate(const Vec2<T>& center, const T& range) noexcept;
+
+        template<typename T = float>
+        inline Vec2<T> peripheralCircularCoordinate(const Vec2<T>& center, const T& range) noexcept;
+
+        template<typename T = float>
+        inline Vec2<T> unitPeripheralCircularCoordinate() noexcept;
+
+#pragma endregion //!Cicular
+
+#pragma region Spherique
+
+        /**
+         * @brief return point uniformly distributed on unit sphere
+         * 
+         * @tparam float 
+         * @return Vec3<T> 
+         */
+        template<typename T = float>
+        inline Vec3<T> unitPeripheralSphericalCoordonate() noexcept;
+
+        template<typename T = float>
+        inline Vec3<T> sphericalCoordinate(const Vec3<T>& center, const T& range) noexcept;
+
+        template<typename T = float>
+        inline Vec3<T> peripheralSphericalCoordinate(const Vec3<T>& center, const T& range) noexcept;
+
+#pragma endregion //!Spherique
+
+#pragma region Square
+
+        template<typename T = float>
+        inline Vec2<T> peripheralSquareCoordinate(const Vec2<T>& center, const T& extX, const T& extY) noexcept;
+
+        /**
+         * @brief return square coordonate
+         * 
+         * @tparam float 
+         * @param center the center of the square
+         * @param extX half saquare extension on x axis
+         * @param extY half saquare extension on y axis
+         * @return Vec2<T> 
+         */
+        template<typename T = float>
+        inline Vec2<T> squareCoordinate(const Vec2<T>& center, const T& extX, const T& extY) noexcept;
+
+        /**
+         * @brief return unit sqare with value between 0 and 1
+         * 
+         * @tparam float 
+         * @return Vec2<T> 
+         */
+        template<typename T = float>
+        inline Vec2<T> unitPeripheralSquareCoordinate() noexcept;
+
+#pragma endregion //!Square
+
+#pragma region Cubique
+
+        template<typename T = float>
+        inline Vec3<T> peripheralCubiqueCoordinate(const Vec3<T>& center, const T& extX, const T& extY, const T& extZ) noexcept;
+
+        /**
+         * @brief return cubique coordonate
+         * 
+         * @tparam float 
+         * @param center the center of the square
+         * @param extX half saquare extension on x axis
+         * @param extY half saquare extension on y axis
+         * @param extZ half saquare extension on z axis
+         * @return Vec3<T> 
+         */
+        template<typename T = float>
+        inline Vec3<T> cubiqueCoordinate(const Vec3<T>& center, const T& extX, const T& extY, const T& extZ) noexcept;
+
+        /**
+         * @brief return unit cubic with value between 0 and 1
+         * 
+         * @tparam float 
+         * @return Vec3<T> 
+         */
+        template<typename T = float>
+        inline Vec3<T> unitPeripheralCubiqueCoordinate() noexcept;
+
+#pragma endregion //!Cubique
+
+#pragma region Bulk
+
+        /**
+         * @brief Fill out with count values from 0.0 to 1.0 (1.0 excluded for float). One pass without call by value
+         * 
+         * @tparam float 
+         * @param out 
+         * @param count 
+         */
+        template<typename T = float>
+        inline void fillUnitValue(T* out, size_t count) noexcept;
+
+        /**
+         * @brief Fill out with count values from min to max (max excluded for float)
+         * 
+         * @tparam float 
+         * @param out 
+         * @param count 
+         * @param min 
+         * @param max 
+         */
+        template<typename T = float>
+        inline void fillRanged(T* out, size_t count, const T& min, const T& max) noexcept;
+
+        /**
+         * @brief Fill out with count squareCoordinate
+         * 
+         * @tparam float 
+         * @param out 
+         * @param count 
+         * @param center the center of the square
+         * @param extX half saquare extension on x axis
+         * @param extY half saquare extension on y axis
+         */
+        template<typename T = float>
+        inline void fillSquareCoordinate(Vec2<T>* out, size_t count, const Vec2<T>& center, const T& extX, const T& extY) noexcept;
+
+        /**
+         * @brief Fill out with count cubiqueCoordinate
+         * 
+         * @tparam float 
+         * @param out 
+         * @param count 
+         * @param center the center of the square
+         * @param extX half saquare extension on x axis
+         * @param extY half saquare extension on y axis
+         * @param extZ half saquare extension on z axis
+         */
+        template<typename T = float>
+        inline void fillCubiqueCoordinate(Vec3<T>* out, size_t count, const Vec3<T>& center, const T& extX, const T& extY, const T& extZ) noexcept;
+
+        /**
+         * @brief Fill out with count unitPeripheralSphericalCoordonate. Uniform values are generated by block before cos and sin
+         * 
+         * @tparam float 
+         * @param out 
+         * @param count 
+         */
+        template<typename T = float>
+        inline void fillUnitPeripheralSphericalCoordonate(Vec3<T>* out, size_t count) noexcept;
+
+#pragma endregion //!Bulk
+
+        /**
+         * @brief return if purcent value is respect in randome case. Inclusive test
+         * 
+         * @tparam float 
+         * @param percent 
+         * @return true 
+         * @return false 
+         */
+        template<typename T = float>
+        inline bool ranPercentProba(const T& percent) noexcept;
+
+        #pragma endregion //!methods
+
+        #pragma region accessor
+
+        [[nodiscard]] inline
+        TEngine& getEngine() noexcept { return m_engine; }
+
+        [[nodiscard]] inline
+        const TEngine& getEngine() const noexcept { return m_engine; }
+
+        #pragma endregion //!accessor
+    };
+
+    #include "RandomGenerator.inl"
+
+} /*namespace FoxMath*/
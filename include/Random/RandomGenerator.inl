@@ -0,0 +1,396 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 14 h 40
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <typename TEngine>
+inline
+RandomGenerator<TEngine>::RandomGenerator (uint64_t seed) noexcept
+    :   m_engine    (seed)
+{}
+
+template <typename TEngine>
+inline
+RandomGenerator<TEngine>::RandomGenerator (const TEngine& engine) noexcept
+    :   m_engine    (engine)
+{}
+
+template <typename TEngine>
+inline
+void RandomGenerator<TEngine>::seed (uint64_t seed) noexcept
+{
+    m_engine.seed(seed);
+}
+
+template <typename TEngine>
+inline
+void RandomGenerator<TEngine>::jump () noexcept
+{
+    m_engine.jump();
+}
+
+template <typename TEngine>
+inline
+RandomGenerator<TEngine> RandomGenerator<TEngine>::split () noexcept
+{
+    RandomGenerator rst (*this);
+    jump();
+    return rst;
+}
+
+template <typename TEngine>
+template<typename T> 
+inline auto RandomGenerator<TEngine>::unitValue() noexcept -> std::enable_if_t<std::is_floating_point<T>::value, T>
+{
+    if constexpr (sizeof(T) <= sizeof(float))
+    {
+        //24 bits of mantissa. Scale is computed in double so the max value give exactly 1
+        return static_cast<T>(static_cast<double>(m_engine() >> 40) * (1.0 / 16777215.0));
+    }
+    else
+    {
+        //53 bits of mantissa
+        return static_cast<T>(m_engine() >> 11) * (static_cast<T>(1) / static_cast<T>(9007199254740991.0));
+    }
+}
+
+template <typename TEngine>
+template<typename T> 
+inline auto RandomGenerator<TEngine>::unitValue() noexcept -> std::enable_if_t<std::is_integral<T>::value, T>
+{
+    //Upper bit is the best quality bit
+    return static_cast<T>(m_engine() >> 63);
+}
+
+template <typename TEngine>
+template<typename T>
+inline auto RandomGenerator<TEngine>::ranged(const T& max) noexcept -> std::enable_if_t<std::is_floating_point<T>::value, T>
+{
+    return max <= std::numeric_limits<T>::epsilon() ? static_cast<T>(0) : unitValue<T>() * max;
+}
+
+template <typename TEngine>
+template<typename T>
+inline auto RandomGenerator<TEngine>::ranged(const T& max) noexcept -> std::enable_if_t<std::is_integral<T>::value, T>
+{
+    return max <= static_cast<T>(0) ? static_cast<T>(0) : ranged<T>(static_cast<T>(0), max);
+}
+
+template <typename TEngine>
+template<typename T>
+inline auto RandomGenerator<TEngine>::ranged(const T& min, const T& max) noexcept -> std::enable_if_t<std::is_floating_point<T>::value, T>
+{
+    return max - min <= std::numeric_limits<T>::epsilon() ? max : min + unitValue<T>() * (max - min);
+}
+
+template <typename TEngine>
+template<typename T>
+inline auto RandomGenerator<TEngine>::ranged(const T& min, const T& max) noexcept -> std::enable_if_t<std::is_integral<T>::value, T>
+{
+    if (max <= min)
+        return max;
+
+    using TUnsigned = std::make_unsigned_t<T>;
+
+    //Number of values minus one, computed in unsigned to avoid overflow
+    const uint64_t rangeMinusOne = static_cast<uint64_t>(static_cast<TUnsigned>(static_cast<TUnsigned>(max) - static_cast<TUnsigned>(min)));
+
+    uint64_t offset;
+    if (rangeMinusOne < std::numeric_limits<uint32_t>::max())
+    {
+        //Multiply shift (Lemire) on 32 upper bits : no division
+        offset = ((m_engine() >> 32) * (rangeMinusOne + 1)) >> 32;
+    }
+    else
+    {
+        offset = rangeMinusOne == std::numeric_limits<uint64_t>::max() ? m_engine() : m_engine() % (rangeMinusOne + 1);
+    }
+
+    return static_cast<T>(static_cast<TUnsigned>(static_cast<TUnsigned>(min) + static_cast<TUnsigned>(offset)));
+}
+
+template <typename TEngine>
+template<typename T>
+inline Vec2<T> RandomGenerator<TEngine>::circularCoordinate(const Vec2<T>& center, const T& range) noexcept
+{
+    const T angle = ranged<T>(static_cast<T>(0), static_cast<T>(TWO_PI));
+    const T scale = unitValue<T>() * range;
+    return Vec2<T>(center.getX() + std::cos(angle) * scale, center.getY() + std::sin(angle) * scale);
+}
+
+template <typename TEngine>
+template<typename T>
+inline Vec2<T> RandomGenerator<TEngine>::peripheralCircularCoordinate(const Vec2<T>& center, const T& range) noexcept
+{
+    const T angle = ranged<T>(static_cast<T>(0), static_cast<T>(TWO_PI));
+    return Vec2<T>(center.getX() + std::cos(angle) * range, center.getY() + std::sin(angle) * range);
+}
+
+template <typename TEngine>
+template<typename T>
+inline Vec2<T> RandomGenerator<TEngine>::unitPeripheralCircularCoordinate() noexcept
+{
+    const T angle = ranged<T>(static_cast<T>(0), static_cast<T>(TWO_PI));
+    return Vec2<T>(std::cos(angle), std::sin(angle));
+}
+
+template <typename TEngine>
+template<typename T>
+inline Vec3<T> RandomGenerator<TEngine>::unitPeripheralSphericalCoordonate() noexcept
+{
+    //Uniform z and longitude give uniform distribution on sphere (Archimedes)
+    const T z       = ranged<T>(static_cast<T>(-1), static_cast<T>(1));
+    const T angle   = ranged<T>(static_cast<T>(0), static_cast<T>(TWO_PI));
+    const T radius  = std::sqrt(std::max(static_cast<T>(0), static_cast<T>(1) - z * z));
+    return Vec3<T>(radius * std::cos(angle), radius * std::sin(angle), z);
+}
+
+template <typename TEngine>
+template<typename T>
+inline Vec3<T> RandomGenerator<TEngine>::sphericalCoordinate(const Vec3<T>& center, const T& range) noexcept
+{
+    return center + unitPeripheralSphericalCoordonate<T>() * (unitValue<T>() * range);
+}
+
+template <typename TEngine>
+template<typename T>
+inline Vec3<T> RandomGenerator<TEngine>::peripheralSphericalCoordinate(const Vec3<T>& center, const T& range) noexcept
+{
+    return center + unitPeripheralSphericalCoordonate<T>() * range;
+}
+
+template <typename TEngine>
+template<typename T>
+inline Vec2<T> RandomGenerator<TEngine>::peripheralSquareCoordinate(const Vec2<T>& center, const T& extX, const T& extY) noexcept
+{
+    if (unitValue<bool>())
+    {
+        const T x = unitValue<bool>() ? center.getX() - extX : center.getX() + extX;
+        return Vec2<T>(x, center.getY() + ranged<T>(-extY, extY));
+    }
+
+    const T y = unitValue<bool>() ? center.getY() - extY : center.getY() + extY;
+    return Vec2<T>(center.getX() + ranged<T>(-extX, extX), y);
+}
+
+template <typename TEngine>
+template<typename T>
+inline Vec2<T> RandomGenerator<TEngine>::squareCoordinate(const Vec2<T>& center, const T& extX, const T& extY) noexcept
+{
+    const T x = center.getX() + ranged<T>(-extX, extX);
+    const T y = center.getY() + ranged<T>(-extY, extY);
+    return Vec2<T>(x, y);
+}
+
+template <typename TEngine>
+template<typename T>
+inline Vec2<T> RandomGenerator<TEngine>::unitPeripheralSquareCoordinate() noexcept
+{
+    const T x = unitValue<T>();
+    const T y = unitValue<T>();
+    return Vec2<T>(x, y);
+}
+
+template <typename TEngine>
+template<typename T>
+inline Vec3<T> RandomGenerator<TEngine>::peripheralCubiqueCoordinate(const Vec3<T>& center, const T& extX, const T& extY, const T& extZ) noexcept
+{
+    //One of the 6 faces, then uniform coordinate on this face
+    const int face  = ranged<int>(0, 5);
+    const T   side  = (face & 1) ? static_cast<T>(1) : static_cast<T>(-1);
+    const T   x     = center.getX() + ranged<T>(-extX, extX);
+    const T   y     = center.getY() + ranged<T>(-extY, extY);
+    const T   z     = center.getZ() + ranged<T>(-extZ, extZ);
+
+    switch (face >> 1)
+    {
+    case 0:
+        return Vec3<T>(center.getX() + side * extX, y, z);
+
+    case 1:
+        return Vec3<T>(x, center.getY() + side * extY, z);
+
+    default:
+        return Vec3<T>(x, y, center.getZ() + side * extZ);
+    }
+}
+
+template <typename TEngine>
+template<typename T>
+inline Vec3<T> RandomGenerator<TEngine>::cubiqueCoordinate(const Vec3<T>& center, const T& extX, const T& extY, const T& extZ) noexcept
+{
+    const T x = center.getX() + ranged<T>(-extX, extX);
+    const T y = center.getY() + ranged<T>(-extY, extY);
+    const T z = center.getZ() + ranged<T>(-extZ, extZ);
+    return Vec3<T>(x, y, z);
+}
+
+template <typename TEngine>
+template<typename T>
+inline Vec3<T> RandomGenerator<TEngine>::unitPeripheralCubiqueCoordinate() noexcept
+{
+    const T x = unitValue<T>();
+    const T y = unitValue<T>();
+    const T z = unitValue<T>();
+    return Vec3<T>(x, y, z);
+}
+
+template <typename TEngine>
+template<typename T>
+inline bool RandomGenerator<TEngine>::ranPercentProba(const T& percent) noexcept
+{
+    return ranged<T>(static_cast<T>(0), static_cast<T>(100)) <= percent;
+}
+
+template <typename TEngine>
+template<typename T, size_t TPatternLength>
+inline void RandomGenerator<TEngine>::fillPattern(T* out, size_t count, const std::array<T, TPatternLength>& min, const std::array<T, TPatternLength>& range) noexcept
+{
+#ifdef FOXMATH_SIMD_SSE
+    if constexpr (std::is_same_v<T, float>)
+    {
+        /*Seeding 4 streams cost 8 engine calls : only for large arrays*/
+        if (count >= 64)
+        {
+            uint32_t state [16];
+            for (size_t i = 0; i < 16; i += 2)
+            {
+                const uint64_t value = m_engine();
+                state[i]     = static_cast<uint32_t>(value);
+                state[i + 1] = static_cast<uint32_t>(value >> 32);
+            }
+
+            float scale [TPatternLength];
+            for (size_t i = 0; i < TPatternLength; ++i)
+                scale[i] = range[i] / 16777216.f;
+
+            SIMD::uniformBulk<TPatternLength>(state, out, count, min.data(), scale);
+            return;
+        }
+    }
+#endif
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        out[i] = min[i % TPatternLength] + unitValue<T>() * range[i % TPatternLength];
+    }
+}
+
+template <typename TEngine>
+template<typename T>
+inline void RandomGenerator<TEngine>::fillUnitValue(T* out, size_t count) noexcept
+{
+    fillRanged<T>(out, count, static_cast<T>(0), static_cast<T>(1));
+}
+
+template <typename TEngine>
+template<typename T>
+inline void RandomGenerator<TEngine>::fillRanged(T* out, size_t count, const T& min, const T& max) noexcept
+{
+    if constexpr (std::is_floating_point<T>::value)
+    {
+        const T range = max - min;
+        fillPattern<T>(out, count, {min, min, min, min}, {range, range, range, range});
+    }
+    else
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = ranged<T>(min, max);
+    }
+}
+
+template <typename TEngine>
+template<typename T>
+inline void RandomGenerator<TEngine>::fillSquareCoordinate(Vec2<T>* out, size_t count, const Vec2<T>& center, const T& extX, const T& extY) noexcept
+{
+    const T minX = center.getX() - extX;
+    const T minY = center.getY() - extY;
+    const T twoExtX = extX + extX;
+    const T twoExtY = extY + extY;
+
+    if constexpr (sizeof(Vec2<T>) == 2 * sizeof(T))
+    {
+        /*GenericVector storage is its only member : array of Vec2 is an array of x y x y...*/
+        fillPattern<T>(reinterpret_cast<T*>(out), count * 2, {minX, minY, minX, minY}, {twoExtX, twoExtY, twoExtX, twoExtY});
+    }
+    else
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = squareCoordinate<T>(center, extX, extY);
+    }
+}
+
+template <typename TEngine>
+template<typename T>
+inline void RandomGenerator<TEngine>::fillCubiqueCoordinate(Vec3<T>* out, size_t count, const Vec3<T>& center, const T& extX, const T& extY, const T& extZ) noexcept
+{
+    const T minX = center.getX() - extX;
+    const T minY = center.getY() - extY;
+    const T minZ = center.getZ() - extZ;
+    const T twoExtX = extX + extX;
+    const T twoExtY = extY + extY;
+    const T twoExtZ = extZ + extZ;
+
+    if constexpr (sizeof(Vec3<T>) == 3 * sizeof(T))
+    {
+        /*GenericVector storage is its only member : array of Vec3 is an array of x y z x y z...*/
+        fillPattern<T, 12>(reinterpret_cast<T*>(out), count * 3,
+                            {minX, minY, minZ, minX, minY, minZ, minX, minY, minZ, minX, minY, minZ},
+                            {twoExtX, twoExtY, twoExtZ, twoExtX, twoExtY, twoExtZ, twoExtX, twoExtY, twoExtZ, twoExtX, twoExtY, twoExtZ});
+    }
+    else
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = cubiqueCoordinate<T>(center, extX, extY, extZ);
+    }
+}
+
+template <typename TEngine>
+template<typename T>
+inline void RandomGenerator<TEngine>::fillUnitPeripheralSphericalCoordonate(Vec3<T>* out, size_t count) noexcept
+{
+    /*Uniform z and longitude by block, then projection on sphere*/
+    constexpr size_t blockSize = 256;
+    T z     [blockSize];
+    T angle [blockSize];
+
+    for (size_t blockStart = 0; blockStart < count; blockStart += blockSize)
+    {
+        const size_t blockCount = std::min(blockSize, count - blockStart);
+
+        fillRanged<T>(z, blockCount, static_cast<T>(-1), static_cast<T>(1));
+        fillRanged<T>(angle, blockCount, static_cast<T>(0), static_cast<T>(TWO_PI));
+
+        for (size_t i = 0; i < blockCount; ++i)
+        {
+            const T radius = std::sqrt(std::max(static_cast<T>(0), static_cast<T>(1) - z[i] * z[i]));
+            out[blockStart + i] = Vec3<T>(radius * std::cos(angle[i]), radius * std::sin(angle[i]), z[i]);
+        }
+    }
+}
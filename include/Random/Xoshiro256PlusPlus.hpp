@@ -0,0 +1,233 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 14 h 10
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h> //uint64_t
+#include <stddef.h> //size_t
+#include <array> //std::array
+#include <limits> //std::numeric_limits
+
+namespace FoxMath
+{
+    /**
+     * @brief xoshiro256++ pseudo random number generator (Blackman and Vigna). 256 bits of state, period of 2^256 - 1.
+     * Satisfy UniformRandomBitGenerator so it can be used with std distributions.
+     * Instance is not shared : use one instance by thread, created with split or jump for parallel streams
+     */
+    class Xoshiro256PlusPlus
+    {
+        public:
+
+        using result_type = uint64_t;
+
+        protected:
+
+        #pragma region attribut
+
+        std::array<uint64_t, 4> m_state {};
+
+        #pragma endregion //!attribut
+
+        #pragma region static methods
+
+        [[nodiscard]] static constexpr inline
+        uint64_t rotl (uint64_t value, int shift) noexcept
+        {
+            return (value << shift) | (value >> (64 - shift));
+        }
+
+        /**
+         * @brief splitmix64 step : used to expand a 64 bits seed in 256 bits of state (never all zero)
+         * 
+         * @param seed : updated
+         * @return constexpr uint64_t 
+         */
+        [[nodiscard]] static constexpr inline
+        uint64_t splitMix64 (uint64_t& seed) noexcept
+        {
+            uint64_t z = (seed += 0x9e3779b97f4a7c15ull);
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+            return z ^ (z >> 31);
+        }
+
+        #pragma endregion //!static methods
+
+        #pragma region methods
+
+        /**
+         * @brief Advance the state of 2^x calls, x depend of the polynom
+         * 
+         * @param jumpPolynom 
+         */
+        constexpr inline
+        void jump (const std::array<uint64_t, 4>& jumpPolynom) noexcept
+        {
+            std::array<uint64_t, 4> state {};
+
+            for (uint64_t word : jumpPolynom)
+            {
+                for (int bit = 0; bit < 64; ++bit)
+                {
+                    if (word & (uint64_t{1} << bit))
+                    {
+                        for (size_t i = 0; i < 4; ++i)
+                            state[i] ^= m_state[i];
+                    }
+                    (*this)();
+                }
+            }
+
+            m_state = state;
+        }
+
+        #pragma endregion //!methods
+
+        public:
+
+        #pragma region constructor/destructor
+
+        /**
+         * @brief Deterministic seeding : the same seed always give the same sequence
+         * 
+         * @param seed 
+         */
+        explicit constexpr inline
+        Xoshiro256PlusPlus (uint64_t seed = 0) noexcept
+        {
+            this->seed(seed);
+        }
+
+        constexpr inline
+        Xoshiro256PlusPlus (const Xoshiro256PlusPlus& other) noexcept			    = default;
+
+        constexpr inline
+        Xoshiro256PlusPlus (Xoshiro256PlusPlus&& other) noexcept				    = default;
+
+        inline
+        ~Xoshiro256PlusPlus () noexcept				                                = default;
+
+        constexpr inline
+        Xoshiro256PlusPlus& operator=(Xoshiro256PlusPlus const& other) noexcept	= default;
+
+        constexpr inline
+        Xoshiro256PlusPlus& operator=(Xoshiro256PlusPlus && other) noexcept		= default;
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Reset the state with seed
+         * 
+         * @param seed 
+         */
+        constexpr inline
+        void seed (uint64_t seed) noexcept
+        {
+            for (uint64_t& word : m_state)
+                word = splitMix64(seed);
+        }
+
+        /**
+         * @brief Equivalent to 2^128 calls. Generate 2^128 non overlapping sub sequences for parallel computations
+         * 
+         */
+        constexpr inline
+        void jump () noexcept
+        {
+            jump({0x180ec6d33cfd0abaull, 0xd5a61266f0c9392cull, 0xa9582618e03fc9aaull, 0x39abdc4529b1661cull});
+        }
+
+        /**
+         * @brief Equivalent to 2^192 calls. Generate 2^64 starting points, from each of which jump will generate 2^64 non overlapping sub sequences
+         * for parallel distributed computations
+         * 
+         */
+        constexpr inline
+        void longJump () noexcept
+        {
+            jump({0x76e15d3efefdcbbfull, 0xc5004e441c522fb3ull, 0x77710069854ee241ull, 0x39109bb02acbe635ull});
+        }
+
+        /**
+         * @brief Return a generator on the current sequence and jump this one on the next sub sequence.
+         * Call it n times on a main generator to create n independent streams (one by thread)
+         * 
+         * @return constexpr Xoshiro256PlusPlus 
+         */
+        [[nodiscard]] constexpr inline
+        Xoshiro256PlusPlus split () noexcept
+        {
+            Xoshiro256PlusPlus rst (*this);
+            jump();
+            return rst;
+        }
+
+        #pragma endregion //!methods
+
+        #pragma region static methods
+
+        [[nodiscard]] static constexpr inline
+        result_type min () noexcept { return std::numeric_limits<result_type>::min(); }
+
+        [[nodiscard]] static constexpr inline
+        result_type max () noexcept { return std::numeric_limits<result_type>::max(); }
+
+        #pragma endregion //!static methods
+
+        #pragma region operator
+
+        /**
+         * @brief Generate next 64 bits random value
+         * 
+         * @return constexpr result_type 
+         */
+        constexpr inline
+        result_type operator() () noexcept
+        {
+            const uint64_t rst = rotl(m_state[0] + m_state[3], 23) + m_state[0];
+            const uint64_t t = m_state[1] << 17;
+
+            m_state[2] ^= m_state[0];
+            m_state[3] ^= m_state[1];
+            m_state[1] ^= m_state[2];
+            m_state[0] ^= m_state[3];
+
+            m_state[2] ^= t;
+            m_state[3] = rotl(m_state[3], 45);
+
+            return rst;
+        }
+
+        #pragma endregion //!operator
+    };
+
+} /*namespace FoxMath*/
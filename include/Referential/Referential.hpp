@@ -9,7 +9,7 @@
 
 namespace FoxMath
 {
-    template <T>
+    template <typename T = float>
     struct Referential
     {
 		Referential ()								        = default;
@@ -32,13 +32,13 @@ namespace FoxMath
             //x = O'Mw * i'w 
             //y = O'Mw * j'w
             //z = O'Mw * k'w
-            return Vec3<T>({OlocalM.dotProduct(refLocal.unitI), OlocalM.dotProduct(refLocal.unitJ), OlocalM.dotProduct(refLocal.unitK)});
+            return Vec3<T>(OlocalM.dot(refLocal.unitI), OlocalM.dot(refLocal.unitJ), OlocalM.dot(refLocal.unitK));
         }
 
         static Vec3<T> localToGlobalPosition(const Referential&  refLocal, const Vec3<T>& point)
         {
             //O'Mw  = x' * i' + y' * j' + z' * k'
-            Vec3<T> vectorOlocalM = refLocal.unitI * point.x + refLocal.unitJ * point.y + refLocal.unitK * point.z;
+            Vec3<T> vectorOlocalM = refLocal.unitI * point.getX() + refLocal.unitJ * point.getY() + refLocal.unitK * point.getZ();
 
             //OM = OO' + O'M
             return refLocal.origin  + vectorOlocalM;
@@ -49,17 +49,20 @@ namespace FoxMath
             //U'x = U * i
             //U'y = U * j
             //U'z = U * k
-            return Vec3<T>({Vec3<T>::dot(vector, refLocal.unitI), Vec3<T>::dot(vector, refLocal.unitJ), Vec3<T>::dot(vector, refLocal.unitK)});
+            return Vec3<T>(Vec3<T>::dot(vector, refLocal.unitI), Vec3<T>::dot(vector, refLocal.unitJ), Vec3<T>::dot(vector, refLocal.unitK));
         }
 
         static Vec3<T> localToGlobalVector(const Referential&  refLocal, const Vec3<T>& vector)
         {
             //vect(U) = u'x * i'(world) + u'y * j'(world) + u'z * k'(world)
-            return (refLocal.unitI * vector.x) + (refLocal.unitJ * vector.y) + (refLocal.unitK * vector.z);
+            return (refLocal.unitI * vector.getX()) + (refLocal.unitJ * vector.getY()) + (refLocal.unitK * vector.getZ());
         }
 
     };
 
+    using Referentialf = Referential<float>;
+    using Referentiald = Referential<double>;
+
 } /*namespace FoxMath */
 
 #endif //_REFERENTIAL_H
\ No newline at end of file
@@ -0,0 +1,520 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 10 h 12
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Matrix/ETransformMode.hpp" //ETransformMode
+#include "Macro/ConstantEvaluated.hpp" //FOXMATH_IS_CONSTANT_EVALUATED
+#include "Numeric/EPrecision.hpp" //EPrecision
+
+#include <stddef.h> //sizt_t
+#include <stdint.h> //uint32_t
+#include <type_traits> //std::is_same_v
+
+/**
+ * SIMD path is opt-in : define FOXMATH_USE_SIMD before including FoxMath (or with -DFOXMATH_USE_SIMD).
+ * It change the alignment of GenericVector<4, float> and GenericVector<4, int> (16 bytes), so
+ * all translation units must be compiled with the same flag.
+ * Vector3 keep its 12 bytes storage and its scalar operators : SSE only process it in the fused and bulk kernels.
+ * Without SSE2 (or without a way to detect constant evaluation) the scalar path is used.
+ */
+#if defined(FOXMATH_USE_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define FOXMATH_SIMD_SSE 1
+    #include <emmintrin.h> //SSE2
+
+    #if defined(__SSE4_1__) || defined(__AVX__)
+        #define FOXMATH_SIMD_SSE4_1 1
+        #include <smmintrin.h> //_mm_mullo_epi32
+    #endif
+
+    #if defined(__AVX__)
+        #define FOXMATH_SIMD_AVX 1
+        #include <immintrin.h> //__m256
+    #endif
+
+    #if defined(__FMA__)
+        #define FOXMATH_SIMD_FMA 1
+        #include <immintrin.h> //_mm_fmadd_ps
+    #endif
+#endif
+
+#if !defined(FOXMATH_IS_CONSTANT_EVALUATED) && defined(FOXMATH_SIMD_SSE)
+    #undef FOXMATH_SIMD_SSE //Cannot keep constexpr behaviour, use scalar path
+    #undef FOXMATH_SIMD_SSE4_1
+    #undef FOXMATH_SIMD_AVX
+    #undef FOXMATH_SIMD_FMA
+#endif
+
+namespace FoxMath
+{
+    /**
+     * @brief Compile time description of the SIMD support of a GenericVector<TLength, TType>
+     *
+     * @tparam TLength
+     * @tparam TType
+     */
+    template <size_t TLength, typename TType>
+    struct SIMDTraits
+    {
+#ifdef FOXMATH_SIMD_SSE
+        static constexpr bool isEnabled = (TLength == 3 || TLength == 4) && (std::is_same_v<TType, float> || std::is_same_v<TType, int>);
+#else
+        static constexpr bool isEnabled = false;
+#endif
+        /*Division is only vectorized for floating point*/
+        static constexpr bool isDivisionEnabled = isEnabled && std::is_same_v<TType, float>;
+
+        /*Vector3 operators stay scalar : a load/store round trip by operator cost more than 3 scalar operations and stall the store
+        forwarding of the scalar writes (getCross, setData...). Vector4 fill the register and keep the SSE operators*/
+        static constexpr bool isOperatorEnabled         = isEnabled && TLength == 4;
+        static constexpr bool isDivisionOperatorEnabled = isDivisionEnabled && TLength == 4;
+
+        /*Vector3 is not padded : 16 bytes copies of a padded Vector3 built by scalar writes cannot be forwarded from the store buffer*/
+        static constexpr size_t alignment = isOperatorEnabled ? 16 : alignof(TType);
+    };
+
+#ifdef FOXMATH_SIMD_SSE
+
+    namespace SIMD
+    {
+        #pragma region load/store
+
+        /**
+         * @brief load 3 or 4 elements in register. The 4th lane of a 3 length vector is set to zero
+         * @note only 3 elements are read for a 3 length vector : it can be the last element of an array
+         *
+         * @tparam TLength : 3 or 4
+         * @param data : pointer on first element
+         * @return __m128
+         */
+        template <size_t TLength>
+        [[nodiscard]] inline
+        __m128  load    (const float* data) noexcept;
+
+        template <size_t TLength>
+        [[nodiscard]] inline
+        __m128i load    (const int* data) noexcept;
+
+        /**
+         * @brief store 3 or 4 elements from register. Only 3 elements are written for a 3 length vector
+         *        (next Vector3 of an array or Quaternion m_w are kept)
+         *
+         * @tparam TLength : 3 or 4
+         * @param data : pointer on first element
+         * @param reg
+         */
+        template <size_t TLength>
+        inline
+        void    store   (float* data, __m128 reg) noexcept;
+
+        template <size_t TLength>
+        inline
+        void    store   (int* data, __m128i reg) noexcept;
+
+        #pragma endregion //!load/store
+
+        #pragma region kernels
+
+        /**
+         * @brief lhs[i] += rhs[i]
+         */
+        template <size_t TLength, typename TType>
+        inline
+        void    add         (TType* lhs, const TType* rhs) noexcept;
+
+        /**
+         * @brief lhs[i] -= rhs[i]
+         */
+        template <size_t TLength, typename TType>
+        inline
+        void    sub         (TType* lhs, const TType* rhs) noexcept;
+
+        /**
+         * @brief lhs[i] *= rhs[i]
+         * @note Integer multiplication need SSE4.1, else scalar loop is used
+         */
+        template <size_t TLength, typename TType>
+        inline
+        void    mul         (TType* lhs, const TType* rhs) noexcept;
+
+        /**
+         * @brief lhs[i] /= rhs[i]. Only for floating point
+         */
+        template <size_t TLength>
+        inline
+        void    div         (float* lhs, const float* rhs) noexcept;
+
+        /**
+         * @brief lhs[i] += scalar
+         */
+        template <size_t TLength, typename TType>
+        inline
+        void    addScalar   (TType* lhs, TType scalar) noexcept;
+
+        /**
+         * @brief lhs[i] -= scalar
+         */
+        template <size_t TLength, typename TType>
+        inline
+        void    subScalar   (TType* lhs, TType scalar) noexcept;
+
+        /**
+         * @brief lhs[i] *= scalar
+         */
+        template <size_t TLength, typename TType>
+        inline
+        void    mulScalar   (TType* lhs, TType scalar) noexcept;
+
+        /**
+         * @brief lhs[i] /= scalar. Only for floating point
+         */
+        template <size_t TLength>
+        inline
+        void    divScalar   (float* lhs, float scalar) noexcept;
+
+        /**
+         * @brief sum of lhs[i] * rhs[i]
+         */
+        template <size_t TLength, typename TType>
+        [[nodiscard]] inline
+        TType   dot         (const TType* lhs, const TType* rhs) noexcept;
+
+        #pragma endregion //!kernels
+
+        #pragma region bulk kernels
+
+        /**
+         * @brief data[i] = sqrt(data[i]) on contiguous array. std::sqrt loop is not vectorized because of errno
+         *
+         * @param data
+         * @param count
+         */
+        inline
+        void    sqrtBulk            (float* data, size_t count) noexcept;
+
+        /**
+         * @brief squareLength[i] = 1 / sqrt(squareLength[i]), or 1 if squareLength[i] is zero (null vector stay null)
+         *
+         * @param squareLength
+         * @param count
+         */
+        inline
+        void    invLengthBulk       (float* squareLength, size_t count) noexcept;
+
+        /**
+         * @brief out[i] = min[i % TPatternLength] + u * scale[i % TPatternLength], u uniform integer in [0, 2^24[. Values come from 4 xoshiro128+ streams, one by lane.
+         * Use scale = range / 2^24 to get values in [min, min + range[
+         *
+         * @tparam TPatternLength : 4, or 12 for an array of Vector3 (4 x y z patterns fill 3 registers)
+         * @param state : 16 words, word k of lane l is state[k * 4 + l]. Must not be null for all words of a lane. Updated
+         * @param out
+         * @param count : number of floats
+         * @param min : TPatternLength floats
+         * @param scale : TPatternLength floats
+         */
+        template <size_t TPatternLength>
+        inline
+        void    uniformBulk         (uint32_t* state, float* out, size_t count, const float* min, const float* scale) noexcept;
+
+        #pragma endregion //!bulk kernels
+
+        #pragma region matrix kernels
+
+        /**
+         * @brief dst = lhs * rhs on 4x4 row major storage. Each dst row is the sum of rhs rows multiplied by the broadcasted lhs coefficients (FMA if available)
+         *
+         * @param lhs
+         * @param rhs
+         * @param dst : can be lhs
+         */
+        inline
+        void    mulMat4             (const float* lhs, const float* rhs, float* dst) noexcept;
+
+        /**
+         * @brief dst = lhs * rhs on row major storage of any size. Register blocked : dst is computed by tile of 2 rows * 16 columns
+         * (8 accumulators, each rhs load is used twice) on a block of 256 rhs rows so the used part of rhs stay in L1 cache
+         *
+         * @param lhs : rowSize * sharedSize
+         * @param rhs : sharedSize * columnSize
+         * @param dst : rowSize * columnSize, must not overlap lhs or rhs
+         */
+        inline
+        void    mulMat              (const float* lhs, const float* rhs, float* dst, size_t rowSize, size_t sharedSize, size_t columnSize) noexcept;
+
+        /**
+         * @brief dst = lhs * transpose(rhsTransposed) on 4x4 row major storage. rhs rows are rhsTransposed registers transposed in place, then same kernel than mulMat4
+         *
+         * @param lhs
+         * @param rhsTransposed
+         * @param dst : can be lhs
+         */
+        inline
+        void    mulMat4Transposed   (const float* lhs, const float* rhsTransposed, float* dst) noexcept;
+
+        /**
+         * @brief dst = lhs * transpose(rhsTransposed) on row major storage : dst[i][j] is the dot product of the lhs row i and the rhsTransposed row j.
+         * Both operands are read along their rows by 4 floats, dst is computed by tile of 2 rows * 4 columns (8 accumulators)
+         *
+         * @param lhs : rowSize * sharedSize
+         * @param rhsTransposed : columnSize * sharedSize
+         * @param dst : rowSize * columnSize, must not overlap lhs or rhsTransposed
+         */
+        inline
+        void    mulMatTransposed    (const float* lhs, const float* rhsTransposed, float* dst, size_t rowSize, size_t sharedSize, size_t columnSize) noexcept;
+
+        /**
+         * @brief dst = inverse of the 4x4 matrix src (16 contiguous floats). Use 2x2 blocks subdeterminants.
+         * @note Layout agnostic : inverse of transposed matrix is transposed inverse, so row major and column major are both valid
+         * @note dst is not valid if returned determinant is null
+         *
+         * @param src
+         * @param dst
+         * @return float : determinant of src
+         */
+        inline
+        float   inverseMat4         (const float* src, float* dst) noexcept;
+
+        /**
+         * @brief dst = inverse of the affine 4x4 matrix src [M|t] (last row 0 0 0 1) : [M⁻¹|-M⁻¹t]
+         * @note dst is not valid if returned determinant is null
+         *
+         * @tparam TColumnMajor : true if the 4 first floats are the first column, false if they are the first row
+         * @param src
+         * @param dst
+         * @return float : determinant of M
+         */
+        template <bool TColumnMajor>
+        inline
+        float   inverseAffineMat4   (const float* src, float* dst) noexcept;
+
+        /**
+         * @brief out[i] = M * in[i] for count vectors of TLength floats (Vector3 or Vector4). Process 4 vectors per iteration
+         * @note in and out can be the same array
+         *
+         * @tparam TMode : how w is handled
+         * @tparam TLength : 3 or 4
+         * @param columns : 16 floats, the 4 columns of M
+         * @param in
+         * @param out
+         * @param count
+         */
+        template <ETransformMode TMode, size_t TLength>
+        inline
+        void    transformBulk       (const float* columns, const float* in, float* out, size_t count) noexcept;
+
+        #pragma endregion //!matrix kernels
+
+        #pragma region quaternion kernels
+
+        /**
+         * @brief Rotate count vectors of 3 floats (Vector3) by the unit quaternion quat (x, y, z, w) with v + w * t + u×t, t = 2u×v.
+         * Process 4 vectors per iteration
+         * @note in and out can be the same array
+         *
+         * @param quat : 4 floats x, y, z, w
+         * @param in
+         * @param out
+         * @param count
+         */
+        inline
+        void    rotateVectorsBulk   (const float* quat, const float* in, float* out, size_t count) noexcept;
+
+        /**
+         * @brief out[i] = sLerp(start[i], end[i], t[i]) on arrays of quaternions (x, y, z, w). 4 quaternions are transposed and interpolated by iteration.
+         * acos and sin are polynomial approximations (error lower than 1e-6), nLerp is used if cos of angle is upper than 0.9995.
+         * Approximate mode is nLerp with corrected ratio (see Quaternion::approximateSLerp).
+         * Without shortest path, sin of angle of nearly opposite quaternions (cos of angle lower than -0.9995) is computed without 1 - cos² (see Quaternion::sLerpOpposite)
+         * @note out can be start or end
+         *
+         * @tparam TShortestPath
+         * @tparam TClampedRatio
+         * @tparam TApproximate
+         * @param start
+         * @param end
+         * @param t : count ratios
+         * @param out
+         * @param count
+         */
+        template <bool TShortestPath, bool TClampedRatio, bool TApproximate>
+        inline
+        void    sLerpBulk           (const float* start, const float* end, const float* t, float* out, size_t count) noexcept;
+
+        #pragma endregion //!quaternion kernels
+
+        #pragma region trigonometry kernels
+
+        /**
+         * @brief sin and cos of 4 angles in one pass : one reduction in [-pi/4, pi/4] (rounding with cvtps2dq, SSE2 only), both polynomials
+         * and selection by the quadrant bits. Same polynomials than Numeric::sinCos<TPrecision> (Fast : Cephes, Approximate : degree 3)
+         * @note Accurate for |angle| < 8192. NaN angles give NaN
+         *
+         * @tparam TPrecision : Fast or Approximate
+         * @param angles : 4 angles in radian
+         * @param sinAngles
+         * @param cosAngles
+         */
+        template <EPrecision TPrecision>
+        inline
+        void    sinCos4             (__m128 angles, __m128& sinAngles, __m128& cosAngles) noexcept;
+
+        /**
+         * @brief sinAngles[i] = sin(angles[i]) and cosAngles[i] = cos(angles[i]) with sinCos4 on 4 angles by iteration
+         *
+         * @tparam TPrecision : Fast or Approximate
+         * @param angles
+         * @param sinAngles
+         * @param cosAngles
+         * @param count
+         */
+        template <EPrecision TPrecision>
+        inline
+        void    sinCosBulk          (const float* angles, float* sinAngles, float* cosAngles, size_t count) noexcept;
+
+        #pragma endregion //!trigonometry kernels
+
+        #pragma region shape kernels
+
+        /**
+         * @brief Slab test of one segment against 4 AABB. tNear and tFar are clamped in [0, 1] and the box is hit if tNear <= tFar.
+         * Near and far planes are selected once by axis with the sign of invDelta
+         * @note An AABB with min = +inf and max = -inf is never hit
+         *
+         * @param pt1 : 3 floats, first point of segment
+         * @param invDelta : 3 floats, inverse of (pt2 - pt1). Null axis is +/- inf : NaN of 0 * inf (pt1 on a plane of this axis) is ignored
+         * @param boxMin : 3 * 4 floats (4 x, 4 y, 4 z), 16 bytes aligned
+         * @param boxMax : 3 * 4 floats (4 x, 4 y, 4 z), 16 bytes aligned
+         * @param tEntry : 4 floats, clamped entry ratio (0 if pt1 is inside). Only valid for hit lanes
+         * @return uint32_t : bit i is set if box i is hit
+         */
+        inline
+        uint32_t segmentAABB4   (const float* pt1, const float* invDelta, const float* boxMin, const float* boxMax, float* tEntry) noexcept;
+
+        /**
+         * @brief Same as segmentAABB4 for 8 AABB (AVX if available, else 2 * 4 lanes)
+         *
+         * @param pt1 : 3 floats
+         * @param invDelta : 3 floats
+         * @param boxMin : 3 * 8 floats, 32 bytes aligned
+         * @param boxMax : 3 * 8 floats, 32 bytes aligned
+         * @param tEntry : 8 floats
+         * @return uint32_t : bit i is set if box i is hit
+         */
+        inline
+        uint32_t segmentAABB8   (const float* pt1, const float* invDelta, const float* boxMin, const float* boxMax, float* tEntry) noexcept;
+
+        /**
+         * @brief Slab test of 4 segments against one AABB. Near and far planes are selected by lane with the sign of invDelta
+         * @note A segment with pt1 = +inf and invDelta = 1 never hit
+         *
+         * @param pt1 : 3 * 4 floats (4 x, 4 y, 4 z), 16 bytes aligned
+         * @param invDelta : 3 * 4 floats (4 x, 4 y, 4 z), 16 bytes aligned
+         * @param boxMin : 3 floats
+         * @param boxMax : 3 floats
+         * @param tEntry : 4 floats, clamped entry ratio. Only valid for hit lanes
+         * @return uint32_t : bit i is set if segment i hit the box
+         */
+        inline
+        uint32_t segmentsAABB4  (const float* pt1, const float* invDelta, const float* boxMin, const float* boxMax, float* tEntry) noexcept;
+
+        /**
+         * @brief Same as segmentsAABB4 for 8 segments (AVX if available, else 2 * 4 lanes)
+         *
+         * @param pt1 : 3 * 8 floats, 32 bytes aligned
+         * @param invDelta : 3 * 8 floats, 32 bytes aligned
+         * @param boxMin : 3 floats
+         * @param boxMax : 3 floats
+         * @param tEntry : 8 floats
+         * @return uint32_t : bit i is set if segment i hit the box
+         */
+        inline
+        uint32_t segmentsAABB8  (const float* pt1, const float* invDelta, const float* boxMin, const float* boxMax, float* tEntry) noexcept;
+
+        /**
+         * @brief Classify 4 AABB against 6 planes (inside if dot(point, normal) - distance >= 0). For each plane the positive and
+         * negative vertices are selected once by axis with the sign of the normal. Stop when all boxes are outside
+         * @note If rejectPlane is not null, the plane rejecting each box last time is tested first and rejectPlane is updated
+         * with the first plane rejecting the new outside boxes
+         *
+         * @param planes : 6 * 4 floats (normal x, normal y, normal z, distance)
+         * @param boxMin : 3 * 4 floats (4 x, 4 y, 4 z), 16 bytes aligned
+         * @param boxMax : 3 * 4 floats (4 x, 4 y, 4 z), 16 bytes aligned
+         * @param rejectPlane : 4 plane indices or nullptr
+         * @param intersectMask : bit i is set if box i cross the boundary of the volume
+         * @return uint32_t : bit i is set if box i is outside
+         */
+        inline
+        uint32_t frustumAABB4   (const float* planes, const float* boxMin, const float* boxMax, uint8_t* rejectPlane, uint32_t& intersectMask) noexcept;
+
+        /**
+         * @brief Same as frustumAABB4 for 8 AABB (AVX if available, else 2 * 4 lanes)
+         *
+         * @param planes : 6 * 4 floats
+         * @param boxMin : 3 * 8 floats, 32 bytes aligned
+         * @param boxMax : 3 * 8 floats, 32 bytes aligned
+         * @param rejectPlane : 8 plane indices or nullptr
+         * @param intersectMask : bit i is set if box i cross the boundary of the volume
+         * @return uint32_t : bit i is set if box i is outside
+         */
+        inline
+        uint32_t frustumAABB8   (const float* planes, const float* boxMin, const float* boxMax, uint8_t* rejectPlane, uint32_t& intersectMask) noexcept;
+
+        /**
+         * @brief Classify 4 spheres against 6 planes. Same plane order and plane coherency than frustumAABB4
+         *
+         * @param planes : 6 * 4 floats (normal x, normal y, normal z, distance)
+         * @param center : 3 * 4 floats (4 x, 4 y, 4 z), 16 bytes aligned
+         * @param radius : 4 floats, 16 bytes aligned
+         * @param rejectPlane : 4 plane indices or nullptr
+         * @param intersectMask : bit i is set if sphere i cross the boundary of the volume
+         * @return uint32_t : bit i is set if sphere i is outside
+         */
+        inline
+        uint32_t frustumSphere4 (const float* planes, const float* center, const float* radius, uint8_t* rejectPlane, uint32_t& intersectMask) noexcept;
+
+        /**
+         * @brief Same as frustumSphere4 for 8 spheres (AVX if available, else 2 * 4 lanes)
+         *
+         * @param planes : 6 * 4 floats
+         * @param center : 3 * 8 floats, 32 bytes aligned
+         * @param radius : 8 floats, 32 bytes aligned
+         * @param rejectPlane : 8 plane indices or nullptr
+         * @param intersectMask : bit i is set if sphere i cross the boundary of the volume
+         * @return uint32_t : bit i is set if sphere i is outside
+         */
+        inline
+        uint32_t frustumSphere8 (const float* planes, const float* center, const float* radius, uint8_t* rejectPlane, uint32_t& intersectMask) noexcept;
+
+        #pragma endregion //!shape kernels
+    } /*namespace SIMD*/
+
+    #include "SIMD.inl"
+
+#endif
+
+} /*namespace FoxMath*/
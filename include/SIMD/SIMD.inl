@@ -0,0 +1,1583 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 10 h 12
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+namespace SIMD
+{
+
+template <size_t TLength>
+inline
+__m128 load (const float* data) noexcept
+{
+    static_assert(TLength == 3 || TLength == 4);
+
+    if constexpr (TLength == 4)
+    {
+        return _mm_loadu_ps(data);
+    }
+    else
+    {
+        /*Only 12 bytes are read : x y in the low half, z in the 3rd lane and 4th lane cleared*/
+        return _mm_movelh_ps(_mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(data))), _mm_load_ss(data + 2));
+    }
+}
+
+template <size_t TLength>
+inline
+__m128i load (const int* data) noexcept
+{
+    static_assert(TLength == 3 || TLength == 4);
+
+    if constexpr (TLength == 4)
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    }
+    else
+    {
+        /*Only 12 bytes are read : x y in the low half, z in the 3rd lane and 4th lane cleared*/
+        return _mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(data)), _mm_cvtsi32_si128(data[2]));
+    }
+}
+
+template <size_t TLength>
+inline
+void store (float* data, __m128 reg) noexcept
+{
+    static_assert(TLength == 3 || TLength == 4);
+
+    if constexpr (TLength == 4)
+    {
+        _mm_storeu_ps(data, reg);
+    }
+    else
+    {
+        /*Only 12 bytes are written : the next element of an array of Vector3 is not touched*/
+        _mm_storel_pi(reinterpret_cast<__m64*>(data), reg);
+        _mm_store_ss(data + 2, _mm_movehl_ps(reg, reg));
+    }
+}
+
+template <size_t TLength>
+inline
+void store (int* data, __m128i reg) noexcept
+{
+    static_assert(TLength == 3 || TLength == 4);
+
+    if constexpr (TLength == 4)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data), reg);
+    }
+    else
+    {
+        /*Only 12 bytes are written : the next element of an array of Vector3 is not touched*/
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(data), reg);
+        data[2] = _mm_cvtsi128_si32(_mm_srli_si128(reg, 8));
+    }
+}
+
+template <size_t TLength, typename TType>
+inline
+void add (TType* lhs, const TType* rhs) noexcept
+{
+    if constexpr (std::is_same_v<TType, float>)
+    {
+        store<TLength>(lhs, _mm_add_ps(load<TLength>(lhs), load<TLength>(rhs)));
+    }
+    else
+    {
+        store<TLength>(lhs, _mm_add_epi32(load<TLength>(lhs), load<TLength>(rhs)));
+    }
+}
+
+template <size_t TLength, typename TType>
+inline
+void sub (TType* lhs, const TType* rhs) noexcept
+{
+    if constexpr (std::is_same_v<TType, float>)
+    {
+        store<TLength>(lhs, _mm_sub_ps(load<TLength>(lhs), load<TLength>(rhs)));
+    }
+    else
+    {
+        store<TLength>(lhs, _mm_sub_epi32(load<TLength>(lhs), load<TLength>(rhs)));
+    }
+}
+
+template <size_t TLength, typename TType>
+inline
+void mul (TType* lhs, const TType* rhs) noexcept
+{
+    if constexpr (std::is_same_v<TType, float>)
+    {
+        store<TLength>(lhs, _mm_mul_ps(load<TLength>(lhs), load<TLength>(rhs)));
+    }
+    else
+    {
+#ifdef FOXMATH_SIMD_SSE4_1
+        store<TLength>(lhs, _mm_mullo_epi32(load<TLength>(lhs), load<TLength>(rhs)));
+#else
+        for (size_t i = 0; i < TLength; i++)
+        {
+            lhs[i] *= rhs[i];
+        }
+#endif
+    }
+}
+
+template <size_t TLength>
+inline
+void div (float* lhs, const float* rhs) noexcept
+{
+    if constexpr (TLength == 4)
+    {
+        store<TLength>(lhs, _mm_div_ps(load<TLength>(lhs), load<TLength>(rhs)));
+    }
+    else
+    {
+        /*4th lane is set to 1 to avoid 0/0*/
+        const __m128 rhsReg = _mm_or_ps(load<TLength>(rhs), _mm_set_ps(1.f, 0.f, 0.f, 0.f));
+        store<TLength>(lhs, _mm_div_ps(load<TLength>(lhs), rhsReg));
+    }
+}
+
+template <size_t TLength, typename TType>
+inline
+void addScalar (TType* lhs, TType scalar) noexcept
+{
+    if constexpr (std::is_same_v<TType, float>)
+    {
+        store<TLength>(lhs, _mm_add_ps(load<TLength>(lhs), _mm_set1_ps(scalar)));
+    }
+    else
+    {
+        store<TLength>(lhs, _mm_add_epi32(load<TLength>(lhs), _mm_set1_epi32(scalar)));
+    }
+}
+
+template <size_t TLength, typename TType>
+inline
+void subScalar (TType* lhs, TType scalar) noexcept
+{
+    if constexpr (std::is_same_v<TType, float>)
+    {
+        store<TLength>(lhs, _mm_sub_ps(load<TLength>(lhs), _mm_set1_ps(scalar)));
+    }
+    else
+    {
+        store<TLength>(lhs, _mm_sub_epi32(load<TLength>(lhs), _mm_set1_epi32(scalar)));
+    }
+}
+
+template <size_t TLength, typename TType>
+inline
+void mulScalar (TType* lhs, TType scalar) noexcept
+{
+    if constexpr (std::is_same_v<TType, float>)
+    {
+        store<TLength>(lhs, _mm_mul_ps(load<TLength>(lhs), _mm_set1_ps(scalar)));
+    }
+    else
+    {
+#ifdef FOXMATH_SIMD_SSE4_1
+        store<TLength>(lhs, _mm_mullo_epi32(load<TLength>(lhs), _mm_set1_epi32(scalar)));
+#else
+        for (size_t i = 0; i < TLength; i++)
+        {
+            lhs[i] *= scalar;
+        }
+#endif
+    }
+}
+
+template <size_t TLength>
+inline
+void divScalar (float* lhs, float scalar) noexcept
+{
+    store<TLength>(lhs, _mm_div_ps(load<TLength>(lhs), _mm_set1_ps(scalar)));
+}
+
+template <size_t TLength, typename TType>
+inline
+TType dot (const TType* lhs, const TType* rhs) noexcept
+{
+    if constexpr (std::is_same_v<TType, float>)
+    {
+        /*Shuffle reduction is faster than _mm_dp_ps latency on most architectures*/
+        const __m128 product    = _mm_mul_ps(load<TLength>(lhs), load<TLength>(rhs));
+        const __m128 shuffled   = _mm_shuffle_ps(product, product, _MM_SHUFFLE(2, 3, 0, 1)); //y x w z
+        const __m128 sums       = _mm_add_ps(product, shuffled); //x+y x+y z+w z+w
+        return _mm_cvtss_f32(_mm_add_ss(sums, _mm_movehl_ps(shuffled, sums)));
+    }
+    else
+    {
+#ifdef FOXMATH_SIMD_SSE4_1
+        const __m128i product   = _mm_mullo_epi32(load<TLength>(lhs), load<TLength>(rhs));
+        const __m128i sums      = _mm_add_epi32(product, _mm_shuffle_epi32(product, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_cvtsi128_si32(_mm_add_epi32(sums, _mm_shuffle_epi32(sums, _MM_SHUFFLE(1, 0, 3, 2))));
+#else
+        TType rst {0};
+        for (size_t i = 0; i < TLength; i++)
+        {
+            rst += lhs[i] * rhs[i];
+        }
+        return rst;
+#endif
+    }
+}
+
+inline
+void sqrtBulk (float* data, size_t count) noexcept
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        _mm_storeu_ps(data + i, _mm_sqrt_ps(_mm_loadu_ps(data + i)));
+    }
+
+    for (; i < count; i++)
+    {
+        _mm_store_ss(data + i, _mm_sqrt_ss(_mm_load_ss(data + i)));
+    }
+}
+
+inline
+void invLengthBulk (float* squareLength, size_t count) noexcept
+{
+    const __m128 zero   = _mm_setzero_ps();
+    const __m128 one    = _mm_set1_ps(1.f);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 value      = _mm_loadu_ps(squareLength + i);
+        const __m128 isNull     = _mm_cmpeq_ps(value, zero);
+        const __m128 divisor    = _mm_or_ps(_mm_andnot_ps(isNull, _mm_sqrt_ps(value)), _mm_and_ps(isNull, one));
+        _mm_storeu_ps(squareLength + i, _mm_div_ps(one, divisor));
+    }
+
+    for (; i < count; i++)
+    {
+        squareLength[i] = (squareLength[i] != 0.f) ? 1.f / _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(squareLength[i]))) : 1.f;
+    }
+}
+
+/*Lanes are given in memory order (x, y, z, w) contrary to _MM_SHUFFLE*/
+template <int TX, int TY, int TZ, int TW>
+inline
+__m128 swizzle (__m128 reg) noexcept
+{
+    return _mm_castsi128_ps(_mm_shuffle_epi32(_mm_castps_si128(reg), _MM_SHUFFLE(TW, TZ, TY, TX)));
+}
+
+template <int TX, int TY, int TZ, int TW>
+inline
+__m128 shuffle (__m128 lhs, __m128 rhs) noexcept
+{
+    return _mm_shuffle_ps(lhs, rhs, _MM_SHUFFLE(TW, TZ, TY, TX));
+}
+
+/*2x2 matrix stored in one register : lhs * rhs*/
+inline
+__m128 mat2Mul (__m128 lhs, __m128 rhs) noexcept
+{
+    return _mm_add_ps(_mm_mul_ps(lhs, swizzle<0, 3, 0, 3>(rhs)), _mm_mul_ps(swizzle<1, 0, 3, 2>(lhs), swizzle<2, 1, 2, 1>(rhs)));
+}
+
+/*2x2 matrix stored in one register : adjugate(lhs) * rhs*/
+inline
+__m128 mat2AdjMul (__m128 lhs, __m128 rhs) noexcept
+{
+    return _mm_sub_ps(_mm_mul_ps(swizzle<3, 3, 0, 0>(lhs), rhs), _mm_mul_ps(swizzle<1, 1, 2, 2>(lhs), swizzle<2, 3, 0, 1>(rhs)));
+}
+
+/*2x2 matrix stored in one register : lhs * adjugate(rhs)*/
+inline
+__m128 mat2MulAdj (__m128 lhs, __m128 rhs) noexcept
+{
+    return _mm_sub_ps(_mm_mul_ps(lhs, swizzle<3, 0, 3, 0>(rhs)), _mm_mul_ps(swizzle<1, 0, 3, 2>(lhs), swizzle<2, 1, 2, 1>(rhs)));
+}
+
+/*lhs * rhs + acc*/
+inline
+__m128 madd (__m128 lhs, __m128 rhs, __m128 acc) noexcept
+{
+#ifdef FOXMATH_SIMD_FMA
+    return _mm_fmadd_ps(lhs, rhs, acc);
+#else
+    return _mm_add_ps(_mm_mul_ps(lhs, rhs), acc);
+#endif
+}
+
+/*xoshiro128+ step on 4 streams (one by lane)*/
+inline
+__m128i xoshiro128PlusNext (__m128i* state) noexcept
+{
+    const __m128i rst   = _mm_add_epi32(state[0], state[3]);
+    const __m128i t     = _mm_slli_epi32(state[1], 9);
+
+    state[2] = _mm_xor_si128(state[2], state[0]);
+    state[3] = _mm_xor_si128(state[3], state[1]);
+    state[1] = _mm_xor_si128(state[1], state[2]);
+    state[0] = _mm_xor_si128(state[0], state[3]);
+
+    state[2] = _mm_xor_si128(state[2], t);
+    state[3] = _mm_or_si128(_mm_slli_epi32(state[3], 11), _mm_srli_epi32(state[3], 21));
+
+    return rst;
+}
+
+template <size_t TPatternLength>
+inline
+void uniformBulk (uint32_t* state, float* out, size_t count, const float* min, const float* scale) noexcept
+{
+    static_assert(TPatternLength == 4 || TPatternLength == 12);
+    constexpr size_t registerCount = TPatternLength / 4;
+
+    __m128i streams[4] = {  _mm_loadu_si128(reinterpret_cast<const __m128i*>(state)),
+                            _mm_loadu_si128(reinterpret_cast<const __m128i*>(state + 4)),
+                            _mm_loadu_si128(reinterpret_cast<const __m128i*>(state + 8)),
+                            _mm_loadu_si128(reinterpret_cast<const __m128i*>(state + 12))};
+
+    __m128 minRegs   [registerCount];
+    __m128 scaleRegs [registerCount];
+    for (size_t r = 0; r < registerCount; ++r)
+    {
+        minRegs[r]   = _mm_loadu_ps(min + r * 4);
+        scaleRegs[r] = _mm_loadu_ps(scale + r * 4);
+    }
+
+    /*24 upper bits are converted : exact in float and positive in signed conversion*/
+    size_t i = 0;
+    size_t r = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 value = _mm_cvtepi32_ps(_mm_srli_epi32(xoshiro128PlusNext(streams), 8));
+        _mm_storeu_ps(out + i, madd(value, scaleRegs[r], minRegs[r]));
+
+        if constexpr (registerCount > 1)
+            r = (r + 1 == registerCount) ? 0 : r + 1;
+    }
+
+    if (i < count)
+    {
+        alignas(16) float tail [4];
+        const __m128 value = _mm_cvtepi32_ps(_mm_srli_epi32(xoshiro128PlusNext(streams), 8));
+        _mm_store_ps(tail, madd(value, scaleRegs[r], minRegs[r]));
+
+        for (size_t j = 0; i + j < count; ++j)
+            out[i + j] = tail[j];
+    }
+
+    for (size_t k = 0; k < 4; ++k)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(state + k * 4), streams[k]);
+}
+
+inline
+void mulMat4 (const float* lhs, const float* rhs, float* dst) noexcept
+{
+    const __m128 row0 = _mm_loadu_ps(rhs);
+    const __m128 row1 = _mm_loadu_ps(rhs + 4);
+    const __m128 row2 = _mm_loadu_ps(rhs + 8);
+    const __m128 row3 = _mm_loadu_ps(rhs + 12);
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        const __m128 coefs = _mm_loadu_ps(lhs + i * 4);
+
+        __m128 rst = _mm_mul_ps(swizzle<0, 0, 0, 0>(coefs), row0);
+        rst = madd(swizzle<1, 1, 1, 1>(coefs), row1, rst);
+        rst = madd(swizzle<2, 2, 2, 2>(coefs), row2, rst);
+        rst = madd(swizzle<3, 3, 3, 3>(coefs), row3, rst);
+
+        _mm_storeu_ps(dst + i * 4, rst);
+    }
+}
+
+inline
+void mulMat4Transposed (const float* lhs, const float* rhsTransposed, float* dst) noexcept
+{
+    __m128 row0 = _mm_loadu_ps(rhsTransposed);
+    __m128 row1 = _mm_loadu_ps(rhsTransposed + 4);
+    __m128 row2 = _mm_loadu_ps(rhsTransposed + 8);
+    __m128 row3 = _mm_loadu_ps(rhsTransposed + 12);
+    _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        const __m128 coefs = _mm_loadu_ps(lhs + i * 4);
+
+        __m128 rst = _mm_mul_ps(swizzle<0, 0, 0, 0>(coefs), row0);
+        rst = madd(swizzle<1, 1, 1, 1>(coefs), row1, rst);
+        rst = madd(swizzle<2, 2, 2, 2>(coefs), row2, rst);
+        rst = madd(swizzle<3, 3, 3, 3>(coefs), row3, rst);
+
+        _mm_storeu_ps(dst + i * 4, rst);
+    }
+}
+
+/*dst[row][column..column + 4 * TTile] for TRows rows, accumulated on rhs rows [kBegin, kEnd)*/
+template <size_t TRows, size_t TTile>
+inline
+void mulMatTile (const float* lhs, const float* rhs, float* dst, size_t sharedSize, size_t columnSize, size_t column, size_t kBegin, size_t kEnd) noexcept
+{
+    __m128 acc[TRows][TTile];
+
+    for (size_t r = 0; r < TRows; r++)
+    {
+        for (size_t t = 0; t < TTile; t++)
+        {
+            acc[r][t] = kBegin ? _mm_loadu_ps(dst + r * columnSize + column + t * 4) : _mm_setzero_ps();
+        }
+    }
+
+    for (size_t k = kBegin; k < kEnd; k++)
+    {
+        /*Each rhs register is reused for all the rows of the tile*/
+        const float* rhsRow = rhs + k * columnSize + column;
+        __m128 rhsReg[TTile];
+        for (size_t t = 0; t < TTile; t++)
+        {
+            rhsReg[t] = _mm_loadu_ps(rhsRow + t * 4);
+        }
+
+        for (size_t r = 0; r < TRows; r++)
+        {
+            const __m128 coef = _mm_set1_ps(lhs[r * sharedSize + k]);
+
+            for (size_t t = 0; t < TTile; t++)
+            {
+                acc[r][t] = madd(coef, rhsReg[t], acc[r][t]);
+            }
+        }
+    }
+
+    for (size_t r = 0; r < TRows; r++)
+    {
+        for (size_t t = 0; t < TTile; t++)
+        {
+            _mm_storeu_ps(dst + r * columnSize + column + t * 4, acc[r][t]);
+        }
+    }
+}
+
+/*Register tile of TRows rows on all the columns : 16 columns, then 4 columns, then scalar*/
+template <size_t TRows>
+inline
+void mulMatRows (const float* lhs, const float* rhs, float* dst, size_t sharedSize, size_t columnSize, size_t kBegin, size_t kEnd) noexcept
+{
+    size_t j = 0;
+
+    for (; j + 16 <= columnSize; j += 16)
+    {
+        mulMatTile<TRows, 4>(lhs, rhs, dst, sharedSize, columnSize, j, kBegin, kEnd);
+    }
+
+    for (; j + 4 <= columnSize; j += 4)
+    {
+        mulMatTile<TRows, 1>(lhs, rhs, dst, sharedSize, columnSize, j, kBegin, kEnd);
+    }
+
+    for (; j < columnSize; j++)
+    {
+        for (size_t r = 0; r < TRows; r++)
+        {
+            float acc = kBegin ? dst[r * columnSize + j] : 0.f;
+
+            for (size_t k = kBegin; k < kEnd; k++)
+            {
+                acc += lhs[r * sharedSize + k] * rhs[k * columnSize + j];
+            }
+
+            dst[r * columnSize + j] = acc;
+        }
+    }
+}
+
+inline
+void mulMat (const float* lhs, const float* rhs, float* dst, size_t rowSize, size_t sharedSize, size_t columnSize) noexcept
+{
+    constexpr size_t sharedBlockSize = 256;
+
+    for (size_t kBlock = 0; kBlock < sharedSize; kBlock += sharedBlockSize)
+    {
+        const size_t kEnd = (kBlock + sharedBlockSize < sharedSize) ? kBlock + sharedBlockSize : sharedSize;
+
+        size_t i = 0;
+        for (; i + 2 <= rowSize; i += 2)
+        {
+            mulMatRows<2>(lhs + i * sharedSize, rhs, dst + i * columnSize, sharedSize, columnSize, kBlock, kEnd);
+        }
+
+        for (; i < rowSize; i++)
+        {
+            mulMatRows<1>(lhs + i * sharedSize, rhs, dst + i * columnSize, sharedSize, columnSize, kBlock, kEnd);
+        }
+    }
+}
+
+/*dst[row][column..column + columnCount] (columnCount <= 4) for TRows rows : dot products on the shared dimension by 4 floats, then scalar tail*/
+template <size_t TRows>
+inline
+void mulMatTransposedTile (const float* lhs, const float* rhsTransposed, float* dst, size_t sharedSize, size_t columnSize, size_t column, size_t columnCount) noexcept
+{
+    __m128 acc[TRows][4];
+
+    for (size_t r = 0; r < TRows; r++)
+    {
+        for (size_t c = 0; c < 4; c++)
+        {
+            acc[r][c] = _mm_setzero_ps();
+        }
+    }
+
+    /*Missing columns read the last one and are not stored*/
+    const float* rhsRows[4];
+    for (size_t c = 0; c < 4; c++)
+    {
+        rhsRows[c] = rhsTransposed + (column + (c < columnCount ? c : columnCount - 1)) * sharedSize;
+    }
+
+    const size_t sharedVectorSize = sharedSize - sharedSize % 4;
+    for (size_t k = 0; k < sharedVectorSize; k += 4)
+    {
+        /*Each rhs register is reused for all the rows of the tile*/
+        const __m128 rhsReg[4] = {_mm_loadu_ps(rhsRows[0] + k), _mm_loadu_ps(rhsRows[1] + k), _mm_loadu_ps(rhsRows[2] + k), _mm_loadu_ps(rhsRows[3] + k)};
+
+        for (size_t r = 0; r < TRows; r++)
+        {
+            const __m128 lhsReg = _mm_loadu_ps(lhs + r * sharedSize + k);
+
+            for (size_t c = 0; c < 4; c++)
+            {
+                acc[r][c] = madd(lhsReg, rhsReg[c], acc[r][c]);
+            }
+        }
+    }
+
+    for (size_t r = 0; r < TRows; r++)
+    {
+        /*Lane c of the sum is the horizontal sum of acc[r][c]*/
+        _MM_TRANSPOSE4_PS(acc[r][0], acc[r][1], acc[r][2], acc[r][3]);
+        __m128 sum = _mm_add_ps(_mm_add_ps(acc[r][0], acc[r][1]), _mm_add_ps(acc[r][2], acc[r][3]));
+
+        for (size_t k = sharedVectorSize; k < sharedSize; k++)
+        {
+            sum = madd(_mm_set1_ps(lhs[r * sharedSize + k]), _mm_setr_ps(rhsRows[0][k], rhsRows[1][k], rhsRows[2][k], rhsRows[3][k]), sum);
+        }
+
+        alignas(16) float rst[4];
+        _mm_store_ps(rst, sum);
+
+        for (size_t c = 0; c < columnCount; c++)
+        {
+            dst[r * columnSize + column + c] = rst[c];
+        }
+    }
+}
+
+/*Register tile of TRows rows on all the columns by 4 columns*/
+template <size_t TRows>
+inline
+void mulMatTransposedRows (const float* lhs, const float* rhsTransposed, float* dst, size_t sharedSize, size_t columnSize) noexcept
+{
+    for (size_t j = 0; j < columnSize; j += 4)
+    {
+        mulMatTransposedTile<TRows>(lhs, rhsTransposed, dst, sharedSize, columnSize, j, columnSize - j < 4 ? columnSize - j : 4);
+    }
+}
+
+inline
+void mulMatTransposed (const float* lhs, const float* rhsTransposed, float* dst, size_t rowSize, size_t sharedSize, size_t columnSize) noexcept
+{
+    size_t i = 0;
+    for (; i + 2 <= rowSize; i += 2)
+    {
+        mulMatTransposedRows<2>(lhs + i * sharedSize, rhsTransposed, dst + i * columnSize, sharedSize, columnSize);
+    }
+
+    for (; i < rowSize; i++)
+    {
+        mulMatTransposedRows<1>(lhs + i * sharedSize, rhsTransposed, dst + i * columnSize, sharedSize, columnSize);
+    }
+}
+
+inline
+float inverseMat4 (const float* src, float* dst) noexcept
+{
+    const __m128 row0 = _mm_loadu_ps(src);
+    const __m128 row1 = _mm_loadu_ps(src + 4);
+    const __m128 row2 = _mm_loadu_ps(src + 8);
+    const __m128 row3 = _mm_loadu_ps(src + 12);
+
+    /*Split in 4 sub matrix 2x2 : | A B |
+                                  | C D |*/
+    const __m128 a = _mm_movelh_ps(row0, row1);
+    const __m128 b = _mm_movehl_ps(row1, row0);
+    const __m128 c = _mm_movelh_ps(row2, row3);
+    const __m128 d = _mm_movehl_ps(row3, row2);
+
+    /*Determinant of A, B, C and D in one pass*/
+    const __m128 detSub = _mm_sub_ps(_mm_mul_ps(shuffle<0, 2, 0, 2>(row0, row2), shuffle<1, 3, 1, 3>(row1, row3)),
+                                     _mm_mul_ps(shuffle<1, 3, 1, 3>(row0, row2), shuffle<0, 2, 0, 2>(row1, row3)));
+    const __m128 detA = swizzle<0, 0, 0, 0>(detSub);
+    const __m128 detB = swizzle<1, 1, 1, 1>(detSub);
+    const __m128 detC = swizzle<2, 2, 2, 2>(detSub);
+    const __m128 detD = swizzle<3, 3, 3, 3>(detSub);
+
+    const __m128 dc = mat2AdjMul(d, c);
+    const __m128 ab = mat2AdjMul(a, b);
+
+    __m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), mat2Mul(b, dc));
+    __m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), mat2Mul(c, ab));
+    __m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), mat2MulAdj(d, ab));
+    __m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), mat2MulAdj(a, dc));
+
+    /*det(M) = det(A)det(D) + det(B)det(C) - tr((A#B)(D#C))*/
+    __m128 trace = _mm_mul_ps(ab, swizzle<0, 2, 1, 3>(dc));
+    trace = _mm_add_ps(trace, swizzle<1, 0, 3, 2>(trace));
+    trace = _mm_add_ps(trace, swizzle<2, 3, 0, 1>(trace));
+
+    const __m128 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+
+    const __m128 invDet = _mm_div_ps(_mm_setr_ps(1.f, -1.f, -1.f, 1.f), det);
+    x = _mm_mul_ps(x, invDet);
+    y = _mm_mul_ps(y, invDet);
+    z = _mm_mul_ps(z, invDet);
+    w = _mm_mul_ps(w, invDet);
+
+    _mm_storeu_ps(dst,      shuffle<3, 1, 3, 1>(x, y));
+    _mm_storeu_ps(dst + 4,  shuffle<2, 0, 2, 0>(x, y));
+    _mm_storeu_ps(dst + 8,  shuffle<3, 1, 3, 1>(z, w));
+    _mm_storeu_ps(dst + 12, shuffle<2, 0, 2, 0>(z, w));
+
+    return _mm_cvtss_f32(det);
+}
+
+/*Cross product of xyz lanes. 4th lane is aw * bw - aw * bw = 0*/
+inline
+__m128 cross3 (__m128 lhs, __m128 rhs) noexcept
+{
+    return _mm_sub_ps(_mm_mul_ps(swizzle<1, 2, 0, 3>(lhs), swizzle<2, 0, 1, 3>(rhs)),
+                      _mm_mul_ps(swizzle<2, 0, 1, 3>(lhs), swizzle<1, 2, 0, 3>(rhs)));
+}
+
+template <bool TColumnMajor>
+inline
+float inverseAffineMat4 (const float* src, float* dst) noexcept
+{
+    const __m128 v0 = _mm_loadu_ps(src);
+    const __m128 v1 = _mm_loadu_ps(src + 4);
+    const __m128 v2 = _mm_loadu_ps(src + 8);
+    const __m128 v3 = _mm_loadu_ps(src + 12);
+
+    /*Rows of adjugate if v are the columns of M, columns of adjugate if v are the rows of M*/
+    const __m128 c0 = cross3(v1, v2);
+    const __m128 c1 = cross3(v2, v0);
+    const __m128 c2 = cross3(v0, v1);
+
+    __m128 det = _mm_mul_ps(v0, c0);
+    det = _mm_add_ps(det, swizzle<1, 0, 3, 2>(det));
+    det = _mm_add_ps(det, swizzle<2, 3, 0, 1>(det));
+
+    const __m128 invDet = _mm_div_ps(_mm_set1_ps(1.f), det);
+    __m128 i0 = _mm_mul_ps(c0, invDet);
+    __m128 i1 = _mm_mul_ps(c1, invDet);
+    __m128 i2 = _mm_mul_ps(c2, invDet);
+    __m128 i3 = _mm_setzero_ps();
+
+    if constexpr (TColumnMajor)
+    {
+        _MM_TRANSPOSE4_PS(i0, i1, i2, i3);
+
+        /*-M⁻¹t with the columns of M⁻¹. 4th lane is 0 - 0 + 1*/
+        const __m128 sum = _mm_add_ps(_mm_add_ps(_mm_mul_ps(i0, swizzle<0, 0, 0, 0>(v3)), _mm_mul_ps(i1, swizzle<1, 1, 1, 1>(v3))),
+                                      _mm_mul_ps(i2, swizzle<2, 2, 2, 2>(v3)));
+        i3 = _mm_sub_ps(_mm_setr_ps(0.f, 0.f, 0.f, 1.f), sum);
+    }
+    else
+    {
+        /*-M⁻¹t with the columns of M⁻¹. 4th lane of the last row become 0 - 0 + 1 after transposition*/
+        const __m128 sum = _mm_add_ps(_mm_add_ps(_mm_mul_ps(i0, swizzle<3, 3, 3, 3>(v0)), _mm_mul_ps(i1, swizzle<3, 3, 3, 3>(v1))),
+                                      _mm_mul_ps(i2, swizzle<3, 3, 3, 3>(v2)));
+        i3 = _mm_sub_ps(_mm_setr_ps(0.f, 0.f, 0.f, 1.f), sum);
+
+        _MM_TRANSPOSE4_PS(i0, i1, i2, i3);
+    }
+
+    _mm_storeu_ps(dst,      i0);
+    _mm_storeu_ps(dst + 4,  i1);
+    _mm_storeu_ps(dst + 8,  i2);
+    _mm_storeu_ps(dst + 12, i3);
+
+    return _mm_cvtss_f32(det);
+}
+
+/*M * vec with M columns in registers*/
+template <ETransformMode TMode>
+inline
+__m128 transformOne (__m128 c0, __m128 c1, __m128 c2, __m128 c3, __m128 vec) noexcept
+{
+    __m128 rst = _mm_mul_ps(swizzle<0, 0, 0, 0>(vec), c0);
+    rst = madd(swizzle<1, 1, 1, 1>(vec), c1, rst);
+    rst = madd(swizzle<2, 2, 2, 2>(vec), c2, rst);
+
+    if constexpr (TMode == ETransformMode::Point || TMode == ETransformMode::PointHomogenized)
+    {
+        rst = _mm_add_ps(rst, c3);
+    }
+    else if constexpr (TMode == ETransformMode::Homogeneous)
+    {
+        rst = madd(swizzle<3, 3, 3, 3>(vec), c3, rst);
+    }
+
+    if constexpr (TMode == ETransformMode::PointHomogenized)
+    {
+        /*Divide by w only if w is not null, like GenericVector::homogenize*/
+        const __m128 w          = swizzle<3, 3, 3, 3>(rst);
+        const __m128 isNotNull  = _mm_cmpneq_ps(w, _mm_setzero_ps());
+        const __m128 divisor    = _mm_or_ps(_mm_and_ps(isNotNull, w), _mm_andnot_ps(isNotNull, _mm_set1_ps(1.f)));
+        rst = _mm_div_ps(rst, divisor);
+    }
+
+    return rst;
+}
+
+template <ETransformMode TMode, size_t TLength>
+inline
+void transformBulk (const float* columns, const float* in, float* out, size_t count) noexcept
+{
+    const __m128 c0 = _mm_loadu_ps(columns);
+    const __m128 c1 = _mm_loadu_ps(columns + 4);
+    const __m128 c2 = _mm_loadu_ps(columns + 8);
+    const __m128 c3 = _mm_loadu_ps(columns + 12);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        /*All loads before stores : in place transform is valid*/
+        const __m128 rst0 = transformOne<TMode>(c0, c1, c2, c3, load<TLength>(in + i * TLength));
+        const __m128 rst1 = transformOne<TMode>(c0, c1, c2, c3, load<TLength>(in + (i + 1) * TLength));
+        const __m128 rst2 = transformOne<TMode>(c0, c1, c2, c3, load<TLength>(in + (i + 2) * TLength));
+        const __m128 rst3 = transformOne<TMode>(c0, c1, c2, c3, load<TLength>(in + (i + 3) * TLength));
+
+        store<TLength>(out + i * TLength,        rst0);
+        store<TLength>(out + (i + 1) * TLength,  rst1);
+        store<TLength>(out + (i + 2) * TLength,  rst2);
+        store<TLength>(out + (i + 3) * TLength,  rst3);
+    }
+
+    for (; i < count; i++)
+    {
+        store<TLength>(out + i * TLength, transformOne<TMode>(c0, c1, c2, c3, load<TLength>(in + i * TLength)));
+    }
+}
+
+/*v + w * t + u x t with t = 2 * u x v. 4th lane of u is null so 4th lane of v is kept*/
+inline
+__m128 rotateVectorOne (__m128 u, __m128 w, __m128 vec) noexcept
+{
+    const __m128 t = cross3(u, vec);
+    const __m128 twoT = _mm_add_ps(t, t);
+    return _mm_add_ps(vec, madd(w, twoT, cross3(u, twoT)));
+}
+
+inline
+void rotateVectorsBulk (const float* quat, const float* in, float* out, size_t count) noexcept
+{
+    const __m128 q = _mm_loadu_ps(quat);
+    const __m128 u = _mm_and_ps(q, _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1)));
+    const __m128 w = swizzle<3, 3, 3, 3>(q);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        /*All loads before stores : in place rotation is valid*/
+        const __m128 rst0 = rotateVectorOne(u, w, load<3>(in + i * 3));
+        const __m128 rst1 = rotateVectorOne(u, w, load<3>(in + i * 3 + 3));
+        const __m128 rst2 = rotateVectorOne(u, w, load<3>(in + i * 3 + 6));
+        const __m128 rst3 = rotateVectorOne(u, w, load<3>(in + i * 3 + 9));
+
+        store<3>(out + i * 3,      rst0);
+        store<3>(out + i * 3 + 3,  rst1);
+        store<3>(out + i * 3 + 6,  rst2);
+        store<3>(out + i * 3 + 9,  rst3);
+    }
+
+    for (; i < count; i++)
+    {
+        store<3>(out + i * 3, rotateVectorOne(u, w, load<3>(in + i * 3)));
+    }
+}
+
+/*acos(x) for x in [-1, 1]. sqrt(1 - |x|) * P(|x|) (Abramowitz and Stegun 4.4.46, error 2e-8), pi - acos(-x) if x is negative*/
+inline
+__m128 acosApprox (__m128 x) noexcept
+{
+    const __m128 signMask   = _mm_set1_ps(-0.f);
+    const __m128 absX       = _mm_andnot_ps(signMask, x);
+
+    __m128 poly = _mm_set1_ps(-0.0012624911f);
+    poly = madd(poly, absX, _mm_set1_ps(0.0066700901f));
+    poly = madd(poly, absX, _mm_set1_ps(-0.0170881256f));
+    poly = madd(poly, absX, _mm_set1_ps(0.0308918810f));
+    poly = madd(poly, absX, _mm_set1_ps(-0.0501743046f));
+    poly = madd(poly, absX, _mm_set1_ps(0.0889789874f));
+    poly = madd(poly, absX, _mm_set1_ps(-0.2145988016f));
+    poly = madd(poly, absX, _mm_set1_ps(1.5707963050f));
+
+    const __m128 rst        = _mm_mul_ps(_mm_sqrt_ps(_mm_sub_ps(_mm_set1_ps(1.f), absX)), poly);
+    const __m128 isNegative = _mm_cmplt_ps(x, _mm_setzero_ps());
+    return _mm_or_ps(_mm_andnot_ps(isNegative, rst), _mm_and_ps(isNegative, _mm_sub_ps(_mm_set1_ps(3.14159265f), rst)));
+}
+
+/*sin(x) for x in [0, pi]. x is reduced to [0, pi/2] with sin(pi - x), then Taylor polynomial of degree 11 (error 6e-8)*/
+inline
+__m128 sinApprox (__m128 x) noexcept
+{
+    x = _mm_min_ps(x, _mm_sub_ps(_mm_set1_ps(3.14159265f), x));
+    const __m128 x2 = _mm_mul_ps(x, x);
+
+    __m128 poly = _mm_set1_ps(-2.5052108e-8f);
+    poly = madd(poly, x2, _mm_set1_ps(2.7557319e-6f));
+    poly = madd(poly, x2, _mm_set1_ps(-1.9841270e-4f));
+    poly = madd(poly, x2, _mm_set1_ps(8.3333333e-3f));
+    poly = madd(poly, x2, _mm_set1_ps(-1.6666667e-1f));
+    poly = madd(poly, x2, _mm_set1_ps(1.f));
+    return _mm_mul_ps(poly, x);
+}
+
+/*Interpolate 4 quaternions in SoA registers (sx[i] is x of the ith start quaternion)*/
+template <bool TShortestPath, bool TClampedRatio, bool TApproximate>
+inline
+void sLerp4 (const __m128* start, __m128* end, __m128 t) noexcept
+{
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one  = _mm_set1_ps(1.f);
+
+    if constexpr (TClampedRatio)
+        t = _mm_min_ps(_mm_max_ps(t, zero), one);
+
+    __m128 cosAngle = _mm_mul_ps(start[0], end[0]);
+    cosAngle = madd(start[1], end[1], cosAngle);
+    cosAngle = madd(start[2], end[2], cosAngle);
+    cosAngle = madd(start[3], end[3], cosAngle);
+
+    /*Sign bit of cos is applied on end ratio*/
+    __m128 endSign = zero;
+    if constexpr (TShortestPath)
+    {
+        endSign  = _mm_and_ps(cosAngle, _mm_set1_ps(-0.f));
+        cosAngle = _mm_xor_ps(cosAngle, endSign);
+    }
+
+    __m128 startRatio;
+    __m128 endRatio;
+
+    if constexpr (TApproximate)
+    {
+        const __m128 half = _mm_set1_ps(0.5f);
+
+        __m128 a = _mm_set1_ps(-1.43519f);
+        a = madd(a, cosAngle, _mm_set1_ps(3.55645f));
+        a = madd(a, cosAngle, _mm_set1_ps(-3.2452f));
+        a = madd(a, cosAngle, _mm_set1_ps(1.0904f));
+
+        __m128 b = _mm_set1_ps(0.215638f);
+        b = madd(b, cosAngle, _mm_set1_ps(-1.06021f));
+        b = madd(b, cosAngle, _mm_set1_ps(0.848013f));
+
+        const __m128 tMinusHalf = _mm_sub_ps(t, half);
+        const __m128 k          = madd(_mm_mul_ps(a, tMinusHalf), tMinusHalf, b);
+        const __m128 correction = _mm_mul_ps(_mm_mul_ps(t, tMinusHalf), _mm_mul_ps(_mm_sub_ps(t, one), k));
+
+        endRatio    = _mm_add_ps(t, correction);
+        startRatio  = _mm_sub_ps(one, endRatio);
+    }
+    else
+    {
+        const __m128 clampedCos     = _mm_min_ps(_mm_max_ps(cosAngle, _mm_set1_ps(-1.f)), one);
+        const __m128 angle          = acosApprox(clampedCos);
+        const __m128 sinAngle       = _mm_sqrt_ps(_mm_sub_ps(one, _mm_mul_ps(clampedCos, clampedCos)));
+        const __m128 isNearlyEqual  = _mm_cmpge_ps(cosAngle, _mm_set1_ps(0.9995f));
+
+        /*Divisor is 1 for nLerp lanes (no division by nearly 0)*/
+        const __m128 invSinAngle    = _mm_div_ps(one, _mm_or_ps(_mm_andnot_ps(isNearlyEqual, sinAngle), _mm_and_ps(isNearlyEqual, one)));
+        const __m128 oneMinusT      = _mm_sub_ps(one, t);
+
+        const __m128 sLerpStart     = _mm_mul_ps(sinApprox(_mm_mul_ps(oneMinusT, angle)), invSinAngle);
+        const __m128 sLerpEnd       = _mm_mul_ps(sinApprox(_mm_mul_ps(t, angle)), invSinAngle);
+
+        startRatio  = _mm_or_ps(_mm_andnot_ps(isNearlyEqual, sLerpStart), _mm_and_ps(isNearlyEqual, oneMinusT));
+        endRatio    = _mm_or_ps(_mm_andnot_ps(isNearlyEqual, sLerpEnd), _mm_and_ps(isNearlyEqual, t));
+    }
+
+    /*Nearly opposite quaternions (1 - cos² lose its precision) : start * cos(t * angle) + orthogonal * sin(t * angle), like Quaternion::sLerpOpposite*/
+    if constexpr (!TShortestPath)
+    {
+        const __m128 isOpposite = _mm_cmple_ps(cosAngle, _mm_set1_ps(-0.9995f));
+
+        if (_mm_movemask_ps(isOpposite) != 0)
+        {
+            /*Part of end orthogonal to start, its length is sin(angle)*/
+            __m128 orthogonal[4];
+            for (int i = 0; i < 4; ++i)
+            {
+                orthogonal[i] = _mm_sub_ps(end[i], _mm_mul_ps(cosAngle, start[i]));
+            }
+
+            __m128 squareSin = _mm_mul_ps(orthogonal[0], orthogonal[0]);
+            squareSin = madd(orthogonal[1], orthogonal[1], squareSin);
+            squareSin = madd(orthogonal[2], orthogonal[2], squareSin);
+            squareSin = madd(orthogonal[3], orthogonal[3], squareSin);
+
+            /*Exactly opposite : use the perpendicular quaternion (-y, x, -w, z) of start*/
+            const __m128 isExact        = _mm_cmple_ps(squareSin, _mm_set1_ps(1.1920929e-7f));
+            const __m128 signMask       = _mm_set1_ps(-0.f);
+            const __m128 perpendicular[4] = {_mm_xor_ps(start[1], signMask), start[0], _mm_xor_ps(start[3], signMask), start[2]};
+            const __m128 invSinAngle    = _mm_div_ps(one, _mm_sqrt_ps(_mm_or_ps(_mm_andnot_ps(isExact, squareSin), _mm_and_ps(isExact, one))));
+
+            const __m128 angle          = acosApprox(_mm_max_ps(cosAngle, _mm_set1_ps(-1.f)));
+            const __m128 tAngle         = _mm_mul_ps(t, angle);
+
+            /*cos(x) = sin(pi/2 - x) with sinApprox defined on [0, pi]*/
+            const __m128 complementary  = _mm_sub_ps(_mm_set1_ps(1.57079633f), tAngle);
+            const __m128 cosTAngle      = _mm_or_ps(sinApprox(_mm_andnot_ps(signMask, complementary)), _mm_and_ps(signMask, complementary));
+            const __m128 sinTAngle      = _mm_mul_ps(sinApprox(tAngle), invSinAngle);
+
+            for (int i = 0; i < 4; ++i)
+            {
+                const __m128 direction = _mm_or_ps(_mm_andnot_ps(isExact, orthogonal[i]), _mm_and_ps(isExact, perpendicular[i]));
+                end[i] = _mm_or_ps(_mm_andnot_ps(isOpposite, end[i]), _mm_and_ps(isOpposite, direction));
+            }
+
+            startRatio  = _mm_or_ps(_mm_andnot_ps(isOpposite, startRatio), _mm_and_ps(isOpposite, cosTAngle));
+            endRatio    = _mm_or_ps(_mm_andnot_ps(isOpposite, endRatio), _mm_and_ps(isOpposite, sinTAngle));
+        }
+    }
+
+    endRatio = _mm_xor_ps(endRatio, endSign);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        end[i] = madd(start[i], startRatio, _mm_mul_ps(end[i], endRatio));
+    }
+
+    /*Normalize : result of nLerp lanes is not unit, sLerp lanes stay unit*/
+    __m128 squaredMagnitude = _mm_mul_ps(end[0], end[0]);
+    squaredMagnitude = madd(end[1], end[1], squaredMagnitude);
+    squaredMagnitude = madd(end[2], end[2], squaredMagnitude);
+    squaredMagnitude = madd(end[3], end[3], squaredMagnitude);
+
+    const __m128 invMagnitude = _mm_div_ps(one, _mm_sqrt_ps(squaredMagnitude));
+    for (int i = 0; i < 4; ++i)
+    {
+        end[i] = _mm_mul_ps(end[i], invMagnitude);
+    }
+}
+
+template <bool TShortestPath, bool TClampedRatio, bool TApproximate>
+inline
+void sLerpBulk (const float* start, const float* end, const float* t, float* out, size_t count) noexcept
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 s[4] = {_mm_loadu_ps(start + i * 4), _mm_loadu_ps(start + i * 4 + 4), _mm_loadu_ps(start + i * 4 + 8), _mm_loadu_ps(start + i * 4 + 12)};
+        __m128 e[4] = {_mm_loadu_ps(end + i * 4),   _mm_loadu_ps(end + i * 4 + 4),   _mm_loadu_ps(end + i * 4 + 8),   _mm_loadu_ps(end + i * 4 + 12)};
+
+        /*AoS to SoA : s[0] = 4 x, s[1] = 4 y...*/
+        _MM_TRANSPOSE4_PS(s[0], s[1], s[2], s[3]);
+        _MM_TRANSPOSE4_PS(e[0], e[1], e[2], e[3]);
+
+        sLerp4<TShortestPath, TClampedRatio, TApproximate>(s, e, _mm_loadu_ps(t + i));
+
+        _MM_TRANSPOSE4_PS(e[0], e[1], e[2], e[3]);
+
+        _mm_storeu_ps(out + i * 4,      e[0]);
+        _mm_storeu_ps(out + i * 4 + 4,  e[1]);
+        _mm_storeu_ps(out + i * 4 + 8,  e[2]);
+        _mm_storeu_ps(out + i * 4 + 12, e[3]);
+    }
+
+    if (i == count)
+        return;
+
+    /*Tail : padded with identity quaternions*/
+    const size_t rest = count - i;
+    alignas(16) float startTail [16] = {0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f};
+    alignas(16) float endTail   [16] = {0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f};
+    alignas(16) float tTail     [4]  = {0.f, 0.f, 0.f, 0.f};
+
+    for (size_t j = 0; j < rest; ++j)
+    {
+        for (size_t k = 0; k < 4; ++k)
+        {
+            startTail[j * 4 + k] = start[(i + j) * 4 + k];
+            endTail[j * 4 + k]   = end[(i + j) * 4 + k];
+        }
+        tTail[j] = t[i + j];
+    }
+
+    sLerpBulk<TShortestPath, TClampedRatio, TApproximate>(startTail, endTail, tTail, endTail, 4);
+
+    for (size_t j = 0; j < rest * 4; ++j)
+    {
+        out[i * 4 + j] = endTail[j];
+    }
+}
+
+template <EPrecision TPrecision>
+inline
+void sinCos4 (__m128 angles, __m128& sinAngles, __m128& cosAngles) noexcept
+{
+    /*angle = quadrant * pi/2 + reduced, pi/2 in 3 parts (Cephes) so quadrant * part is exact*/
+    const __m128i quadrant  = _mm_cvtps_epi32(_mm_mul_ps(angles, _mm_set1_ps(0.636619772f)));
+    const __m128 quadrantF  = _mm_cvtepi32_ps(quadrant);
+
+    __m128 reduced = madd(quadrantF, _mm_set1_ps(-1.5703125f), angles);
+    reduced = madd(quadrantF, _mm_set1_ps(-4.837512969970703125e-4f), reduced);
+    reduced = madd(quadrantF, _mm_set1_ps(-7.54978995489188216e-8f), reduced);
+
+    const __m128 x2 = _mm_mul_ps(reduced, reduced);
+    __m128 sinPoly;
+    __m128 cosPoly;
+
+    if constexpr (TPrecision == EPrecision::Approximate)
+    {
+        sinPoly = _mm_mul_ps(reduced, madd(x2, _mm_set1_ps(-0.16153509933200558f), _mm_set1_ps(0.9995915742153391f)));
+        cosPoly = madd(x2, madd(x2, _mm_set1_ps(0.04048893584359353f), _mm_set1_ps(-0.49977630707616877f)), _mm_set1_ps(1.f));
+    }
+    else
+    {
+        sinPoly = madd(x2, _mm_set1_ps(-1.9515295891e-4f), _mm_set1_ps(8.3321608736e-3f));
+        sinPoly = madd(x2, sinPoly, _mm_set1_ps(-1.6666654611e-1f));
+        sinPoly = madd(_mm_mul_ps(reduced, x2), sinPoly, reduced);
+
+        cosPoly = madd(x2, _mm_set1_ps(2.443315711809948e-5f), _mm_set1_ps(-1.388731625493765e-3f));
+        cosPoly = madd(x2, cosPoly, _mm_set1_ps(4.166664568298827e-2f));
+        cosPoly = madd(_mm_mul_ps(x2, x2), cosPoly, madd(x2, _mm_set1_ps(-0.5f), _mm_set1_ps(1.f)));
+    }
+
+    /*Odd quadrant swap sin and cos. Sign bit of sin is bit 1 of quadrant, of cos is bit 1 of quadrant + 1*/
+    const __m128i one       = _mm_set1_epi32(1);
+    const __m128 isSwapped  = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, one), one));
+    const __m128 sinSign    = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, _mm_set1_epi32(2)), 30));
+    const __m128 cosSign    = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, one), _mm_set1_epi32(2)), 30));
+
+    sinAngles = _mm_xor_ps(_mm_or_ps(_mm_andnot_ps(isSwapped, sinPoly), _mm_and_ps(isSwapped, cosPoly)), sinSign);
+    cosAngles = _mm_xor_ps(_mm_or_ps(_mm_andnot_ps(isSwapped, cosPoly), _mm_and_ps(isSwapped, sinPoly)), cosSign);
+}
+
+template <EPrecision TPrecision>
+inline
+void sinCosBulk (const float* angles, float* sinAngles, float* cosAngles, size_t count) noexcept
+{
+    __m128 sinRst;
+    __m128 cosRst;
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        sinCos4<TPrecision>(_mm_loadu_ps(angles + i), sinRst, cosRst);
+        _mm_storeu_ps(sinAngles + i, sinRst);
+        _mm_storeu_ps(cosAngles + i, cosRst);
+    }
+
+    if (i == count)
+        return;
+
+    /*Tail : padded with zero angles*/
+    const size_t rest = count - i;
+    alignas(16) float tail [4] = {0.f, 0.f, 0.f, 0.f};
+    alignas(16) float sinTail [4];
+    alignas(16) float cosTail [4];
+
+    for (size_t j = 0; j < rest; ++j)
+    {
+        tail[j] = angles[i + j];
+    }
+
+    sinCos4<TPrecision>(_mm_load_ps(tail), sinRst, cosRst);
+    _mm_store_ps(sinTail, sinRst);
+    _mm_store_ps(cosTail, cosRst);
+
+    for (size_t j = 0; j < rest; ++j)
+    {
+        sinAngles[i + j] = sinTail[j];
+        cosAngles[i + j] = cosTail[j];
+    }
+}
+
+inline
+uint32_t segmentAABB4 (const float* pt1, const float* invDelta, const float* boxMin, const float* boxMax, float* tEntry) noexcept
+{
+    __m128 tNear = _mm_setzero_ps();
+    __m128 tFar  = _mm_set1_ps(1.f);
+
+    /*Accumulator is the second operand of max and min : NaN of 0 * inf (null axis and pt1 on the plane) is discarded*/
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        const bool      isPositive  = invDelta[axis] >= 0.f;
+        const __m128    origin      = _mm_set1_ps(pt1[axis]);
+        const __m128    inv         = _mm_set1_ps(invDelta[axis]);
+        const __m128    nearPlane   = _mm_load_ps((isPositive ? boxMin : boxMax) + axis * 4);
+        const __m128    farPlane    = _mm_load_ps((isPositive ? boxMax : boxMin) + axis * 4);
+
+        tNear   = _mm_max_ps(_mm_mul_ps(_mm_sub_ps(nearPlane, origin), inv), tNear);
+        tFar    = _mm_min_ps(_mm_mul_ps(_mm_sub_ps(farPlane, origin), inv), tFar);
+    }
+
+    _mm_storeu_ps(tEntry, tNear);
+    return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmple_ps(tNear, tFar)));
+}
+
+inline
+uint32_t segmentAABB8 (const float* pt1, const float* invDelta, const float* boxMin, const float* boxMax, float* tEntry) noexcept
+{
+#ifdef FOXMATH_SIMD_AVX
+    __m256 tNear = _mm256_setzero_ps();
+    __m256 tFar  = _mm256_set1_ps(1.f);
+
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        const bool      isPositive  = invDelta[axis] >= 0.f;
+        const __m256    origin      = _mm256_set1_ps(pt1[axis]);
+        const __m256    inv         = _mm256_set1_ps(invDelta[axis]);
+        const __m256    nearPlane   = _mm256_load_ps((isPositive ? boxMin : boxMax) + axis * 8);
+        const __m256    farPlane    = _mm256_load_ps((isPositive ? boxMax : boxMin) + axis * 8);
+
+        tNear   = _mm256_max_ps(_mm256_mul_ps(_mm256_sub_ps(nearPlane, origin), inv), tNear);
+        tFar    = _mm256_min_ps(_mm256_mul_ps(_mm256_sub_ps(farPlane, origin), inv), tFar);
+    }
+
+    _mm256_storeu_ps(tEntry, tNear);
+    return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(tNear, tFar, _CMP_LE_OQ)));
+#else
+    __m128 tNear [2] = {_mm_setzero_ps(), _mm_setzero_ps()};
+    __m128 tFar  [2] = {_mm_set1_ps(1.f), _mm_set1_ps(1.f)};
+
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        const bool      isPositive  = invDelta[axis] >= 0.f;
+        const __m128    origin      = _mm_set1_ps(pt1[axis]);
+        const __m128    inv         = _mm_set1_ps(invDelta[axis]);
+        const float*    nearPlanes  = (isPositive ? boxMin : boxMax) + axis * 8;
+        const float*    farPlanes   = (isPositive ? boxMax : boxMin) + axis * 8;
+
+        for (size_t half = 0; half < 2; ++half)
+        {
+            tNear[half] = _mm_max_ps(_mm_mul_ps(_mm_sub_ps(_mm_load_ps(nearPlanes + half * 4), origin), inv), tNear[half]);
+            tFar[half]  = _mm_min_ps(_mm_mul_ps(_mm_sub_ps(_mm_load_ps(farPlanes + half * 4), origin), inv), tFar[half]);
+        }
+    }
+
+    _mm_storeu_ps(tEntry, tNear[0]);
+    _mm_storeu_ps(tEntry + 4, tNear[1]);
+    return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmple_ps(tNear[0], tFar[0])) | (_mm_movemask_ps(_mm_cmple_ps(tNear[1], tFar[1])) << 4));
+#endif
+}
+
+/*Clip [tNear, tFar] of 4 segments with the slab [planeMin, planeMax]. Near plane is selected by lane with the sign of inv.
+NaN of 0 * inf (null axis and pt1 on the plane) is discarded : max and min return their second operand with NaN*/
+inline
+void clipSlab4 (__m128 origin, __m128 inv, __m128 planeMin, __m128 planeMax, __m128& tNear, __m128& tFar) noexcept
+{
+#ifdef FOXMATH_SIMD_SSE4_1
+    const __m128 nearPlane  = _mm_blendv_ps(planeMin, planeMax, inv);
+    const __m128 farPlane   = _mm_blendv_ps(planeMax, planeMin, inv);
+#else
+    const __m128 isNegative = _mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(inv), 31));
+    const __m128 nearPlane  = _mm_or_ps(_mm_andnot_ps(isNegative, planeMin), _mm_and_ps(isNegative, planeMax));
+    const __m128 farPlane   = _mm_xor_ps(_mm_xor_ps(planeMin, planeMax), nearPlane);
+#endif
+
+    tNear   = _mm_max_ps(_mm_mul_ps(_mm_sub_ps(nearPlane, origin), inv), tNear);
+    tFar    = _mm_min_ps(_mm_mul_ps(_mm_sub_ps(farPlane, origin), inv), tFar);
+}
+
+inline
+uint32_t segmentsAABB4 (const float* pt1, const float* invDelta, const float* boxMin, const float* boxMax, float* tEntry) noexcept
+{
+    __m128 tNear = _mm_setzero_ps();
+    __m128 tFar  = _mm_set1_ps(1.f);
+
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        clipSlab4(_mm_load_ps(pt1 + axis * 4), _mm_load_ps(invDelta + axis * 4), _mm_set1_ps(boxMin[axis]), _mm_set1_ps(boxMax[axis]), tNear, tFar);
+    }
+
+    _mm_storeu_ps(tEntry, tNear);
+    return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmple_ps(tNear, tFar)));
+}
+
+inline
+uint32_t segmentsAABB8 (const float* pt1, const float* invDelta, const float* boxMin, const float* boxMax, float* tEntry) noexcept
+{
+#ifdef FOXMATH_SIMD_AVX
+    __m256 tNear = _mm256_setzero_ps();
+    __m256 tFar  = _mm256_set1_ps(1.f);
+
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        const __m256 origin     = _mm256_load_ps(pt1 + axis * 8);
+        const __m256 inv        = _mm256_load_ps(invDelta + axis * 8);
+        const __m256 planeMin   = _mm256_set1_ps(boxMin[axis]);
+        const __m256 planeMax   = _mm256_set1_ps(boxMax[axis]);
+
+        /*Same as clipSlab4 on 8 lanes*/
+        tNear   = _mm256_max_ps(_mm256_mul_ps(_mm256_sub_ps(_mm256_blendv_ps(planeMin, planeMax, inv), origin), inv), tNear);
+        tFar    = _mm256_min_ps(_mm256_mul_ps(_mm256_sub_ps(_mm256_blendv_ps(planeMax, planeMin, inv), origin), inv), tFar);
+    }
+
+    _mm256_storeu_ps(tEntry, tNear);
+    return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(tNear, tFar, _CMP_LE_OQ)));
+#else
+    __m128 tNear [2] = {_mm_setzero_ps(), _mm_setzero_ps()};
+    __m128 tFar  [2] = {_mm_set1_ps(1.f), _mm_set1_ps(1.f)};
+
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        const __m128 planeMin = _mm_set1_ps(boxMin[axis]);
+        const __m128 planeMax = _mm_set1_ps(boxMax[axis]);
+
+        for (size_t half = 0; half < 2; ++half)
+        {
+            clipSlab4(_mm_load_ps(pt1 + axis * 8 + half * 4), _mm_load_ps(invDelta + axis * 8 + half * 4), planeMin, planeMax, tNear[half], tFar[half]);
+        }
+    }
+
+    _mm_storeu_ps(tEntry, tNear[0]);
+    _mm_storeu_ps(tEntry + 4, tNear[1]);
+    return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmple_ps(tNear[0], tFar[0])) | (_mm_movemask_ps(_mm_cmple_ps(tNear[1], tFar[1])) << 4));
+#endif
+}
+
+
+inline
+uint32_t frustumAABB4 (const float* planes, const float* boxMin, const float* boxMax, uint8_t* rejectPlane, uint32_t& intersectMask) noexcept
+{
+    const __m128    zero        = _mm_setzero_ps();
+    uint32_t        outsideMask = 0;
+
+    if (rejectPlane != nullptr)
+    {
+        /*Plane rejecting each box last time is gathered and transposed (one register by component) : positive vertex is selected by lane*/
+        __m128 normal [3]   = {_mm_loadu_ps(planes + rejectPlane[0] * 4), _mm_loadu_ps(planes + rejectPlane[1] * 4), _mm_loadu_ps(planes + rejectPlane[2] * 4)};
+        __m128 distance     = _mm_loadu_ps(planes + rejectPlane[3] * 4);
+        _MM_TRANSPOSE4_PS(normal[0], normal[1], normal[2], distance);
+
+        __m128 positiveDot = _mm_setzero_ps();
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+            const __m128 isPositive = _mm_cmpge_ps(normal[axis], zero);
+            const __m128 vertex     = _mm_or_ps(_mm_and_ps(isPositive, _mm_load_ps(boxMax + axis * 4)), _mm_andnot_ps(isPositive, _mm_load_ps(boxMin + axis * 4)));
+
+            positiveDot = _mm_add_ps(positiveDot, _mm_mul_ps(normal[axis], vertex));
+        }
+
+        outsideMask = static_cast<uint32_t>(_mm_movemask_ps(_mm_cmplt_ps(positiveDot, distance)));
+
+        if (outsideMask == 0xF)
+        {
+            intersectMask = 0;
+            return outsideMask;
+        }
+    }
+
+    uint32_t crossMask = 0;
+    for (size_t plane = 0; plane < 6; ++plane)
+    {
+        const float*    planeData   = planes + plane * 4;
+        __m128          positiveDot = _mm_setzero_ps();
+        __m128          negativeDot = _mm_setzero_ps();
+
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+            const bool      isPositive  = planeData[axis] >= 0.f;
+            const __m128    normal      = _mm_set1_ps(planeData[axis]);
+
+            positiveDot = _mm_add_ps(positiveDot, _mm_mul_ps(normal, _mm_load_ps((isPositive ? boxMax : boxMin) + axis * 4)));
+            negativeDot = _mm_add_ps(negativeDot, _mm_mul_ps(normal, _mm_load_ps((isPositive ? boxMin : boxMax) + axis * 4)));
+        }
+
+        const __m128    distance        = _mm_set1_ps(planeData[3]);
+        const uint32_t  planeOutside    = static_cast<uint32_t>(_mm_movemask_ps(_mm_cmplt_ps(positiveDot, distance)));
+        crossMask |= static_cast<uint32_t>(_mm_movemask_ps(_mm_cmplt_ps(negativeDot, distance)));
+
+        if (rejectPlane != nullptr)
+        {
+            const uint32_t newOutside = planeOutside & ~outsideMask;
+            for (size_t lane = 0; newOutside >> lane; ++lane)
+            {
+                if (newOutside & (1u << lane))
+                    rejectPlane[lane] = static_cast<uint8_t>(plane);
+            }
+        }
+
+        outsideMask |= planeOutside;
+        if (outsideMask == 0xF)
+            break;
+    }
+
+    intersectMask = crossMask & ~outsideMask;
+    return outsideMask;
+}
+
+inline
+uint32_t frustumAABB8 (const float* planes, const float* boxMin, const float* boxMax, uint8_t* rejectPlane, uint32_t& intersectMask) noexcept
+{
+#ifdef FOXMATH_SIMD_AVX
+    const __m256    zero        = _mm256_setzero_ps();
+    uint32_t        outsideMask = 0;
+
+    if (rejectPlane != nullptr)
+    {
+        __m256 positiveDot = _mm256_setzero_ps();
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+            const __m256 normal     = _mm256_setr_ps(planes[rejectPlane[0] * 4 + axis], planes[rejectPlane[1] * 4 + axis], planes[rejectPlane[2] * 4 + axis], planes[rejectPlane[3] * 4 + axis],
+                                                     planes[rejectPlane[4] * 4 + axis], planes[rejectPlane[5] * 4 + axis], planes[rejectPlane[6] * 4 + axis], planes[rejectPlane[7] * 4 + axis]);
+            const __m256 isPositive = _mm256_cmp_ps(normal, zero, _CMP_GE_OQ);
+            const __m256 vertex     = _mm256_blendv_ps(_mm256_load_ps(boxMin + axis * 8), _mm256_load_ps(boxMax + axis * 8), isPositive);
+
+            positiveDot = _mm256_add_ps(positiveDot, _mm256_mul_ps(normal, vertex));
+        }
+
+        const __m256 distance = _mm256_setr_ps(planes[rejectPlane[0] * 4 + 3], planes[rejectPlane[1] * 4 + 3], planes[rejectPlane[2] * 4 + 3], planes[rejectPlane[3] * 4 + 3],
+                                               planes[rejectPlane[4] * 4 + 3], planes[rejectPlane[5] * 4 + 3], planes[rejectPlane[6] * 4 + 3], planes[rejectPlane[7] * 4 + 3]);
+        outsideMask = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(positiveDot, distance, _CMP_LT_OQ)));
+
+        if (outsideMask == 0xFF)
+        {
+            intersectMask = 0;
+            return outsideMask;
+        }
+    }
+
+    uint32_t crossMask = 0;
+    for (size_t plane = 0; plane < 6; ++plane)
+    {
+        const float*    planeData   = planes + plane * 4;
+        __m256          positiveDot = _mm256_setzero_ps();
+        __m256          negativeDot = _mm256_setzero_ps();
+
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+            const bool      isPositive  = planeData[axis] >= 0.f;
+            const __m256    normal      = _mm256_set1_ps(planeData[axis]);
+
+            positiveDot = _mm256_add_ps(positiveDot, _mm256_mul_ps(normal, _mm256_load_ps((isPositive ? boxMax : boxMin) + axis * 8)));
+            negativeDot = _mm256_add_ps(negativeDot, _mm256_mul_ps(normal, _mm256_load_ps((isPositive ? boxMin : boxMax) + axis * 8)));
+        }
+
+        const __m256    distance        = _mm256_set1_ps(planeData[3]);
+        const uint32_t  planeOutside    = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(positiveDot, distance, _CMP_LT_OQ)));
+        crossMask |= static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(negativeDot, distance, _CMP_LT_OQ)));
+
+        if (rejectPlane != nullptr)
+        {
+            const uint32_t newOutside = planeOutside & ~outsideMask;
+            for (size_t lane = 0; newOutside >> lane; ++lane)
+            {
+                if (newOutside & (1u << lane))
+                    rejectPlane[lane] = static_cast<uint8_t>(plane);
+            }
+        }
+
+        outsideMask |= planeOutside;
+        if (outsideMask == 0xFF)
+            break;
+    }
+
+    intersectMask = crossMask & ~outsideMask;
+    return outsideMask;
+#else
+    /*Each half is copied in a 4 lanes structure of arrays*/
+    alignas(16) float halfMin [3 * 4];
+    alignas(16) float halfMax [3 * 4];
+    uint32_t outsideMask    = 0;
+    intersectMask           = 0;
+
+    for (size_t half = 0; half < 2; ++half)
+    {
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+            _mm_store_ps(halfMin + axis * 4, _mm_load_ps(boxMin + axis * 8 + half * 4));
+            _mm_store_ps(halfMax + axis * 4, _mm_load_ps(boxMax + axis * 8 + half * 4));
+        }
+
+        uint32_t halfIntersect;
+        outsideMask     |= frustumAABB4(planes, halfMin, halfMax, rejectPlane != nullptr ? rejectPlane + half * 4 : nullptr, halfIntersect) << (half * 4);
+        intersectMask   |= halfIntersect << (half * 4);
+    }
+
+    return outsideMask;
+#endif
+}
+
+inline
+uint32_t frustumSphere4 (const float* planes, const float* center, const float* radius, uint8_t* rejectPlane, uint32_t& intersectMask) noexcept
+{
+    const __m128    sphereRadius    = _mm_load_ps(radius);
+    const __m128    negativeRadius  = _mm_sub_ps(_mm_setzero_ps(), sphereRadius);
+    const __m128    centerX         = _mm_load_ps(center);
+    const __m128    centerY         = _mm_load_ps(center + 4);
+    const __m128    centerZ         = _mm_load_ps(center + 8);
+    uint32_t        outsideMask     = 0;
+
+    if (rejectPlane != nullptr)
+    {
+        /*Plane rejecting each sphere last time is gathered and transposed : one register by component*/
+        __m128 normalX  = _mm_loadu_ps(planes + rejectPlane[0] * 4);
+        __m128 normalY  = _mm_loadu_ps(planes + rejectPlane[1] * 4);
+        __m128 normalZ  = _mm_loadu_ps(planes + rejectPlane[2] * 4);
+        __m128 distance = _mm_loadu_ps(planes + rejectPlane[3] * 4);
+        _MM_TRANSPOSE4_PS(normalX, normalY, normalZ, distance);
+
+        const __m128 signedDistance = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(normalX, centerX), _mm_mul_ps(normalY, centerY)), _mm_mul_ps(normalZ, centerZ)), distance);
+        outsideMask = static_cast<uint32_t>(_mm_movemask_ps(_mm_cmplt_ps(signedDistance, negativeRadius)));
+
+        if (outsideMask == 0xF)
+        {
+            intersectMask = 0;
+            return outsideMask;
+        }
+    }
+
+    uint32_t crossMask = 0;
+    for (size_t plane = 0; plane < 6; ++plane)
+    {
+        const float*    planeData       = planes + plane * 4;
+        const __m128    signedDistance  = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(planeData[0]), centerX), _mm_mul_ps(_mm_set1_ps(planeData[1]), centerY)),
+                                                                _mm_mul_ps(_mm_set1_ps(planeData[2]), centerZ)), _mm_set1_ps(planeData[3]));
+        const uint32_t  planeOutside    = static_cast<uint32_t>(_mm_movemask_ps(_mm_cmplt_ps(signedDistance, negativeRadius)));
+        crossMask |= static_cast<uint32_t>(_mm_movemask_ps(_mm_cmplt_ps(signedDistance, sphereRadius)));
+
+        if (rejectPlane != nullptr)
+        {
+            const uint32_t newOutside = planeOutside & ~outsideMask;
+            for (size_t lane = 0; newOutside >> lane; ++lane)
+            {
+                if (newOutside & (1u << lane))
+                    rejectPlane[lane] = static_cast<uint8_t>(plane);
+            }
+        }
+
+        outsideMask |= planeOutside;
+        if (outsideMask == 0xF)
+            break;
+    }
+
+    intersectMask = crossMask & ~outsideMask;
+    return outsideMask;
+}
+
+inline
+uint32_t frustumSphere8 (const float* planes, const float* center, const float* radius, uint8_t* rejectPlane, uint32_t& intersectMask) noexcept
+{
+#ifdef FOXMATH_SIMD_AVX
+    const __m256    sphereRadius    = _mm256_load_ps(radius);
+    const __m256    negativeRadius  = _mm256_sub_ps(_mm256_setzero_ps(), sphereRadius);
+    const __m256    centerX         = _mm256_load_ps(center);
+    const __m256    centerY         = _mm256_load_ps(center + 8);
+    const __m256    centerZ         = _mm256_load_ps(center + 16);
+    uint32_t        outsideMask     = 0;
+
+    if (rejectPlane != nullptr)
+    {
+        __m256 signedDistance = _mm256_setzero_ps();
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+            const __m256 normal = _mm256_setr_ps(planes[rejectPlane[0] * 4 + axis], planes[rejectPlane[1] * 4 + axis], planes[rejectPlane[2] * 4 + axis], planes[rejectPlane[3] * 4 + axis],
+                                                 planes[rejectPlane[4] * 4 + axis], planes[rejectPlane[5] * 4 + axis], planes[rejectPlane[6] * 4 + axis], planes[rejectPlane[7] * 4 + axis]);
+            signedDistance = _mm256_add_ps(signedDistance, _mm256_mul_ps(normal, _mm256_load_ps(center + axis * 8)));
+        }
+
+        const __m256 distance = _mm256_setr_ps(planes[rejectPlane[0] * 4 + 3], planes[rejectPlane[1] * 4 + 3], planes[rejectPlane[2] * 4 + 3], planes[rejectPlane[3] * 4 + 3],
+                                               planes[rejectPlane[4] * 4 + 3], planes[rejectPlane[5] * 4 + 3], planes[rejectPlane[6] * 4 + 3], planes[rejectPlane[7] * 4 + 3]);
+        signedDistance  = _mm256_sub_ps(signedDistance, distance);
+        outsideMask     = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(signedDistance, negativeRadius, _CMP_LT_OQ)));
+
+        if (outsideMask == 0xFF)
+        {
+            intersectMask = 0;
+            return outsideMask;
+        }
+    }
+
+    uint32_t crossMask = 0;
+    for (size_t plane = 0; plane < 6; ++plane)
+    {
+        const float*    planeData       = planes + plane * 4;
+        const __m256    signedDistance  = _mm256_sub_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(planeData[0]), centerX), _mm256_mul_ps(_mm256_set1_ps(planeData[1]), centerY)),
+                                                                      _mm256_mul_ps(_mm256_set1_ps(planeData[2]), centerZ)), _mm256_set1_ps(planeData[3]));
+        const uint32_t  planeOutside    = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(signedDistance, negativeRadius, _CMP_LT_OQ)));
+        crossMask |= static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(signedDistance, sphereRadius, _CMP_LT_OQ)));
+
+        if (rejectPlane != nullptr)
+        {
+            const uint32_t newOutside = planeOutside & ~outsideMask;
+            for (size_t lane = 0; newOutside >> lane; ++lane)
+            {
+                if (newOutside & (1u << lane))
+                    rejectPlane[lane] = static_cast<uint8_t>(plane);
+            }
+        }
+
+        outsideMask |= planeOutside;
+        if (outsideMask == 0xFF)
+            break;
+    }
+
+    intersectMask = crossMask & ~outsideMask;
+    return outsideMask;
+#else
+    alignas(16) float halfCenter [3 * 4];
+    alignas(16) float halfRadius [4];
+    uint32_t outsideMask    = 0;
+    intersectMask           = 0;
+
+    for (size_t half = 0; half < 2; ++half)
+    {
+        for (size_t axis = 0; axis < 3; ++axis)
+            _mm_store_ps(halfCenter + axis * 4, _mm_load_ps(center + axis * 8 + half * 4));
+
+        _mm_store_ps(halfRadius, _mm_load_ps(radius + half * 4));
+
+        uint32_t halfIntersect;
+        outsideMask     |= frustumSphere4(planes, halfCenter, halfRadius, rejectPlane != nullptr ? rejectPlane + half * 4 : nullptr, halfIntersect) << (half * 4);
+        intersectMask   |= halfIntersect << (half * 4);
+    }
+
+    return outsideMask;
+#endif
+}
+
+} /*namespace SIMD*/
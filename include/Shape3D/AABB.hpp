@@ -24,7 +24,7 @@ namespace FoxMath
         AABB& operator=(AABB const& other)		= default;
         AABB& operator=(AABB && other)			= default;
 
-        AABB(const Vec3& center, float iI, float iJ, float iK)
+        AABB(const Vec3f& center, float iI, float iJ, float iK)
         :       Volume  {},
                 center_ {center},
                 iI_     {iI},
@@ -36,30 +36,45 @@ namespace FoxMath
 
         #pragma region methods
 
-        bool isInside(Vec3 pt) const noexcept
+        bool isInside(Vec3f pt) const noexcept
         {
-            Vec3 localPt = pt - center_;
+            Vec3f localPt = pt - center_;
             const float espilon = 0.0001f; /*The standard float espsilone his enought in this case. The float value has chang to much*/
 
-            return  isBetween(localPt.x, -iI_ - espilon, iI_ + espilon) &&
-                    isBetween(localPt.y, -iJ_ - espilon, iJ_ + espilon) &&
-                    isBetween(localPt.z, -iK_ - espilon, iK_ + espilon);
+            return  isBetween(localPt.getX(), -iI_ - espilon, iI_ + espilon) &&
+                    isBetween(localPt.getY(), -iJ_ - espilon, iJ_ + espilon) &&
+                    isBetween(localPt.getZ(), -iK_ - espilon, iK_ + espilon);
+        }
+
+        /**
+         * @brief Corner of the box farthest in direction (GJK support function)
+         * 
+         * @param direction 
+         * @return Vec3f 
+         */
+        Vec3f getSupportPoint(const Vec3f& direction) const noexcept
+        {
+            return Vec3f{   center_.getX() + (direction.getX() < 0.f ? -iI_ : iI_),
+                            center_.getY() + (direction.getY() < 0.f ? -iJ_ : iJ_),
+                            center_.getZ() + (direction.getZ() < 0.f ? -iK_ : iK_)};
         }
 
         #pragma endregion //!methods
 
         #pragma region accessor
 
-        virtual Vec3    getCenter() const noexcept  { return center_; }
+        virtual Vec3f   getCenter() const noexcept  { return center_; }
         virtual float   getExtI()   const noexcept  { return iI_; }
         virtual float   getExtJ()   const noexcept  { return iJ_; }
         virtual float   getExtK()   const noexcept  { return iK_; }
+        Vec3f           getMin()    const noexcept  { return Vec3f{center_.getX() - iI_, center_.getY() - iJ_, center_.getZ() - iK_}; }
+        Vec3f           getMax()    const noexcept  { return Vec3f{center_.getX() + iI_, center_.getY() + iJ_, center_.getZ() + iK_}; }
 
         #pragma endregion //!accessor
 
         #pragma region mutator
 
-        void setCenter (const Vec3& center) noexcept   {  center_ = center; }
+        void setCenter (const Vec3f& center) noexcept   {  center_ = center; }
         void setExtI   (const float& i)     noexcept   {  iI_ = i; }
         void setExtJ   (const float& j)     noexcept   {  iJ_ = j; }
         void setExtK   (const float& k)     noexcept   {  iK_ = k; }
@@ -70,7 +85,7 @@ namespace FoxMath
 
         #pragma region attribut
 
-        Vec3 center_;
+        Vec3f center_;
         float iI_, iJ_, iK_;
 
         #pragma endregion //!attribut
@@ -12,6 +12,8 @@
 #include "Shape3D/Sphere.hpp"
 #include "Shape3D/Cylinder.hpp"
 
+#include <limits>
+
 namespace FoxMath
 {
     class Capsule : public Volume
@@ -27,9 +29,9 @@ namespace FoxMath
         Capsule& operator=(Capsule const& other)    = default;
         Capsule& operator=(Capsule && other)		= default;
 
-        explicit Capsule (const Vec3& center, const Vec3& normal, float height, float radius)
+        explicit Capsule (const Vec3f& center, const Vec3f& normal, float height, float radius)
         :       Volume          {},
-                segment_    {Vec3(center - normal * (height / 2.f)), Vec3(center + normal * (height / 2.f))},
+                segment_    {Vec3f(center - normal * (height / 2.f)), Vec3f(center + normal * (height / 2.f))},
                 radius_     {radius}
         {}
 
@@ -68,16 +70,33 @@ namespace FoxMath
             return Sphere(radius_, segment_.getPt2());
         }
 
-        bool isInside(const Vec3& pt) const noexcept
+        bool isInside(const Vec3f& pt) const noexcept
         {
             return segment_.getDistanceWithPoint(pt) <= radius_;
         }
 
-        Vec3 getCenter() const noexcept
+        Vec3f getCenter() const noexcept
         {
             return segment_.getCenter();
         }
 
+        /**
+         * @brief Point of the capsule farthest in direction : extremity of the segment pushed by the radius
+         * 
+         * @param direction 
+         * @return Vec3f 
+         */
+        Vec3f getSupportPoint(const Vec3f& direction) const noexcept
+        {
+            /*Support of the segment plus support of the sphere*/
+            const float length = direction.length();
+            const Vec3f& segmentSupport = segment_.getSupportPoint(direction);
+            if (length <= std::numeric_limits<float>::epsilon())
+                return segmentSupport;
+
+            return segmentSupport + direction * (radius_ / length);
+        }
+
         #pragma endregion //!methods
 
         #pragma region accessor
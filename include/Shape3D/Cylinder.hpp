@@ -11,6 +11,8 @@
 #include "Shape3D/Plane.hpp"
 #include "Shape3D/InfiniteCylinder.hpp"
 
+#include <limits>
+
 namespace FoxMath
 {
     class Cylinder : public Volume
@@ -26,9 +28,9 @@ namespace FoxMath
         Cylinder& operator=(Cylinder const&)  = default;
         Cylinder& operator=(Cylinder &&)      = default;
 
-        explicit Cylinder (const Vec3& center, const Vec3& normal, float height, float radius)
+        explicit Cylinder (const Vec3f& center, const Vec3f& normal, float height, float radius)
         :       Volume          {},
-                segment_  {Vec3(center - normal * (height / 2.f)), Vec3(center + normal * (height / 2.f))},
+                segment_  {Vec3f(center - normal * (height / 2.f)), Vec3f(center + normal * (height / 2.f))},
                 radius_   {radius}
         {}
 
@@ -38,7 +40,7 @@ namespace FoxMath
             radius_     {radius}
         {}
 
-        explicit Cylinder (const Vec3& pt1, const Vec3& pt2, float radius)
+        explicit Cylinder (const Vec3f& pt1, const Vec3f& pt2, float radius)
         :   Volume          {},
             segment_    (pt1, pt2),
             radius_  {radius}
@@ -55,19 +57,38 @@ namespace FoxMath
 
         Plane LeftPlane () const noexcept
         {
-            return Plane(segment_.getPt1(), (segment_.getPt1() - segment_.getPt2()).getNormalize());
+            return Plane(segment_.getPt1(), (segment_.getPt1() - segment_.getPt2()).getNormalized());
         }
 
         Plane RightPlane () const noexcept
         {
-            return Plane(segment_.getPt2(), (segment_.getPt2() - segment_.getPt1()).getNormalize());
+            return Plane(segment_.getPt2(), (segment_.getPt2() - segment_.getPt1()).getNormalized());
         }
 
-        Vec3 getCenter() const noexcept
+        Vec3f getCenter() const noexcept
         {
             return segment_.getCenter();
         }
 
+        /**
+         * @brief Point of the cylinder farthest in direction : extremity of the segment plus the rim of the disk
+         * 
+         * @param direction 
+         * @return Vec3f 
+         */
+        Vec3f getSupportPoint(const Vec3f& direction) const noexcept
+        {
+            /*Support of the segment plus support of the disk orthogonal to the segment*/
+            const Vec3f axis = segment_.getPt2() - segment_.getPt1();
+            const Vec3f radial = direction - axis * (Vec3f::dot(direction, axis) / Vec3f::dot(axis, axis));
+            const float radialLength = radial.length();
+            const Vec3f& segmentSupport = segment_.getSupportPoint(direction);
+            if (radialLength <= std::numeric_limits<float>::epsilon())
+                return segmentSupport;
+
+            return segmentSupport + radial * (radius_ / radialLength);
+        }
+
         #pragma endregion //!methods
     
         #pragma region accessor
@@ -0,0 +1,146 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 15 h 05
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stddef.h> //size_t
+#include <stdint.h> //uint8_t
+#include <cmath> //std::sqrt
+
+#include "Shape3D/Volume.hpp"
+#include "Shape3D/Plane.hpp"
+#include "Matrix/Matrix4.hpp"
+
+namespace FoxMath
+{
+    /**
+     * @brief Index of the planes of a frustum
+     */
+    enum class EFrustumPlane : uint8_t
+    {
+        Left    = 0,
+        Right   = 1,
+        Bottom  = 2,
+        Top     = 3,
+        Near    = 4,
+        Far     = 5,
+        Count   = 6
+    };
+
+    /**
+     * @brief Convex volume bounded by 6 planes (camera view volume). Plane normals point inside the frustum :
+     * a point is inside if its signed distance to each plane is positive
+     */
+    class Frustum : public Volume
+    {
+        public:
+
+        static constexpr size_t planeCount = static_cast<size_t>(EFrustumPlane::Count);
+
+        #pragma region constructor/destructor
+
+        Frustum ()					                = default;
+        Frustum (const Frustum& other)			    = default;
+        Frustum (Frustum&& other)				    = default;
+        virtual ~Frustum ()				            = default;
+        Frustum& operator=(Frustum const& other)	= default;
+        Frustum& operator=(Frustum && other)		= default;
+
+        /**
+         * @brief Extract the planes of the view volume of a view projection matrix (Mat4 projection * view, OpenGL clip space
+         * with -w <= z <= w). Planes are the combinations row 3 +/- row 0, 1 and 2 of the matrix (Gribb and Hartmann)
+         * 
+         * @tparam TMatrixConvention 
+         * @param viewProjection 
+         */
+        template <EMatrixConvention TMatrixConvention>
+        explicit inline
+        Frustum (const GenericMatrix<4, 4, float, TMatrixConvention>& viewProjection) noexcept;
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief Return true if the point is inside the frustum or on its boundary
+         * 
+         * @param point 
+         * @return true 
+         * @return false 
+         */
+        [[nodiscard]] inline
+        bool isPointInside (const Vec3f& point) const noexcept;
+
+        #pragma endregion //!methods
+
+        #pragma region accessor
+
+        [[nodiscard]] inline
+        const Plane&    getPlane    (EFrustumPlane plane)   const noexcept { return m_planes[static_cast<size_t>(plane)]; }
+
+        [[nodiscard]] inline
+        const Plane&    getPlane    (size_t index)          const noexcept { return m_planes[index]; }
+
+        #pragma endregion //!accessor
+
+        #pragma region mutator
+
+        inline
+        void            setPlane    (EFrustumPlane plane, const Plane& newPlane) noexcept { m_planes[static_cast<size_t>(plane)] = newPlane; }
+
+        #pragma endregion //!mutator
+
+        protected:
+
+        #pragma region attribut
+
+        Plane m_planes [planeCount];
+
+        #pragma endregion //!attribut
+
+        #pragma region methods
+
+        /**
+         * @brief Plane a * x + b * y + c * z + d >= 0 with normalized normal
+         * 
+         * @param a 
+         * @param b 
+         * @param c 
+         * @param d 
+         * @return Plane 
+         */
+        [[nodiscard]] static inline
+        Plane createPlane (float a, float b, float c, float d) noexcept;
+
+        #pragma endregion //!methods
+    };
+
+    #include "Frustum.inl"
+
+} /*namespace FoxMath*/
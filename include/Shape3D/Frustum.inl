@@ -0,0 +1,72 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 15 h 05
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <EMatrixConvention TMatrixConvention>
+inline
+Frustum::Frustum (const GenericMatrix<4, 4, float, TMatrixConvention>& viewProjection) noexcept
+    : Volume {}
+{
+    /*Element at row/column of the mathematical matrix (same order than the scalar constructor)*/
+    auto at = [&viewProjection](size_t row, size_t column) noexcept -> float
+    {
+        if constexpr (TMatrixConvention == EMatrixConvention::ColumnMajor)
+            return viewProjection.getData(column * 4 + row);
+        else
+            return viewProjection.getData(row * 4 + column);
+    };
+
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        /*-w <= clip[axis] : row 3 + row axis. clip[axis] <= w : row 3 - row axis*/
+        m_planes[axis * 2]      = createPlane(at(3, 0) + at(axis, 0), at(3, 1) + at(axis, 1), at(3, 2) + at(axis, 2), at(3, 3) + at(axis, 3));
+        m_planes[axis * 2 + 1]  = createPlane(at(3, 0) - at(axis, 0), at(3, 1) - at(axis, 1), at(3, 2) - at(axis, 2), at(3, 3) - at(axis, 3));
+    }
+}
+
+inline
+bool Frustum::isPointInside (const Vec3f& point) const noexcept
+{
+    for (const Plane& plane : m_planes)
+    {
+        if (plane.getSignedDistanceToPlane(point) < 0.f)
+            return false;
+    }
+
+    return true;
+}
+
+inline
+Plane Frustum::createPlane (float a, float b, float c, float d) noexcept
+{
+    /*Plane store dot(point, normal) - distance : distance is -d once the plane is normalized*/
+    const float invLength = 1.f / std::sqrt(a * a + b * b + c * c);
+    return Plane(-d * invLength, Vec3f{a * invLength, b * invLength, c * invLength});
+}
@@ -30,7 +30,7 @@ namespace FoxMath
             radius_  {radius}
         {}
 
-        explicit InfiniteCylinder (const Vec3& pt, const Vec3& normal, float radius)
+        explicit InfiniteCylinder (const Vec3f& pt, const Vec3f& normal, float radius)
         :   Volume          {},
             line_    (pt, normal),
             radius_  {radius}
@@ -40,9 +40,9 @@ namespace FoxMath
     
         #pragma region methods
 
-        bool isPointInside(const Vec3& pt) 
+        bool isPointInside(const Vec3f& pt) const noexcept
         {
-            return Vec3::cross(line_.getNormal(), pt - line_.getOrigin()).length() <= radius_;
+            return Vec3f::cross(line_.getNormal(), pt - line_.getOrigin()).length() <= radius_;
         }
 
         #pragma endregion //!methods
@@ -22,7 +22,7 @@ namespace FoxMath
         Line& operator=(Line const&)        = default;
         Line& operator=(Line &&)            = default; 
 
-        explicit Line (const Vec3& origin, const Vec3& normal)
+        explicit Line (const Vec3f& origin, const Vec3f& normal)
             :   origin_     {origin},
                 normal_ {normal}
         {}
@@ -31,21 +31,21 @@ namespace FoxMath
 
         #pragma region accessor
 
-        const Vec3& getOrigin() const noexcept    { return origin_; }
-        const Vec3& getNormal() const noexcept    { return normal_; }
+        const Vec3f& getOrigin() const noexcept    { return origin_; }
+        const Vec3f& getNormal() const noexcept    { return normal_; }
 
         #pragma endregion //!accessor
 
         #pragma region mutator
 
-        void setOrigin(const Vec3& newOrigin) noexcept { origin_ = newOrigin; }
-        void setNormal(const Vec3& newNormal) noexcept { normal_ = newNormal; }
+        void setOrigin(const Vec3f& newOrigin) noexcept { origin_ = newOrigin; }
+        void setNormal(const Vec3f& newNormal) noexcept { normal_ = newNormal; }
 
         #pragma endregion //!mutator
 
         protected :
 
-        Vec3    origin_, 
+        Vec3f   origin_, 
                 normal_;
     };
 } /*namespace FoxMath*/
@@ -26,20 +26,20 @@ namespace FoxMath
         OrientedBox& operator=(OrientedBox const&)  = default;
         OrientedBox& operator=(OrientedBox &&)      = default;
 
-        explicit OrientedBox (float rightLenght, float upLenght, float forwardLenght, const Vec3& center = Vec3::zero, const Vec3& rotation = Vec3::zero)
+        explicit OrientedBox (float rightLenght, float upLenght, float forwardLenght, const Vec3f& center = Vec3f::zero, const Vec3f& rotation = Vec3f::zero)
             :   Volume          {},
                 referential_    {center},
                 iI_             {rightLenght}, 
                 iJ_             {upLenght}, 
                 iK_             {forwardLenght}
         {
-            Mat3 rotationMatrix = Mat3::createFixedAngleEulerRotationMatrix(rotation);
-            referential_.unitI = rotationMatrix.getVectorRight();
-            referential_.unitJ = rotationMatrix.getVectorUp();
-            referential_.unitK = rotationMatrix.getVectorForward();
+            const Mat4f<> rotationMatrix = Mat4f<>::createFixedAngleEulerRotationMatrix(rotation);
+            rotationMatrix.transformDirections(&Vec3f::right, &referential_.unitI, 1);
+            rotationMatrix.transformDirections(&Vec3f::up, &referential_.unitJ, 1);
+            rotationMatrix.transformDirections(&Vec3f::forward, &referential_.unitK, 1);
         }
 
-        explicit OrientedBox(const Referential& referential, float rightLenght, float upLenght, float forwardLenght)
+        explicit OrientedBox(const Referentialf& referential, float rightLenght, float upLenght, float forwardLenght)
             :   Volume          {},
                 referential_    {referential},
                 iI_             {rightLenght}, 
@@ -53,30 +53,44 @@ namespace FoxMath
 
         AABB getAABB() const noexcept
         {
-            Vec3 vecIi = referential_.unitI * iI_;
-            Vec3 vecIj = referential_.unitJ * iJ_;
-            Vec3 vecIk = referential_.unitK * iK_;
-            float AABBiI = std::abs(Vec3::dot(Vec3::right, vecIi)) + std::abs(Vec3::dot(Vec3::right, vecIj)) + std::abs(Vec3::dot(Vec3::right, vecIk));
-            float AABBiJ = std::abs(Vec3::dot(Vec3::up, vecIi)) + std::abs(Vec3::dot(Vec3::up, vecIj)) + std::abs(Vec3::dot(Vec3::up, vecIk));
-            float AABBiK = std::abs(Vec3::dot(Vec3::forward, vecIi)) + std::abs(Vec3::dot(Vec3::forward, vecIj)) + std::abs(Vec3::dot(Vec3::forward, vecIk));
+            Vec3f vecIi = referential_.unitI * iI_;
+            Vec3f vecIj = referential_.unitJ * iJ_;
+            Vec3f vecIk = referential_.unitK * iK_;
+            float AABBiI = std::abs(Vec3f::dot(Vec3f::right, vecIi)) + std::abs(Vec3f::dot(Vec3f::right, vecIj)) + std::abs(Vec3f::dot(Vec3f::right, vecIk));
+            float AABBiJ = std::abs(Vec3f::dot(Vec3f::up, vecIi)) + std::abs(Vec3f::dot(Vec3f::up, vecIj)) + std::abs(Vec3f::dot(Vec3f::up, vecIk));
+            float AABBiK = std::abs(Vec3f::dot(Vec3f::forward, vecIi)) + std::abs(Vec3f::dot(Vec3f::forward, vecIj)) + std::abs(Vec3f::dot(Vec3f::forward, vecIk));
             return AABB{referential_.origin, AABBiI, AABBiJ, AABBiK};
         }
 
-        Vec3 ptForwardTopLeft     () const noexcept { return referential_.origin - (referential_.unitI * iI_) + (referential_.unitJ * iJ_) + (referential_.unitK * iK_); }
-        Vec3 ptForwardTopRight    () const noexcept { return referential_.origin + (referential_.unitI * iI_) + (referential_.unitJ * iJ_) + (referential_.unitK * iK_); }
-        Vec3 ptForwardBottomLeft  () const noexcept { return referential_.origin - (referential_.unitI * iI_) - (referential_.unitJ * iJ_) + (referential_.unitK * iK_); }
-        Vec3 ptForwardBottomRight () const noexcept { return referential_.origin + (referential_.unitI * iI_) - (referential_.unitJ * iJ_) + (referential_.unitK * iK_); }
-        Vec3 ptBackTopLeft        () const noexcept { return referential_.origin - (referential_.unitI * iI_) + (referential_.unitJ * iJ_) - (referential_.unitK * iK_); }
-        Vec3 ptBackTopRight       () const noexcept { return referential_.origin + (referential_.unitI * iI_) + (referential_.unitJ * iJ_) - (referential_.unitK * iK_); }
-        Vec3 ptBackBottomLeft     () const noexcept { return referential_.origin - (referential_.unitI * iI_) - (referential_.unitJ * iJ_) - (referential_.unitK * iK_); }
-        Vec3 ptBackBottomRight    () const noexcept { return referential_.origin + (referential_.unitI * iI_) - (referential_.unitJ * iJ_) - (referential_.unitK * iK_); }
+        Vec3f ptForwardTopLeft     () const noexcept { return referential_.origin - (referential_.unitI * iI_) + (referential_.unitJ * iJ_) + (referential_.unitK * iK_); }
+        Vec3f ptForwardTopRight    () const noexcept { return referential_.origin + (referential_.unitI * iI_) + (referential_.unitJ * iJ_) + (referential_.unitK * iK_); }
+        Vec3f ptForwardBottomLeft  () const noexcept { return referential_.origin - (referential_.unitI * iI_) - (referential_.unitJ * iJ_) + (referential_.unitK * iK_); }
+        Vec3f ptForwardBottomRight () const noexcept { return referential_.origin + (referential_.unitI * iI_) - (referential_.unitJ * iJ_) + (referential_.unitK * iK_); }
+        Vec3f ptBackTopLeft        () const noexcept { return referential_.origin - (referential_.unitI * iI_) + (referential_.unitJ * iJ_) - (referential_.unitK * iK_); }
+        Vec3f ptBackTopRight       () const noexcept { return referential_.origin + (referential_.unitI * iI_) + (referential_.unitJ * iJ_) - (referential_.unitK * iK_); }
+        Vec3f ptBackBottomLeft     () const noexcept { return referential_.origin - (referential_.unitI * iI_) - (referential_.unitJ * iJ_) - (referential_.unitK * iK_); }
+        Vec3f ptBackBottomRight    () const noexcept { return referential_.origin + (referential_.unitI * iI_) - (referential_.unitJ * iJ_) - (referential_.unitK * iK_); }
+
+        /**
+         * @brief Corner of the box farthest in direction, chosen with the sign of the direction on each axis of the referential
+         * 
+         * @param direction 
+         * @return Vec3f 
+         */
+        Vec3f getSupportPoint(const Vec3f& direction) const noexcept
+        {
+            return  referential_.origin
+                    + referential_.unitI * (Vec3f::dot(direction, referential_.unitI) < 0.f ? -iI_ : iI_)
+                    + referential_.unitJ * (Vec3f::dot(direction, referential_.unitJ) < 0.f ? -iJ_ : iJ_)
+                    + referential_.unitK * (Vec3f::dot(direction, referential_.unitK) < 0.f ? -iK_ : iK_);
+        }
 
         #pragma endregion //!methods
 
         #pragma region accessor
 
-        virtual Referential  getReferential()    const noexcept  { return referential_; }
-        Referential&         getReferential()          noexcept  { return referential_; }
+        virtual Referentialf  getReferential()    const noexcept  { return referential_; }
+        Referentialf&         getReferential()          noexcept  { return referential_; }
         virtual float        getExtI()           const noexcept  { return iI_; }
         virtual float        getExtJ()           const noexcept  { return iJ_; }
         virtual float        getExtK()           const noexcept  { return iK_; }
@@ -85,7 +99,7 @@ namespace FoxMath
 
         #pragma region mutator
 
-        void setReferential (const Referential& newReferential)    noexcept   {  referential_ = newReferential; }
+        void setReferential (const Referentialf& newReferential)    noexcept   {  referential_ = newReferential; }
         void setExtI        (const float& newExtI)                 noexcept   {  iI_ = newExtI; }
         void setExtJ        (const float& newExtJ)                 noexcept   {  iJ_ = newExtJ; }
         void setExtK        (const float& newExtK)                 noexcept   {  iK_ = newExtK; }
@@ -96,7 +110,7 @@ namespace FoxMath
 
         #pragma region attribut
 
-        Referential referential_;
+        Referentialf referential_;
         float       iI_ {0.f}, iJ_ {0.f}, iK_ {0.f}; 
 
         #pragma endregion //!attribut
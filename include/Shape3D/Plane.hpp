@@ -16,9 +16,20 @@ namespace FoxMath
 
             #pragma region constructor/destructor
 
-            Plane (float distance, const Vec3& normal);
-            Plane (const Vec3& p1, const Vec3& p2, const Vec3& p3);
-            Plane (const Vec3& p1, const Vec3& normal);
+            Plane (float distance, const Vec3f& normal)
+                :   normal_     (normal.getNormalized()),
+                    distance_   (distance)
+            {}
+
+            Plane (const Vec3f& p1, const Vec3f& p2, const Vec3f& p3)
+                :   normal_     ((p2 - p1).getCross(p3 - p1).getNormalized()),
+                    distance_   (p1.dot(normal_))
+            {}
+
+            Plane (const Vec3f& p1, const Vec3f& normal)
+                :   normal_     (normal.getNormalized()),
+                    distance_   (p1.dot(normal_))
+            {}
 
             Plane ()					    = default;
             Plane (const Plane& other)		= default;
@@ -44,7 +55,7 @@ namespace FoxMath
              * @return void 
              */
             static
-            void getPlansIntersection (const Plane& plane1, const Plane& plane2, const Plane& plane3, Vec3** point);
+            void getPlansIntersection (const Plane& plane1, const Plane& plane2, const Plane& plane3, Vec3f** point);
 
             
             /**
@@ -55,15 +66,15 @@ namespace FoxMath
              * @return float 
              */
             static
-            float getSignedDistanceToPlane(const Plane& plane, const Vec3& point)
+            float getSignedDistanceToPlane(const Plane& plane, const Vec3f& point)
             {
-                return Vec3::dot(point, plane.normal_) - plane.distance_;
+                return Vec3f::dot(point, plane.normal_) - plane.distance_;
             }
 
 
-            float getSignedDistanceToPlane(const Vec3& point)
+            float getSignedDistanceToPlane(const Vec3f& point) const
             {
-                return Vec3::dot(point, normal_) - distance_;
+                return Vec3f::dot(point, normal_) - distance_;
             }
 
             /**
@@ -71,10 +82,10 @@ namespace FoxMath
              * 
              * @param plane 
              * @param point 
-             * @return Vec3 
+             * @return Vec3f 
              */
             static
-            Vec3 getClosestPointToPlane(const Plane& plane, const Vec3& point)
+            Vec3f getClosestPointToPlane(const Plane& plane, const Vec3f& point)
             {
                 return point + getSignedDistanceToPlane(plane, point) * plane.normal_;
             }
@@ -87,9 +98,9 @@ namespace FoxMath
              * @return * float 
              */
             static
-            float getDistanceFromPointToPlan(const Plane& plane, const Vec3& point)
+            float getDistanceFromPointToPlan(const Plane& plane, const Vec3f& point)
             {
-                return plane.normal_.dotProduct(point);
+                return plane.normal_.dot(point);
             }
 
             /**
@@ -101,9 +112,9 @@ namespace FoxMath
              * @return false 
              */
             static
-            bool isOnPlane (const Plane& plane, const Vec3& point)
+            bool isOnPlane (const Plane& plane, const Vec3f& point)
             {
-                float rst = plane.normal_.dotProduct(point);
+                float rst = plane.normal_.dot(point);
                 return rst < plane.distance_ + std::numeric_limits<float>::epsilon() && rst > plane.distance_ - std::numeric_limits<float>::epsilon();
             }
 
@@ -116,7 +127,7 @@ namespace FoxMath
              * @return float 
              */
             static
-            bool vecIsBetweenPlanes (const Plane& plane1, const Plane& plane2, const Vec3& pt)
+            bool vecIsBetweenPlanes (const Plane& plane1, const Plane& plane2, const Vec3f& pt)
             {
                 return (getSignedDistanceToPlane(plane1, pt) <= -std::numeric_limits<float>::epsilon()) && (getSignedDistanceToPlane(plane2, pt) <= -std::numeric_limits<float>::epsilon());
             }
@@ -125,14 +136,14 @@ namespace FoxMath
 
             #pragma region accessor
 
-            const Vec3&  getNormal   ()   const noexcept { return normal_;}
+            const Vec3f&  getNormal   ()   const noexcept { return normal_;}
             const float& getDistance ()   const noexcept { return distance_;}
 
             #pragma endregion //!accessor
 
             #pragma region mutator
 
-            void setNormal   (const Vec3& newNormal)   noexcept { normal_ = newNormal.getNormalize();}
+            void setNormal   (const Vec3f& newNormal)   noexcept { normal_ = newNormal.getNormalized();}
             void setDistance (float newDistance) noexcept { distance_ = newDistance;}
 
             #pragma endregion //!mutator
@@ -141,7 +152,7 @@ namespace FoxMath
 
             #pragma region attribut
 
-            Vec3 normal_;       //unit vector
+            Vec3f normal_;       //unit vector
             float distance_;    //Distance with origin
 
             #pragma endregion //!attribut
@@ -43,7 +43,7 @@ namespace FoxMath
          * @param iI            :   lengths in i vector
          * @param iJ            :   lengths in j vector
          */
-         explicit Quad (const Referential& referential, float iI, float iJ)
+         explicit Quad (const Referentialf& referential, float iI, float iJ)
             :   referential_    {referential},
                 iI_             {iI},
                 iJ_             {iJ}
@@ -53,29 +53,29 @@ namespace FoxMath
     
         #pragma region methods
 
-        Vec3 PtTopLeft      ()  const noexcept  { return referential_.origin - (referential_.unitI * iI_) + (referential_.unitJ * iJ_); }
-        Vec3 PtTopRight     ()  const noexcept  { return referential_.origin + (referential_.unitI * iI_) + (referential_.unitJ * iJ_); }
-        Vec3 PtBottomLeft   ()  const noexcept  { return referential_.origin - (referential_.unitI * iI_) - (referential_.unitJ * iJ_); }
-        Vec3 PtBottomRight  ()  const noexcept  { return referential_.origin + (referential_.unitI * iI_) - (referential_.unitJ * iJ_); }
+        Vec3f PtTopLeft      ()  const noexcept  { return referential_.origin - (referential_.unitI * iI_) + (referential_.unitJ * iJ_); }
+        Vec3f PtTopRight     ()  const noexcept  { return referential_.origin + (referential_.unitI * iI_) + (referential_.unitJ * iJ_); }
+        Vec3f PtBottomLeft   ()  const noexcept  { return referential_.origin - (referential_.unitI * iI_) - (referential_.unitJ * iJ_); }
+        Vec3f PtBottomRight  ()  const noexcept  { return referential_.origin + (referential_.unitI * iI_) - (referential_.unitJ * iJ_); }
 
-        bool isPointInside(const Vec3& pt) const noexcept
+        bool isPointInside(const Vec3f& pt) const noexcept
         {
-            return  isBetween(Vec3::dot(referential_.unitI, pt - referential_.origin), -iI_, iI_) &&
-                    isBetween(Vec3::dot(referential_.unitJ, pt - referential_.origin), -iJ_, iJ_) &&
-                    isBetween(Vec3::dot(referential_.unitK, pt - referential_.origin), -std::numeric_limits<float>::epsilon(), std::numeric_limits<float>::epsilon());
+            return  isBetween(Vec3f::dot(referential_.unitI, pt - referential_.origin), -iI_, iI_) &&
+                    isBetween(Vec3f::dot(referential_.unitJ, pt - referential_.origin), -iJ_, iJ_) &&
+                    isBetween(Vec3f::dot(referential_.unitK, pt - referential_.origin), -std::numeric_limits<float>::epsilon(), std::numeric_limits<float>::epsilon());
         }
 
-        bool isPointInsideQuadZone(const Vec3& pt) const noexcept 
+        bool isPointInsideQuadZone(const Vec3f& pt) const noexcept 
         {
-            return  isBetween(Vec3::dot(referential_.unitI, pt - referential_.origin), -iI_, iI_) &&
-                    isBetween(Vec3::dot(referential_.unitJ, pt - referential_.origin), -iJ_, iJ_);
+            return  isBetween(Vec3f::dot(referential_.unitI, pt - referential_.origin), -iI_, iI_) &&
+                    isBetween(Vec3f::dot(referential_.unitJ, pt - referential_.origin), -iJ_, iJ_);
         }
 
-        int isPointInsideQuadZoneOutCode(const Vec3& pt) const noexcept
+        int isPointInsideQuadZoneOutCode(const Vec3f& pt) const noexcept
         {
             int outCode = 0;
-            float projectionPtOnI = Vec3::dot(referential_.unitI, pt - referential_.origin);
-            float projectionPtOnJ = Vec3::dot(referential_.unitJ, pt - referential_.origin);
+            float projectionPtOnI = Vec3f::dot(referential_.unitI, pt - referential_.origin);
+            float projectionPtOnJ = Vec3f::dot(referential_.unitJ, pt - referential_.origin);
             outCode += projectionPtOnI <  iI_ ? 0 : QUAD_OUTCODE_RIGHT;
             outCode += projectionPtOnI > -iI_ ? 0 : QUAD_OUTCODE_LEFT;
             outCode += projectionPtOnJ <  iJ_ ? 0 : QUAD_OUTCODE_TOP;
@@ -83,12 +83,25 @@ namespace FoxMath
             return outCode;
         }
 
+        /**
+         * @brief Corner of the quad farthest in direction (GJK support function)
+         * 
+         * @param direction 
+         * @return Vec3f 
+         */
+        Vec3f getSupportPoint(const Vec3f& direction) const noexcept
+        {
+            return  referential_.origin
+                    + referential_.unitI * (Vec3f::dot(direction, referential_.unitI) < 0.f ? -iI_ : iI_)
+                    + referential_.unitJ * (Vec3f::dot(direction, referential_.unitJ) < 0.f ? -iJ_ : iJ_);
+        }
+
         #pragma endregion //!methods
     
         #pragma region accessor
 
-        const Referential&  getReferential()    const noexcept  { return referential_; }
-        Referential&        getReferential()          noexcept  { return referential_; }
+        const Referentialf&  getReferential()    const noexcept  { return referential_; }
+        Referentialf&        getReferential()          noexcept  { return referential_; }
         const float&        getExtI()           const noexcept  { return iI_; }
         const float&        getExtJ()           const noexcept  { return iJ_; }
 
@@ -96,7 +109,7 @@ namespace FoxMath
 
         #pragma region mutator
 
-        void setReferential (const Referential& newReferential)    noexcept   {  referential_ = newReferential; }
+        void setReferential (const Referentialf& newReferential)    noexcept   {  referential_ = newReferential; }
         void setExtI        (const float& newExtI)                 noexcept   {  iI_ = newExtI; }
         void setExtJ        (const float& newExtJ)                 noexcept   {  iJ_ = newExtJ; }
 
@@ -115,7 +128,7 @@ namespace FoxMath
     
         #pragma region attribut
 
-        Referential referential_;
+        Referentialf referential_;
         float iI_, iJ_;
 
         #pragma endregion //!attribut
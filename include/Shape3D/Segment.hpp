@@ -26,7 +26,7 @@ namespace FoxMath
         Segment& operator=(Segment const& other)	= default;
         Segment& operator=(Segment && other)		= default;
 
-        explicit Segment (const Vec3& pt1, const Vec3& pt2)
+        explicit Segment (const Vec3f& pt1, const Vec3f& pt2)
             :   pt1_    {pt1},
                 pt2_    {pt2}
         {}
@@ -45,17 +45,17 @@ namespace FoxMath
             return Plane(pt2_, (pt2_ - pt1_).normalize());
         }
 
-        float getDistanceWithPoint(Vec3 pt) const noexcept
+        float getDistanceWithPoint(Vec3f pt) const noexcept
         {
-            Vec3 AB = pt2_ - pt1_;
+            Vec3f AB = pt2_ - pt1_;
 
             if (Plane::getSignedDistanceToPlane(getLeftPlane(), pt) > std::numeric_limits<float>::epsilon())
             {
                 if(Plane::getSignedDistanceToPlane(getRightPlane(), pt) > std::numeric_limits<float>::epsilon())
                 {
-                    Vec3 AC = pt - pt1_;
+                    Vec3f AC = pt - pt1_;
                     //The point in between the 2 plan. So The result is the rejection of the vectoo AC on AB
-                    return (AC - ((Vec3::dot(AC, AB) / Vec3::dot(AB, AB)) * AB)).length();
+                    return (AC - ((Vec3f::dot(AC, AB) / Vec3f::dot(AB, AB)) * AB)).length();
                 }   
                 else
                 {
@@ -70,7 +70,7 @@ namespace FoxMath
             }
         }
 
-        Vec3 getCenter() const noexcept
+        Vec3f getCenter() const noexcept
         {
             return pt1_ + 0.5f * (pt2_ - pt1_);
         }
@@ -80,19 +80,30 @@ namespace FoxMath
             return (pt2_ - pt1_).length();
         }
 
+        /**
+         * @brief Extremity of the segment farthest in direction (GJK support function)
+         * 
+         * @param direction 
+         * @return Vec3f 
+         */
+        const Vec3f& getSupportPoint(const Vec3f& direction) const noexcept
+        {
+            return Vec3f::dot(direction, pt2_ - pt1_) > 0.f ? pt2_ : pt1_;
+        }
+
         #pragma endregion //!methods
 
         #pragma region accessor
 
-        const Vec3& getPt1() const noexcept { return pt1_; }
-        const Vec3& getPt2() const noexcept { return pt2_; }
+        const Vec3f& getPt1() const noexcept { return pt1_; }
+        const Vec3f& getPt2() const noexcept { return pt2_; }
 
         #pragma endregion //!accessor
 
         #pragma region mutator
 
-        void setPt1(const Vec3& newPt) noexcept { pt1_ = newPt; }
-        void setPt2(const Vec3& newPt) noexcept { pt2_ = newPt; }
+        void setPt1(const Vec3f& newPt) noexcept { pt1_ = newPt; }
+        void setPt2(const Vec3f& newPt) noexcept { pt2_ = newPt; }
 
         #pragma endregion //!mutator
 
@@ -109,7 +120,7 @@ namespace FoxMath
 
         #pragma region attribut
 
-        Vec3      pt1_, pt2_;
+        Vec3f     pt1_, pt2_;
 
         #pragma endregion //!attribut
 
@@ -8,6 +8,8 @@
 #include "Shape3D/Volume.hpp"
 #include "Vector/Vector.hpp"
 
+#include <limits>
+
 namespace FoxMath
 {
     class Sphere : public Volume
@@ -23,7 +25,7 @@ namespace FoxMath
         Sphere& operator=(Sphere const&)    = default;
         Sphere& operator=(Sphere &&)        = default; 
 
-        explicit Sphere (float radius, const Vec3& localCenter = Vec3::zero)
+        explicit Sphere (float radius, const Vec3f& localCenter = Vec3f::zero)
             :   Volume          {},
                 center_         {localCenter},
                 radius_         {radius}
@@ -31,16 +33,35 @@ namespace FoxMath
     
         #pragma endregion //!constructor/destructor
     
+        #pragma region methods
+
+        /**
+         * @brief Point of the sphere farthest in direction (GJK support function). Direction does not need to be normalized
+         * 
+         * @param direction 
+         * @return Vec3f 
+         */
+        Vec3f getSupportPoint(const Vec3f& direction) const noexcept
+        {
+            const float length = direction.length();
+            if (length <= std::numeric_limits<float>::epsilon())
+                return center_;
+
+            return center_ + direction * (radius_ / length);
+        }
+
+        #pragma endregion //!methods
+    
         #pragma region accessor
 
-        virtual Vec3     getCenter() const noexcept { return center_;}
+        virtual Vec3f    getCenter() const noexcept { return center_;}
         virtual float    getRadius() const noexcept { return radius_;}
 
         #pragma endregion //!accessor
     
         #pragma region mutator
 
-        void    setCenter(const Vec3&  newCenter) noexcept { center_ = newCenter;}
+        void    setCenter(const Vec3f& newCenter) noexcept { center_ = newCenter;}
         void    setRadius(const float& newRadius) noexcept { radius_ = newRadius;}
 
         #pragma endregion //!mutator
@@ -49,7 +70,7 @@ namespace FoxMath
     
         #pragma region attribut
 
-        Vec3            center_ {Vec3::zero};
+        Vec3f           center_ {Vec3f::zero};
         float           radius_ {0.f};
 
         #pragma endregion //!attribut
@@ -8,6 +8,9 @@
 #include "ShapeRelation/Intersection.hpp"
 #include "Shape3D/AABB.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 namespace FoxMath
 {
     class AabbAabb
@@ -39,6 +42,43 @@ namespace FoxMath
         #pragma endregion //!static methods
     };
 
+    inline bool AabbAabb::isBothAABBCollided(const AABB& aabb1, const AABB& aabb2, Intersection& intersection)
+    {
+        /*Step 1 : Find if the both shape are non collided*/
+        //looking for a collision between the bow and the AABB of the sphere.
+        Vec3f BOmega = aabb2.getCenter() - aabb1.getCenter();
+
+        if (std::abs(BOmega.getX()) > aabb1.getExtI() + aabb2.getExtI()  ||
+            std::abs(BOmega.getY()) > aabb1.getExtJ() + aabb2.getExtJ()  ||
+            std::abs(BOmega.getZ()) > aabb1.getExtK() + aabb2.getExtK())
+        {
+            intersection.setNotIntersection();
+            return false;
+        }
+
+        /*Step 2 : find the near point from box to the sphere*/
+        Vec3f pointInBoxNearestOfAABB {  std::clamp(BOmega.getX(), -aabb1.getExtI(), aabb1.getExtI()),
+                                        std::clamp(BOmega.getY(), -aabb1.getExtJ(), aabb1.getExtJ()),
+                                        std::clamp(BOmega.getZ(), -aabb1.getExtK(), aabb1.getExtK())};
+        intersection.setOneIntersection(pointInBoxNearestOfAABB);
+        return true;
+    }
+
+    inline bool AabbAabb::isBothAABBCollided(const AABB& aabb1, const AABB& aabb2)
+    {
+        /*Step 1 : Find if the both shape are non collided*/
+        //looking for a collision between the bow and the AABB of the sphere.
+        Vec3f BOmega = aabb2.getCenter() - aabb1.getCenter();
+
+        if (std::abs(BOmega.getX()) > aabb1.getExtI() + aabb2.getExtI() ||
+            std::abs(BOmega.getY()) > aabb1.getExtJ() + aabb2.getExtJ() ||
+            std::abs(BOmega.getZ()) > aabb1.getExtK() + aabb2.getExtK())
+        {
+            return false;
+        }
+        return true;
+    }
+
 } /*namespace FoxMath*/
 
 #endif //_AABB_AABB_H
\ No newline at end of file
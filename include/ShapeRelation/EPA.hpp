@@ -0,0 +1,153 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 11 h 05
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stddef.h> //sizt_t
+#include <limits> //std::numeric_limits
+#include <algorithm> //std::max
+#include <cmath> //std::abs
+
+#include "Vector/Vector.hpp"
+#include "ShapeRelation/GJK.hpp"
+
+namespace FoxMath
+{
+    /*Penetration of two overlapped convex shapes*/
+    struct ConvexPenetration
+    {
+        Vec3f   normal  {Vec3f::zero};  /*unit vector from A to B : move B by normal * depth to separate both shapes*/
+        float   depth   {0.f};
+        Vec3f   pointA  {Vec3f::zero};  /*deepest point of A inside B*/
+        Vec3f   pointB  {Vec3f::zero};  /*deepest point of B inside A*/
+    };
+
+    /**
+     * @brief Expanding Polytope Algorithm : expand the GJK tetrahedron containing origin toward the boundary of A - B.
+     * The face of the polytope closest to origin give the minimum translation to separate both shapes.
+     * Same shapes as GJK (support function getSupportPoint)
+     */
+    class EPA
+    {
+        public:
+
+        #pragma region static attribut
+
+        static constexpr size_t maxIteration        = 64;
+        static constexpr size_t maxVertex           = 4 + maxIteration;
+        static constexpr size_t maxFace             = 4 * maxVertex;
+        static constexpr float  relativeTolerance   = 1e-4f;   /*convergence when the support point is not farther than the closest face with this ratio*/
+
+        #pragma endregion //!static attribut
+
+        #pragma region constructor/destructor
+
+        EPA ()                                  = delete;
+        EPA (const EPA& other)                  = delete;
+        EPA (EPA&& other)                       = delete;
+        ~EPA ()                                 = delete;
+        EPA& operator=(EPA const& other)        = delete;
+        EPA& operator=(EPA && other)            = delete;
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region static methods
+
+        /**
+         * @brief Run GJK then EPA if both shapes overlap. Return false without penetration if they do not overlap.
+         * Touching or flat shapes can give a null depth and normal
+         * 
+         * @tparam TShapeA 
+         * @tparam TShapeB 
+         * @param shapeA 
+         * @param shapeB 
+         * @param penetration 
+         * @param simplex : GJK simplex of the previous query of the same pair or empty simplex
+         * @return true 
+         * @return false 
+         */
+        template <typename TShapeA, typename TShapeB>
+        static inline
+        bool getPenetration (const TShapeA& shapeA, const TShapeB& shapeB, ConvexPenetration& penetration, GJKSimplex& simplex) noexcept;
+
+        template <typename TShapeA, typename TShapeB>
+        static inline
+        bool getPenetration (const TShapeA& shapeA, const TShapeB& shapeB, ConvexPenetration& penetration) noexcept;
+
+        #pragma endregion //!static methods
+
+        protected:
+
+        struct Face
+        {
+            size_t  vertices [3];
+            Vec3f   normal;         /*unit outward normal*/
+            float   distance;       /*distance from origin to the plane of the face*/
+        };
+
+        struct Polytope
+        {
+            Vec3f   pointsA     [maxVertex];
+            Vec3f   pointsB     [maxVertex];
+            Face    faces       [maxFace];
+            size_t  vertexCount {0};
+            size_t  faceCount   {0};
+
+            [[nodiscard]] inline
+            Vec3f getPoint (size_t index) const noexcept { return pointsA[index] - pointsB[index]; }
+        };
+
+        #pragma region static methods
+
+        /**
+         * @brief Complete the simplex of GJK ending on a point, a segment or a triangle (shapes touching) into a tetrahedron
+         * 
+         * @return false if A - B is flat
+         */
+        template <typename TShapeA, typename TShapeB>
+        static inline
+        bool    completeSimplex (const TShapeA& shapeA, const TShapeB& shapeB, GJKSimplex& simplex) noexcept;
+
+        static inline
+        void    addFace         (Polytope& polytope, size_t a, size_t b, size_t c) noexcept;
+
+        /*The face is seen from point (point is in front of the face)*/
+        static inline
+        bool    isFaceVisible   (const Polytope& polytope, const Face& face, const Vec3f& point) noexcept;
+
+        /*Add the edge to the horizon or remove it if the opposite edge is already in (edge between two removed faces)*/
+        static inline
+        void    addHorizonEdge  (size_t (*edges)[2], size_t& edgeCount, size_t a, size_t b) noexcept;
+
+        #pragma endregion //!static methods
+    };
+
+    #include "EPA.inl"
+
+} /*namespace FoxMath*/
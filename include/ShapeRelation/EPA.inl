@@ -0,0 +1,293 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 11 h 05
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <typename TShapeA, typename TShapeB>
+inline
+bool EPA::getPenetration (const TShapeA& shapeA, const TShapeB& shapeB, ConvexPenetration& penetration, GJKSimplex& simplex) noexcept
+{
+    if (GJK::computeSquareDistance(shapeA, shapeB, simplex, true) > 0.f)
+        return false;
+
+    penetration = ConvexPenetration{};
+
+    /*Keep the GJK simplex for the next query : the polytope is a copy*/
+    GJKSimplex tetrahedron = simplex;
+    if (!completeSimplex(shapeA, shapeB, tetrahedron))
+        return true;
+
+    Polytope polytope;
+    for (size_t i = 0; i < 4; ++i)
+    {
+        polytope.pointsA[i] = tetrahedron.pointsA[i];
+        polytope.pointsB[i] = tetrahedron.pointsB[i];
+    }
+    polytope.vertexCount = 4;
+
+    /*Faces of the tetrahedron with outward normal : the opposite vertex is behind*/
+    const size_t faces[4][4] {{0, 1, 2, 3}, {0, 2, 3, 1}, {0, 3, 1, 2}, {1, 3, 2, 0}};
+    for (const auto& face : faces)
+    {
+        const Vec3f pointA = polytope.getPoint(face[0]);
+        const Vec3f normal = Vec3f::cross(polytope.getPoint(face[1]) - pointA, polytope.getPoint(face[2]) - pointA);
+
+        if (Vec3f::dot(normal, polytope.getPoint(face[3]) - pointA) > 0.f)
+            addFace(polytope, face[0], face[2], face[1]);
+        else
+            addFace(polytope, face[0], face[1], face[2]);
+    }
+
+    /*Horizon edges are shared by a removed face and a kept face : less than 3 / 2 face count*/
+    size_t  edges [3 * maxFace / 2][2];
+    size_t  closestFace = 0;
+
+    for (size_t iteration = 0; iteration < maxIteration; ++iteration)
+    {
+        closestFace = 0;
+        for (size_t i = 1; i < polytope.faceCount; ++i)
+        {
+            if (polytope.faces[i].distance < polytope.faces[closestFace].distance)
+                closestFace = i;
+        }
+
+        if (polytope.vertexCount == maxVertex)
+            break;
+
+        /*Support point in the direction of the closest face*/
+        const Face      face        = polytope.faces[closestFace];
+        const size_t    newVertex   = polytope.vertexCount;
+        polytope.pointsA[newVertex] = shapeA.getSupportPoint(face.normal);
+        polytope.pointsB[newVertex] = shapeB.getSupportPoint(-face.normal);
+
+        const Vec3f newPoint = polytope.getPoint(newVertex);
+
+        /*The face is on the boundary of A - B*/
+        if (Vec3f::dot(newPoint, face.normal) - face.distance <= relativeTolerance * std::max(face.distance, 1.f))
+            break;
+
+        /*Horizon of the faces seen from the new point*/
+        size_t edgeCount    = 0;
+        size_t visibleCount = 0;
+        for (size_t i = 0; i < polytope.faceCount; ++i)
+        {
+            const Face& visibleFace = polytope.faces[i];
+
+            if (!isFaceVisible(polytope, visibleFace, newPoint))
+                continue;
+
+            addHorizonEdge(edges, edgeCount, visibleFace.vertices[0], visibleFace.vertices[1]);
+            addHorizonEdge(edges, edgeCount, visibleFace.vertices[1], visibleFace.vertices[2]);
+            addHorizonEdge(edges, edgeCount, visibleFace.vertices[2], visibleFace.vertices[0]);
+            ++visibleCount;
+        }
+
+        /*Check the capacity before removing the visible faces : the polytope stay closed if the new point is not added*/
+        if (polytope.faceCount - visibleCount + edgeCount > maxFace)
+            break;
+
+        ++polytope.vertexCount;
+
+        for (size_t i = polytope.faceCount; i-- > 0;)
+        {
+            if (isFaceVisible(polytope, polytope.faces[i], newPoint))
+                polytope.faces[i] = polytope.faces[--polytope.faceCount];
+        }
+
+        /*Close the polytope with the new point*/
+        for (size_t i = 0; i < edgeCount; ++i)
+        {
+            addFace(polytope, edges[i][0], edges[i][1], newVertex);
+        }
+    }
+
+    if (polytope.faceCount == 0)
+        return true;
+
+    closestFace = 0;
+    for (size_t i = 1; i < polytope.faceCount; ++i)
+    {
+        if (polytope.faces[i].distance < polytope.faces[closestFace].distance)
+            closestFace = i;
+    }
+
+    const Face& face = polytope.faces[closestFace];
+    penetration.normal  = face.normal;
+    penetration.depth   = std::max(face.distance, 0.f);
+
+    /*Barycentric coordinates of the projection of origin on the face, Ericson Real-Time Collision Detection 3.4*/
+    const Vec3f pointA      = polytope.getPoint(face.vertices[0]);
+    const Vec3f v0          = polytope.getPoint(face.vertices[1]) - pointA;
+    const Vec3f v1          = polytope.getPoint(face.vertices[2]) - pointA;
+    const Vec3f v2          = face.normal * face.distance - pointA;
+    const float d00         = Vec3f::dot(v0, v0);
+    const float d01         = Vec3f::dot(v0, v1);
+    const float d11         = Vec3f::dot(v1, v1);
+    const float d20         = Vec3f::dot(v2, v0);
+    const float d21         = Vec3f::dot(v2, v1);
+    const float denominator = d00 * d11 - d01 * d01;
+
+    float v = 0.f, w = 0.f;
+    if (std::abs(denominator) > std::numeric_limits<float>::min())
+    {
+        v = (d11 * d20 - d01 * d21) / denominator;
+        w = (d00 * d21 - d01 * d20) / denominator;
+    }
+    const float u = 1.f - v - w;
+
+    penetration.pointA = polytope.pointsA[face.vertices[0]] * u + polytope.pointsA[face.vertices[1]] * v + polytope.pointsA[face.vertices[2]] * w;
+    penetration.pointB = polytope.pointsB[face.vertices[0]] * u + polytope.pointsB[face.vertices[1]] * v + polytope.pointsB[face.vertices[2]] * w;
+
+    return true;
+}
+
+template <typename TShapeA, typename TShapeB>
+inline
+bool EPA::getPenetration (const TShapeA& shapeA, const TShapeB& shapeB, ConvexPenetration& penetration) noexcept
+{
+    GJKSimplex simplex;
+    return getPenetration(shapeA, shapeB, penetration, simplex);
+}
+
+template <typename TShapeA, typename TShapeB>
+inline
+bool EPA::completeSimplex (const TShapeA& shapeA, const TShapeB& shapeB, GJKSimplex& simplex) noexcept
+{
+    const Vec3f axis[6] {Vec3f::right, Vec3f::left, Vec3f::up, Vec3f::down, Vec3f::forward, Vec3f::backward};
+
+    float maxSquareLength = std::numeric_limits<float>::min();
+    for (size_t i = 0; i < simplex.count; ++i)
+    {
+        maxSquareLength = std::max(maxSquareLength, simplex.getPoint(i).squareLength());
+    }
+    const float tolerance = GJK::relativeTolerance * GJK::relativeTolerance * maxSquareLength;
+
+    if (simplex.count == 1)
+    {
+        for (const Vec3f& direction : axis)
+        {
+            GJK::setSupportPoint(shapeA, shapeB, direction, simplex, 1);
+
+            if ((simplex.getPoint(1) - simplex.getPoint(0)).squareLength() > tolerance)
+            {
+                simplex.count = 2;
+                break;
+            }
+        }
+    }
+
+    if (simplex.count == 2)
+    {
+        /*Directions orthogonal to the segment*/
+        const Vec3f segment     = simplex.getPoint(1) - simplex.getPoint(0);
+        const Vec3f normal1     = Vec3f::cross(segment, std::abs(segment.getX()) < std::abs(segment.getY()) ? Vec3f::right : Vec3f::up);
+        const Vec3f normal2     = Vec3f::cross(segment, normal1);
+        const Vec3f directions[4] {normal1, -normal1, normal2, -normal2};
+
+        for (const Vec3f& direction : directions)
+        {
+            GJK::setSupportPoint(shapeA, shapeB, direction, simplex, 2);
+
+            if (Vec3f::cross(segment, simplex.getPoint(2) - simplex.getPoint(0)).squareLength() > tolerance * segment.squareLength())
+            {
+                simplex.count = 3;
+                break;
+            }
+        }
+    }
+
+    if (simplex.count == 3)
+    {
+        const Vec3f normal = Vec3f::cross(simplex.getPoint(1) - simplex.getPoint(0), simplex.getPoint(2) - simplex.getPoint(0));
+        const Vec3f directions[2] {normal, -normal};
+
+        for (const Vec3f& direction : directions)
+        {
+            GJK::setSupportPoint(shapeA, shapeB, direction, simplex, 3);
+
+            const float height = Vec3f::dot(normal, simplex.getPoint(3) - simplex.getPoint(0));
+            if (height * height > tolerance * normal.squareLength())
+            {
+                simplex.count = 4;
+                break;
+            }
+        }
+    }
+
+    return simplex.count == 4;
+}
+
+inline
+void EPA::addFace (Polytope& polytope, size_t a, size_t b, size_t c) noexcept
+{
+    Face& face = polytope.faces[polytope.faceCount++];
+    face.vertices[0] = a;
+    face.vertices[1] = b;
+    face.vertices[2] = c;
+
+    const Vec3f pointA  = polytope.getPoint(a);
+    const Vec3f normal  = Vec3f::cross(polytope.getPoint(b) - pointA, polytope.getPoint(c) - pointA);
+    const float length  = normal.length();
+
+    /*Degenerated face : never the closest*/
+    if (length <= std::numeric_limits<float>::min())
+    {
+        face.normal     = Vec3f::zero;
+        face.distance   = std::numeric_limits<float>::max();
+        return;
+    }
+
+    face.normal     = normal / length;
+    face.distance   = Vec3f::dot(face.normal, pointA);
+}
+
+inline
+bool EPA::isFaceVisible (const Polytope& polytope, const Face& face, const Vec3f& point) noexcept
+{
+    return Vec3f::dot(face.normal, point - polytope.getPoint(face.vertices[0])) > 0.f;
+}
+
+inline
+void EPA::addHorizonEdge (size_t (*edges)[2], size_t& edgeCount, size_t a, size_t b) noexcept
+{
+    for (size_t i = 0; i < edgeCount; ++i)
+    {
+        if (edges[i][0] == b && edges[i][1] == a)
+        {
+            edges[i][0] = edges[edgeCount - 1][0];
+            edges[i][1] = edges[edgeCount - 1][1];
+            --edgeCount;
+            return;
+        }
+    }
+
+    edges[edgeCount][0] = a;
+    edges[edgeCount][1] = b;
+    ++edgeCount;
+}
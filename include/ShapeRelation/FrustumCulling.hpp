@@ -0,0 +1,233 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 15 h 40
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stddef.h> //sizt_t
+#include <stdint.h> //uint8_t, uint32_t
+#include <limits> //std::numeric_limits
+#include <cmath> //std::abs
+#include <algorithm> //std::copy_n
+
+#include "SIMD/SIMD.hpp" //FOXMATH_SIMD_SSE
+#include "Shape3D/Frustum.hpp"
+#include "Shape3D/Sphere.hpp"
+#include "Shape3D/AABB.hpp"
+#include "Shape3D/OrientedBox.hpp"
+#include "ShapeRelation/SegmentAABBBatch.hpp" //AABBPacket
+
+namespace FoxMath
+{
+    /**
+     * @brief Position of a volume relative to a frustum
+     */
+    enum class ECullingResult : uint8_t
+    {
+        Outside         = 0,
+        Intersecting    = 1,
+        Inside          = 2
+    };
+
+    /**
+     * @brief TWidth spheres in structure of arrays (center x of each sphere, center y of each sphere...) for the batch frustum test.
+     * Unused lanes must be set with setEmpty
+     * 
+     * @tparam TWidth : 4 or 8
+     */
+    template <size_t TWidth>
+    struct SpherePacket
+    {
+        static_assert(TWidth == 4 || TWidth == 8, "SpherePacket width must be 4 or 8");
+
+        alignas(32) float center [3][TWidth];
+        alignas(32) float radius [TWidth];
+
+        inline
+        void set        (size_t lane, const Sphere& sphere) noexcept;
+
+        /**
+         * @brief Set lane with a null sphere at the origin
+         * 
+         * @param lane 
+         */
+        inline
+        void setEmpty   (size_t lane) noexcept;
+    };
+
+    /**
+     * @brief Classify spheres, AABB and oriented boxes as outside, intersecting or inside a frustum, one by one or by packets of 4 or 8 bounds.
+     * A volume is outside if it is fully behind one plane, so a volume near a corner of the frustum can be reported intersecting while it is outside (conservative test).
+     * @note Plane coherency : the overloads with lastPlane test first the plane that rejected the volume last time and store the new rejecting plane.
+     * Between two close frames, a volume outside the frustum is mostly rejected by the same plane with one test. lastPlane must be initialized
+     * (0 is valid) and only read by the test, it does not change the result
+     */
+    class FrustumCulling
+    {
+        protected:
+
+        #pragma region static methods
+
+        /**
+         * @brief Classify a volume with its signed distance to each plane and its projected radius on the plane normal
+         * 
+         * @tparam TProjection : float(const Plane& plane, float& radius), return the signed distance of the center of the volume
+         * @param frustum 
+         * @param lastPlane : nullptr without plane coherency
+         * @param projection 
+         * @return ECullingResult 
+         */
+        template <typename TProjection>
+        [[nodiscard]] static inline
+        ECullingResult  classifyPlanes  (const Frustum& frustum, uint8_t* lastPlane, TProjection&& projection) noexcept;
+
+        /**
+         * @brief Planes of the frustum in 6 * 4 floats (normal x, normal y, normal z, distance) for the SIMD kernels
+         * 
+         * @param frustum 
+         * @param planes 
+         */
+        static inline
+        void            getPlanesData   (const Frustum& frustum, float* planes) noexcept;
+
+        /**
+         * @brief Convert the masks of one packet in results
+         * 
+         * @param outsideMask 
+         * @param intersectMask 
+         * @param laneCount 
+         * @param results 
+         */
+        static inline
+        void            writeResults    (uint32_t outsideMask, uint32_t intersectMask, size_t laneCount, ECullingResult* results) noexcept;
+
+        #pragma endregion //!static methods
+
+        public:
+
+        #pragma region constructor/destructor
+
+        FrustumCulling ()					                        = delete;
+        FrustumCulling (const FrustumCulling& other)			    = delete;
+        FrustumCulling (FrustumCulling&& other)				        = delete;
+        ~FrustumCulling ()				                            = delete;
+        FrustumCulling& operator=(FrustumCulling const& other)      = delete;
+        FrustumCulling& operator=(FrustumCulling && other)		    = delete;
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region static methods
+
+        [[nodiscard]] static inline
+        ECullingResult  classify        (const Frustum& frustum, const Sphere& sphere) noexcept;
+
+        /**
+         * @brief Classify sphere with plane coherency
+         * 
+         * @param frustum 
+         * @param sphere 
+         * @param lastPlane : plane tested first, updated with the rejecting plane if sphere is outside
+         * @return ECullingResult 
+         */
+        [[nodiscard]] static inline
+        ECullingResult  classify        (const Frustum& frustum, const Sphere& sphere, uint8_t& lastPlane) noexcept;
+
+        [[nodiscard]] static inline
+        ECullingResult  classify        (const Frustum& frustum, const AABB& aabb) noexcept;
+
+        /**
+         * @brief Classify AABB with plane coherency
+         * 
+         * @param frustum 
+         * @param aabb 
+         * @param lastPlane : plane tested first, updated with the rejecting plane if box is outside
+         * @return ECullingResult 
+         */
+        [[nodiscard]] static inline
+        ECullingResult  classify        (const Frustum& frustum, const AABB& aabb, uint8_t& lastPlane) noexcept;
+
+        [[nodiscard]] static inline
+        ECullingResult  classify        (const Frustum& frustum, const OrientedBox& box) noexcept;
+
+        /**
+         * @brief Classify oriented box with plane coherency
+         * 
+         * @param frustum 
+         * @param box 
+         * @param lastPlane : plane tested first, updated with the rejecting plane if box is outside
+         * @return ECullingResult 
+         */
+        [[nodiscard]] static inline
+        ECullingResult  classify        (const Frustum& frustum, const OrientedBox& box, uint8_t& lastPlane) noexcept;
+
+        /**
+         * @brief Classify count AABB stored in packets (filled with SegmentAABBBatch::fillPackets)
+         * 
+         * @tparam TWidth : 4 or 8
+         * @param frustum 
+         * @param packets : (count + TWidth - 1) / TWidth packets
+         * @param count : number of boxes
+         * @param results : count results
+         * @param lastPlanes : count plane indices for plane coherency, or nullptr
+         */
+        template <size_t TWidth>
+        static inline
+        void            classify        (const Frustum& frustum, const AABBPacket<TWidth>* packets, size_t count, ECullingResult* results, uint8_t* lastPlanes = nullptr) noexcept;
+
+        /**
+         * @brief Classify count spheres stored in packets (filled with fillPackets)
+         * 
+         * @tparam TWidth : 4 or 8
+         * @param frustum 
+         * @param packets : (count + TWidth - 1) / TWidth packets
+         * @param count : number of spheres
+         * @param results : count results
+         * @param lastPlanes : count plane indices for plane coherency, or nullptr
+         */
+        template <size_t TWidth>
+        static inline
+        void            classify        (const Frustum& frustum, const SpherePacket<TWidth>* packets, size_t count, ECullingResult* results, uint8_t* lastPlanes = nullptr) noexcept;
+
+        /**
+         * @brief Fill (count + TWidth - 1) / TWidth packets with spheres. Lanes after the last sphere are empty
+         * 
+         * @tparam TWidth : 4 or 8
+         * @param spheres 
+         * @param count 
+         * @param packets 
+         */
+        template <size_t TWidth>
+        static inline
+        void            fillPackets     (const Sphere* spheres, size_t count, SpherePacket<TWidth>* packets) noexcept;
+
+        #pragma endregion //!static methods
+    };
+
+    #include "FrustumCulling.inl"
+
+} /*namespace FoxMath*/
@@ -0,0 +1,317 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 15 h 40
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <size_t TWidth>
+inline
+void SpherePacket<TWidth>::set (size_t lane, const Sphere& sphere) noexcept
+{
+    const Vec3f sphereCenter = sphere.getCenter();
+
+    for (size_t axis = 0; axis < 3; ++axis)
+        center[axis][lane] = sphereCenter[axis];
+
+    radius[lane] = sphere.getRadius();
+}
+
+template <size_t TWidth>
+inline
+void SpherePacket<TWidth>::setEmpty (size_t lane) noexcept
+{
+    for (size_t axis = 0; axis < 3; ++axis)
+        center[axis][lane] = 0.f;
+
+    radius[lane] = 0.f;
+}
+
+template <typename TProjection>
+inline
+ECullingResult FrustumCulling::classifyPlanes (const Frustum& frustum, uint8_t* lastPlane, TProjection&& projection) noexcept
+{
+    if (lastPlane != nullptr)
+    {
+        float radius;
+        if (projection(frustum.getPlane(*lastPlane), radius) < -radius)
+            return ECullingResult::Outside;
+    }
+
+    ECullingResult result = ECullingResult::Inside;
+    for (size_t plane = 0; plane < Frustum::planeCount; ++plane)
+    {
+        float       radius;
+        const float signedDistance = projection(frustum.getPlane(plane), radius);
+
+        if (signedDistance < -radius)
+        {
+            if (lastPlane != nullptr)
+                *lastPlane = static_cast<uint8_t>(plane);
+
+            return ECullingResult::Outside;
+        }
+
+        if (signedDistance < radius)
+            result = ECullingResult::Intersecting;
+    }
+
+    return result;
+}
+
+inline
+void FrustumCulling::getPlanesData (const Frustum& frustum, float* planes) noexcept
+{
+    for (size_t plane = 0; plane < Frustum::planeCount; ++plane)
+    {
+        const Vec3f& normal = frustum.getPlane(plane).getNormal();
+
+        planes[plane * 4]       = normal.getX();
+        planes[plane * 4 + 1]   = normal.getY();
+        planes[plane * 4 + 2]   = normal.getZ();
+        planes[plane * 4 + 3]   = frustum.getPlane(plane).getDistance();
+    }
+}
+
+inline
+void FrustumCulling::writeResults (uint32_t outsideMask, uint32_t intersectMask, size_t laneCount, ECullingResult* results) noexcept
+{
+    for (size_t lane = 0; lane < laneCount; ++lane)
+    {
+        if (outsideMask & (1u << lane))
+            results[lane] = ECullingResult::Outside;
+        else if (intersectMask & (1u << lane))
+            results[lane] = ECullingResult::Intersecting;
+        else
+            results[lane] = ECullingResult::Inside;
+    }
+}
+
+inline
+ECullingResult FrustumCulling::classify (const Frustum& frustum, const Sphere& sphere) noexcept
+{
+    const Vec3f center = sphere.getCenter();
+    const float radius = sphere.getRadius();
+
+    return classifyPlanes(frustum, nullptr, [&](const Plane& plane, float& projectedRadius) noexcept
+    {
+        projectedRadius = radius;
+        return plane.getSignedDistanceToPlane(center);
+    });
+}
+
+inline
+ECullingResult FrustumCulling::classify (const Frustum& frustum, const Sphere& sphere, uint8_t& lastPlane) noexcept
+{
+    const Vec3f center = sphere.getCenter();
+    const float radius = sphere.getRadius();
+
+    return classifyPlanes(frustum, &lastPlane, [&](const Plane& plane, float& projectedRadius) noexcept
+    {
+        projectedRadius = radius;
+        return plane.getSignedDistanceToPlane(center);
+    });
+}
+
+inline
+ECullingResult FrustumCulling::classify (const Frustum& frustum, const AABB& aabb) noexcept
+{
+    const Vec3f center = aabb.getCenter();
+    const Vec3f extents {aabb.getExtI(), aabb.getExtJ(), aabb.getExtK()};
+
+    return classifyPlanes(frustum, nullptr, [&](const Plane& plane, float& projectedRadius) noexcept
+    {
+        const Vec3f& normal = plane.getNormal();
+
+        projectedRadius = extents.getX() * std::abs(normal.getX()) + extents.getY() * std::abs(normal.getY()) + extents.getZ() * std::abs(normal.getZ());
+        return plane.getSignedDistanceToPlane(center);
+    });
+}
+
+inline
+ECullingResult FrustumCulling::classify (const Frustum& frustum, const AABB& aabb, uint8_t& lastPlane) noexcept
+{
+    const Vec3f center = aabb.getCenter();
+    const Vec3f extents {aabb.getExtI(), aabb.getExtJ(), aabb.getExtK()};
+
+    return classifyPlanes(frustum, &lastPlane, [&](const Plane& plane, float& projectedRadius) noexcept
+    {
+        const Vec3f& normal = plane.getNormal();
+
+        projectedRadius = extents.getX() * std::abs(normal.getX()) + extents.getY() * std::abs(normal.getY()) + extents.getZ() * std::abs(normal.getZ());
+        return plane.getSignedDistanceToPlane(center);
+    });
+}
+
+inline
+ECullingResult FrustumCulling::classify (const Frustum& frustum, const OrientedBox& box) noexcept
+{
+    const Referentialf  referential = box.getReferential();
+    const Vec3f         axisI       = referential.unitI * box.getExtI();
+    const Vec3f         axisJ       = referential.unitJ * box.getExtJ();
+    const Vec3f         axisK       = referential.unitK * box.getExtK();
+
+    return classifyPlanes(frustum, nullptr, [&](const Plane& plane, float& projectedRadius) noexcept
+    {
+        const Vec3f& normal = plane.getNormal();
+
+        projectedRadius = std::abs(Vec3f::dot(normal, axisI)) + std::abs(Vec3f::dot(normal, axisJ)) + std::abs(Vec3f::dot(normal, axisK));
+        return plane.getSignedDistanceToPlane(referential.origin);
+    });
+}
+
+inline
+ECullingResult FrustumCulling::classify (const Frustum& frustum, const OrientedBox& box, uint8_t& lastPlane) noexcept
+{
+    const Referentialf  referential = box.getReferential();
+    const Vec3f         axisI       = referential.unitI * box.getExtI();
+    const Vec3f         axisJ       = referential.unitJ * box.getExtJ();
+    const Vec3f         axisK       = referential.unitK * box.getExtK();
+
+    return classifyPlanes(frustum, &lastPlane, [&](const Plane& plane, float& projectedRadius) noexcept
+    {
+        const Vec3f& normal = plane.getNormal();
+
+        projectedRadius = std::abs(Vec3f::dot(normal, axisI)) + std::abs(Vec3f::dot(normal, axisJ)) + std::abs(Vec3f::dot(normal, axisK));
+        return plane.getSignedDistanceToPlane(referential.origin);
+    });
+}
+
+template <size_t TWidth>
+inline
+void FrustumCulling::classify (const Frustum& frustum, const AABBPacket<TWidth>* packets, size_t count, ECullingResult* results, uint8_t* lastPlanes) noexcept
+{
+    alignas(16) float planes [Frustum::planeCount * 4];
+    getPlanesData(frustum, planes);
+
+    for (size_t first = 0; first < count; first += TWidth)
+    {
+        const AABBPacket<TWidth>&   packet      = packets[first / TWidth];
+        const size_t                laneCount   = std::min(TWidth, count - first);
+
+        /*The last packet can be partial : plane indices of its empty lanes are not in lastPlanes*/
+        uint8_t     packetPlanes [TWidth] {};
+        uint8_t*    rejectPlane = nullptr;
+        if (lastPlanes != nullptr)
+        {
+            rejectPlane = laneCount == TWidth ? lastPlanes + first : packetPlanes;
+            if (laneCount != TWidth)
+                std::copy_n(lastPlanes + first, laneCount, packetPlanes);
+        }
+
+        uint32_t outsideMask    = 0;
+        uint32_t intersectMask  = 0;
+
+#ifdef FOXMATH_SIMD_SSE
+        if constexpr (TWidth == 4)
+            outsideMask = SIMD::frustumAABB4(planes, packet.min[0], packet.max[0], rejectPlane, intersectMask);
+        else
+            outsideMask = SIMD::frustumAABB8(planes, packet.min[0], packet.max[0], rejectPlane, intersectMask);
+#else
+        for (size_t lane = 0; lane < laneCount; ++lane)
+        {
+            const AABB aabb (Vec3f{ (packet.min[0][lane] + packet.max[0][lane]) * 0.5f,
+                                    (packet.min[1][lane] + packet.max[1][lane]) * 0.5f,
+                                    (packet.min[2][lane] + packet.max[2][lane]) * 0.5f},
+                                    (packet.max[0][lane] - packet.min[0][lane]) * 0.5f,
+                                    (packet.max[1][lane] - packet.min[1][lane]) * 0.5f,
+                                    (packet.max[2][lane] - packet.min[2][lane]) * 0.5f);
+
+            const ECullingResult result = rejectPlane != nullptr ? classify(frustum, aabb, rejectPlane[lane]) : classify(frustum, aabb);
+            outsideMask     |= static_cast<uint32_t>(result == ECullingResult::Outside) << lane;
+            intersectMask   |= static_cast<uint32_t>(result == ECullingResult::Intersecting) << lane;
+        }
+#endif
+
+        if (lastPlanes != nullptr && laneCount != TWidth)
+            std::copy_n(packetPlanes, laneCount, lastPlanes + first);
+
+        writeResults(outsideMask, intersectMask, laneCount, results + first);
+    }
+}
+
+template <size_t TWidth>
+inline
+void FrustumCulling::classify (const Frustum& frustum, const SpherePacket<TWidth>* packets, size_t count, ECullingResult* results, uint8_t* lastPlanes) noexcept
+{
+    alignas(16) float planes [Frustum::planeCount * 4];
+    getPlanesData(frustum, planes);
+
+    for (size_t first = 0; first < count; first += TWidth)
+    {
+        const SpherePacket<TWidth>& packet      = packets[first / TWidth];
+        const size_t                laneCount   = std::min(TWidth, count - first);
+
+        uint8_t     packetPlanes [TWidth] {};
+        uint8_t*    rejectPlane = nullptr;
+        if (lastPlanes != nullptr)
+        {
+            rejectPlane = laneCount == TWidth ? lastPlanes + first : packetPlanes;
+            if (laneCount != TWidth)
+                std::copy_n(lastPlanes + first, laneCount, packetPlanes);
+        }
+
+        uint32_t outsideMask    = 0;
+        uint32_t intersectMask  = 0;
+
+#ifdef FOXMATH_SIMD_SSE
+        if constexpr (TWidth == 4)
+            outsideMask = SIMD::frustumSphere4(planes, packet.center[0], packet.radius, rejectPlane, intersectMask);
+        else
+            outsideMask = SIMD::frustumSphere8(planes, packet.center[0], packet.radius, rejectPlane, intersectMask);
+#else
+        for (size_t lane = 0; lane < laneCount; ++lane)
+        {
+            const Sphere sphere (packet.radius[lane], Vec3f{packet.center[0][lane], packet.center[1][lane], packet.center[2][lane]});
+
+            const ECullingResult result = rejectPlane != nullptr ? classify(frustum, sphere, rejectPlane[lane]) : classify(frustum, sphere);
+            outsideMask     |= static_cast<uint32_t>(result == ECullingResult::Outside) << lane;
+            intersectMask   |= static_cast<uint32_t>(result == ECullingResult::Intersecting) << lane;
+        }
+#endif
+
+        if (lastPlanes != nullptr && laneCount != TWidth)
+            std::copy_n(packetPlanes, laneCount, lastPlanes + first);
+
+        writeResults(outsideMask, intersectMask, laneCount, results + first);
+    }
+}
+
+template <size_t TWidth>
+inline
+void FrustumCulling::fillPackets (const Sphere* spheres, size_t count, SpherePacket<TWidth>* packets) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        packets[i / TWidth].set(i % TWidth, spheres[i]);
+    }
+
+    for (size_t i = count; i % TWidth != 0; ++i)
+    {
+        packets[i / TWidth].setEmpty(i % TWidth);
+    }
+}
@@ -0,0 +1,191 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 09 h 30
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stddef.h> //sizt_t
+#include <limits> //std::numeric_limits
+#include <algorithm> //std::max
+#include <cmath> //std::sqrt
+
+#include "Vector/Vector.hpp"
+
+namespace FoxMath
+{
+    /**
+     * @brief Simplex of the Minkowski difference A - B with the support points of both shapes.
+     * Keep it between two queries of the same pair : the vertices are recomputed from the same directions on the new positions (warm start)
+     */
+    struct GJKSimplex
+    {
+        Vec3f   directions  [4];    /*search direction of each vertex*/
+        Vec3f   pointsA     [4];    /*support point of A in direction*/
+        Vec3f   pointsB     [4];    /*support point of B in -direction*/
+        float   weights     [4];    /*barycentric coordinates of the point of the simplex closest to origin*/
+        size_t  count       {0};
+
+        [[nodiscard]] inline
+        Vec3f   getPoint    (size_t index) const noexcept { return pointsA[index] - pointsB[index]; }
+
+        inline
+        void    clear       () noexcept { count = 0; }
+    };
+
+    /**
+     * @brief Gilbert-Johnson-Keerthi algorithm on any pair of convex shapes with a support function :
+     * Vec3f getSupportPoint(const Vec3f& direction) const (Sphere, AABB, OrientedBox, Capsule, Cylinder, Segment, Quad...).
+     * The simplex converges to the point of A - B closest to origin : origin inside means overlap.
+     * See EPA for the penetration of overlapped shapes
+     */
+    class GJK
+    {
+        public:
+
+        #pragma region static attribut
+
+        static constexpr size_t maxIteration        = 64;
+        static constexpr float  relativeTolerance   = 1e-5f;   /*convergence when the squared distance does not decrease more than this ratio*/
+
+        #pragma endregion //!static attribut
+
+        #pragma region constructor/destructor
+
+        GJK ()                                  = delete;
+        GJK (const GJK& other)                  = delete;
+        GJK (GJK&& other)                       = delete;
+        ~GJK ()                                 = delete;
+        GJK& operator=(GJK const& other)        = delete;
+        GJK& operator=(GJK && other)            = delete;
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region static methods
+
+        /**
+         * @brief Return true if both shapes overlap. Exit as soon as a separating plane is found
+         * 
+         * @tparam TShapeA 
+         * @tparam TShapeB 
+         * @param shapeA 
+         * @param shapeB 
+         * @param simplex : simplex of the previous query of the same pair or empty simplex
+         * @return true 
+         * @return false 
+         */
+        template <typename TShapeA, typename TShapeB>
+        [[nodiscard]] static inline
+        bool    isOverlapped    (const TShapeA& shapeA, const TShapeB& shapeB, GJKSimplex& simplex) noexcept;
+
+        template <typename TShapeA, typename TShapeB>
+        [[nodiscard]] static inline
+        bool    isOverlapped    (const TShapeA& shapeA, const TShapeB& shapeB) noexcept;
+
+        /**
+         * @brief Return the distance between both shapes with the closest points. Return 0 if shapes overlap (closest points are meaningless)
+         * 
+         * @tparam TShapeA 
+         * @tparam TShapeB 
+         * @param shapeA 
+         * @param shapeB 
+         * @param closestPointA 
+         * @param closestPointB 
+         * @param simplex : simplex of the previous query of the same pair or empty simplex
+         * @return float 
+         */
+        template <typename TShapeA, typename TShapeB>
+        static inline
+        float   getDistance     (const TShapeA& shapeA, const TShapeB& shapeB, Vec3f& closestPointA, Vec3f& closestPointB, GJKSimplex& simplex) noexcept;
+
+        template <typename TShapeA, typename TShapeB>
+        static inline
+        float   getDistance     (const TShapeA& shapeA, const TShapeB& shapeB, Vec3f& closestPointA, Vec3f& closestPointB) noexcept;
+
+        /**
+         * @brief Run GJK. Return the squared distance between both shapes, 0 if they overlap (simplex is a tetrahedron containing origin or origin is on the simplex)
+         * 
+         * @tparam TShapeA 
+         * @tparam TShapeB 
+         * @param shapeA 
+         * @param shapeB 
+         * @param simplex 
+         * @param exitOnSeparation : stop with a positive value as soon as a separating plane is found
+         * @return float 
+         */
+        template <typename TShapeA, typename TShapeB>
+        static inline
+        float   computeSquareDistance   (const TShapeA& shapeA, const TShapeB& shapeB, GJKSimplex& simplex, bool exitOnSeparation) noexcept;
+
+        /**
+         * @brief Set the vertex index of the simplex with the support points of A in direction and of B in -direction
+         * 
+         */
+        template <typename TShapeA, typename TShapeB>
+        static inline
+        void    setSupportPoint         (const TShapeA& shapeA, const TShapeB& shapeB, const Vec3f& direction, GJKSimplex& simplex, size_t index) noexcept;
+
+        /**
+         * @brief Reduce the simplex to the smallest sub simplex containing its point closest to origin, update the weights and return this point.
+         * A tetrahedron containing origin is kept
+         * 
+         * @param simplex 
+         * @return Vec3f 
+         */
+        static inline
+        Vec3f   solveSimplex            (GJKSimplex& simplex) noexcept;
+
+        /**
+         * @brief Point of A - B closest to origin of a solved simplex (closestPointA - closestPointB of getDistance).
+         * Use it for the direction of contact : the difference of the closest points lose precision when they are far from origin
+         * 
+         * @param simplex 
+         * @return Vec3f 
+         */
+        [[nodiscard]] static inline
+        Vec3f   getClosestPoint         (const GJKSimplex& simplex) noexcept;
+
+        #pragma endregion //!static methods
+
+        protected:
+
+        #pragma region static methods
+
+        static inline void      keepVertices    (GJKSimplex& simplex, const GJKSimplex& source, const size_t* indices, const float* weights, size_t count) noexcept;
+
+        /*Closest point to origin of the sub simplex of source and its weights, return the squared distance. simplex can be source if a < b < c*/
+        static inline float     solveSegment    (const GJKSimplex& source, size_t a, size_t b, GJKSimplex& simplex) noexcept;
+        static inline float     solveTriangle   (const GJKSimplex& source, size_t a, size_t b, size_t c, GJKSimplex& simplex) noexcept;
+        static inline void      solveTetrahedron(GJKSimplex& simplex) noexcept;
+
+
+        #pragma endregion //!static methods
+    };
+
+    #include "GJK.inl"
+
+} /*namespace FoxMath*/
@@ -0,0 +1,387 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 09 h 30
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <typename TShapeA, typename TShapeB>
+inline
+bool GJK::isOverlapped (const TShapeA& shapeA, const TShapeB& shapeB, GJKSimplex& simplex) noexcept
+{
+    return computeSquareDistance(shapeA, shapeB, simplex, true) <= 0.f;
+}
+
+template <typename TShapeA, typename TShapeB>
+inline
+bool GJK::isOverlapped (const TShapeA& shapeA, const TShapeB& shapeB) noexcept
+{
+    GJKSimplex simplex;
+    return isOverlapped(shapeA, shapeB, simplex);
+}
+
+template <typename TShapeA, typename TShapeB>
+inline
+float GJK::getDistance (const TShapeA& shapeA, const TShapeB& shapeB, Vec3f& closestPointA, Vec3f& closestPointB, GJKSimplex& simplex) noexcept
+{
+    const float squareDistance = computeSquareDistance(shapeA, shapeB, simplex, false);
+
+    closestPointA = Vec3f::zero;
+
+    for (size_t i = 0; i < simplex.count; ++i)
+    {
+        closestPointA += simplex.pointsA[i] * simplex.weights[i];
+    }
+
+    closestPointB = closestPointA - getClosestPoint(simplex);
+
+    return std::sqrt(squareDistance);
+}
+
+template <typename TShapeA, typename TShapeB>
+inline
+float GJK::getDistance (const TShapeA& shapeA, const TShapeB& shapeB, Vec3f& closestPointA, Vec3f& closestPointB) noexcept
+{
+    GJKSimplex simplex;
+    return getDistance(shapeA, shapeB, closestPointA, closestPointB, simplex);
+}
+
+template <typename TShapeA, typename TShapeB>
+inline
+float GJK::computeSquareDistance (const TShapeA& shapeA, const TShapeB& shapeB, GJKSimplex& simplex, bool exitOnSeparation) noexcept
+{
+    Vec3f closestPoint;
+
+    if (simplex.count == 0)
+    {
+        setSupportPoint(shapeA, shapeB, Vec3f::right, simplex, 0);
+        simplex.weights[0]  = 1.f;
+        simplex.count       = 1;
+        closestPoint        = simplex.getPoint(0);
+    }
+    else
+    {
+        /*Warm start : the previous simplex on the new positions*/
+        for (size_t i = 0; i < simplex.count; ++i)
+        {
+            setSupportPoint(shapeA, shapeB, simplex.directions[i], simplex, i);
+        }
+
+        closestPoint = solveSimplex(simplex);
+    }
+
+    float maxSquareLength = 0.f;
+    for (size_t i = 0; i < simplex.count; ++i)
+    {
+        maxSquareLength = std::max(maxSquareLength, simplex.getPoint(i).squareLength());
+    }
+
+    for (size_t iteration = 0; iteration < maxIteration; ++iteration)
+    {
+        const float squareDistance = closestPoint.squareLength();
+
+        /*Origin in the tetrahedron or on the simplex*/
+        if (simplex.count == 4 || squareDistance <= relativeTolerance * relativeTolerance * maxSquareLength)
+            return 0.f;
+
+        setSupportPoint(shapeA, shapeB, -closestPoint, simplex, simplex.count);
+
+        const Vec3f newPoint = simplex.getPoint(simplex.count);
+        const float newPointProjection = Vec3f::dot(closestPoint, newPoint);
+
+        /*The plane orthogonal to closestPoint separate origin and A - B*/
+        if (exitOnSeparation && newPointProjection > 0.f)
+            return squareDistance;
+
+        /*No more progress : closestPoint is the point of A - B closest to origin. The absolute term is the float precision on the points*/
+        if (squareDistance - newPointProjection <= relativeTolerance * squareDistance + relativeTolerance * relativeTolerance * maxSquareLength)
+            return squareDistance;
+
+        for (size_t i = 0; i < simplex.count; ++i)
+        {
+            if ((simplex.getPoint(i) - newPoint).squareLength() <= relativeTolerance * relativeTolerance * maxSquareLength)
+                return squareDistance;
+        }
+
+        const GJKSimplex previousSimplex = simplex;
+
+        maxSquareLength = std::max(maxSquareLength, newPoint.squareLength());
+        ++simplex.count;
+        closestPoint = solveSimplex(simplex);
+
+        /*Rounding errors can make the new simplex farther than the previous one : keep the previous one*/
+        if (simplex.count != 4 && closestPoint.squareLength() >= squareDistance)
+        {
+            simplex = previousSimplex;
+            return squareDistance;
+        }
+    }
+
+    return closestPoint.squareLength();
+}
+
+template <typename TShapeA, typename TShapeB>
+inline
+void GJK::setSupportPoint (const TShapeA& shapeA, const TShapeB& shapeB, const Vec3f& direction, GJKSimplex& simplex, size_t index) noexcept
+{
+    simplex.directions[index]   = direction;
+    simplex.pointsA[index]      = shapeA.getSupportPoint(direction);
+    simplex.pointsB[index]      = shapeB.getSupportPoint(-direction);
+}
+
+inline
+Vec3f GJK::solveSimplex (GJKSimplex& simplex) noexcept
+{
+    /*Sorted vertices are kept in place : the simplex is its own source*/
+    switch (simplex.count)
+    {
+        case 1:
+            simplex.weights[0] = 1.f;
+            break;
+
+        case 2:
+            solveSegment(simplex, 0, 1, simplex);
+            break;
+
+        case 3:
+            solveTriangle(simplex, 0, 1, 2, simplex);
+            break;
+
+        case 4:
+            solveTetrahedron(simplex);
+
+            if (simplex.count == 4)
+                return Vec3f::zero;
+            break;
+
+        default:
+            break;
+    }
+
+    return getClosestPoint(simplex);
+}
+
+inline
+void GJK::keepVertices (GJKSimplex& simplex, const GJKSimplex& source, const size_t* indices, const float* weights, size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        simplex.directions[i]   = source.directions[indices[i]];
+        simplex.pointsA[i]      = source.pointsA[indices[i]];
+        simplex.pointsB[i]      = source.pointsB[indices[i]];
+        simplex.weights[i]      = weights[i];
+    }
+
+    simplex.count = count;
+}
+
+inline
+float GJK::solveSegment (const GJKSimplex& source, size_t a, size_t b, GJKSimplex& simplex) noexcept
+{
+    const Vec3f pointA          = source.getPoint(a);
+    const Vec3f ab              = source.getPoint(b) - pointA;
+    const float squareLength    = ab.squareLength();
+    const float t               = squareLength > std::numeric_limits<float>::min() ? -Vec3f::dot(pointA, ab) / squareLength : 0.f;
+
+    if (t <= 0.f)
+    {
+        const size_t indices[1] {a};
+        const float weights[1]  {1.f};
+        keepVertices(simplex, source, indices, weights, 1);
+        return pointA.squareLength();
+    }
+
+    if (t >= 1.f)
+    {
+        const size_t indices[1] {b};
+        const float weights[1]  {1.f};
+        keepVertices(simplex, source, indices, weights, 1);
+        return source.getPoint(b).squareLength();
+    }
+
+    const size_t indices[2] {a, b};
+    const float weights[2]  {1.f - t, t};
+    keepVertices(simplex, source, indices, weights, 2);
+    return (pointA + ab * t).squareLength();
+}
+
+inline
+float GJK::solveTriangle (const GJKSimplex& source, size_t a, size_t b, size_t c, GJKSimplex& simplex) noexcept
+{
+    /*Voronoi regions of the triangle, Ericson Real-Time Collision Detection 5.1.5 with the origin as point*/
+    const Vec3f pointA  = source.getPoint(a);
+    const Vec3f pointB  = source.getPoint(b);
+    const Vec3f pointC  = source.getPoint(c);
+    const Vec3f ab      = pointB - pointA;
+    const Vec3f ac      = pointC - pointA;
+
+    const float d1 = -Vec3f::dot(ab, pointA);
+    const float d2 = -Vec3f::dot(ac, pointA);
+    if (d1 <= 0.f && d2 <= 0.f)
+    {
+        const size_t indices[1] {a};
+        const float weights[1]  {1.f};
+        keepVertices(simplex, source, indices, weights, 1);
+        return pointA.squareLength();
+    }
+
+    const float d3 = -Vec3f::dot(ab, pointB);
+    const float d4 = -Vec3f::dot(ac, pointB);
+    if (d3 >= 0.f && d4 <= d3)
+    {
+        const size_t indices[1] {b};
+        const float weights[1]  {1.f};
+        keepVertices(simplex, source, indices, weights, 1);
+        return pointB.squareLength();
+    }
+
+    const float vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.f && d1 >= 0.f && d3 <= 0.f)
+        return solveSegment(source, a, b, simplex);
+
+    const float d5 = -Vec3f::dot(ab, pointC);
+    const float d6 = -Vec3f::dot(ac, pointC);
+    if (d6 >= 0.f && d5 <= d6)
+    {
+        const size_t indices[1] {c};
+        const float weights[1]  {1.f};
+        keepVertices(simplex, source, indices, weights, 1);
+        return pointC.squareLength();
+    }
+
+    const float vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.f && d2 >= 0.f && d6 <= 0.f)
+        return solveSegment(source, a, c, simplex);
+
+    const float va = d3 * d6 - d5 * d4;
+    if (va <= 0.f && (d4 - d3) >= 0.f && (d5 - d6) >= 0.f)
+        return solveSegment(source, b, c, simplex);
+
+    const float sum = va + vb + vc;
+
+    /*Flat triangle : closest edge*/
+    if (sum <= std::numeric_limits<float>::min())
+    {
+        const GJKSimplex triangle = source;
+        GJKSimplex edgeSimplex;
+        float squareDistance = solveSegment(triangle, a, b, simplex);
+
+        const size_t edges[2][2] {{a, c}, {b, c}};
+        for (const auto& edge : edges)
+        {
+            const float edgeSquareDistance = solveSegment(triangle, edge[0], edge[1], edgeSimplex);
+            if (edgeSquareDistance < squareDistance)
+            {
+                squareDistance  = edgeSquareDistance;
+                simplex         = edgeSimplex;
+            }
+        }
+
+        return squareDistance;
+    }
+
+    const float v = vb / sum;
+    const float w = vc / sum;
+    const size_t indices[3] {a, b, c};
+    const float weights[3]  {1.f - v - w, v, w};
+    keepVertices(simplex, source, indices, weights, 3);
+    return (pointA + ab * v + ac * w).squareLength();
+}
+
+inline
+void GJK::solveTetrahedron (GJKSimplex& simplex) noexcept
+{
+    const GJKSimplex source = simplex;
+    const Vec3f points[4] {source.getPoint(0), source.getPoint(1), source.getPoint(2), source.getPoint(3)};
+
+    /*Faces with their opposite vertex*/
+    const size_t faces[4][4] {{0, 1, 2, 3}, {0, 2, 3, 1}, {0, 3, 1, 2}, {1, 3, 2, 0}};
+
+    /*Flat tetrahedron : origin can not be inside, keep the closest face*/
+    const Vec3f edge1   = points[1] - points[0];
+    const Vec3f edge2   = points[2] - points[0];
+    const Vec3f edge3   = points[3] - points[0];
+    const float volume  = Vec3f::dot(edge1, Vec3f::cross(edge2, edge3));
+    const bool  isFlat  = volume * volume <= relativeTolerance * relativeTolerance * edge1.squareLength() * edge2.squareLength() * edge3.squareLength();
+
+    GJKSimplex  faceSimplex;
+    float       squareDistance  = std::numeric_limits<float>::max();
+    bool        isInside        = true;
+
+    for (const auto& face : faces)
+    {
+        const Vec3f normal          = Vec3f::cross(points[face[1]] - points[face[0]], points[face[2]] - points[face[0]]);
+        const float originSide      = -Vec3f::dot(normal, points[face[0]]);
+        const float oppositeSide    = Vec3f::dot(normal, points[face[3]] - points[face[0]]);
+
+        /*Origin and the opposite vertex on the same side of the face*/
+        if (!isFlat && originSide * oppositeSide >= 0.f)
+            continue;
+
+        isInside = false;
+
+        const float faceSquareDistance = solveTriangle(source, face[0], face[1], face[2], faceSimplex);
+        if (faceSquareDistance < squareDistance)
+        {
+            squareDistance  = faceSquareDistance;
+            simplex         = faceSimplex;
+        }
+    }
+
+    /*Barycentric coordinates of origin in the tetrahedron*/
+    if (isInside)
+    {
+        simplex.weights[1] = -Vec3f::dot(points[0], Vec3f::cross(edge2, edge3)) / volume;
+        simplex.weights[2] = -Vec3f::dot(edge1, Vec3f::cross(points[0], edge3)) / volume;
+        simplex.weights[3] = -Vec3f::dot(edge1, Vec3f::cross(edge2, points[0])) / volume;
+        simplex.weights[0] = 1.f - simplex.weights[1] - simplex.weights[2] - simplex.weights[3];
+    }
+}
+
+inline
+Vec3f GJK::getClosestPoint (const GJKSimplex& simplex) noexcept
+{
+    /*Projection on the plane of the triangle : the weighted sum of the vertices lose the direction when origin is near the triangle*/
+    if (simplex.count == 3)
+    {
+        const Vec3f pointA = simplex.getPoint(0);
+        const Vec3f normal = Vec3f::cross(simplex.getPoint(1) - pointA, simplex.getPoint(2) - pointA);
+        const float squareLength = normal.squareLength();
+
+        if (squareLength > std::numeric_limits<float>::min())
+            return normal * (Vec3f::dot(normal, pointA) / squareLength);
+    }
+
+    Vec3f closestPoint = Vec3f::zero;
+
+    for (size_t i = 0; i < simplex.count; ++i)
+    {
+        closestPoint += simplex.getPoint(i) * simplex.weights[i];
+    }
+
+    return closestPoint;
+}
@@ -0,0 +1,219 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 16 h 20
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stddef.h> //sizt_t
+#include <stdint.h> //int16_t, uint32_t
+#include <cmath> //std::abs, std::round, std::sqrt
+#include <vector> //std::vector
+#include <algorithm> //std::sort, std::min_element
+
+#include "Vector/Vector3.hpp"
+#include "Shape3D/Segment.hpp"
+#include "ShapeRelation/Intersection.hpp"
+
+namespace FoxMath
+{
+    /**
+     * @brief Unit vector in 4 bytes : octahedral projection stored in 2 signed normalized 16 bits integers (error near 1e-4).
+     * The null vector is not representable and is decoded as forward
+     */
+    struct PackedNormal
+    {
+        int16_t x {0};
+        int16_t y {0};
+
+        PackedNormal () noexcept = default;
+
+        /**
+         * @brief Encode normal. Normal does not need to be normalized
+         * 
+         * @param normal 
+         */
+        explicit inline
+        PackedNormal (const Vec3f& normal) noexcept;
+
+        [[nodiscard]] inline
+        Vec3f decode () const noexcept;
+    };
+
+    /**
+     * @brief Compact result of a segment query (24 bytes). Points are stored as ratios on the segment and only computed with getPoint,
+     * normals are packed. Intersection is still filled by the historical functions and can be converted with toIntersection
+     * @note Ratios are sorted from the first point of the segment
+     */
+    struct HitRecord
+    {
+        float               t           [2] {0.f, 0.f};
+        PackedNormal        normal      [2] {};
+        uint32_t            shapeIndex  {0};
+        EIntersectionType   type        {EIntersectionType::NoIntersection};
+
+        /**
+         * @brief Number of points stored (0, 1 or 2)
+         * 
+         * @return size_t 
+         */
+        [[nodiscard]] inline
+        size_t  getPointCount   () const noexcept;
+
+        /**
+         * @brief Point of the segment at the ratio t[index]
+         * 
+         * @param seg : segment of the query
+         * @param index : 0 or 1
+         * @return Vec3f 
+         */
+        [[nodiscard]] inline
+        Vec3f   getPoint        (const Segment& seg, size_t index) const noexcept;
+
+        [[nodiscard]] inline
+        Vec3f   getNormal       (size_t index) const noexcept;
+
+        inline
+        void    toIntersection  (const Segment& seg, Intersection& intersection) const noexcept;
+
+        /**
+         * @brief Convert an intersection on seg. Points are projected on the segment to get their ratio
+         * 
+         * @param seg : segment of the query
+         * @param intersection 
+         * @param shapeIndex 
+         * @return HitRecord 
+         */
+        [[nodiscard]] static inline
+        HitRecord fromIntersection (const Segment& seg, const Intersection& intersection, uint32_t shapeIndex = 0) noexcept;
+
+        /**
+         * @brief Solve a * t² + b * t + c = 0 and keep the roots in [0, 1], sorted. Same as Intersection::computeDiscriminentAndSolveEquation without the points
+         * 
+         * @param a 
+         * @param b 
+         * @param c 
+         * @param hit : type and ratios are written
+         * @return true if one root is on the segment
+         */
+        static inline
+        bool computeDiscriminentAndSolveEquation (float a, float b, float c, HitRecord& hit) noexcept;
+    };
+
+    /**
+     * @brief Append only buffer of HitRecord for batched queries. Clear it and reuse it between queries to keep its memory
+     */
+    class HitBuffer
+    {
+        protected:
+
+        #pragma region attribut
+
+        std::vector<HitRecord> m_hits;
+
+        #pragma endregion //!attribut
+
+        public:
+
+        #pragma region constructor/destructor
+
+        HitBuffer ()					                = default;
+        HitBuffer (const HitBuffer& other)			    = default;
+        HitBuffer (HitBuffer&& other)				    = default;
+        ~HitBuffer ()				                    = default;
+        HitBuffer& operator=(HitBuffer const& other)    = default;
+        HitBuffer& operator=(HitBuffer && other)		= default;
+
+        explicit inline
+        HitBuffer (size_t capacity);
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        inline
+        void        clear       () noexcept { m_hits.clear(); }
+
+        inline
+        void        reserve     (size_t capacity) { m_hits.reserve(capacity); }
+
+        inline
+        HitRecord&  append      (const HitRecord& hit);
+
+        /**
+         * @brief Append the intersection of a historical segment function. Nothing is appended if intersection type is NoIntersection
+         * 
+         * @param seg : segment of the query
+         * @param intersection 
+         * @param shapeIndex 
+         */
+        inline
+        void        append      (const Segment& seg, const Intersection& intersection, uint32_t shapeIndex);
+
+        /**
+         * @brief Sort hits by their first ratio (nearest hit first)
+         * 
+         */
+        inline
+        void        sortByEntry () noexcept;
+
+        /**
+         * @brief Return the hit with the smallest first ratio or nullptr if buffer is empty
+         * 
+         * @return const HitRecord* 
+         */
+        [[nodiscard]] inline
+        const HitRecord* findFirst () const noexcept;
+
+        #pragma endregion //!methods
+
+        #pragma region accessor
+
+        [[nodiscard]] inline
+        size_t              size        () const noexcept                   { return m_hits.size(); }
+
+        [[nodiscard]] inline
+        bool                empty       () const noexcept                   { return m_hits.empty(); }
+
+        [[nodiscard]] inline
+        const HitRecord&    operator[]  (size_t index) const noexcept       { return m_hits[index]; }
+
+        [[nodiscard]] inline
+        const HitRecord*    data        () const noexcept                   { return m_hits.data(); }
+
+        [[nodiscard]] inline
+        auto                begin       () const noexcept                   { return m_hits.begin(); }
+
+        [[nodiscard]] inline
+        auto                end         () const noexcept                   { return m_hits.end(); }
+
+        #pragma endregion //!accessor
+    };
+
+    #include "HitRecord.inl"
+
+} /*namespace FoxMath*/
@@ -0,0 +1,224 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 16 h 20
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+inline
+PackedNormal::PackedNormal (const Vec3f& normal) noexcept
+{
+    const float sum = std::abs(normal.getX()) + std::abs(normal.getY()) + std::abs(normal.getZ());
+    if (sum <= 0.f)
+        return;
+
+    /*Project on the octahedron |x| + |y| + |z| = 1 and fold the lower half on the upper one*/
+    float octX = normal.getX() / sum;
+    float octY = normal.getY() / sum;
+    if (normal.getZ() < 0.f)
+    {
+        const float foldX = (1.f - std::abs(octY)) * (octX >= 0.f ? 1.f : -1.f);
+        const float foldY = (1.f - std::abs(octX)) * (octY >= 0.f ? 1.f : -1.f);
+        octX = foldX;
+        octY = foldY;
+    }
+
+    x = static_cast<int16_t>(std::round(octX * 32767.f));
+    y = static_cast<int16_t>(std::round(octY * 32767.f));
+}
+
+inline
+Vec3f PackedNormal::decode () const noexcept
+{
+    float       octX = static_cast<float>(x) / 32767.f;
+    float       octY = static_cast<float>(y) / 32767.f;
+    const float octZ = 1.f - std::abs(octX) - std::abs(octY);
+
+    if (octZ < 0.f)
+    {
+        const float unfoldX = (1.f - std::abs(octY)) * (octX >= 0.f ? 1.f : -1.f);
+        const float unfoldY = (1.f - std::abs(octX)) * (octY >= 0.f ? 1.f : -1.f);
+        octX = unfoldX;
+        octY = unfoldY;
+    }
+
+    const float invLength = 1.f / std::sqrt(octX * octX + octY * octY + octZ * octZ);
+    return Vec3f{octX * invLength, octY * invLength, octZ * invLength};
+}
+
+inline
+size_t HitRecord::getPointCount () const noexcept
+{
+    switch (type)
+    {
+        case EIntersectionType::OneIntersectiont : return 1;
+        case EIntersectionType::TwoIntersectiont : return 2;
+        default : return 0;
+    }
+}
+
+inline
+Vec3f HitRecord::getPoint (const Segment& seg, size_t index) const noexcept
+{
+    return seg.getPt1() + (seg.getPt2() - seg.getPt1()) * t[index];
+}
+
+inline
+Vec3f HitRecord::getNormal (size_t index) const noexcept
+{
+    return normal[index].decode();
+}
+
+inline
+void HitRecord::toIntersection (const Segment& seg, Intersection& intersection) const noexcept
+{
+    intersection.intersectionType = type;
+
+    if (getPointCount() > 0)
+    {
+        intersection.intersection1  = getPoint(seg, 0);
+        intersection.normalI1       = getNormal(0);
+    }
+
+    if (getPointCount() > 1)
+    {
+        intersection.intersection2  = getPoint(seg, 1);
+        intersection.normalI2       = getNormal(1);
+    }
+}
+
+inline
+HitRecord HitRecord::fromIntersection (const Segment& seg, const Intersection& intersection, uint32_t shapeIndex) noexcept
+{
+    HitRecord hit;
+    hit.type        = intersection.intersectionType;
+    hit.shapeIndex  = shapeIndex;
+
+    const Vec3f AB              = seg.getPt2() - seg.getPt1();
+    const float squareLengthAB  = AB.squareLength();
+    const float invSquareLength = squareLengthAB > 0.f ? 1.f / squareLengthAB : 0.f;
+
+    for (size_t index = 0; index < hit.getPointCount(); ++index)
+    {
+        const Vec3f& point = index == 0 ? intersection.intersection1 : intersection.intersection2;
+
+        hit.t[index]        = Vec3f::dot(point - seg.getPt1(), AB) * invSquareLength;
+        hit.normal[index]   = PackedNormal(index == 0 ? intersection.normalI1 : intersection.normalI2);
+    }
+
+    if (hit.type == EIntersectionType::TwoIntersectiont && hit.t[0] > hit.t[1])
+    {
+        std::swap(hit.t[0], hit.t[1]);
+        std::swap(hit.normal[0], hit.normal[1]);
+    }
+
+    return hit;
+}
+
+inline
+bool HitRecord::computeDiscriminentAndSolveEquation (float a, float b, float c, HitRecord& hit) noexcept
+{
+    const float discriminent = b * b - 4.f * a * c;
+
+    if (discriminent < 0.f || a == 0.f)
+    {
+        hit.type = EIntersectionType::NoIntersection;
+        return false;
+    }
+
+    const float sqrtDiscriminent    = std::sqrt(discriminent);
+    const float inv2A               = 0.5f / a;
+    float       t1                  = (-b - sqrtDiscriminent) * inv2A;
+    float       t2                  = (-b + sqrtDiscriminent) * inv2A;
+
+    if (t1 > t2)
+    {
+        std::swap(t1, t2);
+    }
+
+    const bool isT1OnSegment = isBetween(t1, 0.f, 1.f);
+    const bool isT2OnSegment = isBetween(t2, 0.f, 1.f) && discriminent > 0.f;
+
+    if (isT1OnSegment && isT2OnSegment)
+    {
+        hit.type = EIntersectionType::TwoIntersectiont;
+        hit.t[0] = t1;
+        hit.t[1] = t2;
+    }
+    else if (isT1OnSegment || isT2OnSegment)
+    {
+        hit.type = EIntersectionType::OneIntersectiont;
+        hit.t[0] = isT1OnSegment ? t1 : t2;
+    }
+    else
+    {
+        hit.type = EIntersectionType::NoIntersection;
+        return false;
+    }
+
+    return true;
+}
+
+inline
+HitBuffer::HitBuffer (size_t capacity)
+{
+    m_hits.reserve(capacity);
+}
+
+inline
+HitRecord& HitBuffer::append (const HitRecord& hit)
+{
+    return m_hits.emplace_back(hit);
+}
+
+inline
+void HitBuffer::append (const Segment& seg, const Intersection& intersection, uint32_t shapeIndex)
+{
+    if (intersection.intersectionType != EIntersectionType::NoIntersection)
+        m_hits.emplace_back(HitRecord::fromIntersection(seg, intersection, shapeIndex));
+}
+
+inline
+void HitBuffer::sortByEntry () noexcept
+{
+    std::sort(m_hits.begin(), m_hits.end(), [](const HitRecord& lhs, const HitRecord& rhs) noexcept
+    {
+        return lhs.t[0] < rhs.t[0];
+    });
+}
+
+inline
+const HitRecord* HitBuffer::findFirst () const noexcept
+{
+    if (m_hits.empty())
+        return nullptr;
+
+    return &*std::min_element(m_hits.begin(), m_hits.end(), [](const HitRecord& lhs, const HitRecord& rhs) noexcept
+    {
+        return lhs.t[0] < rhs.t[0];
+    });
+}
@@ -6,12 +6,16 @@
 #define _INTERSECTION_3D_H
 
 #include "Vector/Vector.hpp"
+#include "Numeric/MathTools.hpp"
 
 #include <limits>
+#include <cmath>
+#include <utility>
+#include <stdint.h>
 
 namespace FoxMath
 {
-    enum class EIntersectionType
+    enum class EIntersectionType : uint8_t
     {
         NoIntersection,
         OneIntersectiont,
@@ -22,73 +26,73 @@ namespace FoxMath
 
     struct Intersection
     {
-        EIntersectionType intersectionType = EIntersectionNoIntersection;
-        Vec3 intersection1;
-        Vec3 intersection2;
-        Vec3 normalI1;
-        Vec3 normalI2;
+        EIntersectionType intersectionType = EIntersectionType::NoIntersection;
+        Vec3f intersection1;
+        Vec3f intersection2;
+        Vec3f normalI1;
+        Vec3f normalI2;
 
         void setNotIntersection ()
         {
-            intersectionType = EIntersectionNoIntersection;
+            intersectionType = EIntersectionType::NoIntersection;
         }
 
-        void setOneIntersection(const Vec3& intersectionPoint)
+        void setOneIntersection(const Vec3f& intersectionPoint)
         {
-            intersectionType = EIntersectionOneIntersectiont;
+            intersectionType = EIntersectionType::OneIntersectiont;
             intersection1 = intersectionPoint;
         }
 
-        void setTwoIntersection(const Vec3& intersectionPoint1, const Vec3 intersectionPoint2)
+        void setTwoIntersection(const Vec3f& intersectionPoint1, const Vec3f intersectionPoint2)
         {
-            intersectionType = EIntersectionTwoIntersectiont;
+            intersectionType = EIntersectionType::TwoIntersectiont;
             intersection1 = intersectionPoint1;
             intersection2 = intersectionPoint2;
         }
 
-        void setSecondIntersection(const Vec3& intersectionPoint2)
+        void setSecondIntersection(const Vec3f& intersectionPoint2)
         {
-            intersectionType = EIntersectionTwoIntersectiont;
+            intersectionType = EIntersectionType::TwoIntersectiont;
             intersection2 = intersectionPoint2;
         }
 
         void setInifitIntersection()
         {
-            intersectionType = EIntersectionInfinyIntersection;
+            intersectionType = EIntersectionType::InfinyIntersection;
         }
 
         void setUnKnowIntersection()
         {
-            intersectionType = EIntersectionUnknowIntersection;
+            intersectionType = EIntersectionType::UnknowIntersection;
         }
 
         void removeFirstIntersection()
         {
-            if (intersectionType == EIntersectionTwoIntersectiont)
+            if (intersectionType == EIntersectionType::TwoIntersectiont)
             {
-                intersectionType = EIntersectionOneIntersectiont;
+                intersectionType = EIntersectionType::OneIntersectiont;
                 intersection1 = intersection2;
                 normalI1 = normalI2;
             }
             else
             {
-                intersectionType = EIntersectionNoIntersection;
+                intersectionType = EIntersectionType::NoIntersection;
             }
         }
 
         void removeSecondIntersection()
         {
-            if (intersectionType == EIntersectionTwoIntersectiont)
+            if (intersectionType == EIntersectionType::TwoIntersectiont)
             {
-                intersectionType = EIntersectionOneIntersectiont;
+                intersectionType = EIntersectionType::OneIntersectiont;
 
             }
         }
 
         /*return true if intersection contenor is full (if there are 2 intersection)*/
-        bool addIntersectionAndCheckIfSecond(const Vec3& intersection)
+        bool addIntersectionAndCheckIfSecond(const Vec3f& intersection)
         {
-            if (intersectionType != EIntersectionOneIntersectiont)
+            if (intersectionType != EIntersectionType::OneIntersectiont)
             {
                 setOneIntersection(intersection);
                 return false;
@@ -103,27 +107,73 @@ namespace FoxMath
         void swapIntersection()
         {
             /*swap intersection*/
-            std::swap<Vec3>(intersection1, intersection2);
+            std::swap<Vec3f>(intersection1, intersection2);
 
             /*swap normal*/
-            std::swap<Vec3>(normalI1, normalI2);
+            std::swap<Vec3f>(normalI1, normalI2);
         }
 
-        void sortIntersection(const Vec3& pt1Seg)
+        void sortIntersection(const Vec3f& pt1Seg)
         {
-            if (intersectionType != EIntersectionTwoIntersectiont)
+            if (intersectionType != EIntersectionType::TwoIntersectiont)
             {
                 return;
             }
 
-            if ((intersection1 - pt1Seg).length() > (intersection2 - pt1Seg).length())
+            /*Compare square lengths : no square root*/
+            if ((intersection1 - pt1Seg).squareLength() > (intersection2 - pt1Seg).squareLength())
             {
                 swapIntersection();
             }
         }
 
-        static bool computeDiscriminentAndSolveEquation(float a, float b, float c, const Vec3& segPt1, const Vec3& segPt2, Intersection& intersection);
+        /*solve a * t² + b * t + c = 0 and keep the roots in [0, 1] as the points segPt1 + t * (segPt2 - segPt1), sorted from segPt1*/
+        static bool computeDiscriminentAndSolveEquation(float a, float b, float c, const Vec3f& segPt1, const Vec3f& segPt2, Intersection& intersection);
     };
+
+    inline bool Intersection::computeDiscriminentAndSolveEquation(float a, float b, float c, const Vec3f& segPt1, const Vec3f& segPt2, Intersection& intersection)
+    {
+        float discriminent = b * b - 4.f * a * c;
+
+        if (discriminent < 0.f || a == 0.f)
+        {
+            intersection.setNotIntersection();
+            return false;
+        }
+
+        float sqrtDiscriminent = std::sqrt(discriminent);
+        float t1 = (-b - sqrtDiscriminent) / (2.f * a);
+        float t2 = (-b + sqrtDiscriminent) / (2.f * a);
+
+        if (t1 > t2)
+        {
+            std::swap(t1, t2);
+        }
+
+        bool isT1OnSegment = isBetween(t1, 0.f, 1.f);
+        bool isT2OnSegment = isBetween(t2, 0.f, 1.f) && discriminent > 0.f;
+        Vec3f AB = segPt2 - segPt1;
+
+        if (isT1OnSegment && isT2OnSegment)
+        {
+            intersection.setTwoIntersection(segPt1 + t1 * AB, segPt1 + t2 * AB);
+        }
+        else if (isT1OnSegment)
+        {
+            intersection.setOneIntersection(segPt1 + t1 * AB);
+        }
+        else if (isT2OnSegment)
+        {
+            intersection.setOneIntersection(segPt1 + t2 * AB);
+        }
+        else
+        {
+            intersection.setNotIntersection();
+            return false;
+        }
+
+        return true;
+    }
 } /*namespace FoxMath*/
 
 #endif //_INTERSECTION_3D_H
\ No newline at end of file
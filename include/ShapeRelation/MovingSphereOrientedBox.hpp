@@ -8,9 +8,19 @@
 #include "Vector/Vector.hpp"
 #include "ShapeRelation/Intersection.hpp"
 #include "Shape3D/Segment.hpp"
-#include "GE/Core/Maths/Shape3D/Capsule.hpp"
-#include "GE/Core/Maths/Shape3D/Quad.hpp"
-#include "GE/Core/Maths/Shape3D/OrientedBox.hpp"
+#include "Shape3D/Capsule.hpp"
+#include "Shape3D/Quad.hpp"
+#include "Shape3D/OrientedBox.hpp"
+#include "Shape3D/Sphere.hpp"
+#include "ShapeRelation/SegmentOrientedBox.hpp"
+#include "ShapeRelation/SegmentCapsule.hpp"
+#include "ShapeRelation/SegmentSegment.hpp"
+#include "Referential/Referential.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
 
 namespace FoxMath
 {
@@ -32,7 +42,10 @@ namespace FoxMath
         #pragma region static methods
 
         /*get the first collision point between moving sphere and static box*/
-        static bool isMovingSphereOrientedBoxCollided(const Sphere& sphere, const OrientedBox& box, const Vec3& sphereVelocity, Intersection& intersection);
+        static bool isMovingSphereOrientedBoxCollided(const Sphere& sphere, const OrientedBox& box, const Vec3f& sphereVelocity, Intersection& intersection);
+
+        /*Overlap only : slab test with the extended box then capsule of the edges only if the entry point is in an edge or vertex region*/
+        static bool isMovingSphereOrientedBoxCollided(const Sphere& sphere, const OrientedBox& box, const Vec3f& sphereVelocity);
 
         #pragma endregion //!static methods
 
@@ -48,6 +61,9 @@ namespace FoxMath
 
         static bool applyCapsuleCorrection(const Segment& seg, const Capsule& _capsule, Intersection& intersection, bool checkFirstIntersection);
 
+        /*In a vertex region the sphere can touch the 3 edges of the vertex : keep the nearest (first) or farthest (second) intersection with their capsules*/
+        static bool applyVertexCapsuleCorrection(const Segment& seg, const Capsule (&edgeCapsules)[3], Intersection& intersection, bool checkFirstIntersection);
+
         /*Sub component of minkowski sum*/
         static Capsule getTopLeftVeronoiCapsule(const OrientedBox& box, float sphereRadius);
 
@@ -107,6 +123,541 @@ namespace FoxMath
         #pragma endregion //!static attribut
     };
 
+    /*get the first collision point between moving sphere and box*/
+    inline bool MovingSphereOrientedBox::isMovingSphereOrientedBoxCollided(const Sphere& sphere, const OrientedBox& box, const Vec3f& sphereVelocity, Intersection& intersection)
+    {
+        OrientedBox minkowskiSumOBB = getMinkowskiSumOBB(box, sphere.getRadius());
+        Segment spherePt1ToPt2 {sphere.getCenter(), sphere.getCenter() + sphereVelocity};
+
+        /*Step 1, check if the segment collid with the Minkowski sum box*/
+        if (!SegmentOrientedBox::isSegmentOrientedBoxCollided(spherePt1ToPt2, minkowskiSumOBB, intersection))
+        {
+            intersection.setNotIntersection();
+            return false;
+        }
+
+        /*A path that start inside the Minkowski sum box only find the exit*/
+        const Vec3f localCenter = Referentialf::globalToLocalPosition(box.getReferential(), sphere.getCenter());
+        const bool isStartInMinkowskiSum = intersection.intersectionType == EIntersectionType::OneIntersectiont &&
+                                           std::abs(localCenter.getX()) <= minkowskiSumOBB.getExtI() &&
+                                           std::abs(localCenter.getY()) <= minkowskiSumOBB.getExtJ() &&
+                                           std::abs(localCenter.getZ()) <= minkowskiSumOBB.getExtK();
+
+        /*Step 2, check if intersection points are on the veronoi face*/
+        applyVeronoiRegionCorrection(box, intersection, spherePt1ToPt2, sphere.getRadius());
+
+        /*Step 3, a sphere that start in the Minkowski sum box without touching the box is in an edge or vertex region : the first contact is on the capsules of this region*/
+        if (isStartInMinkowskiSum)
+        {
+            const Vec3f closestPoint {  std::clamp(localCenter.getX(), -box.getExtI(), box.getExtI()),
+                                        std::clamp(localCenter.getY(), -box.getExtJ(), box.getExtJ()),
+                                        std::clamp(localCenter.getZ(), -box.getExtK(), box.getExtK())};
+
+            if ((localCenter - closestPoint).squareLength() > sphere.getRadius() * sphere.getRadius())
+            {
+                Intersection entry;
+                entry.setOneIntersection(sphere.getCenter());
+
+                int topVeronoiOutCode = getTopVeronoiFace(box, sphere.getRadius()).isPointInsideQuadZoneOutCode(sphere.getCenter());
+                int rightVeronoiOutCode = getRightVeronoiFace(box, sphere.getRadius()).isPointInsideQuadZoneOutCode(sphere.getCenter());
+                int forwardVeronoiOutCode = getFowardVeronoiFace(box, sphere.getRadius()).isPointInsideQuadZoneOutCode(sphere.getCenter());
+
+                if (applyVeronoiRegionCorrectionWithOutCode(box, entry, spherePt1ToPt2, sphere.getRadius(), topVeronoiOutCode, rightVeronoiOutCode, forwardVeronoiOutCode, true))
+                {
+                    if (intersection.intersectionType == EIntersectionType::OneIntersectiont)
+                    {
+                        intersection.setTwoIntersection(entry.intersection1, intersection.intersection1);
+                        intersection.normalI2 = intersection.normalI1;
+                    }
+                    else
+                    {
+                        intersection.setOneIntersection(entry.intersection1);
+                    }
+
+                    intersection.normalI1 = entry.normalI1;
+                }
+            }
+        }
+
+        return intersection.intersectionType != EIntersectionType::NoIntersection;
+    }
+
+    inline OrientedBox MovingSphereOrientedBox::getMinkowskiSumOBB (const OrientedBox& box, float sphereRadius)
+    {
+        return OrientedBox{box.getReferential(), box.getExtI() + sphereRadius, box.getExtJ() + sphereRadius, box.getExtK() + sphereRadius};
+    }
+
+    inline void MovingSphereOrientedBox::applyVeronoiRegionCorrection(const OrientedBox& box, Intersection& intersection, const Segment& seg, float sphereRadius)
+    {
+        if (intersection.intersectionType == EIntersectionType::OneIntersectiont)
+        {
+            int topVeronoiOutCode = getTopVeronoiFace(box, sphereRadius).isPointInsideQuadZoneOutCode(intersection.intersection1);
+            int rightVeronoiOutCode = getRightVeronoiFace(box, sphereRadius).isPointInsideQuadZoneOutCode(intersection.intersection1);
+            int forwardVeronoiOutCode = getFowardVeronoiFace(box, sphereRadius).isPointInsideQuadZoneOutCode(intersection.intersection1);
+
+            if (topVeronoiOutCode == QUAD_OUTCODE_INSIDE || rightVeronoiOutCode == QUAD_OUTCODE_INSIDE || forwardVeronoiOutCode == QUAD_OUTCODE_INSIDE)
+            {
+                return;
+            }
+
+            /*Define if AB or BA in function of the position of the first segment point. If This point is inside do BA else AB*/
+            int topVeronoiOutCodeSeg1 = getTopVeronoiFace(box, sphereRadius).isPointInsideQuadZoneOutCode(seg.getPt1());
+            int rightVeronoiOutCodeSeg1 = getRightVeronoiFace(box, sphereRadius).isPointInsideQuadZoneOutCode(seg.getPt1());
+            int forwardVeronoiOutCodeSeg1 = getFowardVeronoiFace(box, sphereRadius).isPointInsideQuadZoneOutCode(seg.getPt1());
+
+            if (topVeronoiOutCodeSeg1 == QUAD_OUTCODE_INSIDE && rightVeronoiOutCodeSeg1 == QUAD_OUTCODE_INSIDE && forwardVeronoiOutCodeSeg1 == QUAD_OUTCODE_INSIDE)
+            {
+                applyVeronoiRegionCorrectionWithOutCode(box, intersection, Segment{seg.getPt2(), seg.getPt1()}, sphereRadius, topVeronoiOutCode, rightVeronoiOutCode, forwardVeronoiOutCode, true);
+            }
+            else
+            {
+                applyVeronoiRegionCorrectionWithOutCode(box, intersection, seg, sphereRadius, topVeronoiOutCode, rightVeronoiOutCode, forwardVeronoiOutCode, true);
+            }
+        }
+        else if (intersection.intersectionType == EIntersectionType::TwoIntersectiont)
+        {
+            bool keepInter1 = false;
+            bool keepInter2 = false;
+
+            int topVeronoiOutCodePt1 = getTopVeronoiFace(box, sphereRadius).isPointInsideQuadZoneOutCode(intersection.intersection1);
+            int rightVeronoiOutCodePt1 = getRightVeronoiFace(box, sphereRadius).isPointInsideQuadZoneOutCode(intersection.intersection1);
+            int forwardVeronoiOutCodePt1 = getFowardVeronoiFace(box, sphereRadius).isPointInsideQuadZoneOutCode(intersection.intersection1);
+
+            int topVeronoiOutCodePt2 = getTopVeronoiFace(box, sphereRadius).isPointInsideQuadZoneOutCode(intersection.intersection2);
+            int rightVeronoiOutCodePt2 = getRightVeronoiFace(box, sphereRadius).isPointInsideQuadZoneOutCode(intersection.intersection2);
+            int forwardVeronoiOutCodePt2 = getBackwardVeronoiFace(box, sphereRadius).isPointInsideQuadZoneOutCode(intersection.intersection2);
+
+            if (topVeronoiOutCodePt1 == QUAD_OUTCODE_INSIDE || rightVeronoiOutCodePt1 == QUAD_OUTCODE_INSIDE || forwardVeronoiOutCodePt1 == QUAD_OUTCODE_INSIDE)
+            {
+                keepInter1 = true;
+            }
+
+            if (topVeronoiOutCodePt2 == QUAD_OUTCODE_INSIDE || rightVeronoiOutCodePt2 == QUAD_OUTCODE_INSIDE || forwardVeronoiOutCodePt2 == QUAD_OUTCODE_INSIDE)
+            {
+                keepInter2 = true;
+            }
+
+            if (keepInter1)
+            {
+                if (!keepInter2)
+                {
+                    applyVeronoiRegionCorrectionWithOutCode(box, intersection, seg, sphereRadius, topVeronoiOutCodePt2, rightVeronoiOutCodePt2, forwardVeronoiOutCodePt2, false);
+                }
+            }
+            else if (keepInter2)
+            {
+                if (!keepInter1)
+                {
+                    applyVeronoiRegionCorrectionWithOutCode(box, intersection, seg, sphereRadius, topVeronoiOutCodePt1, rightVeronoiOutCodePt1, forwardVeronoiOutCodePt1, true);
+                }
+            }
+            else 
+            {
+                applyVeronoiRegionCorrectionWithOutCode(box, intersection, seg, sphereRadius, topVeronoiOutCodePt2, rightVeronoiOutCodePt2, forwardVeronoiOutCodePt2, false);
+                applyVeronoiRegionCorrectionWithOutCode(box, intersection, seg, sphereRadius, topVeronoiOutCodePt1, rightVeronoiOutCodePt1, forwardVeronoiOutCodePt1, true);
+            }
+        } 
+        else if (intersection.intersectionType == EIntersectionType::InfinyIntersection)
+        {
+            int topVeronoiOutCodeSegPt1 = getTopVeronoiFace(box, sphereRadius).isPointInsideQuadZoneOutCode(seg.getPt1());
+            int rightVeronoiOutCodeSegPt1 = getRightVeronoiFace(box, sphereRadius).isPointInsideQuadZoneOutCode(seg.getPt1());
+            int forwardVeronoiOutCodeSegPt1 = getFowardVeronoiFace(box, sphereRadius).isPointInsideQuadZoneOutCode(seg.getPt1());
+
+            if (!(topVeronoiOutCodeSegPt1 == QUAD_OUTCODE_INSIDE || rightVeronoiOutCodeSegPt1 == QUAD_OUTCODE_INSIDE || forwardVeronoiOutCodeSegPt1 == QUAD_OUTCODE_INSIDE))
+            {
+                if (applyVeronoiRegionCorrectionWithOutCode(box, intersection, seg, sphereRadius, topVeronoiOutCodeSegPt1, rightVeronoiOutCodeSegPt1, forwardVeronoiOutCodeSegPt1, true))
+                {
+                    intersection.intersectionType = EIntersectionType::OneIntersectiont;
+                }
+                else
+                {
+                    intersection.intersectionType = EIntersectionType::NoIntersection;
+                }
+            }
+        }     
+    }
+
+    inline bool MovingSphereOrientedBox::applyVeronoiRegionCorrectionWithOutCode(const OrientedBox& box, Intersection& intersection, const Segment& seg, float sphereRadius, int topOutCode, int rightOutCode, int forwardOutCode, bool checkFirstIntersection)
+    {
+        if (topOutCode == QUAD_OUTCODE_INSIDE || rightOutCode == QUAD_OUTCODE_INSIDE || forwardOutCode == QUAD_OUTCODE_INSIDE)
+        {
+            return true;
+        }
+
+        /*Outside on the 3 axis : vertex region*/
+        if ((topOutCode & (QUAD_OUTCODE_LEFT | QUAD_OUTCODE_RIGHT)) && (topOutCode & (QUAD_OUTCODE_TOP | QUAD_OUTCODE_BOTTOM)) && (forwardOutCode & (QUAD_OUTCODE_TOP | QUAD_OUTCODE_BOTTOM)))
+        {
+            const bool isOnTop      = (forwardOutCode & QUAD_OUTCODE_TOP) == QUAD_OUTCODE_TOP;
+            const bool isOnRight    = (topOutCode & QUAD_OUTCODE_RIGHT) == QUAD_OUTCODE_RIGHT;
+            const bool isOnForward  = (topOutCode & QUAD_OUTCODE_TOP) == QUAD_OUTCODE_TOP;
+
+            const Capsule edgeCapsules[3] {
+                isOnTop ? (isOnForward ? getTopForwardVeronoiCapsule(box, sphereRadius) : getTopBackwardVeronoiCapsule(box, sphereRadius))
+                        : (isOnForward ? getBottomForwardVeronoiCapsule(box, sphereRadius) : getBottomBackwardVeronoiCapsule(box, sphereRadius)),
+                isOnRight ? (isOnForward ? getRightForwardVeronoiCapsule(box, sphereRadius) : getRightBackwardVeronoiCapsule(box, sphereRadius))
+                          : (isOnForward ? getLeftForwardVeronoiCapsule(box, sphereRadius) : getLeftBackwardVeronoiCapsule(box, sphereRadius)),
+                isOnTop ? (isOnRight ? getTopRightVeronoiCapsule(box, sphereRadius) : getTopLeftVeronoiCapsule(box, sphereRadius))
+                        : (isOnRight ? getBottomRightVeronoiCapsule(box, sphereRadius) : getBottomLeftVeronoiCapsule(box, sphereRadius))};
+
+            return applyVertexCapsuleCorrection(seg, edgeCapsules, intersection, checkFirstIntersection);
+        }
+
+        if ((forwardOutCode & QUAD_OUTCODE_TOP) == QUAD_OUTCODE_TOP)
+        {
+            if ((topOutCode & QUAD_OUTCODE_TOP) == QUAD_OUTCODE_TOP)
+            {
+                return applyCapsuleCorrection(seg, getTopForwardVeronoiCapsule(box, sphereRadius), intersection, checkFirstIntersection);
+            }
+            else if ((topOutCode & QUAD_OUTCODE_BOTTOM) == QUAD_OUTCODE_BOTTOM)
+            {
+                return applyCapsuleCorrection(seg, getTopBackwardVeronoiCapsule(box, sphereRadius), intersection, checkFirstIntersection);
+            }
+            else if ((topOutCode & QUAD_OUTCODE_LEFT) == QUAD_OUTCODE_LEFT)
+            {
+                return applyCapsuleCorrection(seg, getTopLeftVeronoiCapsule(box, sphereRadius), intersection, checkFirstIntersection);
+            }
+            else
+            {               
+                return applyCapsuleCorrection(seg, getTopRightVeronoiCapsule(box, sphereRadius), intersection, checkFirstIntersection);
+            }
+        }
+        else if ((forwardOutCode& QUAD_OUTCODE_BOTTOM) == QUAD_OUTCODE_BOTTOM)
+        {
+            if ((topOutCode & QUAD_OUTCODE_TOP) == QUAD_OUTCODE_TOP)
+            {
+                return applyCapsuleCorrection(seg, getBottomForwardVeronoiCapsule(box, sphereRadius), intersection, checkFirstIntersection);
+            }
+            else if ((topOutCode & QUAD_OUTCODE_BOTTOM) == QUAD_OUTCODE_BOTTOM)
+            {
+                return applyCapsuleCorrection(seg, getBottomBackwardVeronoiCapsule(box, sphereRadius), intersection, checkFirstIntersection);
+            }
+            else if ((topOutCode & QUAD_OUTCODE_LEFT) == QUAD_OUTCODE_LEFT)
+            {
+                return applyCapsuleCorrection(seg, getBottomLeftVeronoiCapsule(box, sphereRadius), intersection, checkFirstIntersection);
+            }
+            else
+            {
+                return applyCapsuleCorrection(seg, getBottomRightVeronoiCapsule(box, sphereRadius), intersection, checkFirstIntersection);
+            }
+        }
+        else /*On the center*/
+        {
+            if ((topOutCode & (QUAD_OUTCODE_TOP | QUAD_OUTCODE_LEFT)) == QUAD_OUTCODE_TOP + QUAD_OUTCODE_LEFT)
+            {
+                return applyCapsuleCorrection(seg, getLeftForwardVeronoiCapsule(box, sphereRadius), intersection, checkFirstIntersection);
+            }
+            else if ((topOutCode & (QUAD_OUTCODE_TOP | QUAD_OUTCODE_RIGHT)) == QUAD_OUTCODE_TOP + QUAD_OUTCODE_RIGHT)
+            {
+                return applyCapsuleCorrection(seg, getRightForwardVeronoiCapsule(box, sphereRadius), intersection, checkFirstIntersection);
+            }
+            else if ((topOutCode & (QUAD_OUTCODE_BOTTOM | QUAD_OUTCODE_LEFT)) == QUAD_OUTCODE_BOTTOM + QUAD_OUTCODE_LEFT)
+            {
+                return applyCapsuleCorrection(seg, getLeftBackwardVeronoiCapsule(box, sphereRadius), intersection, checkFirstIntersection);
+            }
+            else
+            {
+                return applyCapsuleCorrection(seg, getRightBackwardVeronoiCapsule(box, sphereRadius), intersection, checkFirstIntersection);
+            }
+        }
+    }
+
+    inline bool MovingSphereOrientedBox::applyCapsuleCorrection(const Segment& seg, const Capsule& _capsule, Intersection& intersection, bool checkFirstIntersection)
+    {
+        Intersection shapeIntersection;
+        if (SegmentCapsule::isSegmentCapsuleCollided(seg, _capsule, shapeIntersection))
+        {
+            if (checkFirstIntersection)
+            {
+                intersection.intersection1 = shapeIntersection.intersection1;
+                intersection.normalI1 = shapeIntersection.normalI1;
+            }
+            else
+            {
+                intersection.intersection2 = shapeIntersection.intersection2;
+                intersection.normalI2 = shapeIntersection.normalI2;
+            }
+            return true;
+        }
+        else
+        {
+            if (checkFirstIntersection)
+            {
+                intersection.removeFirstIntersection();
+            }
+            else
+            {
+                intersection.removeSecondIntersection();
+            }
+        return false;
+        }
+    }
+
+    inline bool MovingSphereOrientedBox::applyVertexCapsuleCorrection(const Segment& seg, const Capsule (&edgeCapsules)[3], Intersection& intersection, bool checkFirstIntersection)
+    {
+        bool isCollided = false;
+        float bestSquareDistance = 0.f;
+        Vec3f bestPoint, bestNormal;
+
+        for (const Capsule& capsule : edgeCapsules)
+        {
+            Intersection shapeIntersection;
+            if (!SegmentCapsule::isSegmentCapsuleCollided(seg, capsule, shapeIntersection))
+                continue;
+
+            const size_t count = shapeIntersection.intersectionType == EIntersectionType::TwoIntersectiont ? 2 : 1;
+            for (size_t i = 0; i < count; ++i)
+            {
+                const Vec3f& point = i == 0 ? shapeIntersection.intersection1 : shapeIntersection.intersection2;
+                const float squareDistance = (point - seg.getPt1()).squareLength();
+
+                if (!isCollided || (checkFirstIntersection ? squareDistance < bestSquareDistance : squareDistance > bestSquareDistance))
+                {
+                    isCollided = true;
+                    bestSquareDistance = squareDistance;
+                    bestPoint = point;
+                    bestNormal = i == 0 ? shapeIntersection.normalI1 : shapeIntersection.normalI2;
+                }
+            }
+        }
+
+        if (!isCollided)
+        {
+            if (checkFirstIntersection)
+            {
+                intersection.removeFirstIntersection();
+            }
+            else
+            {
+                intersection.removeSecondIntersection();
+            }
+            return false;
+        }
+
+        if (checkFirstIntersection)
+        {
+            intersection.intersection1 = bestPoint;
+            intersection.normalI1 = bestNormal;
+        }
+        else
+        {
+            intersection.intersection2 = bestPoint;
+            intersection.normalI2 = bestNormal;
+        }
+        return true;
+    }
+
+
+    inline Capsule MovingSphereOrientedBox::getTopLeftVeronoiCapsule(const OrientedBox& box, float sphereRadius)
+    {
+        Vec3f capsuleCenter = box.getReferential().origin - box.getReferential().unitI * box.getExtI() + box.getReferential().unitJ * box.getExtJ();
+        return Capsule{capsuleCenter, box.getReferential().unitK, box.getExtK() * 2.f, sphereRadius};
+    }
+
+    inline Capsule MovingSphereOrientedBox::getTopRightVeronoiCapsule(const OrientedBox& box, float sphereRadius)
+    {
+        Vec3f capsuleCenter = box.getReferential().origin + box.getReferential().unitI * box.getExtI() + box.getReferential().unitJ * box.getExtJ();  
+        return Capsule{capsuleCenter, box.getReferential().unitK, box.getExtK()* 2.f, sphereRadius};
+    }
+
+    inline Capsule MovingSphereOrientedBox::getTopForwardVeronoiCapsule(const OrientedBox& box, float sphereRadius)
+    {
+        Vec3f capsuleCenter = box.getReferential().origin + box.getReferential().unitK * box.getExtK() + box.getReferential().unitJ * box.getExtJ();
+        return Capsule{capsuleCenter, box.getReferential().unitI, box.getExtI() * 2.f, sphereRadius};
+    }
+
+    inline Capsule MovingSphereOrientedBox::getTopBackwardVeronoiCapsule(const OrientedBox& box, float sphereRadius)
+    {
+        Vec3f capsuleCenter = box.getReferential().origin - box.getReferential().unitK * box.getExtK() + box.getReferential().unitJ * box.getExtJ();
+        return Capsule{capsuleCenter, box.getReferential().unitI, box.getExtI() * 2.f, sphereRadius};
+    }
+
+    inline Capsule MovingSphereOrientedBox::getBottomLeftVeronoiCapsule(const OrientedBox& box, float sphereRadius)
+    {
+        Vec3f capsuleCenter = box.getReferential().origin - box.getReferential().unitI * box.getExtI() - box.getReferential().unitJ * box.getExtJ();
+        return Capsule{capsuleCenter, box.getReferential().unitK, box.getExtK() * 2.f, sphereRadius};
+    }
+
+    inline Capsule MovingSphereOrientedBox::getBottomRightVeronoiCapsule(const OrientedBox& box, float sphereRadius)
+    {
+        Vec3f capsuleCenter = box.getReferential().origin + box.getReferential().unitI * box.getExtI() - box.getReferential().unitJ * box.getExtJ();
+        return Capsule{capsuleCenter, box.getReferential().unitK, box.getExtK() * 2.f, sphereRadius};
+    }
+
+    inline Capsule MovingSphereOrientedBox::getBottomForwardVeronoiCapsule(const OrientedBox& box, float sphereRadius)
+    {
+        Vec3f capsuleCenter = box.getReferential().origin + box.getReferential().unitK * box.getExtK() - box.getReferential().unitJ * box.getExtJ();
+        return Capsule{capsuleCenter, box.getReferential().unitI, box.getExtI() * 2.f, sphereRadius};
+    }
+
+    inline Capsule MovingSphereOrientedBox::getBottomBackwardVeronoiCapsule(const OrientedBox& box, float sphereRadius)
+    {
+        Vec3f capsuleCenter = box.getReferential().origin - box.getReferential().unitK * box.getExtK() - box.getReferential().unitJ * box.getExtJ();
+        return Capsule{capsuleCenter, box.getReferential().unitI, box.getExtI() * 2.f, sphereRadius};
+    }
+
+    inline Capsule MovingSphereOrientedBox::getLeftForwardVeronoiCapsule(const OrientedBox& box, float sphereRadius)
+    {
+        Vec3f capsuleCenter = box.getReferential().origin - box.getReferential().unitI * box.getExtI() + box.getReferential().unitK * box.getExtK();
+        return Capsule{capsuleCenter, box.getReferential().unitJ, box.getExtJ() * 2.f, sphereRadius};
+    }
+
+    inline Capsule MovingSphereOrientedBox::getLeftBackwardVeronoiCapsule(const OrientedBox& box, float sphereRadius)
+    {
+        Vec3f capsuleCenter = box.getReferential().origin - box.getReferential().unitI * box.getExtI() - box.getReferential().unitK * box.getExtK();
+        return Capsule{capsuleCenter, box.getReferential().unitJ, box.getExtJ() * 2.f, sphereRadius};
+    }
+
+    inline Capsule MovingSphereOrientedBox::getRightForwardVeronoiCapsule(const OrientedBox& box, float sphereRadius)
+    {
+        Vec3f capsuleCenter = box.getReferential().origin + box.getReferential().unitI * box.getExtI() + box.getReferential().unitK * box.getExtK();
+        return Capsule{capsuleCenter, box.getReferential().unitJ, box.getExtJ() * 2.f, sphereRadius};
+    }
+
+    inline Capsule MovingSphereOrientedBox::getRightBackwardVeronoiCapsule(const OrientedBox& box, float sphereRadius)
+    {
+        Vec3f capsuleCenter = box.getReferential().origin + box.getReferential().unitI * box.getExtI() - box.getReferential().unitK * box.getExtK();
+        return Capsule{capsuleCenter, box.getReferential().unitJ, box.getExtJ() * 2.f, sphereRadius};
+    }
+
+    inline Quad MovingSphereOrientedBox::getTopVeronoiFace (const OrientedBox& box, float sphereRadius)
+    {
+        Referentialf quadRef = box.getReferential();
+        quadRef.origin += box.getReferential().unitJ * (sphereRadius + box.getExtJ());
+        quadRef.unitJ = box.getReferential().unitK;
+        quadRef.unitK = box.getReferential().unitJ;
+        return Quad{quadRef, box.getExtI(), box.getExtK()};
+    }
+
+    inline Quad MovingSphereOrientedBox::getBottomVeronoiFace(const OrientedBox& box, float sphereRadius)
+    {
+        Referentialf quadRef = box.getReferential();
+        quadRef.origin -= box.getReferential().unitJ * (sphereRadius + box.getExtJ());
+        quadRef.unitJ = -box.getReferential().unitK;
+        quadRef.unitK = -box.getReferential().unitJ;
+        return Quad{quadRef, box.getExtI(), box.getExtK()};
+    }
+
+    inline Quad MovingSphereOrientedBox::getRightVeronoiFace(const OrientedBox& box, float sphereRadius)
+    {
+        Referentialf quadRef = box.getReferential();
+        quadRef.origin += box.getReferential().unitI * (sphereRadius + box.getExtI());
+
+        quadRef.unitI = -box.getReferential().unitK;
+        quadRef.unitK = box.getReferential().unitI;
+
+        return Quad{quadRef, box.getExtK(), box.getExtJ()};
+    }
+
+    inline Quad MovingSphereOrientedBox::getLeftVeronoiFace(const OrientedBox& box, float sphereRadius)
+    {
+        Referentialf quadRef = box.getReferential();
+        quadRef.origin -= box.getReferential().unitI * (sphereRadius + box.getExtI());
+
+        quadRef.unitI = box.getReferential().unitK;
+        quadRef.unitK = -box.getReferential().unitI;
+
+        return Quad{quadRef, box.getExtK(), box.getExtJ()};
+    }
+
+    inline Quad MovingSphereOrientedBox::getFowardVeronoiFace(const OrientedBox& box, float sphereRadius)
+    {
+        Referentialf quadRef = box.getReferential();
+        quadRef.origin += box.getReferential().unitK * (sphereRadius + box.getExtK());
+        return Quad{quadRef, box.getExtI(), box.getExtJ()};
+    }
+
+    inline Quad MovingSphereOrientedBox::getBackwardVeronoiFace(const OrientedBox& box, float sphereRadius)
+    {
+        Referentialf quadRef = box.getReferential();
+
+        quadRef.origin -= box.getReferential().unitK * (sphereRadius + box.getExtK());
+        quadRef.unitI = -box.getReferential().unitI;
+        quadRef.unitK = -box.getReferential().unitK;
+
+        return Quad{quadRef, box.getExtI(), box.getExtJ()};
+    }
+
+    inline bool MovingSphereOrientedBox::isMovingSphereOrientedBoxCollided(const Sphere& sphere, const OrientedBox& box, const Vec3f& sphereVelocity)
+    {
+        const Referentialf referential = box.getReferential();
+        const float radius = sphere.getRadius();
+        const float ext[3] {box.getExtI(), box.getExtJ(), box.getExtK()};
+
+        /*Path of the sphere center in the local referential of the box*/
+        const Vec3f localPt1 = Referentialf::globalToLocalPosition(referential, sphere.getCenter());
+        const Vec3f localVelocity = Referentialf::globalToLocalVector(referential, sphereVelocity);
+
+        /*Step 1 : slab test with the box extended by the radius*/
+        float tMin = 0.f;
+        float tMax = 1.f;
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            const float extendedExt = ext[i] + radius;
+
+            if (std::abs(localVelocity[i]) <= std::numeric_limits<float>::epsilon())
+            {
+                if (std::abs(localPt1[i]) > extendedExt)
+                    return false;
+
+                continue;
+            }
+
+            float invVelocity = 1.f / localVelocity[i];
+            float t0 = (-extendedExt - localPt1[i]) * invVelocity;
+            float t1 = (extendedExt - localPt1[i]) * invVelocity;
+
+            if (t0 > t1)
+                std::swap(t0, t1);
+
+            tMin = std::max(tMin, t0);
+            tMax = std::min(tMax, t1);
+
+            if (tMin > tMax)
+                return false;
+        }
+
+        /*Step 2 : veronoi region of the entry point. Outside on 0 or 1 axis, the point is on the rounded box*/
+        const Vec3f entry = localPt1 + localVelocity * tMin;
+        float corner[3];
+        int outsideMask = 0;
+        int outsideCount = 0;
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            corner[i] = entry[i] < 0.f ? -ext[i] : ext[i];
+
+            if (std::abs(entry[i]) > ext[i])
+            {
+                outsideMask |= 1 << i;
+                ++outsideCount;
+            }
+        }
+
+        if (outsideCount <= 1)
+            return true;
+
+        /*Step 3 : edge region test the capsule of the edge, vertex region test the capsules of the 3 edges of the vertex*/
+        const Vec3f localPt2 = localPt1 + localVelocity;
+        const float squareRadius = radius * radius;
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            if (outsideCount != 3 && (outsideMask & (1 << i)))
+                continue;
+
+            float edgePt1[3] {corner[0], corner[1], corner[2]};
+            float edgePt2[3] {corner[0], corner[1], corner[2]};
+            edgePt1[i] = -ext[i];
+            edgePt2[i] = ext[i];
+
+            if (SegmentSegment::getSquareDistance(localPt1, localPt2, Vec3f{edgePt1[0], edgePt1[1], edgePt1[2]}, Vec3f{edgePt2[0], edgePt2[1], edgePt2[2]}) <= squareRadius)
+                return true;
+        }
+
+        return false;
+    }
+
 } /*namespace FoxMath*/
 
 #endif //_MOVING_SPHERE_ORIENTED_BOX_H
\ No newline at end of file
@@ -6,10 +6,22 @@
 #define _ORIENTED_BOX_ORIENTED_BOX_H
 
 #include "ShapeRelation/Intersection.hpp"
-#include "GE/Core/Maths/Shape3D/OrientedBox.hpp"
+#include "Shape3D/OrientedBox.hpp"
+#include "Vector/Vector.hpp"
+
+#include <cmath>
+#include <limits>
 
 namespace FoxMath
 {
+    /*Minimum penetration between two oriented boxes found with the separating axis test*/
+    struct OrientedBoxPenetration
+    {
+        Vec3f   normal  {Vec3f::zero};  /*unit vector in global referential from box1 to box2*/
+        float   depth   {0.f};          /*overlap of both boxes along normal*/
+        int     axis    {-1};           /*index of the axis, see OrientedBoxOrientedBox::SAT_AXIS_COUNT*/
+    };
+
     class OrientedBoxOrientedBox
     {
         public:
@@ -25,19 +37,256 @@ namespace FoxMath
 
         #pragma endregion //!constructor/destructor
 
+        #pragma region static attribut
+
+        /*0-2 : unitI, unitJ, unitK of box1. 3-5 : unitI, unitJ, unitK of box2. 6-14 : cross(box1 unit (axis - 6) / 3, box2 unit (axis - 6) % 3)*/
+        static constexpr int SAT_AXIS_COUNT = 15;
+
+        #pragma endregion //!static attribut
+
         #pragma region static methods
 
         static bool isBothOrientedBoxCollided(const OrientedBox& box1, const OrientedBox& box2);
 
+        /*Test the 15 axis and return the axis of minimum penetration*/
+        static bool isBothOrientedBoxCollided(const OrientedBox& box1, const OrientedBox& box2, OrientedBoxPenetration& penetration);
+
+        /*separatingAxis is tested first, set it to -1 if unknow. Is replaced by the separating axis found (or by the axis of minimum penetration with penetration).
+        Keep it between frames for the same pair (see SeparatingAxisCache) : most of separated pairs stay separated by the same axis and exit after one axis*/
+        static bool isBothOrientedBoxCollided(const OrientedBox& box1, const OrientedBox& box2, int& separatingAxis);
+
+        static bool isBothOrientedBoxCollided(const OrientedBox& box1, const OrientedBox& box2, int& separatingAxis, OrientedBoxPenetration& penetration);
+
+        /*Index of the same axis if box1 and box2 are swapped*/
+        static int getSwappedAxis(int axis);
+
         #pragma endregion //!static methods
 
         private :
 
+        /*Box2 expressed in the referential of box1*/
+        struct SATFrame
+        {
+            float rotation      [3][3]; /*dot(box1 unit i, box2 unit j)*/
+            float absRotation   [3][3]; /*abs(rotation) + epsilon : cross product of parallel edges is never a separating axis*/
+            float translation   [3];    /*center of box2*/
+            float ext1          [3];
+            float ext2          [3];
+        };
+
         #pragma region static methods
 
+        static SATFrame getSATFrame(const Referentialf& referential1, const OrientedBox& box1, const Referentialf& referential2, const OrientedBox& box2);
+
+        /*Return abs(centerDistance) - (radius1 + radius2) with the axis not normalized : the boxes are separated if the result is positive.
+        centerDistance is the projection of the center of box2 and squareAxisLength is the square length of the axis*/
+        static float getAxisSeparation(const SATFrame& frame, int axis, float& centerDistance, float& squareAxisLength);
+
+        /*Same in global referential without the frame, used for the cached axis only*/
+        static float getAxisSeparation(const Referentialf& referential1, const OrientedBox& box1, const Referentialf& referential2, const OrientedBox& box2, int axis);
+
+        static Vec3f getGlobalAxis(const Referentialf& referential1, const Referentialf& referential2, int axis);
+
         #pragma endregion //!static methods
     };
 
+    inline bool OrientedBoxOrientedBox::isBothOrientedBoxCollided(const OrientedBox& box1, const OrientedBox& box2)
+    {
+        int separatingAxis = -1;
+        return isBothOrientedBoxCollided(box1, box2, separatingAxis);
+    }
+
+    inline bool OrientedBoxOrientedBox::isBothOrientedBoxCollided(const OrientedBox& box1, const OrientedBox& box2, OrientedBoxPenetration& penetration)
+    {
+        int separatingAxis = -1;
+        return isBothOrientedBoxCollided(box1, box2, separatingAxis, penetration);
+    }
+
+    inline bool OrientedBoxOrientedBox::isBothOrientedBoxCollided(const OrientedBox& box1, const OrientedBox& box2, int& separatingAxis)
+    {
+        const Referentialf referential1 = box1.getReferential();
+        const Referentialf referential2 = box2.getReferential();
+
+        /*Coherence : the last separating axis is the most likely. Test it before computing the whole frame*/
+        if (separatingAxis >= 0 && separatingAxis < SAT_AXIS_COUNT && getAxisSeparation(referential1, box1, referential2, box2, separatingAxis) > 0.f)
+            return false;
+
+        const SATFrame frame = getSATFrame(referential1, box1, referential2, box2);
+        float centerDistance, squareAxisLength;
+
+        for (int axis = 0; axis < SAT_AXIS_COUNT; ++axis)
+        {
+            if (axis != separatingAxis && getAxisSeparation(frame, axis, centerDistance, squareAxisLength) > 0.f)
+            {
+                separatingAxis = axis;
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    inline bool OrientedBoxOrientedBox::isBothOrientedBoxCollided(const OrientedBox& box1, const OrientedBox& box2, int& separatingAxis, OrientedBoxPenetration& penetration)
+    {
+        const Referentialf referential1 = box1.getReferential();
+        const Referentialf referential2 = box2.getReferential();
+
+        /*Coherence : the last separating axis is the most likely. Test it before computing the whole frame*/
+        if (separatingAxis >= 0 && separatingAxis < SAT_AXIS_COUNT && getAxisSeparation(referential1, box1, referential2, box2, separatingAxis) > 0.f)
+            return false;
+
+        const SATFrame frame = getSATFrame(referential1, box1, referential2, box2);
+        float centerDistance, squareAxisLength;
+
+        int     minAxis             = -1;
+        float   minDepth            = std::numeric_limits<float>::max();
+        float   minCenterDistance   = 0.f;
+
+        for (int axis = 0; axis < SAT_AXIS_COUNT; ++axis)
+        {
+            float separation = getAxisSeparation(frame, axis, centerDistance, squareAxisLength);
+
+            if (separation > 0.f)
+            {
+                separatingAxis = axis;
+                return false;
+            }
+
+            /*Cross product of parallel edges : no direction*/
+            if (squareAxisLength <= std::numeric_limits<float>::epsilon())
+                continue;
+
+            /*Face axis are tested first and keeped at equal depth*/
+            float depth = -separation / std::sqrt(squareAxisLength);
+            if (depth < minDepth)
+            {
+                minAxis             = axis;
+                minDepth            = depth;
+                minCenterDistance   = centerDistance;
+            }
+        }
+
+        separatingAxis      = minAxis;
+        penetration.axis    = minAxis;
+        penetration.depth   = minDepth;
+        penetration.normal  = getGlobalAxis(referential1, referential2, minAxis).getNormalized();
+
+        if (minCenterDistance < 0.f)
+            penetration.normal = -penetration.normal;
+
+        return true;
+    }
+
+    inline int OrientedBoxOrientedBox::getSwappedAxis(int axis)
+    {
+        if (axis < 0)
+            return axis;
+
+        if (axis < 6)
+            return (axis + 3) % 6;
+
+        /*cross(b, a) = -cross(a, b) : same axis*/
+        return 6 + ((axis - 6) % 3) * 3 + (axis - 6) / 3;
+    }
+
+    inline OrientedBoxOrientedBox::SATFrame OrientedBoxOrientedBox::getSATFrame(const Referentialf& referential1, const OrientedBox& box1, const Referentialf& referential2, const OrientedBox& box2)
+    {
+        const Vec3f units1[3] {referential1.unitI, referential1.unitJ, referential1.unitK};
+        const Vec3f units2[3] {referential2.unitI, referential2.unitJ, referential2.unitK};
+        const Vec3f centerToCenter = referential2.origin - referential1.origin;
+
+        SATFrame frame;
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            for (size_t j = 0; j < 3; ++j)
+            {
+                frame.rotation[i][j]    = Vec3f::dot(units1[i], units2[j]);
+                frame.absRotation[i][j] = std::abs(frame.rotation[i][j]) + std::numeric_limits<float>::epsilon();
+            }
+
+            frame.translation[i] = Vec3f::dot(centerToCenter, units1[i]);
+        }
+
+        frame.ext1[0] = box1.getExtI();
+        frame.ext1[1] = box1.getExtJ();
+        frame.ext1[2] = box1.getExtK();
+        frame.ext2[0] = box2.getExtI();
+        frame.ext2[1] = box2.getExtJ();
+        frame.ext2[2] = box2.getExtK();
+
+        return frame;
+    }
+
+    inline float OrientedBoxOrientedBox::getAxisSeparation(const SATFrame& frame, int axis, float& centerDistance, float& squareAxisLength)
+    {
+        float radius1, radius2;
+
+        if (axis < 3)
+        {
+            /*Face of box1*/
+            const int i = axis;
+            radius1 = frame.ext1[i];
+            radius2 = frame.ext2[0] * frame.absRotation[i][0] + frame.ext2[1] * frame.absRotation[i][1] + frame.ext2[2] * frame.absRotation[i][2];
+            centerDistance = frame.translation[i];
+            squareAxisLength = 1.f;
+        }
+        else if (axis < 6)
+        {
+            /*Face of box2*/
+            const int j = axis - 3;
+            radius1 = frame.ext1[0] * frame.absRotation[0][j] + frame.ext1[1] * frame.absRotation[1][j] + frame.ext1[2] * frame.absRotation[2][j];
+            radius2 = frame.ext2[j];
+            centerDistance = frame.translation[0] * frame.rotation[0][j] + frame.translation[1] * frame.rotation[1][j] + frame.translation[2] * frame.rotation[2][j];
+            squareAxisLength = 1.f;
+        }
+        else
+        {
+            /*Edge of box1 cross edge of box2. In box1 referential the axis is (0, -rotation[i2][j], rotation[i1][j]) rolled on i*/
+            const int i = (axis - 6) / 3, i1 = (i + 1) % 3, i2 = (i + 2) % 3;
+            const int j = (axis - 6) % 3, j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+            radius1 = frame.ext1[i1] * frame.absRotation[i2][j] + frame.ext1[i2] * frame.absRotation[i1][j];
+            radius2 = frame.ext2[j1] * frame.absRotation[i][j2] + frame.ext2[j2] * frame.absRotation[i][j1];
+            centerDistance = frame.translation[i2] * frame.rotation[i1][j] - frame.translation[i1] * frame.rotation[i2][j];
+            squareAxisLength = frame.rotation[i1][j] * frame.rotation[i1][j] + frame.rotation[i2][j] * frame.rotation[i2][j];
+        }
+
+        return std::abs(centerDistance) - (radius1 + radius2);
+    }
+
+    inline float OrientedBoxOrientedBox::getAxisSeparation(const Referentialf& referential1, const OrientedBox& box1, const Referentialf& referential2, const OrientedBox& box2, int axis)
+    {
+        const Vec3f globalAxis = getGlobalAxis(referential1, referential2, axis);
+
+        /*Cross product of parallel edges : no direction*/
+        if (globalAxis.squareLength() <= std::numeric_limits<float>::epsilon())
+            return 0.f;
+
+        float radius1 =   box1.getExtI() * std::abs(Vec3f::dot(globalAxis, referential1.unitI))
+                        + box1.getExtJ() * std::abs(Vec3f::dot(globalAxis, referential1.unitJ))
+                        + box1.getExtK() * std::abs(Vec3f::dot(globalAxis, referential1.unitK));
+
+        float radius2 =   box2.getExtI() * std::abs(Vec3f::dot(globalAxis, referential2.unitI))
+                        + box2.getExtJ() * std::abs(Vec3f::dot(globalAxis, referential2.unitJ))
+                        + box2.getExtK() * std::abs(Vec3f::dot(globalAxis, referential2.unitK));
+
+        return std::abs(Vec3f::dot(globalAxis, referential2.origin - referential1.origin)) - (radius1 + radius2);
+    }
+
+    inline Vec3f OrientedBoxOrientedBox::getGlobalAxis(const Referentialf& referential1, const Referentialf& referential2, int axis)
+    {
+        const Vec3f units1[3] {referential1.unitI, referential1.unitJ, referential1.unitK};
+        const Vec3f units2[3] {referential2.unitI, referential2.unitJ, referential2.unitK};
+
+        if (axis < 3)
+            return units1[axis];
+
+        if (axis < 6)
+            return units2[axis - 3];
+
+        return Vec3f::cross(units1[(axis - 6) / 3], units2[(axis - 6) % 3]);
+    }
+
 } /*namespace FoxMath*/
 
 #endif //_ORIENTED_BOX_ORIENTED_BOX_H
\ No newline at end of file
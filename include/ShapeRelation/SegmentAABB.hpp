@@ -9,6 +9,12 @@
 #include "ShapeRelation/Intersection.hpp"
 #include "Shape3D/Segment.hpp"
 #include "Shape3D/AABB.hpp"
+#include "Numeric/MathTools.hpp"
+
+#include <limits>
+#include <algorithm>
+#include <cmath>
+#include <utility>
 
 namespace FoxMath
 {
@@ -31,6 +37,9 @@ namespace FoxMath
 
         static bool isSegmentAABBCollided(const Segment& seg, const AABB& AABB, Intersection& intersection);
 
+        /*Overlap only with slab test : no intersection point or normal. See SegmentAABBBatch for packets of AABB*/
+        static bool isSegmentAABBCollided(const Segment& seg, const AABB& AABB);
+
         #pragma endregion //!static methods
 
         private :
@@ -38,11 +47,150 @@ namespace FoxMath
         #pragma region static methods
 
         /*memorise with temporal float the value of T. Compare this value to the new T and compute the nearest point af seg.pt1*/
-        static bool addIntersectionWithScalerIfOnAABBAndReturnIfFull(const Segment& seg, const AABB& AABB, Intersection& intersection, float scaler, float& tempT, Vec3 faceNormal);
+        static bool addIntersectionWithScalerIfOnAABBAndReturnIfFull(const Segment& seg, const AABB& AABB, Intersection& intersection, float scaler, float& tempT, Vec3f faceNormal);
 
         #pragma endregion //!static methods
     };
 
+    inline bool SegmentAABB::isSegmentAABBCollided(const Segment& seg, const AABB& AABB, Intersection& intersection)
+    {
+        Vec3f AB = seg.getPt2() - seg.getPt1();
+        float tx0, tx1, ty0, ty1, tz0, tz1, tempT;
+        tempT = 1.f; // memorise with temporal float the value of T. Compare this value to the new T and compute the nearest point af seg.pt1
+
+        intersection.intersectionType = EIntersectionType::NoIntersection;
+
+        if (!isBetween(AB.getX(), -std::numeric_limits<float>::epsilon(), std::numeric_limits<float>::epsilon()))
+        {
+            float invABX = 1.f / AB.getX();
+            tx0 = (AABB.getExtI() - seg.getPt1().getX() + AABB.getCenter().getX()) * invABX;
+            tx1 = (-AABB.getExtI() - seg.getPt1().getX() + AABB.getCenter().getX()) * invABX;
+
+            addIntersectionWithScalerIfOnAABBAndReturnIfFull(seg, AABB, intersection, tx0, tempT, Vec3f::right);
+
+            if (addIntersectionWithScalerIfOnAABBAndReturnIfFull(seg, AABB, intersection, tx1, tempT, Vec3f::left))
+            {
+                return true;
+            }
+        }
+
+        if (!isBetween(AB.getY(), -std::numeric_limits<float>::epsilon(), std::numeric_limits<float>::epsilon()))
+        {
+            float invABY = 1.f / AB.getY();
+            ty0 = (AABB.getExtJ() - seg.getPt1().getY() + AABB.getCenter().getY()) * invABY;
+            ty1 = (-AABB.getExtJ() - seg.getPt1().getY() + AABB.getCenter().getY()) * invABY;
+
+            if (addIntersectionWithScalerIfOnAABBAndReturnIfFull(seg, AABB, intersection, ty0, tempT, Vec3f::up))
+            {
+                return true;
+            }
+
+            if (addIntersectionWithScalerIfOnAABBAndReturnIfFull(seg, AABB, intersection, ty1, tempT, Vec3f::down))
+            {
+                return true;
+            }
+        }
+
+        if (!isBetween(AB.getZ(), -std::numeric_limits<float>::epsilon(), std::numeric_limits<float>::epsilon()))
+        {
+            float invABZ = 1.f / AB.getZ();
+            tz0 = (AABB.getExtK() - seg.getPt1().getZ() + AABB.getCenter().getZ()) * invABZ;
+            tz1 = (-AABB.getExtK() - seg.getPt1().getZ() + AABB.getCenter().getZ()) * invABZ;
+
+            if (addIntersectionWithScalerIfOnAABBAndReturnIfFull(seg, AABB, intersection, tz0, tempT, Vec3f::forward))
+            {
+                return true;
+            }
+
+            if (addIntersectionWithScalerIfOnAABBAndReturnIfFull(seg, AABB, intersection, tz1, tempT, Vec3f::backward))
+            {
+                return true;
+            }
+        }
+
+        if (intersection.intersectionType != EIntersectionType::OneIntersectiont)
+        {
+            /*Check if segment is inside*/
+            if (AABB.isInside(seg.getPt1()) && AABB.isInside(seg.getPt2()))
+            {
+                intersection.intersectionType = EIntersectionType::InfinyIntersection;
+                return true;
+            }
+            return false;
+        }
+        return true;
+    }
+
+    inline bool SegmentAABB::addIntersectionWithScalerIfOnAABBAndReturnIfFull(const Segment& seg, const AABB& AABB, Intersection& intersection, float scaler, float& tempT, Vec3f faceNormal)
+    {
+        if (isBetween(scaler, 0.f, 1.f))
+        {
+            Vec3f pt = seg.getPt1() + (scaler * (seg.getPt2() - seg.getPt1()));
+
+            if (AABB.isInside(pt))
+            {
+                if (intersection.intersectionType != EIntersectionType::OneIntersectiont)
+                {
+                    intersection.setOneIntersection(pt);
+                    intersection.normalI1 = faceNormal;
+
+                    tempT = scaler;
+                    return false;
+                }
+                else
+                {
+                    intersection.setSecondIntersection(pt);
+                    intersection.normalI2 = faceNormal;
+
+                    if (tempT > scaler)
+                    {
+                        intersection.swapIntersection();
+                    }
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    inline bool SegmentAABB::isSegmentAABBCollided(const Segment& seg, const AABB& AABB)
+    {
+        Vec3f AB = seg.getPt2() - seg.getPt1();
+        Vec3f centerToPt1 = seg.getPt1() - AABB.getCenter();
+        const float ext[3] {AABB.getExtI(), AABB.getExtJ(), AABB.getExtK()};
+
+        float tMin = 0.f;
+        float tMax = 1.f;
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            if (std::abs(AB[i]) <= std::numeric_limits<float>::epsilon())
+            {
+                /*Segment parallel to the slab : must start inside*/
+                if (std::abs(centerToPt1[i]) > ext[i])
+                    return false;
+
+                continue;
+            }
+
+            float invAB = 1.f / AB[i];
+            float t0 = (-ext[i] - centerToPt1[i]) * invAB;
+            float t1 = (ext[i] - centerToPt1[i]) * invAB;
+
+            if (t0 > t1)
+                std::swap(t0, t1);
+
+            tMin = std::max(tMin, t0);
+            tMax = std::min(tMax, t1);
+
+            if (tMin > tMax)
+                return false;
+        }
+
+        return true;
+    }
+
 } /*namespace FoxMath*/
 
 #endif //_SEGMENT_AABB_H
\ No newline at end of file
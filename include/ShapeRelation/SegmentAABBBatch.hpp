@@ -0,0 +1,258 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 11 h 40
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stddef.h> //sizt_t
+#include <stdint.h> //uint32_t
+#include <limits> //std::numeric_limits
+#include <cmath> //std::copysign
+#include <algorithm> //std::min, std::max
+
+#include "SIMD/SIMD.hpp" //FOXMATH_SIMD_SSE
+#include "Shape3D/AABB.hpp"
+#include "Shape3D/Segment.hpp"
+#include "ShapeRelation/Intersection.hpp"
+#include "ShapeRelation/HitRecord.hpp"
+#include "ShapeRelation/SegmentAABB.hpp"
+
+namespace FoxMath
+{
+    /**
+     * @brief Segment prepared for the slab test : first point and inverse of (pt2 - pt1).
+     * A null component of (pt2 - pt1) give +/- infinity : the slab test ignore the NaN of 0 * inf when pt1 is on a plane of this axis,
+     * so a segment on a face or an edge of the box hit it
+     */
+    struct SegmentSlab
+    {
+        float pt1       [3];
+        float invDelta  [3];
+
+        SegmentSlab () noexcept = default;
+
+        explicit inline
+        SegmentSlab (const Segment& seg) noexcept;
+    };
+
+    /**
+     * @brief TWidth AABB in structure of arrays (min x of each box, min y of each box...) for the batch slab test.
+     * Unused lanes must be set with setEmpty
+     * 
+     * @tparam TWidth : 4 or 8
+     */
+    template <size_t TWidth>
+    struct AABBPacket
+    {
+        static_assert(TWidth == 4 || TWidth == 8, "AABBPacket width must be 4 or 8");
+
+        alignas(32) float min [3][TWidth];
+        alignas(32) float max [3][TWidth];
+
+        inline
+        void set        (size_t lane, const AABB& aabb) noexcept;
+
+        /**
+         * @brief Set lane with min = +inf and max = -inf : this box is never hit
+         * 
+         * @param lane 
+         */
+        inline
+        void setEmpty   (size_t lane) noexcept;
+    };
+
+    /**
+     * @brief TWidth segments in structure of arrays prepared for the batch slab test.
+     * Unused lanes must be set with setEmpty
+     * 
+     * @tparam TWidth : 4 or 8
+     */
+    template <size_t TWidth>
+    struct SegmentPacket
+    {
+        static_assert(TWidth == 4 || TWidth == 8, "SegmentPacket width must be 4 or 8");
+
+        alignas(32) float pt1       [3][TWidth];
+        alignas(32) float invDelta  [3][TWidth];
+
+        inline
+        void set        (size_t lane, const Segment& seg) noexcept;
+
+        /**
+         * @brief Set lane with pt1 = +inf : this segment never hit
+         * 
+         * @param lane 
+         */
+        inline
+        void setEmpty   (size_t lane) noexcept;
+    };
+
+    /**
+     * @brief Slab test of segment against AABB for picking and line of sight : one segment against 4 or 8 boxes,
+     * or 4 or 8 segments against one box. Only the hit flags and the entry ratio on the segment are computed, use
+     * computeIntersection on the hit boxes to get the points and normals.
+     * @note A segment with its first point inside a box hit it with an entry ratio of 0
+     */
+    class SegmentAABBBatch
+    {
+        public:
+
+        #pragma region constructor/destructor
+
+        SegmentAABBBatch ()					                            = delete;
+        SegmentAABBBatch (const SegmentAABBBatch& other)			    = delete;
+        SegmentAABBBatch (SegmentAABBBatch&& other)				        = delete;
+        ~SegmentAABBBatch ()				                            = delete;
+        SegmentAABBBatch& operator=(SegmentAABBBatch const& other)      = delete;
+        SegmentAABBBatch& operator=(SegmentAABBBatch && other)		    = delete;
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region static methods
+
+        /**
+         * @brief Slab test of one segment against one AABB
+         * 
+         * @param seg 
+         * @param aabb 
+         * @param tEntry : ratio on the segment of the entry point, only written if hit
+         * @return true if segment hit the box
+         */
+        [[nodiscard]] static inline
+        bool        isSegmentAABBCollided   (const SegmentSlab& seg, const AABB& aabb, float& tEntry) noexcept;
+
+        /**
+         * @brief Slab test of one segment against TWidth AABB
+         * 
+         * @tparam TWidth : 4 or 8
+         * @param seg 
+         * @param aabbs 
+         * @param tEntry : TWidth ratios of entry point, only valid for hit lanes
+         * @return uint32_t : bit i is set if box i is hit
+         */
+        template <size_t TWidth>
+        [[nodiscard]] static inline
+        uint32_t    isSegmentAABBCollided   (const SegmentSlab& seg, const AABBPacket<TWidth>& aabbs, float* tEntry) noexcept;
+
+        /**
+         * @brief Slab test of TWidth segments against one AABB
+         * 
+         * @tparam TWidth : 4 or 8
+         * @param segs 
+         * @param aabb 
+         * @param tEntry : TWidth ratios of entry point, only valid for hit lanes
+         * @return uint32_t : bit i is set if segment i hit the box
+         */
+        template <size_t TWidth>
+        [[nodiscard]] static inline
+        uint32_t    isSegmentAABBCollided   (const SegmentPacket<TWidth>& segs, const AABB& aabb, float* tEntry) noexcept;
+
+        /**
+         * @brief Fill (count + TWidth - 1) / TWidth packets with aabbs. Lanes after the last box are empty
+         * 
+         * @tparam TWidth : 4 or 8
+         * @param aabbs 
+         * @param count 
+         * @param packets 
+         */
+        template <size_t TWidth>
+        static inline
+        void        fillPackets             (const AABB* aabbs, size_t count, AABBPacket<TWidth>* packets) noexcept;
+
+        /**
+         * @brief Fill (count + TWidth - 1) / TWidth packets with segs. Lanes after the last segment are empty
+         * 
+         * @tparam TWidth : 4 or 8
+         * @param segs 
+         * @param count 
+         * @param packets 
+         */
+        template <size_t TWidth>
+        static inline
+        void        fillPackets             (const Segment* segs, size_t count, SegmentPacket<TWidth>* packets) noexcept;
+
+        /**
+         * @brief Return true if the segment hit one of the boxes (line of sight). Stop at the first hit
+         * 
+         * @tparam TWidth : 4 or 8
+         * @param seg 
+         * @param packets 
+         * @param packetCount 
+         * @return true if one box is hit
+         */
+        template <size_t TWidth>
+        [[nodiscard]] static inline
+        bool        isAnyAABBCollided       (const SegmentSlab& seg, const AABBPacket<TWidth>* packets, size_t packetCount) noexcept;
+
+        /**
+         * @brief Find the first box hit by the segment (picking)
+         * 
+         * @tparam TWidth : 4 or 8
+         * @param seg 
+         * @param packets 
+         * @param packetCount 
+         * @param aabbIndex : index of the box in the array used to fill the packets, only written if hit
+         * @param tEntry : ratio of the entry point, only written if hit
+         * @return true if one box is hit
+         */
+        template <size_t TWidth>
+        static inline
+        bool        findFirstAABBCollided   (const SegmentSlab& seg, const AABBPacket<TWidth>* packets, size_t packetCount, size_t& aabbIndex, float& tEntry) noexcept;
+
+        /**
+         * @brief Append a HitRecord for each box hit by the segment (all hits of a ray, unsorted). The record store the entry ratio and the normal
+         * of the entry face, or of the face behind the first point if it is inside the box. Its shapeIndex is the index of the box in the array used to fill the packets
+         * 
+         * @tparam TWidth : 4 or 8
+         * @param seg 
+         * @param packets 
+         * @param packetCount 
+         * @param hits 
+         * @return size_t : number of hits appended
+         */
+        template <size_t TWidth>
+        static inline
+        size_t      findAllAABBCollided     (const SegmentSlab& seg, const AABBPacket<TWidth>* packets, size_t packetCount, HitBuffer& hits);
+
+        /**
+         * @brief Compute the points and normals of the intersection with SegmentAABB::isSegmentAABBCollided. To call on the hit box only
+         * 
+         * @param seg 
+         * @param aabb 
+         * @param intersection 
+         * @return true if segment hit the box
+         */
+        static inline
+        bool        computeIntersection     (const Segment& seg, const AABB& aabb, Intersection& intersection);
+
+        #pragma endregion //!static methods
+    };
+
+    #include "SegmentAABBBatch.inl"
+
+} /*namespace FoxMath*/
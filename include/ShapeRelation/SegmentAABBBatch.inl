@@ -0,0 +1,336 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 11 h 40
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+inline
+SegmentSlab::SegmentSlab (const Segment& seg) noexcept
+{
+    const Vec3f delta = seg.getPt2() - seg.getPt1();
+
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        pt1[axis]       = seg.getPt1()[axis];
+        invDelta[axis]  = (delta[axis] != 0.f) ? 1.f / delta[axis] : std::copysign(std::numeric_limits<float>::infinity(), delta[axis]);
+    }
+}
+
+template <size_t TWidth>
+inline
+void AABBPacket<TWidth>::set (size_t lane, const AABB& aabb) noexcept
+{
+    const Vec3f aabbMin = aabb.getMin();
+    const Vec3f aabbMax = aabb.getMax();
+
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        min[axis][lane] = aabbMin[axis];
+        max[axis][lane] = aabbMax[axis];
+    }
+}
+
+template <size_t TWidth>
+inline
+void AABBPacket<TWidth>::setEmpty (size_t lane) noexcept
+{
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        min[axis][lane] = std::numeric_limits<float>::infinity();
+        max[axis][lane] = -std::numeric_limits<float>::infinity();
+    }
+}
+
+template <size_t TWidth>
+inline
+void SegmentPacket<TWidth>::set (size_t lane, const Segment& seg) noexcept
+{
+    const SegmentSlab slab (seg);
+
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        pt1[axis][lane]         = slab.pt1[axis];
+        invDelta[axis][lane]    = slab.invDelta[axis];
+    }
+}
+
+template <size_t TWidth>
+inline
+void SegmentPacket<TWidth>::setEmpty (size_t lane) noexcept
+{
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        pt1[axis][lane]         = std::numeric_limits<float>::infinity();
+        invDelta[axis][lane]    = 1.f;
+    }
+}
+
+inline
+bool SegmentAABBBatch::isSegmentAABBCollided (const SegmentSlab& seg, const AABB& aabb, float& tEntry) noexcept
+{
+    const Vec3f aabbMin = aabb.getMin();
+    const Vec3f aabbMax = aabb.getMax();
+
+    float tNear = 0.f;
+    float tFar  = 1.f;
+
+    /*Null axis of the segment : 0 * inf is NaN if pt1 is on the plane. std::max and std::min return their first operand with NaN so the plane is ignored*/
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        const bool  isPositive  = seg.invDelta[axis] >= 0.f;
+        const float nearPlane   = isPositive ? aabbMin[axis] : aabbMax[axis];
+        const float farPlane    = isPositive ? aabbMax[axis] : aabbMin[axis];
+
+        tNear   = std::max(tNear, (nearPlane - seg.pt1[axis]) * seg.invDelta[axis]);
+        tFar    = std::min(tFar, (farPlane - seg.pt1[axis]) * seg.invDelta[axis]);
+    }
+
+    if (tNear > tFar)
+        return false;
+
+    tEntry = tNear;
+    return true;
+}
+
+template <size_t TWidth>
+inline
+uint32_t SegmentAABBBatch::isSegmentAABBCollided (const SegmentSlab& seg, const AABBPacket<TWidth>& aabbs, float* tEntry) noexcept
+{
+#ifdef FOXMATH_SIMD_SSE
+    if constexpr (TWidth == 4)
+        return SIMD::segmentAABB4(seg.pt1, seg.invDelta, aabbs.min[0], aabbs.max[0], tEntry);
+    else
+        return SIMD::segmentAABB8(seg.pt1, seg.invDelta, aabbs.min[0], aabbs.max[0], tEntry);
+#else
+    float tNear [TWidth];
+    float tFar  [TWidth];
+
+    for (size_t lane = 0; lane < TWidth; ++lane)
+    {
+        tNear[lane] = 0.f;
+        tFar[lane]  = 1.f;
+    }
+
+    /*Near and far planes are selected once by axis with the sign of the direction*/
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        const bool      isPositive  = seg.invDelta[axis] >= 0.f;
+        const float*    nearPlanes  = isPositive ? aabbs.min[axis] : aabbs.max[axis];
+        const float*    farPlanes   = isPositive ? aabbs.max[axis] : aabbs.min[axis];
+
+        for (size_t lane = 0; lane < TWidth; ++lane)
+        {
+            tNear[lane] = std::max(tNear[lane], (nearPlanes[lane] - seg.pt1[axis]) * seg.invDelta[axis]);
+            tFar[lane]  = std::min(tFar[lane], (farPlanes[lane] - seg.pt1[axis]) * seg.invDelta[axis]);
+        }
+    }
+
+    uint32_t hitMask = 0;
+    for (size_t lane = 0; lane < TWidth; ++lane)
+    {
+        tEntry[lane] = tNear[lane];
+        hitMask |= static_cast<uint32_t>(tNear[lane] <= tFar[lane]) << lane;
+    }
+
+    return hitMask;
+#endif
+}
+
+template <size_t TWidth>
+inline
+uint32_t SegmentAABBBatch::isSegmentAABBCollided (const SegmentPacket<TWidth>& segs, const AABB& aabb, float* tEntry) noexcept
+{
+    const Vec3f aabbMin = aabb.getMin();
+    const Vec3f aabbMax = aabb.getMax();
+    const float boxMin [3] = {aabbMin.getX(), aabbMin.getY(), aabbMin.getZ()};
+    const float boxMax [3] = {aabbMax.getX(), aabbMax.getY(), aabbMax.getZ()};
+
+#ifdef FOXMATH_SIMD_SSE
+    if constexpr (TWidth == 4)
+        return SIMD::segmentsAABB4(segs.pt1[0], segs.invDelta[0], boxMin, boxMax, tEntry);
+    else
+        return SIMD::segmentsAABB8(segs.pt1[0], segs.invDelta[0], boxMin, boxMax, tEntry);
+#else
+    float tNear [TWidth];
+    float tFar  [TWidth];
+
+    for (size_t lane = 0; lane < TWidth; ++lane)
+    {
+        tNear[lane] = 0.f;
+        tFar[lane]  = 1.f;
+    }
+
+    for (size_t axis = 0; axis < 3; ++axis)
+    {
+        for (size_t lane = 0; lane < TWidth; ++lane)
+        {
+            const float inv         = segs.invDelta[axis][lane];
+            const float nearPlane   = inv >= 0.f ? boxMin[axis] : boxMax[axis];
+            const float farPlane    = inv >= 0.f ? boxMax[axis] : boxMin[axis];
+
+            tNear[lane] = std::max(tNear[lane], (nearPlane - segs.pt1[axis][lane]) * inv);
+            tFar[lane]  = std::min(tFar[lane], (farPlane - segs.pt1[axis][lane]) * inv);
+        }
+    }
+
+    uint32_t hitMask = 0;
+    for (size_t lane = 0; lane < TWidth; ++lane)
+    {
+        tEntry[lane] = tNear[lane];
+        hitMask |= static_cast<uint32_t>(tNear[lane] <= tFar[lane]) << lane;
+    }
+
+    return hitMask;
+#endif
+}
+
+template <size_t TWidth>
+inline
+void SegmentAABBBatch::fillPackets (const AABB* aabbs, size_t count, AABBPacket<TWidth>* packets) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        packets[i / TWidth].set(i % TWidth, aabbs[i]);
+    }
+
+    for (size_t i = count; i % TWidth != 0; ++i)
+    {
+        packets[i / TWidth].setEmpty(i % TWidth);
+    }
+}
+
+template <size_t TWidth>
+inline
+void SegmentAABBBatch::fillPackets (const Segment* segs, size_t count, SegmentPacket<TWidth>* packets) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        packets[i / TWidth].set(i % TWidth, segs[i]);
+    }
+
+    for (size_t i = count; i % TWidth != 0; ++i)
+    {
+        packets[i / TWidth].setEmpty(i % TWidth);
+    }
+}
+
+template <size_t TWidth>
+inline
+bool SegmentAABBBatch::isAnyAABBCollided (const SegmentSlab& seg, const AABBPacket<TWidth>* packets, size_t packetCount) noexcept
+{
+    alignas(32) float tEntry [TWidth];
+
+    for (size_t iPacket = 0; iPacket < packetCount; ++iPacket)
+    {
+        if (isSegmentAABBCollided(seg, packets[iPacket], tEntry))
+            return true;
+    }
+
+    return false;
+}
+
+template <size_t TWidth>
+inline
+bool SegmentAABBBatch::findFirstAABBCollided (const SegmentSlab& seg, const AABBPacket<TWidth>* packets, size_t packetCount, size_t& aabbIndex, float& tEntry) noexcept
+{
+    alignas(32) float packetTEntry [TWidth];
+    bool isHit = false;
+
+    for (size_t iPacket = 0; iPacket < packetCount; ++iPacket)
+    {
+        const uint32_t hitMask = isSegmentAABBCollided(seg, packets[iPacket], packetTEntry);
+        if (!hitMask)
+            continue;
+
+        for (size_t lane = 0; lane < TWidth; ++lane)
+        {
+            if ((hitMask & (1u << lane)) && (!isHit || packetTEntry[lane] < tEntry))
+            {
+                isHit       = true;
+                tEntry      = packetTEntry[lane];
+                aabbIndex   = iPacket * TWidth + lane;
+            }
+        }
+    }
+
+    return isHit;
+}
+
+template <size_t TWidth>
+inline
+size_t SegmentAABBBatch::findAllAABBCollided (const SegmentSlab& seg, const AABBPacket<TWidth>* packets, size_t packetCount, HitBuffer& hits)
+{
+    alignas(32) float packetTEntry [TWidth];
+    size_t hitCount = 0;
+
+    for (size_t iPacket = 0; iPacket < packetCount; ++iPacket)
+    {
+        const uint32_t hitMask = isSegmentAABBCollided(seg, packets[iPacket], packetTEntry);
+        if (!hitMask)
+            continue;
+
+        for (size_t lane = 0; lane < TWidth; ++lane)
+        {
+            if (!(hitMask & (1u << lane)))
+                continue;
+
+            /*Entry face is the near plane with the greatest ratio*/
+            size_t  entryAxis   = 0;
+            float   entryT      = -std::numeric_limits<float>::max();
+            for (size_t axis = 0; axis < 3; ++axis)
+            {
+                const float nearPlane   = seg.invDelta[axis] >= 0.f ? packets[iPacket].min[axis][lane] : packets[iPacket].max[axis][lane];
+                const float t           = (nearPlane - seg.pt1[axis]) * seg.invDelta[axis];
+
+                if (t > entryT)
+                {
+                    entryT      = t;
+                    entryAxis   = axis;
+                }
+            }
+
+            Vec3f normal = Vec3f::zero;
+            normal.setData(entryAxis, seg.invDelta[entryAxis] >= 0.f ? -1.f : 1.f);
+
+            HitRecord& hit  = hits.append(HitRecord{});
+            hit.t[0]        = packetTEntry[lane];
+            hit.normal[0]   = PackedNormal(normal);
+            hit.shapeIndex  = static_cast<uint32_t>(iPacket * TWidth + lane);
+            hit.type        = EIntersectionType::OneIntersectiont;
+            ++hitCount;
+        }
+    }
+
+    return hitCount;
+}
+
+inline
+bool SegmentAABBBatch::computeIntersection (const Segment& seg, const AABB& aabb, Intersection& intersection)
+{
+    return SegmentAABB::isSegmentAABBCollided(seg, aabb, intersection);
+}
@@ -2,12 +2,19 @@
 //Editing by Gavelle Anthony, Nisi Guillaume, Six Jonathan
 //Date : 2020-05-07 - 17 h 30
 
-#ifndef _SEGMENT_SEGMENT_H
-#define _SEGMENT_SEGMENT_H
+#ifndef _SEGMENT_CYLINDER_H
+#define _SEGMENT_CYLINDER_H
 
 #include "ShapeRelation/Intersection.hpp"
 #include "Shape3D/Segment.hpp"
 #include "Shape3D/Cylinder.hpp"
+#include "Shape3D/InfiniteCylinder.hpp"
+#include "Shape3D/Plane.hpp"
+#include "ShapeRelation/SegmentInfiniteCylinder.hpp"
+#include "ShapeRelation/SegmentPlane.hpp"
+
+#include <algorithm>
+#include <limits>
 
 namespace FoxMath
 {
@@ -30,6 +37,9 @@ namespace FoxMath
 
         static bool isSegmentCylinderCollided(const Segment& seg, const Cylinder& cylinder, Intersection& intersection);
 
+        /*Overlap only : no intersection point, normal or square root. A segment inside the cylinder is collided*/
+        static bool isSegmentCylinderCollided(const Segment& seg, const Cylinder& cylinder);
+
         #pragma endregion //!static methods
 
         private :
@@ -39,6 +49,321 @@ namespace FoxMath
         #pragma endregion //!static methods
     };
 
+    inline bool SegmentCylinder::isSegmentCylinderCollided(const Segment& seg, const Cylinder& cylinder, Intersection& intersection)
+    {
+        InfiniteCylinder infinitCyl = cylinder.getInfiniteCylinder();
+
+        /*If there not have collision this infinit cylindre coaxile with the cylindre, the segment is outside of it or inside and can only cross the faces*/
+        if (!SegmentInfiniteCylinder::isSegmentInfiniteCylinderCollided(seg, infinitCyl, intersection))
+        {
+            intersection.setNotIntersection();
+
+            if (!infinitCyl.isPointInside(seg.getPt1()))
+                return false;
+        }
+
+        /*If the both points of the segment is on the same midle zone of the cylinder return the infiniteCylinder Intersection*/
+        Plane leftCylindreFace = cylinder.LeftPlane();
+        Plane rightCylindreFace = cylinder.RightPlane();
+
+        bool pt1InFrontOfLeftFace = leftCylindreFace.getSignedDistanceToPlane(seg.getPt1()) > std::numeric_limits<float>::epsilon();
+        bool pt1InFrontOfRightFace = rightCylindreFace.getSignedDistanceToPlane(seg.getPt1()) > std::numeric_limits<float>::epsilon();
+        bool pt2InFrontOfLeftFace = leftCylindreFace.getSignedDistanceToPlane(seg.getPt2()) > std::numeric_limits<float>::epsilon();
+        bool pt2InFrontOfRightFace = rightCylindreFace.getSignedDistanceToPlane(seg.getPt2()) > std::numeric_limits<float>::epsilon();
+
+        if (!pt1InFrontOfLeftFace && !pt1InFrontOfRightFace && !pt2InFrontOfLeftFace && !pt2InFrontOfRightFace)
+        {
+            return intersection.intersectionType != EIntersectionType::NoIntersection;
+        }
+
+        /*If the both points of the segment is on the same side return false*/
+        if ((pt1InFrontOfLeftFace && pt2InFrontOfLeftFace) || (pt1InFrontOfRightFace && pt2InFrontOfRightFace))
+        {
+            intersection.setNotIntersection();
+            return false;
+        }
+
+        /*There is one intersection with the infinite cylinder*/
+        if (intersection.intersectionType == EIntersectionType::OneIntersectiont)
+        {
+            /*Check if the intersection point is inside the cylinder*/
+            if (leftCylindreFace.getSignedDistanceToPlane(intersection.intersection1) > std::numeric_limits<float>::epsilon())
+            {
+                Intersection segQuadIntersection;
+
+                if (SegmentPlane::isSegmentPlaneCollided(seg, leftCylindreFace, segQuadIntersection))
+                {
+                    if (infinitCyl.isPointInside(segQuadIntersection.intersection1))
+                    {
+                        intersection.intersection1 = segQuadIntersection.intersection1;
+                        intersection.normalI1 = pt1InFrontOfLeftFace ? segQuadIntersection.normalI1 : -segQuadIntersection.normalI1;
+
+                        /*Check if there are a second intersection on the other face*/
+                        if (SegmentPlane::isSegmentPlaneCollided(seg, rightCylindreFace, segQuadIntersection))
+                        {
+                            if (infinitCyl.isPointInside(segQuadIntersection.intersection1))
+                            {
+                                intersection.intersection2 = segQuadIntersection.intersection1;
+                                intersection.normalI2 = pt1InFrontOfLeftFace ? -segQuadIntersection.normalI1 : segQuadIntersection.normalI1;
+                                intersection.intersectionType = EIntersectionType::TwoIntersectiont;
+                            }
+                        }
+                        intersection.sortIntersection(seg.getPt1());
+                        return true;
+                    }
+                }
+
+                intersection.setNotIntersection();
+                return false;
+            }
+            else if (rightCylindreFace.getSignedDistanceToPlane(intersection.intersection1) > std::numeric_limits<float>::epsilon())
+            {
+                Intersection segQuadIntersection;
+
+                if (SegmentPlane::isSegmentPlaneCollided(seg, rightCylindreFace, segQuadIntersection))
+                {
+                    if (infinitCyl.isPointInside(segQuadIntersection.intersection1))
+                    {
+                        intersection.intersection1 = segQuadIntersection.intersection1;
+                        intersection.normalI1 = pt1InFrontOfRightFace ? segQuadIntersection.normalI1 : -segQuadIntersection.normalI1;
+
+                        /*Check if there are a second intersection on the other face*/
+                        if (SegmentPlane::isSegmentPlaneCollided(seg, leftCylindreFace, segQuadIntersection))
+                        {
+                            if (infinitCyl.isPointInside(segQuadIntersection.intersection1))
+                            {
+                                intersection.intersection2 = segQuadIntersection.intersection1;
+                                intersection.normalI2 = pt1InFrontOfRightFace ? -segQuadIntersection.normalI1 : segQuadIntersection.normalI1;
+                                intersection.intersectionType = EIntersectionType::TwoIntersectiont;
+                            }
+                        }
+                        intersection.sortIntersection(seg.getPt1());
+                        return true;
+                    }
+                }
+                intersection.setNotIntersection();
+                return false;
+            }
+            else
+            {
+                Intersection segQuadIntersection;
+                if (SegmentPlane::isSegmentPlaneCollided(seg, leftCylindreFace, segQuadIntersection))
+                {
+                    if (infinitCyl.isPointInside(segQuadIntersection.intersection1))
+                    {
+                        intersection.intersection2 = segQuadIntersection.intersection1;
+                        intersection.normalI2 = pt1InFrontOfLeftFace ? segQuadIntersection.normalI1 : -segQuadIntersection.normalI1;
+                        intersection.intersectionType = EIntersectionType::TwoIntersectiont;
+
+                        intersection.sortIntersection(seg.getPt1());
+                        return true;
+                    }
+                }
+
+                if (SegmentPlane::isSegmentPlaneCollided(seg, rightCylindreFace, segQuadIntersection))
+                {
+                    if (infinitCyl.isPointInside(segQuadIntersection.intersection1))
+                    {
+                        intersection.intersection2 = segQuadIntersection.intersection1;
+                        intersection.normalI2 = pt1InFrontOfRightFace ? segQuadIntersection.normalI1 : -segQuadIntersection.normalI1;
+                        intersection.intersectionType = EIntersectionType::TwoIntersectiont;
+
+                        intersection.sortIntersection(seg.getPt1());
+                        return true;
+                    }
+                }
+                intersection.sortIntersection(seg.getPt1());
+                return true;
+            }
+        }
+
+        /*There is two intersection with the infinite cylinder*/
+        if (intersection.intersectionType == EIntersectionType::TwoIntersectiont)
+        {
+            bool keepInter1 = false;
+            bool keepInter2 = false;
+
+            /*if intersection 1 is not inside the cylindre*/
+            if (leftCylindreFace.getSignedDistanceToPlane(intersection.intersection1) > std::numeric_limits<float>::epsilon())
+            {
+                Intersection segQuadIntersection;
+
+                if (SegmentPlane::isSegmentPlaneCollided(seg, leftCylindreFace, segQuadIntersection))
+                {
+                    if (infinitCyl.isPointInside(segQuadIntersection.intersection1))
+                    {
+                        intersection.intersection1 = segQuadIntersection.intersection1;
+                        intersection.normalI1 = pt1InFrontOfLeftFace ? segQuadIntersection.normalI1 : -segQuadIntersection.normalI1;
+                        keepInter1 = true;
+                    }
+                }
+            }
+            else if (rightCylindreFace.getSignedDistanceToPlane(intersection.intersection1) > std::numeric_limits<float>::epsilon())
+            {
+                Intersection segQuadIntersection;
+                if (SegmentPlane::isSegmentPlaneCollided(seg, rightCylindreFace, segQuadIntersection))
+                {
+                    if (infinitCyl.isPointInside(segQuadIntersection.intersection1))
+                    {
+                        intersection.intersection1 = segQuadIntersection.intersection1;
+                        intersection.normalI1 = pt1InFrontOfRightFace ? segQuadIntersection.normalI1 : -segQuadIntersection.normalI1;
+                        keepInter1 = true;
+                    }
+                }
+            }
+            else
+            {
+                keepInter1 = true;
+            }
+
+            /*if the intersection both is not inside the cylindre*/
+            if (leftCylindreFace.getSignedDistanceToPlane(intersection.intersection2) > std::numeric_limits<float>::epsilon())
+            {
+                Intersection segQuadIntersection;
+                if (SegmentPlane::isSegmentPlaneCollided(seg, leftCylindreFace, segQuadIntersection))
+                {
+                    if (infinitCyl.isPointInside(segQuadIntersection.intersection1))
+                    {
+                        intersection.intersection2 = segQuadIntersection.intersection1;
+                        intersection.normalI2 = pt1InFrontOfLeftFace ? segQuadIntersection.normalI1 : -segQuadIntersection.normalI1;
+                        keepInter2 = true;
+                    }
+                }
+            }
+            else if (rightCylindreFace.getSignedDistanceToPlane(intersection.intersection2) > std::numeric_limits<float>::epsilon())
+            {
+                Intersection segQuadIntersection;
+                if (SegmentPlane::isSegmentPlaneCollided(seg, rightCylindreFace, segQuadIntersection))
+                {
+                    if (infinitCyl.isPointInside(segQuadIntersection.intersection1))
+                    {
+                        intersection.intersection2 = segQuadIntersection.intersection1;
+                        intersection.normalI2 = pt1InFrontOfRightFace ? segQuadIntersection.normalI1 : -segQuadIntersection.normalI1;
+                        keepInter2 = true;
+                    }
+                }
+            }
+            else
+            {
+                keepInter2 = true;
+            }
+
+            if (keepInter1)
+            {
+                if (keepInter2)
+                {
+                    intersection.sortIntersection(seg.getPt1());
+                    return true;
+                }
+                else
+                {
+                    intersection.intersectionType = EIntersectionType::OneIntersectiont;
+                    return true;
+                }
+            }
+            else if (keepInter2)
+            {
+                intersection.setOneIntersection(intersection.intersection2);
+                return true;
+            }
+            else
+            {
+                intersection.setNotIntersection();
+                return false;
+            }
+        }
+
+        /*The point is on the infiniteCylinder. Not inside the cylinder and note nd the same side. So, Check if there is 1 or 2 collision*/
+        if (pt1InFrontOfLeftFace && pt2InFrontOfRightFace)
+        {
+            Intersection segQuadIntersection;
+            SegmentPlane::isSegmentPlaneCollided(seg, leftCylindreFace, segQuadIntersection);
+            intersection.intersection1 = segQuadIntersection.intersection1;
+            intersection.normalI1 = pt1InFrontOfLeftFace ? segQuadIntersection.normalI1 : -segQuadIntersection.normalI1;
+
+            SegmentPlane::isSegmentPlaneCollided(seg, rightCylindreFace, segQuadIntersection);
+            intersection.intersection2 = segQuadIntersection.intersection1;
+            intersection.normalI2 = pt1InFrontOfLeftFace ? -segQuadIntersection.normalI1 : segQuadIntersection.normalI1;
+
+            intersection.intersectionType = EIntersectionType::TwoIntersectiont;
+            return true;
+        }
+        else if (pt1InFrontOfRightFace && pt2InFrontOfLeftFace)
+        {
+            Intersection segQuadIntersection;
+            SegmentPlane::isSegmentPlaneCollided(seg, rightCylindreFace, segQuadIntersection);
+            intersection.intersection1 = segQuadIntersection.intersection1;
+            intersection.normalI1 = pt1InFrontOfRightFace ? segQuadIntersection.normalI1 : -segQuadIntersection.normalI1;
+
+            SegmentPlane::isSegmentPlaneCollided(seg, leftCylindreFace, segQuadIntersection);
+            intersection.intersection2 = segQuadIntersection.intersection1;
+            intersection.normalI2 = pt1InFrontOfRightFace ? -segQuadIntersection.normalI1 : segQuadIntersection.normalI1;
+
+            intersection.intersectionType = EIntersectionType::TwoIntersectiont;
+            return true;
+        }
+        else //pt1 or pt2 is inside
+        {
+            if ((!pt1InFrontOfRightFace && pt2InFrontOfRightFace)|| (pt1InFrontOfRightFace && !pt2InFrontOfRightFace))
+            {
+                Intersection segQuadIntersection;
+                SegmentPlane::isSegmentPlaneCollided(seg, rightCylindreFace, segQuadIntersection);
+                intersection.setOneIntersection(segQuadIntersection.intersection1);
+                intersection.normalI1 = pt1InFrontOfRightFace ? segQuadIntersection.normalI1 : -segQuadIntersection.normalI1;
+            }
+            else
+            {
+                Intersection segQuadIntersection;
+                SegmentPlane::isSegmentPlaneCollided(seg, leftCylindreFace, segQuadIntersection);
+                intersection.setOneIntersection(segQuadIntersection.intersection1);
+                intersection.normalI1 = pt1InFrontOfLeftFace ? segQuadIntersection.normalI1 : -segQuadIntersection.normalI1;
+            }
+            return true;
+        }
+    }
+
+    inline bool SegmentCylinder::isSegmentCylinderCollided(const Segment& seg, const Cylinder& cylinder)
+    {
+        const Vec3f& P  = cylinder.getSegment().getPt1();
+        Vec3f d         = cylinder.getSegment().getPt2() - P;
+        Vec3f m         = seg.getPt1() - P;
+        Vec3f n         = seg.getPt2() - seg.getPt1();
+        float dd        = d.squareLength();
+        float md        = Vec3f::dot(m, d);
+        float nd        = Vec3f::dot(n, d);
+        float tMin      = 0.f;
+        float tMax      = 1.f;
+
+        /*Clip the segment between the planes of the faces : 0 <= (m + t * n).d <= d.d*/
+        if (nd == 0.f)
+        {
+            if (md < 0.f || md > dd)
+                return false;
+        }
+        else
+        {
+            float t1 = -md / nd;
+            float t2 = (dd - md) / nd;
+
+            if (t1 > t2)
+                std::swap(t1, t2);
+
+            tMin = std::max(tMin, t1);
+            tMax = std::min(tMax, t2);
+
+            if (tMin > tMax)
+                return false;
+        }
+
+        /*Square distance to the axis multiplied by d.d is |w + t * v|² with w = m x d and v = n x d. Its minimum on [tMin, tMax] is compared to R² * d.d*/
+        Vec3f w = Vec3f::cross(m, d);
+        Vec3f v = Vec3f::cross(n, d);
+        float squareLengthV = v.squareLength();
+        float t = squareLengthV > 0.f ? std::clamp(-Vec3f::dot(w, v) / squareLengthV, tMin, tMax) : tMin;
+
+        return (w + t * v).squareLength() <= cylinder.getRadius() * cylinder.getRadius() * dd;
+    }
+
 } /*namespace FoxMath*/
 
-#endif //_SEGMENT_SEGMENT_H
\ No newline at end of file
+#endif //_SEGMENT_CYLINDER_H
\ No newline at end of file
@@ -30,6 +30,9 @@ namespace FoxMath
 
         static bool isSegmentInfiniteCylinderCollided(const Segment& seg, const InfiniteCylinder& infCylinder, Intersection& intersection);
 
+        /*Overlap only : no intersection point, normal or square root. A segment inside the cylinder is collided*/
+        static bool isSegmentInfiniteCylinderCollided(const Segment& seg, const InfiniteCylinder& infCylinder);
+
         #pragma endregion //!static methods
 
         private :
@@ -39,6 +42,64 @@ namespace FoxMath
         #pragma endregion //!static methods
     };
 
+    inline bool SegmentInfiniteCylinder::isSegmentInfiniteCylinderCollided(const Segment& seg, const InfiniteCylinder& infCylinder, Intersection& intersection)
+    {
+        Vec3f OQ    = infCylinder.getLine().getOrigin() + infCylinder.getLine().getNormal();
+        Vec3f AB    = seg.getPt2() - seg.getPt1();
+        Vec3f PO    = -infCylinder.getLine().getOrigin();
+        Vec3f OA    = seg.getPt1();
+        float R     = infCylinder.getRadius();
+
+        Vec3f vecEq1 = Vec3f::cross(OQ, OA + PO) + Vec3f::cross(PO, OA);
+        Vec3f vecEq2 = Vec3f::cross((OQ + PO), AB);
+
+        float a = vecEq2.squareLength();
+        float b = 2.f * Vec3f::dot(vecEq1, vecEq2);
+        float c = vecEq1.squareLength() - R * R;
+
+        /*We comput the discriminent*/
+        if (Intersection::computeDiscriminentAndSolveEquation(a, b, c, seg.getPt1(), seg.getPt2(), intersection))
+        {
+            if (intersection.intersectionType == EIntersectionType::TwoIntersectiont)
+            {
+                Vec3f cylPtToInter2 = intersection.intersection2 - infCylinder.getLine().getOrigin();
+                intersection.normalI2 = (cylPtToInter2 - infCylinder.getLine().getNormal() * Vec3f::dot(cylPtToInter2, infCylinder.getLine().getNormal())).getNormalized();
+            }
+            Vec3f cylPtToInter1 = intersection.intersection1 - infCylinder.getLine().getOrigin();
+            intersection.normalI1 = (cylPtToInter1 - infCylinder.getLine().getNormal() * Vec3f::dot(cylPtToInter1, infCylinder.getLine().getNormal())).getNormalized();
+
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    inline bool SegmentInfiniteCylinder::isSegmentInfiniteCylinderCollided(const Segment& seg, const InfiniteCylinder& infCylinder)
+    {
+        /*Square distance of A + t * AB to the axis is |w + t * v|² with w = n x OA and v = n x AB. Its minimum on [0, 1] is compared to R²*/
+        const Vec3f& normal = infCylinder.getLine().getNormal();
+        Vec3f w = Vec3f::cross(normal, seg.getPt1() - infCylinder.getLine().getOrigin());
+        Vec3f v = Vec3f::cross(normal, seg.getPt2() - seg.getPt1());
+        float squareRadius = infCylinder.getRadius() * infCylinder.getRadius();
+        float squareLengthW = w.squareLength();
+
+        float projection = -Vec3f::dot(w, v);
+        if (projection <= 0.f)
+        {
+            return squareLengthW <= squareRadius;
+        }
+
+        float squareLengthV = v.squareLength();
+        if (projection >= squareLengthV)
+        {
+            return (w + v).squareLength() <= squareRadius;
+        }
+
+        return squareLengthW * squareLengthV - projection * projection <= squareRadius * squareLengthV;
+    }
+
 } /*namespace FoxMath*/
 
 #endif //_SEGMENT_INFINITE_CYLINDER_H
\ No newline at end of file
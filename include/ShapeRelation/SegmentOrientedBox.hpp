@@ -7,7 +7,11 @@
 
 #include "ShapeRelation/Intersection.hpp"
 #include "Shape3D/Segment.hpp"
-#include "GE/Core/Maths/Shape3D/OrientedBox.hpp"
+#include "Shape3D/OrientedBox.hpp"
+#include "Vector/Vector.hpp"
+#include "Shape3D/AABB.hpp"
+#include "ShapeRelation/SegmentAABB.hpp"
+#include "Referential/Referential.hpp"
 
 namespace FoxMath
 {
@@ -30,6 +34,9 @@ namespace FoxMath
 
         static bool isSegmentOrientedBoxCollided(const Segment& seg, const OrientedBox& orientedBox, Intersection& intersection);
 
+        /*Overlap only : slab test in the local referential of the oriented box*/
+        static bool isSegmentOrientedBoxCollided(const Segment& seg, const OrientedBox& orientedBox);
+
         #pragma endregion //!static methods
 
         private :
@@ -38,6 +45,46 @@ namespace FoxMath
         #pragma endregion //!static methods
     };
 
+    inline bool SegmentOrientedBox::isSegmentOrientedBoxCollided(const Segment& seg, const OrientedBox& orientedBox, Intersection& intersection)
+    {
+        /*Transform the segment from global referential to the local referential of the oriented box*/
+        Segment localSegment {  Referentialf::globalToLocalPosition(orientedBox.getReferential(), seg.getPt1()),
+                                Referentialf::globalToLocalPosition(orientedBox.getReferential(), seg.getPt2())};
+
+
+        AABB orientedBoxAxisAligned {Referentialf::globalToLocalPosition(orientedBox.getReferential(), orientedBox.getReferential().origin), orientedBox.getExtI(), orientedBox.getExtJ(), orientedBox.getExtK()};
+
+        if(SegmentAABB::isSegmentAABBCollided(localSegment, orientedBoxAxisAligned, intersection))
+        {
+            intersection.intersection1 = Referentialf::localToGlobalPosition(orientedBox.getReferential(), intersection.intersection1);
+
+            if (intersection.intersectionType == EIntersectionType::TwoIntersectiont)
+                intersection.intersection2 = Referentialf::localToGlobalPosition(orientedBox.getReferential(), intersection.intersection2);
+
+            intersection.normalI1 = Referentialf::localToGlobalVector(orientedBox.getReferential(), intersection.normalI1);
+
+            if (intersection.intersectionType == EIntersectionType::TwoIntersectiont)
+            {
+                intersection.normalI2 = Referentialf::localToGlobalVector(orientedBox.getReferential(), intersection.normalI2);
+            }
+
+            return true;
+        }
+
+        return intersection.intersectionType != EIntersectionType::NoIntersection;
+    }
+
+    inline bool SegmentOrientedBox::isSegmentOrientedBoxCollided(const Segment& seg, const OrientedBox& orientedBox)
+    {
+        const Referentialf referential = orientedBox.getReferential();
+
+        /*The local AABB is centered on the origin*/
+        Segment localSegment {  Referentialf::globalToLocalPosition(referential, seg.getPt1()),
+                                Referentialf::globalToLocalPosition(referential, seg.getPt2())};
+
+        return SegmentAABB::isSegmentAABBCollided(localSegment, AABB{Vec3f::zero, orientedBox.getExtI(), orientedBox.getExtJ(), orientedBox.getExtK()});
+    }
+
 } /*namespace FoxMath*/
 
 #endif //_SEGMENT_ORIENTED_BOX_H
\ No newline at end of file
@@ -9,6 +9,9 @@
 #include "Shape3D/Segment.hpp"
 #include "Shape3D/Plane.hpp"
 
+#include <cmath>
+#include <limits>
+
 namespace FoxMath
 {
     class SegmentPlane
@@ -30,6 +33,9 @@ namespace FoxMath
 
         static bool isSegmentPlaneCollided(const Segment& seg, const Plane& plane, Intersection& intersection);
 
+        /*Overlap only : true if the points of the segment are on both sides of the plane or on it*/
+        static bool isSegmentPlaneCollided(const Segment& seg, const Plane& plane);
+
         #pragma endregion //!static methods
 
         private :
@@ -38,6 +44,53 @@ namespace FoxMath
         #pragma endregion //!static methods
     };
 
+    inline bool SegmentPlane::isSegmentPlaneCollided(const Segment& seg, const Plane& plane, Intersection& intersection)
+    {
+        Vec3f AB = seg.getPt2() - seg.getPt1();
+        float sub = Vec3f::dot(AB, plane.getNormal());
+        float distanceSegToOrigin = Vec3f::dot(seg.getPt1(), plane.getNormal());
+
+        /*if(sub == 0) segmen is orthogonal to the plan*/
+        if (std::abs(sub) <= std::numeric_limits<float>::epsilon())
+        {
+            /*Check if segmen is confused with the plan*/
+            /*Compute the distance of the segment with origin and compare with the distance of plan with origin*/
+
+            intersection.setInifitIntersection();
+            return std::abs(distanceSegToOrigin - plane.getDistance()) <= std::numeric_limits<float>::epsilon();
+        }
+
+        /*(n . PO( or d ) - n.OA) / n . AB*/
+        float t = ((plane.getDistance() - distanceSegToOrigin) / sub);
+
+        /*if t is not between 0 and 1 so not collision else compute OM with OM = OA + t * AB*/
+        if (t < 0.f || t > 1.f)
+        {
+            intersection.setNotIntersection();
+            return false;
+        }
+        else
+        {
+            intersection.setOneIntersection(seg.getPt1() + t * AB);
+
+            if (distanceSegToOrigin > plane.getDistance())
+            {
+                intersection.normalI1 = plane.getNormal();
+            }
+            else
+            {
+                intersection.normalI1 = -plane.getNormal();
+            }
+
+            return true;
+        }
+    }
+
+    inline bool SegmentPlane::isSegmentPlaneCollided(const Segment& seg, const Plane& plane)
+    {
+        return Plane::getSignedDistanceToPlane(plane, seg.getPt1()) * Plane::getSignedDistanceToPlane(plane, seg.getPt2()) <= 0.f;
+    }
+
 } /*namespace FoxMath*/
 
 #endif //_SEGMENT_PLANE_H
\ No newline at end of file
@@ -7,7 +7,13 @@
 
 #include "ShapeRelation/Intersection.hpp"
 #include "Shape3D/Segment.hpp"
-#include "GE/Core/Maths/Shape3D/Quad.hpp"
+#include "Shape3D/Quad.hpp"
+#include "Shape3D/Plane.hpp"
+#include "ShapeRelation/SegmentPlane.hpp"
+#include "ShapeRelation/SegmentSegment.hpp"
+
+#include <cmath>
+#include <limits>
 
 namespace FoxMath
 {
@@ -30,6 +36,9 @@ namespace FoxMath
 
         static bool isSegmentQuadCollided(const Segment& seg, const Quad& quad, Intersection& intersection);
 
+        /*Overlap only : no intersection point or normal. A segment in the plane of the quad use the complete test*/
+        static bool isSegmentQuadCollided(const Segment& seg, const Quad& quad);
+
         #pragma endregion //!static methods
 
         private :
@@ -37,7 +46,7 @@ namespace FoxMath
         #pragma region static methods
 
         /*using the Cohen–Sutherland algorithm to detect the emplacement of the point*/
-        static int detectPointEmplacement (const Vec2& point, const Vec2& min, const Vec2& max);
+        static int detectPointEmplacement (const Vec2f& point, const Vec2f& min, const Vec2f& max);
 
         static bool detectCollisionOn2DQuad(const Quad& quad, const Segment& seg, Intersection& intersection);
 
@@ -58,6 +67,162 @@ namespace FoxMath
         #pragma endregion //!static attribut
     };
 
+    inline bool SegmentQuad::isSegmentQuadCollided(const Segment& seg, const Quad& quad, Intersection& intersection)
+    {
+        /*We need to know the intersection*/
+        Plane planOfQuad = static_cast<Plane>(quad);
+
+        if (!SegmentPlane::isSegmentPlaneCollided(seg, planOfQuad, intersection))
+        {
+            intersection.setNotIntersection();
+            return false;
+        }
+
+        /*Check if the segment is on the plan*/
+        if (intersection.intersectionType == EIntersectionType::InfinyIntersection)
+        {
+            /*This is a plan problem that must be solve with SAT algorythme in 2 dimension*/
+            /*This case is imposible with 3d trajectory*/
+            intersection.setUnKnowIntersection();
+            return detectCollisionOn2DQuad(quad, seg, intersection);
+        }
+
+        /*Check if intersection is insid the quad*/
+        if (std::abs(Vec3f::dot(quad.getReferential().unitI, intersection.intersection1 - quad.getReferential().origin)) <= quad.getExtI() &&
+            std::abs(Vec3f::dot(quad.getReferential().unitJ, intersection.intersection1 - quad.getReferential().origin)) <= quad.getExtJ())
+        {
+            return true;
+        }
+
+        intersection.setNotIntersection();
+        return false;
+
+    }
+
+    inline int SegmentQuad::detectPointEmplacement (const Vec2f& point, const Vec2f& min, const Vec2f& max)
+    {
+        int code = INSIDE;      // initialised as being inside of [[clip window]]
+
+        if (point.getX() < min.getX())           // to the left of clip window
+        {
+            code |= LEFT;
+        }
+        else if (point.getX() > max.getX())      // to the right of clip window
+        {
+            code |= RIGHT;
+        }
+
+        if (point.getY() < min.getY())           // below the clip window
+        {
+            code |= BOTTOM;
+        }
+        else if (point.getY() > max.getY())      // above the clip window
+        {
+            code |= TOP;
+        }
+
+        return code;
+    }
+
+    inline bool SegmentQuad::detectCollisionOn2DQuad(const Quad& quad, const Segment& seg, Intersection& intersection)
+    {
+        //Keep on float for more visibility
+        float   rangeMinAxisX   = Vec3f::dot(quad.getReferential().origin + (-quad.getReferential().unitI * quad.getExtI()), quad.getReferential().unitI), 
+                rangeMaxAxisX   = rangeMinAxisX + 2.f * quad.getExtI(),
+                rangeMinAxisY   = Vec3f::dot(quad.getReferential().origin + (-quad.getReferential().unitJ * quad.getExtJ()), quad.getReferential().unitJ),
+                rangeMaxAxisY   = rangeMinAxisY + 2.f * quad.getExtJ(), 
+                rangePoint1X    = Vec3f::dot(seg.getPt1(), quad.getReferential().unitI),
+                rangePoint1Y    = Vec3f::dot(seg.getPt1(), quad.getReferential().unitJ),
+                rangePoint2X    = Vec3f::dot(seg.getPt2(), quad.getReferential().unitI),
+                rangePoint2Y    = Vec3f::dot(seg.getPt2(), quad.getReferential().unitJ);
+
+        Vec2f rangeMinXY {rangeMinAxisX, rangeMinAxisY};
+        Vec2f rangeMaxXY {rangeMaxAxisX, rangeMaxAxisY};
+        Vec2f rangePt1   {rangePoint1X, rangePoint1Y};
+        Vec2f rangePt2   {rangePoint2X, rangePoint2Y};
+
+        int emplacementCode1 = detectPointEmplacement(rangePt1, rangeMinXY, rangeMaxXY);
+        int emplacementCode2 = detectPointEmplacement(rangePt2, rangeMinXY, rangeMaxXY);
+
+        //                      OutCode : 
+        //          left     |  central  |   right
+        //          ---------------------------------
+        //  top     |1001 (9)|   1000 (8)|   1010 (10)
+        //  central |0001 (1)|   0000 (0)|   0010 (2)
+        //  bottom  |0101 (5)|   0100 (4)|   0110 (6)
+
+        //check if two point is inside the same zone
+        if (emplacementCode1 == emplacementCode2)
+        {
+            //If the emplacement first emplacement is Inside (the second is obligatory in same zone) there is infinit intersection. Else no collsion
+            if(emplacementCode1 == INSIDE)
+            {
+                intersection.setInifitIntersection();
+                return true;
+            }
+            else
+            {
+                intersection.setNotIntersection();
+                return false;
+            }
+        }
+
+        //check if two point are on the same border. Apply the mask of the border and compare it
+        //If true, there cannot be a collision
+        if (((emplacementCode1 & TOP) == TOP && (emplacementCode2 & TOP) == TOP) ||
+                ((emplacementCode1 & RIGHT) == RIGHT && (emplacementCode2 & RIGHT) == RIGHT) ||
+                ((emplacementCode1 & LEFT) == LEFT && (emplacementCode2 & LEFT) == LEFT) ||
+                ((emplacementCode1 & BOTTOM) == BOTTOM && (emplacementCode2 & BOTTOM) == BOTTOM))
+        {
+            intersection.setNotIntersection();
+            return false;
+        }
+
+        bool rst = false;
+
+        //The segment can only cross the border line that separate its two points : only check the edges with a different bit in the outcodes
+        int crossedBorders = emplacementCode1 ^ emplacementCode2;
+
+        intersection.setNotIntersection();
+
+        if ((crossedBorders & TOP) == TOP)
+            rst |= SegmentSegment::isSegmentSegmentCollided(seg.getPt1(), seg.getPt2(), quad.PtTopLeft(),      quad.PtTopRight(),    intersection);
+
+        if ((crossedBorders & RIGHT) == RIGHT)
+            rst |= SegmentSegment::isSegmentSegmentCollided(seg.getPt1(), seg.getPt2(), quad.PtTopRight(),     quad.PtBottomRight(), intersection);
+
+        if ((crossedBorders & BOTTOM) == BOTTOM)
+            rst |= SegmentSegment::isSegmentSegmentCollided(seg.getPt1(), seg.getPt2(), quad.PtBottomRight(),  quad.PtBottomLeft(),  intersection);
+
+        if ((crossedBorders & LEFT) == LEFT)
+            rst |= SegmentSegment::isSegmentSegmentCollided(seg.getPt1(), seg.getPt2(), quad.PtBottomLeft(),   quad.PtTopLeft(),     intersection);
+
+        return rst;
+    }
+
+    inline bool SegmentQuad::isSegmentQuadCollided(const Segment& seg, const Quad& quad)
+    {
+        const Referentialf& referential = quad.getReferential();
+        float distancePt1 = Vec3f::dot(seg.getPt1() - referential.origin, referential.unitK);
+        float distancePt2 = Vec3f::dot(seg.getPt2() - referential.origin, referential.unitK);
+
+        /*The segment must cross the plane of the quad*/
+        if (distancePt1 * distancePt2 > 0.f)
+            return false;
+
+        float sub = distancePt1 - distancePt2;
+        if (std::abs(sub) <= std::numeric_limits<float>::epsilon())
+        {
+            Intersection intersection;
+            return isSegmentQuadCollided(seg, quad, intersection);
+        }
+
+        Vec3f originToIntersection = seg.getPt1() + (distancePt1 / sub) * (seg.getPt2() - seg.getPt1()) - referential.origin;
+
+        return  std::abs(Vec3f::dot(referential.unitI, originToIntersection)) <= quad.getExtI() &&
+                std::abs(Vec3f::dot(referential.unitJ, originToIntersection)) <= quad.getExtJ();
+    }
+
 } /*namespace FoxMath*/
 
 #endif //_SEGMENT_QUAD_H
\ No newline at end of file
@@ -9,6 +9,9 @@
 #include "ShapeRelation/Intersection.hpp"
 #include "Shape3D/Segment.hpp"
 
+#include <algorithm>
+#include <limits>
+
 namespace FoxMath
 {
     class SegmentSegment
@@ -28,7 +31,13 @@ namespace FoxMath
 
         #pragma region static methods
 
-        static bool isSegmentSegmentCollided(const Vec3& a1, const Vec3& a2, const Vec3& b1, const Vec3& b2, Intersection& intersection);
+        static bool isSegmentSegmentCollided(const Vec3f& a1, const Vec3f& a2, const Vec3f& b1, const Vec3f& b2, Intersection& intersection);
+
+        /*Overlap only : same test without the intersection point*/
+        static bool isSegmentSegmentCollided(const Vec3f& a1, const Vec3f& a2, const Vec3f& b1, const Vec3f& b2);
+
+        /*Square distance between the closest points of the segments [a1, a2] and [b1, b2]*/
+        static float getSquareDistance(const Vec3f& a1, const Vec3f& a2, const Vec3f& b1, const Vec3f& b2);
 
         #pragma endregion //!static methods
 
@@ -36,9 +45,125 @@ namespace FoxMath
 
         #pragma region static methods
 
+        static float d(const Vec3f& m, const Vec3f& n, const Vec3f& o, const Vec3f& p);
+
+        /*ratio t1 on [a1, a2] of the closest point of the lines. Return true if the closest points are on both segments and at the same position
+        (square distance lower than epsilon * max(square length of segments, 1)). Parallel segments have no single closest point and return false*/
+        static bool computeClosestRatio(const Vec3f& a1, const Vec3f& a2, const Vec3f& b1, const Vec3f& b2, float& t1);
+
         #pragma endregion //!static methods
     };
 
+    inline float SegmentSegment::d(const Vec3f& m, const Vec3f& n, const Vec3f& o, const Vec3f& p)
+    {
+        return (m.getX() - n.getX()) * (o.getX() - p.getX()) + (m.getY() - n.getY()) * (o.getY() - p.getY()) + (m.getZ() - n.getZ()) * (o.getZ() - p.getZ());
+    }
+
+    inline bool SegmentSegment::computeClosestRatio(const Vec3f& a1, const Vec3f& a2, const Vec3f& b1, const Vec3f& b2, float& t1)
+    {
+        /*using distance between line algorythme. Found reference of this algorythme on : http://paulbourke.net/geometry/pointlineplane/*/
+
+        float sub1 = (d(a2, a1, a2, a1) * d(b2, b1, b2, b1) - d(b2, b1, a2, a1) * d(b2, b1, a2, a1));
+
+        /* if b dot d == 0, it means the lines are parallel so have infinite intersection points*/
+        if (sub1 == 0)
+            return false;
+
+        t1 = (d(a1, b1, b2, b1) * d(b2, b1, a2, a1) - d(a1, b1, a2, a1) * d(b2, b1, b2, b1)) / sub1;
+
+        float sub2 = d(b2, b1, b2, b1);
+
+        /* if b dot d == 0, it means the lines are parallel so have infinite intersection points*/
+        if (sub2 == 0)
+            return false;
+
+        float t2 = (d(a1, b1, b2, b1) + t1 * d(b2, b1, a2, a1)) / sub2;
+
+        if (t1 < 0 || t1 > 1 || t2 < 0 || t2 > 1)
+            return false;
+
+        /*Closest points of skew lines are distant : the segments cross only if the closest points are the same.
+        Rounding of the closest points grow with the inputs : the tolerance is relative to the square length of the segments*/
+        float squareTolerance = std::numeric_limits<float>::epsilon() * std::max({d(a2, a1, a2, a1), sub2, 1.f});
+
+        return (a1 + t1 * (a2 - a1) - (b1 + t2 * (b2 - b1))).squareLength() <= squareTolerance;
+    }
+
+    inline bool SegmentSegment::isSegmentSegmentCollided(const Vec3f& a1, const Vec3f& a2, const Vec3f& b1, const Vec3f& b2, Intersection& intersection)
+    {
+        float t1;
+        if (!computeClosestRatio(a1, a2, b1, b2, t1))
+            return false;
+
+        /*OM = OA + t(OB - OA)*/
+        if (intersection.intersectionType == EIntersectionType::OneIntersectiont)
+        {
+            intersection.setSecondIntersection(a1 + t1 * (a2 - a1));
+        }
+        else
+        {
+            intersection.setOneIntersection(a1 + t1 * (a2 - a1));
+        }
+
+        return true;
+    }
+
+    inline bool SegmentSegment::isSegmentSegmentCollided(const Vec3f& a1, const Vec3f& a2, const Vec3f& b1, const Vec3f& b2)
+    {
+        float t1;
+        return computeClosestRatio(a1, a2, b1, b2, t1);
+    }
+
+    inline float SegmentSegment::getSquareDistance(const Vec3f& a1, const Vec3f& a2, const Vec3f& b1, const Vec3f& b2)
+    {
+        /*Closest points a1 + s * (a2 - a1) and b1 + t * (b2 - b1) with s and t clamped in [0, 1] (Ericson, Real-Time Collision Detection 5.1.9)*/
+        Vec3f dA = a2 - a1;
+        Vec3f dB = b2 - b1;
+        Vec3f r  = a1 - b1;
+        float a  = dA.squareLength();
+        float e  = dB.squareLength();
+        float f  = Vec3f::dot(dB, r);
+        float s  = 0.f;
+        float t  = 0.f;
+
+        if (a <= std::numeric_limits<float>::epsilon())
+        {
+            if (e > std::numeric_limits<float>::epsilon())
+                t = std::clamp(f / e, 0.f, 1.f);
+        }
+        else
+        {
+            float c = Vec3f::dot(dA, r);
+
+            if (e <= std::numeric_limits<float>::epsilon())
+            {
+                s = std::clamp(-c / a, 0.f, 1.f);
+            }
+            else
+            {
+                float b = Vec3f::dot(dA, dB);
+                float denom = a * e - b * b;
+
+                /*Parallel segments : any s is valid*/
+                s = denom != 0.f ? std::clamp((b * f - c * e) / denom, 0.f, 1.f) : 0.f;
+                t = (b * s + f) / e;
+
+                if (t < 0.f)
+                {
+                    t = 0.f;
+                    s = std::clamp(-c / a, 0.f, 1.f);
+                }
+                else if (t > 1.f)
+                {
+                    t = 1.f;
+                    s = std::clamp((b - c) / a, 0.f, 1.f);
+                }
+            }
+        }
+
+        return (r + s * dA - t * dB).squareLength();
+    }
+
 } /*namespace FoxMath*/
 
 #endif //_SEGMENT_SEGMENT_H
\ No newline at end of file
@@ -6,6 +6,7 @@
 #define _SEGMENT_SPHERE_H
 
 #include "ShapeRelation/Intersection.hpp"
+#include "ShapeRelation/HitRecord.hpp"
 #include "Shape3D/Segment.hpp"
 #include "Shape3D/Sphere.hpp"
 
@@ -30,6 +31,15 @@ namespace FoxMath
 
         static bool isSegmentSphereCollided(const Segment& seg, const Sphere& sphere, Intersection& intersection);
 
+        /*Overlap only : no intersection point, normal or square root. A segment inside the sphere is collided*/
+        static bool isSegmentSphereCollided(const Segment& seg, const Sphere& sphere);
+
+        /*Compact result : ratios on the segment and packed normals. shapeIndex of hit is not written*/
+        static bool isSegmentSphereCollided(const Segment& seg, const Sphere& sphere, HitRecord& hit);
+
+        /*Append a HitRecord with the index of the sphere for each sphere hit by the segment. Return the number of hits appended*/
+        static size_t findAllSegmentSphereCollided(const Segment& seg, const Sphere* spheres, size_t count, HitBuffer& hits);
+
         #pragma endregion //!static methods
 
         private :
@@ -38,6 +48,97 @@ namespace FoxMath
         #pragma endregion //!static methods
     };
 
+    inline bool SegmentSphere::isSegmentSphereCollided(const Segment& seg, const Sphere& sphere, Intersection& intersection)
+    {
+        Vec3f AOmega        = sphere.getCenter() - seg.getPt1();
+        Vec3f AB            = seg.getPt2() - seg.getPt1();
+
+        /*AOmega² - R + 2AB. OmegaA * t + AB² * t² = 0*/
+        float a = AB.squareLength();
+        float b = 2.f * Vec3f::dot(AB, -AOmega);
+        float c = AOmega.squareLength() - sphere.getRadius() * sphere.getRadius();
+
+        /*We comput the discriminent*/
+        if (Intersection::computeDiscriminentAndSolveEquation(a, b, c, seg.getPt1(), seg.getPt2(), intersection))
+        {
+            if (intersection.intersectionType == EIntersectionType::TwoIntersectiont)
+            {
+                intersection.normalI2 = (intersection.intersection2 - sphere.getCenter()).getNormalized();
+            }
+            intersection.normalI1 = (intersection.intersection1 - sphere.getCenter()).getNormalized();
+
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    inline bool SegmentSphere::isSegmentSphereCollided(const Segment& seg, const Sphere& sphere)
+    {
+        Vec3f AOmega    = sphere.getCenter() - seg.getPt1();
+        Vec3f AB        = seg.getPt2() - seg.getPt1();
+        float squareRadius = sphere.getRadius() * sphere.getRadius();
+        float squareLengthAOmega = AOmega.squareLength();
+
+        /*Square distance between the center and its projection on the segment, compared without division*/
+        float projection = Vec3f::dot(AOmega, AB);
+        if (projection <= 0.f)
+        {
+            return squareLengthAOmega <= squareRadius;
+        }
+
+        float squareLengthAB = AB.squareLength();
+        if (projection >= squareLengthAB)
+        {
+            return (AOmega - AB).squareLength() <= squareRadius;
+        }
+
+        return squareLengthAOmega * squareLengthAB - projection * projection <= squareRadius * squareLengthAB;
+    }
+
+    inline bool SegmentSphere::isSegmentSphereCollided(const Segment& seg, const Sphere& sphere, HitRecord& hit)
+    {
+        Vec3f AOmega        = sphere.getCenter() - seg.getPt1();
+        Vec3f AB            = seg.getPt2() - seg.getPt1();
+
+        float a = AB.squareLength();
+        float b = 2.f * Vec3f::dot(AB, -AOmega);
+        float c = AOmega.squareLength() - sphere.getRadius() * sphere.getRadius();
+
+        if (!HitRecord::computeDiscriminentAndSolveEquation(a, b, c, hit))
+        {
+            return false;
+        }
+
+        /*Normal at ratio t is (A + AB * t - Omega) / R*/
+        for (size_t index = 0; index < hit.getPointCount(); ++index)
+        {
+            hit.normal[index] = PackedNormal(AB * hit.t[index] - AOmega);
+        }
+
+        return true;
+    }
+
+    inline size_t SegmentSphere::findAllSegmentSphereCollided(const Segment& seg, const Sphere* spheres, size_t count, HitBuffer& hits)
+    {
+        size_t hitCount = 0;
+        HitRecord hit;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (isSegmentSphereCollided(seg, spheres[i], hit))
+            {
+                hit.shapeIndex = static_cast<uint32_t>(i);
+                hits.append(hit);
+                ++hitCount;
+            }
+        }
+
+        return hitCount;
+    }
+
 } /*namespace FoxMath*/
 
 #endif //_SEGMENT_SPHERE_H
\ No newline at end of file
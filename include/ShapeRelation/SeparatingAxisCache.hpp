@@ -0,0 +1,136 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 16 h 20
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stddef.h> //sizt_t
+#include <stdint.h> //uint32_t, uint64_t
+#include <unordered_map> //std::unordered_map
+#include <algorithm> //std::min, std::max
+
+#include "Shape3D/OrientedBox.hpp"
+#include "ShapeRelation/OrientedBoxOrientedBox.hpp"
+
+namespace FoxMath
+{
+    /**
+     * @brief Last separating axis (or axis of minimum penetration) of each pair of oriented boxes. The SAT start with this axis :
+     * between two frames most of separated pairs are still separated by the same axis and exit after one axis test instead of 15.
+     * Pairs are keyed by the ids of both boxes (proxy id of the broad phase, index...) whatever the order
+     */
+    class SeparatingAxisCache
+    {
+        protected:
+
+        #pragma region attribut
+
+        std::unordered_map<uint64_t, int> m_separatingAxis; /*key = min id << 32 | max id. Axis is relative to the box with the min id as box1*/
+
+        #pragma endregion //!attribut
+
+        #pragma region static methods
+
+        [[nodiscard]] static inline
+        uint64_t    getPairKey  (uint32_t id1, uint32_t id2) noexcept;
+
+        #pragma endregion //!static methods
+
+        public:
+
+        #pragma region constructor/destructor
+
+        SeparatingAxisCache ()                                                  = default;
+        SeparatingAxisCache (const SeparatingAxisCache& other)                  = default;
+        SeparatingAxisCache (SeparatingAxisCache&& other) noexcept              = default;
+        ~SeparatingAxisCache ()                                                 = default;
+        SeparatingAxisCache& operator=(SeparatingAxisCache const& other)        = default;
+        SeparatingAxisCache& operator=(SeparatingAxisCache && other)            = default;
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        /**
+         * @brief OrientedBoxOrientedBox::isBothOrientedBoxCollided starting with the cached axis of the pair. The new axis is cached
+         * 
+         * @param id1 
+         * @param box1 
+         * @param id2 
+         * @param box2 
+         * @return true 
+         * @return false 
+         */
+        inline bool isBothOrientedBoxCollided   (uint32_t id1, const OrientedBox& box1, uint32_t id2, const OrientedBox& box2);
+
+        /**
+         * @brief Same with the penetration. Normal is from box1 to box2 and axis is relative to the order of the parameters
+         * 
+         * @param id1 
+         * @param box1 
+         * @param id2 
+         * @param box2 
+         * @param penetration 
+         * @return true 
+         * @return false 
+         */
+        inline bool isBothOrientedBoxCollided   (uint32_t id1, const OrientedBox& box1, uint32_t id2, const OrientedBox& box2, OrientedBoxPenetration& penetration);
+
+        /**
+         * @brief Forget the pair. Call it when the broad phase remove the pair so the cache does not grow
+         * 
+         * @param id1 
+         * @param id2 
+         */
+        inline void removePair                  (uint32_t id1, uint32_t id2) noexcept;
+
+        inline void clear                       () noexcept { m_separatingAxis.clear(); }
+
+        #pragma endregion //!methods
+
+        #pragma region accessor
+
+        /**
+         * @brief Return the cached axis of the pair (relative to the box with the min id as box1) or -1
+         * 
+         * @param id1 
+         * @param id2 
+         * @return int 
+         */
+        [[nodiscard]] inline
+        int     getSeparatingAxis   (uint32_t id1, uint32_t id2) const noexcept;
+
+        [[nodiscard]] inline
+        size_t  getPairCount        () const noexcept { return m_separatingAxis.size(); }
+
+        #pragma endregion //!accessor
+    };
+
+    #include "SeparatingAxisCache.inl"
+
+} /*namespace FoxMath*/
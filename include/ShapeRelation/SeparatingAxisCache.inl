@@ -0,0 +1,78 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 16 h 20
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+inline
+uint64_t SeparatingAxisCache::getPairKey (uint32_t id1, uint32_t id2) noexcept
+{
+    return (static_cast<uint64_t>(std::min(id1, id2)) << 32) | static_cast<uint64_t>(std::max(id1, id2));
+}
+
+inline
+bool SeparatingAxisCache::isBothOrientedBoxCollided (uint32_t id1, const OrientedBox& box1, uint32_t id2, const OrientedBox& box2)
+{
+    /*Insert -1 for a new pair : full test*/
+    int& separatingAxis = m_separatingAxis.try_emplace(getPairKey(id1, id2), -1).first->second;
+
+    if (id1 <= id2)
+        return OrientedBoxOrientedBox::isBothOrientedBoxCollided(box1, box2, separatingAxis);
+
+    return OrientedBoxOrientedBox::isBothOrientedBoxCollided(box2, box1, separatingAxis);
+}
+
+inline
+bool SeparatingAxisCache::isBothOrientedBoxCollided (uint32_t id1, const OrientedBox& box1, uint32_t id2, const OrientedBox& box2, OrientedBoxPenetration& penetration)
+{
+    int& separatingAxis = m_separatingAxis.try_emplace(getPairKey(id1, id2), -1).first->second;
+
+    if (id1 <= id2)
+        return OrientedBoxOrientedBox::isBothOrientedBoxCollided(box1, box2, separatingAxis, penetration);
+
+    if (!OrientedBoxOrientedBox::isBothOrientedBoxCollided(box2, box1, separatingAxis, penetration))
+        return false;
+
+    /*Penetration of box1 in box2 : back to the order of the parameters*/
+    penetration.normal  = -penetration.normal;
+    penetration.axis    = OrientedBoxOrientedBox::getSwappedAxis(penetration.axis);
+    return true;
+}
+
+inline
+void SeparatingAxisCache::removePair (uint32_t id1, uint32_t id2) noexcept
+{
+    m_separatingAxis.erase(getPairKey(id1, id2));
+}
+
+inline
+int SeparatingAxisCache::getSeparatingAxis (uint32_t id1, uint32_t id2) const noexcept
+{
+    const auto it = m_separatingAxis.find(getPairKey(id1, id2));
+    return it == m_separatingAxis.end() ? -1 : it->second;
+}
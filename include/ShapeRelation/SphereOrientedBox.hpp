@@ -7,7 +7,10 @@
 
 #include "ShapeRelation/Intersection.hpp"
 #include "Shape3D/Sphere.hpp"
-#include "GE/Core/Maths/Shape3D/OrientedBox.hpp"
+#include "Shape3D/OrientedBox.hpp"
+
+#include <algorithm>
+#include <cmath>
 
 namespace FoxMath
 {
@@ -30,6 +33,9 @@ namespace FoxMath
 
         static bool isSphereOrientedBoxCollided(const Sphere& sphere, const OrientedBox& box, Intersection& intersection);
 
+        /*Overlap only : squared distance between the center and the nearest point of the box, without square root*/
+        static bool isSphereOrientedBoxCollided(const Sphere& sphere, const OrientedBox& box);
+
         #pragma endregion //!static methods
 
         private :
@@ -38,6 +44,48 @@ namespace FoxMath
         #pragma endregion //!static methods
     };
 
+    inline bool SphereOrientedBox::isSphereOrientedBoxCollided(const Sphere& sphere, const OrientedBox& box, Intersection& intersection)
+    {
+        /*Step 1 : Find if the both shape are non collided*/
+        //looking for a collision between the bow and the AABB of the sphere.
+        Vec3f BOmega = Referentialf::globalToLocalPosition(box.getReferential(), sphere.getCenter());
+
+        if (std::abs(BOmega.getX()) > box.getExtI() + sphere.getRadius() ||
+            std::abs(BOmega.getY()) > box.getExtJ() + sphere.getRadius() ||
+            std::abs(BOmega.getZ()) > box.getExtK() + sphere.getRadius())
+        {
+            intersection.setNotIntersection();
+            return false;
+        }
+
+        /*Step 2 : find the near point from box to the sphere*/
+        Vec3f pointInBoxNearestOfSphere { std::clamp(BOmega.getX(), -box.getExtI(), box.getExtI()),
+                                          std::clamp(BOmega.getY(), -box.getExtJ(), box.getExtJ()),
+                                          std::clamp(BOmega.getZ(), -box.getExtK(), box.getExtK())};
+
+        /*Step 3 : looking for a collision point*/
+        if ((BOmega - pointInBoxNearestOfSphere).squareLength() <= sphere.getRadius() * sphere.getRadius())
+        {
+            intersection.setOneIntersection(Referentialf::localToGlobalPosition(box.getReferential(), pointInBoxNearestOfSphere));
+            return true;
+        }
+
+        intersection.setNotIntersection();
+        return false;
+    }
+
+    inline bool SphereOrientedBox::isSphereOrientedBoxCollided(const Sphere& sphere, const OrientedBox& box)
+    {
+        Vec3f BOmega = Referentialf::globalToLocalPosition(box.getReferential(), sphere.getCenter());
+
+        /*Distance to the box on each axis, 0 inside the slab*/
+        float dx = std::max(std::abs(BOmega.getX()) - box.getExtI(), 0.f);
+        float dy = std::max(std::abs(BOmega.getY()) - box.getExtJ(), 0.f);
+        float dz = std::max(std::abs(BOmega.getZ()) - box.getExtK(), 0.f);
+
+        return dx * dx + dy * dy + dz * dz <= sphere.getRadius() * sphere.getRadius();
+    }
+
 } /*namespace FoxMath*/
 
 #endif //_SPHERE_ORIENTED_BOX_H
\ No newline at end of file
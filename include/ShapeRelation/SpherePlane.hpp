@@ -37,6 +37,12 @@ namespace FoxMath
         #pragma endregion //!static methods
     };
 
+    inline bool SpherePlane::isSphereOnOrForwardPlanCollided(const Sphere& sphere, const Plane& plane)
+    {
+        float distanceSphereToOrigin = Vec3f::dot(sphere.getCenter(), plane.getNormal());
+        return distanceSphereToOrigin > -sphere.getRadius() + plane.getDistance();
+    }
+
 } /*namespace FoxMath*/
 
 #endif //_SPHERE_PLANE_H
\ No newline at end of file
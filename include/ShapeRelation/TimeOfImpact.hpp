@@ -0,0 +1,204 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 14 h 20
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <stddef.h> //sizt_t
+#include <stdint.h> //uint32_t
+#include <utility> //std::pair
+#include <vector> //std::vector
+#include <limits> //std::numeric_limits
+#include <algorithm> //std::max, std::clamp
+#include <cmath> //std::acos, std::sqrt
+
+#include "Vector/Vector.hpp"
+#include "Quaternion/Quaternion.hpp"
+#include "Shape3D/Segment.hpp"
+#include "Shape3D/Sphere.hpp"
+#include "Shape3D/Capsule.hpp"
+#include "Shape3D/OrientedBox.hpp"
+#include "ShapeRelation/GJK.hpp"
+#include "ShapeRelation/EPA.hpp"
+
+namespace FoxMath
+{
+    /*Motion of a shape during a step : translation of its center and rotation around its center, both at constant speed*/
+    struct RigidMotion
+    {
+        Vec3f               translation {Vec3f::zero};
+        Quaternion<float>   rotation    {Quaternion<float>::identity};
+    };
+
+    struct ShapeImpact
+    {
+        float   time    {1.f};          /*ratio of the step in [0, 1]*/
+        Vec3f   normal  {Vec3f::zero};  /*unit contact normal from A to B*/
+        Vec3f   point   {Vec3f::zero};  /*middle of the closest points of both shapes at time*/
+    };
+
+    struct PairImpact
+    {
+        uint32_t    idA;
+        uint32_t    idB;
+        ShapeImpact impact;
+    };
+
+    /**
+     * @brief Time of impact of two moving convex shapes (Sphere, Capsule, OrientedBox) by conservative advancement :
+     * GJK give the distance and the normal, the shapes are advanced by distance / (bound of the closing speed along the normal).
+     * The shapes never overlap at the advanced time so thin and fast shapes can not tunnel.
+     * @note Shapes overlapped at the begining of the step have an impact at time 0 with the normal of EPA
+     */
+    class TimeOfImpact
+    {
+        public:
+
+        #pragma region static attribut
+
+        static constexpr size_t maxIteration        = 64;
+        static constexpr float  defaultTolerance    = 1e-3f;   /*shapes in contact when their distance is less than the tolerance*/
+
+        #pragma endregion //!static attribut
+
+        #pragma region constructor/destructor
+
+        TimeOfImpact ()                                     = delete;
+        TimeOfImpact (const TimeOfImpact& other)            = delete;
+        TimeOfImpact (TimeOfImpact&& other)                 = delete;
+        ~TimeOfImpact ()                                    = delete;
+        TimeOfImpact& operator=(TimeOfImpact const& other)  = delete;
+        TimeOfImpact& operator=(TimeOfImpact && other)      = delete;
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region static methods
+
+        /**
+         * @brief Return true if both shapes touch during the step and fill impact with the first time of contact.
+         * If the iterations are exhausted, the last (conservative) time is returned as impact
+         * 
+         * @tparam TShapeA : Sphere, Capsule or OrientedBox
+         * @tparam TShapeB : Sphere, Capsule or OrientedBox
+         * @param shapeA : shape at the begining of the step
+         * @param motionA 
+         * @param shapeB : shape at the begining of the step
+         * @param motionB 
+         * @param impact 
+         * @param tolerance : distance of contact
+         * @return true 
+         * @return false 
+         */
+        template <typename TShapeA, typename TShapeB>
+        [[nodiscard]] static inline
+        bool    computeTimeOfImpact     (const TShapeA& shapeA, const RigidMotion& motionA, const TShapeB& shapeB, const RigidMotion& motionB, 
+                                         ShapeImpact& impact, float tolerance = defaultTolerance) noexcept;
+
+        /**
+         * @brief Time of impact of the pairs of a broad phase (use the fat AABB of the swept shapes). pairs[i].first is the index
+         * in shapesA and motionsA, pairs[i].second the index in shapesB and motionsB (give the same arrays for one set of shapes).
+         * The impacts are appended to impacts, in the order of the pairs
+         * 
+         * @tparam TShapeA 
+         * @tparam TShapeB 
+         * @param shapesA 
+         * @param motionsA 
+         * @param shapesB 
+         * @param motionsB 
+         * @param pairs 
+         * @param pairCount 
+         * @param impacts 
+         * @param tolerance 
+         * @return size_t : number of impacts appended
+         */
+        template <typename TShapeA, typename TShapeB>
+        static inline
+        size_t  computeTimeOfImpacts    (const TShapeA* shapesA, const RigidMotion* motionsA, const TShapeB* shapesB, const RigidMotion* motionsB,
+                                         const std::pair<uint32_t, uint32_t>* pairs, size_t pairCount, std::vector<PairImpact>& impacts,
+                                         float tolerance = defaultTolerance);
+
+        /**
+         * @brief Shape moved by the ratio time of its motion
+         * 
+         * @param shape 
+         * @param motion 
+         * @param time : ratio of the step in [0, 1]
+         * @return Sphere 
+         */
+        [[nodiscard]] static inline
+        Sphere      getShapeAtTime      (const Sphere& shape, const RigidMotion& motion, float time) noexcept;
+
+        [[nodiscard]] static inline
+        Capsule     getShapeAtTime      (const Capsule& shape, const RigidMotion& motion, float time) noexcept;
+
+        [[nodiscard]] static inline
+        OrientedBox getShapeAtTime      (const OrientedBox& shape, const RigidMotion& motion, float time) noexcept;
+
+        #pragma endregion //!static methods
+
+        protected:
+
+        /*Motion with the angle and axis of the rotation extracted once for all the iterations*/
+        struct MotionSweep
+        {
+            Vec3f   translation;
+            Vec3f   axis;
+            float   angle;
+
+            explicit inline
+            MotionSweep (const RigidMotion& motion) noexcept;
+
+            [[nodiscard]] inline
+            Quaternion<float> getRotation (float time) const noexcept;
+        };
+
+        #pragma region static methods
+
+        [[nodiscard]] static inline Sphere      getShapeAtTime      (const Sphere& shape, const MotionSweep& sweep, float time) noexcept;
+        [[nodiscard]] static inline Capsule     getShapeAtTime      (const Capsule& shape, const MotionSweep& sweep, float time) noexcept;
+        [[nodiscard]] static inline OrientedBox getShapeAtTime      (const OrientedBox& shape, const MotionSweep& sweep, float time) noexcept;
+
+        /*Shape without its radius (point or segment) and the radius*/
+        [[nodiscard]] static inline Segment             getCore     (const Sphere& shape) noexcept;
+        [[nodiscard]] static inline const Segment&      getCore     (const Capsule& shape) noexcept;
+        [[nodiscard]] static inline const OrientedBox&  getCore     (const OrientedBox& shape) noexcept;
+        [[nodiscard]] static inline float               getMargin   (const Sphere& shape) noexcept;
+        [[nodiscard]] static inline float               getMargin   (const Capsule& shape) noexcept;
+        [[nodiscard]] static inline float               getMargin   (const OrientedBox& shape) noexcept;
+
+        /*Distance from the center to the farthest point of the shape : bound of the speed of a point by radian of rotation*/
+        [[nodiscard]] static inline float       getRotationRadius   (const Sphere& shape) noexcept;
+        [[nodiscard]] static inline float       getRotationRadius   (const Capsule& shape) noexcept;
+        [[nodiscard]] static inline float       getRotationRadius   (const OrientedBox& shape) noexcept;
+
+        #pragma endregion //!static methods
+    };
+
+    #include "TimeOfImpact.inl"
+
+} /*namespace FoxMath*/
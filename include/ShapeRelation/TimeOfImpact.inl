@@ -0,0 +1,257 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 14 h 20
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+inline
+TimeOfImpact::MotionSweep::MotionSweep (const RigidMotion& motion) noexcept
+    :   translation {motion.translation},
+        axis        {Vec3f::zero},
+        angle       {0.f}
+{
+    /*Shortest arc : q and -q are the same rotation*/
+    Quaternion<float> rotation = motion.rotation.getNormalize();
+    if (rotation.getW() < 0.f)
+        rotation = -rotation;
+
+    const float halfAngle = std::acos(std::clamp(rotation.getW(), -1.f, 1.f));
+    const float halfSin   = rotation.getXYZ().length();
+
+    if (halfSin > std::numeric_limits<float>::epsilon())
+    {
+        axis    = rotation.getXYZ() / halfSin;
+        angle   = 2.f * halfAngle;
+    }
+}
+
+inline
+Quaternion<float> TimeOfImpact::MotionSweep::getRotation (float time) const noexcept
+{
+    return Quaternion<float>(axis, Angle<EAngleType::Radian, float>(angle * time));
+}
+
+template <typename TShapeA, typename TShapeB>
+inline
+bool TimeOfImpact::computeTimeOfImpact (const TShapeA& shapeA, const RigidMotion& motionA, const TShapeB& shapeB, const RigidMotion& motionB, 
+                                        ShapeImpact& impact, float tolerance) noexcept
+{
+    const MotionSweep sweepA (motionA);
+    const MotionSweep sweepB (motionB);
+
+    /*Bound of the speed of the points of the shapes due to the rotation*/
+    const float angularBound    = sweepA.angle * getRotationRadius(shapeA) + sweepB.angle * getRotationRadius(shapeB);
+    const Vec3f relativeMotion  = sweepA.translation - sweepB.translation;
+
+    /*GJK run on the cores (center of sphere, segment of capsule) : finite convergence on polytopes, the radius is removed from the distance*/
+    const float margin = getMargin(shapeA) + getMargin(shapeB);
+
+    GJKSimplex  simplex;
+    Vec3f       normal  = Vec3f::zero;
+    float       time    = 0.f;
+
+    for (size_t iteration = 0; iteration <= maxIteration; ++iteration)
+    {
+        const TShapeA movedShapeA = getShapeAtTime(shapeA, sweepA, time);
+        const TShapeB movedShapeB = getShapeAtTime(shapeB, sweepB, time);
+        const auto&   coreA       = getCore(movedShapeA);
+        const auto&   coreB       = getCore(movedShapeB);
+
+        Vec3f closestPointA, closestPointB;
+        const float coreDistance = GJK::getDistance(coreA, coreB, closestPointA, closestPointB, simplex);
+
+        /*Overlapped at the begining of the step*/
+        if (iteration == 0 && coreDistance <= margin)
+        {
+            ConvexPenetration penetration;
+            (void)EPA::getPenetration(movedShapeA, movedShapeB, penetration);
+
+            impact.time     = 0.f;
+            impact.normal   = penetration.normal;
+            impact.point    = (penetration.pointA + penetration.pointB) * 0.5f;
+            return true;
+        }
+
+        /*Keep the normal of the last iteration if the cores touch*/
+        if (coreDistance > std::numeric_limits<float>::epsilon())
+            normal = GJK::getClosestPoint(simplex) / -coreDistance;
+
+        /*Gap between the shapes along the normal : lower bound of the distance even if GJK stopped before convergence*/
+        const float separation = Vec3f::dot(coreB.getSupportPoint(-normal) - coreA.getSupportPoint(normal), normal) - margin;
+
+        /*Contact, or iterations exhausted : the time is still conservative*/
+        if (separation <= tolerance || iteration == maxIteration)
+        {
+            impact.time     = time;
+            impact.normal   = normal;
+            impact.point    = (closestPointA + normal * getMargin(shapeA) + closestPointB - normal * getMargin(shapeB)) * 0.5f;
+            return true;
+        }
+
+        /*The gap along the normal can not decrease faster than closingSpeed*/
+        const float closingSpeed = Vec3f::dot(relativeMotion, normal) + angularBound;
+        if (closingSpeed <= 0.f)
+            return false;
+
+        time += separation / closingSpeed;
+        if (time > 1.f)
+            return false;
+    }
+
+    return false;
+}
+
+template <typename TShapeA, typename TShapeB>
+inline
+size_t TimeOfImpact::computeTimeOfImpacts (const TShapeA* shapesA, const RigidMotion* motionsA, const TShapeB* shapesB, const RigidMotion* motionsB,
+                                           const std::pair<uint32_t, uint32_t>* pairs, size_t pairCount, std::vector<PairImpact>& impacts,
+                                           float tolerance)
+{
+    const size_t previousSize = impacts.size();
+
+    for (size_t i = 0; i < pairCount; ++i)
+    {
+        const uint32_t idA = pairs[i].first;
+        const uint32_t idB = pairs[i].second;
+
+        ShapeImpact impact;
+        if (computeTimeOfImpact(shapesA[idA], motionsA[idA], shapesB[idB], motionsB[idB], impact, tolerance))
+            impacts.push_back(PairImpact{idA, idB, impact});
+    }
+
+    return impacts.size() - previousSize;
+}
+
+inline
+Sphere TimeOfImpact::getShapeAtTime (const Sphere& shape, const RigidMotion& motion, float time) noexcept
+{
+    return getShapeAtTime(shape, MotionSweep(motion), time);
+}
+
+inline
+Capsule TimeOfImpact::getShapeAtTime (const Capsule& shape, const RigidMotion& motion, float time) noexcept
+{
+    return getShapeAtTime(shape, MotionSweep(motion), time);
+}
+
+inline
+OrientedBox TimeOfImpact::getShapeAtTime (const OrientedBox& shape, const RigidMotion& motion, float time) noexcept
+{
+    return getShapeAtTime(shape, MotionSweep(motion), time);
+}
+
+inline
+Sphere TimeOfImpact::getShapeAtTime (const Sphere& shape, const MotionSweep& sweep, float time) noexcept
+{
+    /*Rotation around the center do not move the sphere*/
+    return Sphere(shape.getRadius(), shape.getCenter() + sweep.translation * time);
+}
+
+inline
+Capsule TimeOfImpact::getShapeAtTime (const Capsule& shape, const MotionSweep& sweep, float time) noexcept
+{
+    const Vec3f center = shape.getSegment().getCenter();
+    Vec3f       halfSegment = shape.getSegment().getPt2() - center;
+
+    if (sweep.angle != 0.f)
+        sweep.getRotation(time).rotateVector(halfSegment);
+
+    const Vec3f movedCenter = center + sweep.translation * time;
+    return Capsule(Segment(movedCenter - halfSegment, movedCenter + halfSegment), shape.getRadius());
+}
+
+inline
+OrientedBox TimeOfImpact::getShapeAtTime (const OrientedBox& shape, const MotionSweep& sweep, float time) noexcept
+{
+    Referentialf referential = shape.getReferential();
+    referential.origin += sweep.translation * time;
+
+    if (sweep.angle != 0.f)
+    {
+        const Quaternion<float> rotation = sweep.getRotation(time);
+        rotation.rotateVector(referential.unitI);
+        rotation.rotateVector(referential.unitJ);
+        rotation.rotateVector(referential.unitK);
+    }
+
+    return OrientedBox(referential, shape.getExtI(), shape.getExtJ(), shape.getExtK());
+}
+
+inline
+float TimeOfImpact::getRotationRadius (const Sphere&) noexcept
+{
+    return 0.f;
+}
+
+inline
+float TimeOfImpact::getRotationRadius (const Capsule& shape) noexcept
+{
+    return shape.getSegment().getLenght() * 0.5f + shape.getRadius();
+}
+
+inline
+float TimeOfImpact::getRotationRadius (const OrientedBox& shape) noexcept
+{
+    return std::sqrt(shape.getExtI() * shape.getExtI() + shape.getExtJ() * shape.getExtJ() + shape.getExtK() * shape.getExtK());
+}
+
+inline
+Segment TimeOfImpact::getCore (const Sphere& shape) noexcept
+{
+    return Segment(shape.getCenter(), shape.getCenter());
+}
+
+inline
+const Segment& TimeOfImpact::getCore (const Capsule& shape) noexcept
+{
+    return shape.getSegment();
+}
+
+inline
+const OrientedBox& TimeOfImpact::getCore (const OrientedBox& shape) noexcept
+{
+    return shape;
+}
+
+inline
+float TimeOfImpact::getMargin (const Sphere& shape) noexcept
+{
+    return shape.getRadius();
+}
+
+inline
+float TimeOfImpact::getMargin (const Capsule& shape) noexcept
+{
+    return shape.getRadius();
+}
+
+inline
+float TimeOfImpact::getMargin (const OrientedBox&) noexcept
+{
+    return 0.f;
+}
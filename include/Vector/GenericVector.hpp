@@ -32,14 +32,17 @@
 #include "Types/Implicit.hpp" //implicit
 #include "Types/SFINAEShorthand.hpp" //IsArithmetic<TType>, IsSame, Pack
 #include "Numeric/Limits.hpp" //isSame
+#include "Numeric/ConstexprMath.hpp" //Numeric::sqrt
+#include "Numeric/PrecisionMath.hpp" //EPrecision, Numeric::rsqrt<EPrecision>, Numeric::sinCos<EPrecision>
 #include "Angle/Angle.hpp" //Angle
+#include "SIMD/SIMD.hpp" //SIMDTraits, SIMD kernels (opt-in with FOXMATH_USE_SIMD)
 
 #include <array> //std::array
 #include <stddef.h> //sizt_t
 #include <iostream> //ostream, istream
 #include <cassert> //assert
 #define _USE_MATH_DEFINES
-#include <math.h> //sqrt, lerp (if c++ 2020) //TODO: only include if C++ 20 when own sqrt implemented
+#include <math.h> //lerp (if c++ 2020)
 #include <stdexcept> //std::out_of_range
 
 /*Only if c++ >= 2020*/
@@ -56,6 +59,10 @@ namespace FoxMath
                 IsArithmetic<TType> = true>
     class GenericVector;
 
+    /*Opt-in expression templates, defined in Vector/VectorExpression.hpp*/
+    template <typename TDerived, size_t TLength, typename TType>
+    class VectorExpression;
+
     /*Specilisation of GenericVector class*/
     template <size_t TLength, typename TType>
     class GenericVector<TLength, TType>
@@ -66,7 +73,8 @@ namespace FoxMath
     
         #pragma region attribut
 
-        std::array<TType, TLength> m_data {};
+        /*16 bytes aligned if SIMD operators are enabled for this length and type (Vector4)*/
+        alignas(SIMDTraits<TLength, TType>::alignment) std::array<TType, TLength> m_data {};
 
         #pragma endregion //!attribut
     
@@ -126,6 +134,17 @@ namespace FoxMath
         explicit inline constexpr
         GenericVector (const GenericVector<TLengthOther, TType>& other, TScalarArgs... args) noexcept;
 
+        /**
+         * @brief Evaluate an expression of Vector/VectorExpression.hpp in one loop
+         * @example `Vec3f vec = lazy(lhs) * scalar + rhs;`
+         * 
+         * @tparam TDerived 
+         * @param expression 
+         */
+        template <typename TDerived>
+        implicit inline constexpr
+        GenericVector (const VectorExpression<TDerived, TLength, TType>& expression) noexcept;
+
         #pragma endregion //!constructor/destructor
     
         #pragma region methods
@@ -155,7 +174,6 @@ namespace FoxMath
          * 
          * @return constexpr TType 
          */
-        //TODO: method not constexpr because it use std::sqrt. Replace it by my own function
         [[nodiscard]] inline constexpr
         TType length () const noexcept;
 
@@ -182,16 +200,20 @@ namespace FoxMath
         /**
          * @brief Normalize the generic vector. If the generic vector is null (all components are set to 0), nothing is done.
          * 
+         * @tparam TPrecision : Exact divide each component by length. Fast and Approximate multiply by rsqrt<TPrecision> of the square length (floating point only)
          * @return constexpr GenericVector& 
          */
+        template <EPrecision TPrecision = defaultPrecision>
         inline constexpr
 		GenericVector& 	    normalize	        () noexcept;
 
         /**
          * @brief  Returns the normalized generic vector. If the generic vector is null (all components are set to 0), then generic vector zero is returned.
          * 
+         * @tparam TPrecision : see normalize
          * @return constexpr const GenericVector& 
          */
+        template <EPrecision TPrecision = defaultPrecision>
         [[nodiscard]] inline constexpr
         GenericVector      getNormalized		() const noexcept;
 
@@ -321,22 +343,38 @@ namespace FoxMath
         /**
          * @brief rotate generic vector around another unit generic vector. This function assert if axis is not unit
          * 
+         * @tparam TPrecision : precision of the fused sin and cos of angle (see Numeric::sinCos)
          * @param unitAxis 
          * @param angleRad 
          */
+        template <EPrecision TPrecision = defaultPrecision>
         inline constexpr
 		GenericVector& rotateAroundAxis (const GenericVector& unitAxis, const Angle<EAngleType::Radian, TType>& angle) noexcept;
 
         /**
          * @brief Get the Rotation Around Axis object
          * 
+         * @tparam TPrecision : precision of the fused sin and cos of angle (see Numeric::sinCos)
          * @param unitAxis 
          * @param angleRad 
          * @return GenericVector 
          */
+        template <EPrecision TPrecision = defaultPrecision>
         [[nodiscard]] inline constexpr
 		GenericVector getRotationAroundAxis (const GenericVector& unitAxis, const Angle<EAngleType::Radian, TType>& angle) const noexcept;
 
+        /**
+         * @brief Sin and cos of each component (angles in radian) in one pass. Float Vector3 and Vector4 with FOXMATH_USE_SIMD (Fast and Approximate)
+         * evaluate all components with one SIMD::sinCos4 : the 3 Euler angles of a rotation cost one sinCos
+         * 
+         * @tparam TPrecision : see Numeric::sinCos
+         * @param sinVector 
+         * @param cosVector 
+         */
+        template <EPrecision TPrecision = defaultPrecision>
+        inline constexpr
+        void getSinCos (GenericVector& sinVector, GenericVector& cosVector) const noexcept;
+
         /**
          * @brief Get the projection with another generic vector
          * 
@@ -486,6 +524,22 @@ namespace FoxMath
         [[nodiscard]] inline constexpr
 		const TType 	at (size_t index) const throw ();
 
+        /**
+         * @brief Returns a pointer to the first element of the contiguous storage of the GenericVector (TLength elements)
+         * 
+         * @return constexpr const TType* 
+         */
+        [[nodiscard]] inline constexpr
+		const TType*	getData () const noexcept;
+
+        /**
+         * @brief Returns a pointer to the first element of the contiguous storage of the GenericVector (TLength elements)
+         * 
+         * @return constexpr TType* 
+         */
+        [[nodiscard]] inline constexpr
+		TType*	        getData () noexcept;
+
         #pragma endregion //!accessor
     
         #pragma region mutator
@@ -561,6 +615,17 @@ namespace FoxMath
 		implicit inline constexpr
 		GenericVector& operator=(TscalarType scalar) noexcept;
 
+        /**
+         * @brief Evaluate an expression of Vector/VectorExpression.hpp in one loop. Vector can be an operand of the expression
+         * 
+         * @tparam TDerived 
+         * @param expression 
+         * @return constexpr GenericVector& 
+         */
+        template <typename TDerived>
+		implicit inline constexpr
+		GenericVector& operator=(const VectorExpression<TDerived, TLength, TType>& expression) noexcept;
+
         /**
          * @brief addition assignment 
          * 
@@ -69,6 +69,14 @@ template <size_t TLength, typename TType>
 inline constexpr
 TType GenericVector<TLength, TType>::squareLength () const noexcept
 {
+#ifdef FOXMATH_SIMD_SSE
+    if constexpr (SIMDTraits<TLength, TType>::isOperatorEnabled)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+            return SIMD::dot<TLength, TType>(m_data.data(), m_data.data());
+    }
+#endif
+
     TType sqrtLength {static_cast<TType>(0)};
 
     //x * x + y * y + z * z + [...]
@@ -80,12 +88,11 @@ TType GenericVector<TLength, TType>::squareLength () const noexcept
 	return sqrtLength;
 }
 
-//TODO: method not constexpr if it use std::sqrt. Replace it by my own function
 template <size_t TLength, typename TType>
 inline constexpr
 TType GenericVector<TLength, TType>::length () const noexcept
 {
-    return std::sqrt(squareLength());
+    return Numeric::sqrt(squareLength());
 }
 
 template <size_t TLength, typename TType>
@@ -108,26 +115,39 @@ GenericVector<TLength, TType> 	    GenericVector<TLength, TType>::getHomogenized
 }
 
 template <size_t TLength, typename TType>
+template <EPrecision TPrecision>
 inline constexpr
 GenericVector<TLength, TType>& GenericVector<TLength, TType>::normalize	    () noexcept
 {
-    const TType lengthRst = length();
+    if constexpr (TPrecision == EPrecision::Exact || !std::is_floating_point_v<TType>)
+    {
+        const TType lengthRst = length();
 
-    if (lengthRst) [[likely]]
+        if (lengthRst) [[likely]]
+        {
+            for (size_t i = 0; i < TLength; i++)
+                m_data[i] /= lengthRst;
+        }
+    }
+    else
     {
-        for (size_t i = 0; i < TLength; i++)
-            m_data[i] /= lengthRst;
+        /*One reciprocal square root and TLength multiplications instead of sqrt and TLength divisions*/
+        const TType squareLengthRst = squareLength();
+
+        if (squareLengthRst) [[likely]]
+            *this *= Numeric::rsqrt<TPrecision>(squareLengthRst);
     }
 
     return *this;
 }
 
 template <size_t TLength, typename TType>
+template <EPrecision TPrecision>
 inline constexpr
 GenericVector<TLength, TType> GenericVector<TLength, TType>::getNormalized		() const noexcept
 {
     GenericVector<TLength, TType> rst (*this);
-    rst.normalize();
+    rst.template normalize<TPrecision>();
     return rst;
 }
 
@@ -158,6 +178,14 @@ template <size_t TLength, typename TType>
 inline constexpr
 TType           GenericVector<TLength, TType>::dot		            (const GenericVector& other) const noexcept
 {
+#ifdef FOXMATH_SIMD_SSE
+    if constexpr (SIMDTraits<TLength, TType>::isOperatorEnabled)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+            return SIMD::dot<TLength, TType>(m_data.data(), other.m_data.data());
+    }
+#endif
+
     TType rst {static_cast<TType>(0)};
 
     for (size_t i = 0; i < TLength; i++)
@@ -323,14 +351,16 @@ TType GenericVector<TLength, TType>::getTriangleArea		(const GenericVector<TLeng
 }
 
 template <size_t TLength, typename TType>
+template <EPrecision TPrecision>
 inline constexpr
 GenericVector<TLength, TType>& GenericVector<TLength, TType>::rotateAroundAxis (const GenericVector<TLength, TType>& unitAxis, const Angle<EAngleType::Radian, TType>& angle) noexcept
 {
-	(*this) = getRotationAroundAxis(unitAxis, angle);
+	(*this) = getRotationAroundAxis<TPrecision>(unitAxis, angle);
     return *this;
 }
 
 template <size_t TLength, typename TType>
+template <EPrecision TPrecision>
 inline constexpr
 GenericVector<TLength, TType> GenericVector<TLength, TType>::getRotationAroundAxis (const GenericVector<TLength, TType>& unitAxis, const Angle<EAngleType::Radian, TType>& angle) const noexcept
 {
@@ -338,10 +368,38 @@ GenericVector<TLength, TType> GenericVector<TLength, TType>::getRotationAroundAx
     assert(unitAxis == static_cast<TType>(1) && "You must use unit generic vector. If you want disable assert for unit generic vector guard, please define DONT_USE_DEBUG_ASSERT_FOR_UNIT_VETOR");
 #endif
 
-	TType cosA = std::cos(static_cast<TType>(angle));
+	TType sinA {};
+	TType cosA {};
+	Numeric::sinCos<TPrecision>(static_cast<TType>(angle), sinA, cosA);
 
 	//rodrigues rotation formula
-	return (*this) * cosA + unitAxis.getCross(*this) * std::sin(static_cast<TType>(angle)) + unitAxis * unitAxis.dot(*this) * (static_cast<TType>(1) - cosA);
+	return (*this) * cosA + unitAxis.getCross(*this) * sinA + unitAxis * unitAxis.dot(*this) * (static_cast<TType>(1) - cosA);
+}
+
+template <size_t TLength, typename TType>
+template <EPrecision TPrecision>
+inline constexpr
+void GenericVector<TLength, TType>::getSinCos (GenericVector<TLength, TType>& sinVector, GenericVector<TLength, TType>& cosVector) const noexcept
+{
+#ifdef FOXMATH_SIMD_SSE
+    if constexpr (SIMDTraits<TLength, TType>::isDivisionEnabled && TPrecision != EPrecision::Exact)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            __m128 sinRst {};
+            __m128 cosRst {};
+            SIMD::sinCos4<TPrecision>(SIMD::load<TLength>(m_data.data()), sinRst, cosRst);
+            SIMD::store<TLength>(sinVector.m_data.data(), sinRst);
+            SIMD::store<TLength>(cosVector.m_data.data(), cosRst);
+            return;
+        }
+    }
+#endif
+
+    for (size_t i = 0; i < TLength; i++)
+    {
+        Numeric::sinCos<TPrecision>(m_data[i], sinVector.m_data[i], cosVector.m_data[i]);
+    }
 }
 
 template <size_t TLength, typename TType>
@@ -409,6 +467,20 @@ const TType    GenericVector<TLength, TType>::at (size_t index) const throw ()
 				        index, TLength);
 }
 
+template <size_t TLength, typename TType>
+inline constexpr
+const TType*    GenericVector<TLength, TType>::getData () const noexcept
+{
+    return m_data.data();
+}
+
+template <size_t TLength, typename TType>
+inline constexpr
+TType*    GenericVector<TLength, TType>::getData () noexcept
+{
+    return m_data.data();
+}
+
 template <size_t TLength, typename TType>
 template<typename TscalarType, IsArithmetic<TscalarType> = true>
 inline constexpr
@@ -441,6 +513,17 @@ template<typename TscalarType, IsArithmetic<TscalarType> = true>
 inline constexpr
 GenericVector<TLength, TType>& GenericVector<TLength, TType>::operator+=(TscalarType scalar) noexcept
 {
+#ifdef FOXMATH_SIMD_SSE
+    if constexpr (SIMDTraits<TLength, TType>::isOperatorEnabled)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            SIMD::addScalar<TLength, TType>(m_data.data(), static_cast<TType>(scalar));
+            return *this;
+        }
+    }
+#endif
+
     for (TType& data : m_data)
     {
         data += static_cast<TType>(scalar);
@@ -453,6 +536,17 @@ template <size_t TLengthOther, typename TTypeOther>
 inline constexpr
 GenericVector<TLength, TType>& GenericVector<TLength, TType>::operator+=(const GenericVector<TLengthOther, TTypeOther>& other) noexcept
 {
+#ifdef FOXMATH_SIMD_SSE
+    if constexpr (SIMDTraits<TLength, TType>::isOperatorEnabled && TLengthOther == TLength && std::is_same_v<TTypeOther, TType>)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            SIMD::add<TLength, TType>(m_data.data(), other.m_data.data());
+            return *this;
+        }
+    }
+#endif
+
     constexpr size_t minLenght = (TLengthOther < TLength) ? TLengthOther : TLength;
 
     for (size_t i = 0; i < minLenght; i++)
@@ -467,6 +561,17 @@ template<typename TscalarType, IsArithmetic<TscalarType> = true>
 inline constexpr
 GenericVector<TLength, TType>& GenericVector<TLength, TType>::operator-=(TscalarType scalar) noexcept
 {
+#ifdef FOXMATH_SIMD_SSE
+    if constexpr (SIMDTraits<TLength, TType>::isOperatorEnabled)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            SIMD::subScalar<TLength, TType>(m_data.data(), static_cast<TType>(scalar));
+            return *this;
+        }
+    }
+#endif
+
     for (TType& data : m_data)
     {
         data -= static_cast<TType>(scalar);
@@ -479,6 +584,17 @@ template <size_t TLengthOther, typename TTypeOther>
 inline constexpr
 GenericVector<TLength, TType>& GenericVector<TLength, TType>::operator-=(const GenericVector<TLengthOther, TTypeOther>& other) noexcept
 {
+#ifdef FOXMATH_SIMD_SSE
+    if constexpr (SIMDTraits<TLength, TType>::isOperatorEnabled && TLengthOther == TLength && std::is_same_v<TTypeOther, TType>)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            SIMD::sub<TLength, TType>(m_data.data(), other.m_data.data());
+            return *this;
+        }
+    }
+#endif
+
     constexpr size_t minLenght = (TLengthOther < TLength) ? TLengthOther : TLength;
 
     for (size_t i = 0; i < minLenght; i++)
@@ -493,6 +609,17 @@ template<typename TscalarType, IsArithmetic<TscalarType> = true>
 inline constexpr
 GenericVector<TLength, TType>& GenericVector<TLength, TType>::operator*=(TscalarType scalar) noexcept
 {
+#ifdef FOXMATH_SIMD_SSE
+    if constexpr (SIMDTraits<TLength, TType>::isOperatorEnabled)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            SIMD::mulScalar<TLength, TType>(m_data.data(), static_cast<TType>(scalar));
+            return *this;
+        }
+    }
+#endif
+
     for (TType& data : m_data)
     {
         data *= static_cast<TType>(scalar);
@@ -505,6 +632,17 @@ template <size_t TLengthOther, typename TTypeOther>
 inline constexpr
 GenericVector<TLength, TType>& GenericVector<TLength, TType>::operator*=(const GenericVector<TLengthOther, TTypeOther>& other) noexcept
 {
+#ifdef FOXMATH_SIMD_SSE
+    if constexpr (SIMDTraits<TLength, TType>::isOperatorEnabled && TLengthOther == TLength && std::is_same_v<TTypeOther, TType>)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            SIMD::mul<TLength, TType>(m_data.data(), other.m_data.data());
+            return *this;
+        }
+    }
+#endif
+
     constexpr size_t minLenght = (TLengthOther < TLength) ? TLengthOther : TLength;
 
     for (size_t i = 0; i < minLenght; i++)
@@ -519,6 +657,17 @@ template<typename TscalarType, IsArithmetic<TscalarType> = true>
 inline constexpr
 GenericVector<TLength, TType>& GenericVector<TLength, TType>::operator/=(TscalarType scalar) noexcept
 {
+#ifdef FOXMATH_SIMD_SSE
+    if constexpr (SIMDTraits<TLength, TType>::isDivisionOperatorEnabled)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            SIMD::divScalar<TLength>(m_data.data(), static_cast<TType>(scalar));
+            return *this;
+        }
+    }
+#endif
+
     for (TType& data : m_data)
     {
         data /= static_cast<TType>(scalar);
@@ -531,6 +680,17 @@ template <size_t TLengthOther, typename TTypeOther>
 inline constexpr
 GenericVector<TLength, TType>& GenericVector<TLength, TType>::operator/=(const GenericVector<TLengthOther, TTypeOther>& other) noexcept
 {
+#ifdef FOXMATH_SIMD_SSE
+    if constexpr (SIMDTraits<TLength, TType>::isDivisionOperatorEnabled && TLengthOther == TLength && std::is_same_v<TTypeOther, TType>)
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            SIMD::div<TLength>(m_data.data(), other.m_data.data());
+            return *this;
+        }
+    }
+#endif
+
     constexpr size_t minLenght = (TLengthOther < TLength) ? TLengthOther : TLength;
 
     for (size_t i = 0; i < minLenght; i++)
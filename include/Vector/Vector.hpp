@@ -39,4 +39,6 @@
 
 #include "Vector/Vector2.hpp"
 #include "Vector/Vector3.hpp"
-#include "Vector/Vector4.hpp"
\ No newline at end of file
+#include "Vector/Vector4.hpp"
+
+#include "Vector/VectorBatch.hpp"
\ No newline at end of file
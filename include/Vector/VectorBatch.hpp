@@ -0,0 +1,391 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 11 h 20
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Types/SFINAEShorthand.hpp" //IsArithmetic<TType>, IsNotEqualTo
+#include "Vector/GenericVector.hpp" //GenericVector
+#include "Memory/AlignedAllocator.hpp" //AlignedAllocator
+
+#include <array> //std::array
+#include <vector> //std::vector
+#include <stddef.h> //sizt_t
+#include <cassert> //assert
+#include <cmath> //std::sqrt
+
+namespace FoxMath
+{
+    /*Use of IsArithmetic*/
+    template <size_t TLength, typename TType = float, 
+                IsNotEqualTo<TLength, 0> = true, 
+                IsArithmetic<TType> = true>
+    class VectorBatch;
+
+    /**
+     * @brief Structure of arrays container of TLength components vector. Each component (x, y, z, w...) is store in its own contiguous
+     *        32 bytes aligned array so bulk operation can be auto-vectorized without wasted lane (like the 4th lane of Vec3).
+     *        Methods mirror GenericVector's names and are apply on each element of the batch.
+     * 
+     * @example `VectorBatch<3> points (vecs.data(), vecs.size()); points.normalize(); points.toVectors(vecs.data());`
+     */
+    template <size_t TLength, typename TType>
+    class VectorBatch<TLength, TType>
+    {
+        public:
+
+        using ComponentArray = std::vector<TType, AlignedAllocator<TType, 32>>;
+
+        private:
+    
+        protected:
+    
+        #pragma region attribut
+
+        std::array<ComponentArray, TLength> m_components {};
+
+        #pragma endregion //!attribut
+    
+        public:
+    
+        #pragma region constructor/destructor
+    
+        VectorBatch () noexcept                                     = default;
+
+        VectorBatch (const VectorBatch& other)			            = default;
+        
+        VectorBatch (VectorBatch&& other) noexcept				    = default;
+        
+        ~VectorBatch ()				                                = default;
+        
+        VectorBatch& operator=(VectorBatch const& other)		    = default;
+        
+        VectorBatch& operator=(VectorBatch && other) noexcept		= default;
+
+        /**
+         * @brief Create batch of size element init to zero
+         * 
+         * @param size 
+         */
+        explicit inline
+        VectorBatch (size_t size);
+
+        /**
+         * @brief Create batch from a span of generic vector (array of structures)
+         * 
+         * @param vectors : pointer on first vector
+         * @param count : number of vectors
+         */
+        explicit inline
+        VectorBatch (const GenericVector<TLength, TType>* vectors, size_t count);
+
+        #pragma endregion //!constructor/destructor
+    
+        #pragma region methods
+
+        /**
+         * @brief Resize each component array. New element are init to zero
+         * 
+         * @param size 
+         */
+        inline
+        void resize (size_t size);
+
+        /**
+         * @brief Reserve memory of each component array
+         * 
+         * @param size 
+         */
+        inline
+        void reserve (size_t size);
+
+        /**
+         * @brief Remove all element
+         * 
+         */
+        inline
+        void clear () noexcept;
+
+        /**
+         * @brief Add vector at the end of the batch
+         * 
+         * @param vec 
+         */
+        inline
+        void pushBack (const GenericVector<TLength, TType>& vec);
+
+        /**
+         * @brief Replace the content of batch by the span of generic vector
+         * 
+         * @param vectors : pointer on first vector
+         * @param count : number of vectors
+         * @return VectorBatch& 
+         */
+        inline
+        VectorBatch& fromVectors (const GenericVector<TLength, TType>* vectors, size_t count);
+
+        /**
+         * @brief Write the batch in span of generic vector. Span must contain at least size() element
+         * 
+         * @param vectors : pointer on first vector
+         */
+        inline
+        void toVectors (GenericVector<TLength, TType>* vectors) const noexcept;
+
+        /**
+         * @brief Write square length of each vector in out. Out must contain at least size() element
+         * 
+         * @param out 
+         */
+        inline
+        void squareLength (TType* out) const noexcept;
+
+        /**
+         * @brief Write square length of count vectors starting at first in out. Out must contain at least count element
+         * 
+         * @param out 
+         * @param first 
+         * @param count 
+         */
+        inline
+        void squareLength (TType* out, size_t first, size_t count) const noexcept;
+
+        /**
+         * @brief Write length of each vector in out. Out must contain at least size() element
+         * 
+         * @param out 
+         */
+        inline
+        void length (TType* out) const noexcept;
+
+        /**
+         * @brief Normalize each vector. Null vector stay null
+         * 
+         * @return VectorBatch& 
+         */
+        inline
+        VectorBatch& normalize () noexcept;
+
+        /**
+         * @brief Write dot product of each pair of vector in out. Out must contain at least size() element
+         * 
+         * @param other : batch with the same size
+         * @param out 
+         */
+        inline
+        void dot (const VectorBatch& other, TType* out) const noexcept;
+
+        /**
+         * @brief Write dot product of each vector with other in out. Out must contain at least size() element
+         * 
+         * @param other 
+         * @param out 
+         */
+        inline
+        void dot (const GenericVector<TLength, TType>& other, TType* out) const noexcept;
+
+        /**
+         * @brief Perform cross product of each pair of vector. Only for 3 length batch
+         * 
+         * @param other : batch with the same size
+         * @return VectorBatch& 
+         */
+        inline
+        VectorBatch& cross (const VectorBatch& other) noexcept;
+
+        /**
+         * @brief Perform cross product of each vector with other. Only for 3 length batch
+         * 
+         * @param other 
+         * @return VectorBatch& 
+         */
+        inline
+        VectorBatch& cross (const GenericVector<TLength, TType>& other) noexcept;
+
+        /**
+         * @brief Perform linear interpolation of each vector to the vector of other with the same index
+         * 
+         * @param other : batch with the same size
+         * @param t 
+         * @return VectorBatch& 
+         */
+        inline
+        VectorBatch& lerp (const VectorBatch& other, TType t) noexcept;
+
+        /**
+         * @brief Reflect each vector with normal of other with the same index
+         * 
+         * @param normalNormalized : batch of unit normal with the same size
+         * @return VectorBatch& 
+         */
+        inline
+        VectorBatch& reflect (const VectorBatch& normalNormalized) noexcept;
+
+        /**
+         * @brief Reflect each vector with the same normal
+         * 
+         * @param normalNormalized : unit normal
+         * @return VectorBatch& 
+         */
+        inline
+        VectorBatch& reflect (const GenericVector<TLength, TType>& normalNormalized) noexcept;
+
+        #pragma endregion //!methods
+
+        #pragma region static methods
+        
+        /**
+         * @brief Get the vector dimension
+         * 
+         * @return constexpr const size_t& 
+         */
+        [[nodiscard]] inline static constexpr
+		size_t 	getDimension () noexcept
+        {
+            return TLength;
+        }
+
+        #pragma endregion //!static methods
+    
+        #pragma region accessor
+
+        /**
+         * @brief Number of vector in batch
+         * 
+         * @return size_t 
+         */
+        [[nodiscard]] inline
+        size_t size () const noexcept { return m_components[0].size(); }
+
+        /**
+         * @brief Return true if batch doesn't contain vector
+         * 
+         * @return bool 
+         */
+        [[nodiscard]] inline
+        bool empty () const noexcept { return m_components[0].empty(); }
+
+        /**
+         * @brief Get the contiguous array of component (0 for x, 1 for y...)
+         * 
+         * @param component 
+         * @return TType* 
+         */
+        [[nodiscard]] inline
+        TType* getComponent (size_t component) noexcept { return m_components[component].data(); }
+
+        [[nodiscard]] inline
+        const TType* getComponent (size_t component) const noexcept { return m_components[component].data(); }
+
+        /**
+         * @brief Gather the vector at index
+         * 
+         * @param index 
+         * @return GenericVector<TLength, TType> 
+         */
+        [[nodiscard]] inline
+        GenericVector<TLength, TType> getVector (size_t index) const noexcept;
+
+        #pragma endregion //!accessor
+    
+        #pragma region mutator
+
+        /**
+         * @brief Scatter the vector at index
+         * 
+         * @param index 
+         * @param vec 
+         */
+        inline
+        void setVector (size_t index, const GenericVector<TLength, TType>& vec) noexcept;
+
+        #pragma endregion //!mutator
+    
+        #pragma region operator
+
+        /**
+         * @brief Element wise operators with scalar, a generic vector (same for each element) or another batch of the same size
+         */
+		template<typename TscalarType, IsArithmetic<TscalarType> = true>
+		inline
+		VectorBatch& operator+=(TscalarType scalar) noexcept;
+
+		inline
+		VectorBatch& operator+=(const GenericVector<TLength, TType>& vec) noexcept;
+
+		inline
+		VectorBatch& operator+=(const VectorBatch& other) noexcept;
+
+		template<typename TscalarType, IsArithmetic<TscalarType> = true>
+		inline
+		VectorBatch& operator-=(TscalarType scalar) noexcept;
+
+		inline
+		VectorBatch& operator-=(const GenericVector<TLength, TType>& vec) noexcept;
+
+		inline
+		VectorBatch& operator-=(const VectorBatch& other) noexcept;
+
+		template<typename TscalarType, IsArithmetic<TscalarType> = true>
+		inline
+		VectorBatch& operator*=(TscalarType scalar) noexcept;
+
+		inline
+		VectorBatch& operator*=(const GenericVector<TLength, TType>& vec) noexcept;
+
+		inline
+		VectorBatch& operator*=(const VectorBatch& other) noexcept;
+
+		template<typename TscalarType, IsArithmetic<TscalarType> = true>
+		inline
+		VectorBatch& operator/=(TscalarType scalar) noexcept;
+
+		inline
+		VectorBatch& operator/=(const GenericVector<TLength, TType>& vec) noexcept;
+
+		inline
+		VectorBatch& operator/=(const VectorBatch& other) noexcept;
+
+        #pragma endregion //!operator
+    };
+
+    #include "VectorBatch.inl"
+
+    template <typename TType = float>
+    using Vec2SoA = VectorBatch<2, TType>;
+
+    template <typename TType = float>
+    using Vec3SoA = VectorBatch<3, TType>;
+
+    template <typename TType = float>
+    using Vec4SoA = VectorBatch<4, TType>;
+
+    using Vec3fSoA = Vec3SoA<float>;
+    using Vec4fSoA = Vec4SoA<float>;
+
+} /*namespace FoxMath*/
@@ -0,0 +1,673 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 11 h 20
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+template <size_t TLength, typename TType>
+inline
+VectorBatch<TLength, TType>::VectorBatch (size_t size)
+{
+    resize(size);
+}
+
+template <size_t TLength, typename TType>
+inline
+VectorBatch<TLength, TType>::VectorBatch (const GenericVector<TLength, TType>* vectors, size_t count)
+{
+    fromVectors(vectors, count);
+}
+
+template <size_t TLength, typename TType>
+inline
+void VectorBatch<TLength, TType>::resize (size_t size)
+{
+    for (ComponentArray& component : m_components)
+    {
+        component.resize(size, static_cast<TType>(0));
+    }
+}
+
+template <size_t TLength, typename TType>
+inline
+void VectorBatch<TLength, TType>::reserve (size_t size)
+{
+    for (ComponentArray& component : m_components)
+    {
+        component.reserve(size);
+    }
+}
+
+template <size_t TLength, typename TType>
+inline
+void VectorBatch<TLength, TType>::clear () noexcept
+{
+    for (ComponentArray& component : m_components)
+    {
+        component.clear();
+    }
+}
+
+template <size_t TLength, typename TType>
+inline
+void VectorBatch<TLength, TType>::pushBack (const GenericVector<TLength, TType>& vec)
+{
+    for (size_t iComp = 0; iComp < TLength; iComp++)
+    {
+        m_components[iComp].push_back(vec[iComp]);
+    }
+}
+
+template <size_t TLength, typename TType>
+inline
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::fromVectors (const GenericVector<TLength, TType>* vectors, size_t count)
+{
+    resize(count);
+
+    for (size_t iComp = 0; iComp < TLength; iComp++)
+    {
+        TType* component = m_components[iComp].data();
+
+        for (size_t i = 0; i < count; i++)
+        {
+            component[i] = vectors[i][iComp];
+        }
+    }
+
+    return *this;
+}
+
+template <size_t TLength, typename TType>
+inline
+void VectorBatch<TLength, TType>::toVectors (GenericVector<TLength, TType>* vectors) const noexcept
+{
+    const size_t count = size();
+
+    for (size_t iComp = 0; iComp < TLength; iComp++)
+    {
+        const TType* component = m_components[iComp].data();
+
+        for (size_t i = 0; i < count; i++)
+        {
+            vectors[i].setData(iComp, component[i]);
+        }
+    }
+}
+
+template <size_t TLength, typename TType>
+inline
+void VectorBatch<TLength, TType>::squareLength (TType* out) const noexcept
+{
+    squareLength(out, 0, size());
+}
+
+template <size_t TLength, typename TType>
+inline
+void VectorBatch<TLength, TType>::squareLength (TType* out, size_t first, size_t count) const noexcept
+{
+    const TType* component = m_components[0].data() + first;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        out[i] = component[i] * component[i];
+    }
+
+    for (size_t iComp = 1; iComp < TLength; iComp++)
+    {
+        component = m_components[iComp].data() + first;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            out[i] += component[i] * component[i];
+        }
+    }
+}
+
+template <size_t TLength, typename TType>
+inline
+void VectorBatch<TLength, TType>::length (TType* out) const noexcept
+{
+    squareLength(out);
+
+    const size_t count = size();
+
+#ifdef FOXMATH_SIMD_SSE
+    if constexpr (std::is_same_v<TType, float>)
+    {
+        SIMD::sqrtBulk(out, count);
+        return;
+    }
+#endif
+
+    for (size_t i = 0; i < count; i++)
+    {
+        out[i] = static_cast<TType>(std::sqrt(out[i]));
+    }
+}
+
+template <size_t TLength, typename TType>
+inline
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::normalize () noexcept
+{
+    /*Work by block so each pass is a simple loop the compiler can vectorize*/
+    constexpr size_t blockSize = 256;
+    TType invLength[blockSize];
+
+    const size_t count = size();
+
+    for (size_t blockStart = 0; blockStart < count; blockStart += blockSize)
+    {
+        const size_t blockCount = (count - blockStart < blockSize) ? count - blockStart : blockSize;
+
+        squareLength(invLength, blockStart, blockCount);
+
+#ifdef FOXMATH_SIMD_SSE
+        if constexpr (std::is_same_v<TType, float>)
+        {
+            SIMD::invLengthBulk(invLength, blockCount);
+        }
+        else
+#endif
+        for (size_t i = 0; i < blockCount; i++)
+        {
+            const TType lengthRst = static_cast<TType>(std::sqrt(invLength[i]));
+            const TType divisor = (lengthRst != static_cast<TType>(0)) ? lengthRst : static_cast<TType>(1); //null vector stay null without branch
+
+            if constexpr (std::is_floating_point_v<TType>)
+                invLength[i] = static_cast<TType>(1) / divisor;
+            else
+                invLength[i] = divisor;
+        }
+
+        for (size_t iComp = 0; iComp < TLength; iComp++)
+        {
+            TType* component = m_components[iComp].data() + blockStart;
+
+            for (size_t i = 0; i < blockCount; i++)
+            {
+                if constexpr (std::is_floating_point_v<TType>)
+                    component[i] *= invLength[i];
+                else
+                    component[i] /= invLength[i];
+            }
+        }
+    }
+
+    return *this;
+}
+
+template <size_t TLength, typename TType>
+inline
+void VectorBatch<TLength, TType>::dot (const VectorBatch& other, TType* out) const noexcept
+{
+    assert(other.size() == size());
+
+    const size_t count = size();
+    const TType* component = m_components[0].data();
+    const TType* otherComponent = other.m_components[0].data();
+
+    for (size_t i = 0; i < count; i++)
+    {
+        out[i] = component[i] * otherComponent[i];
+    }
+
+    for (size_t iComp = 1; iComp < TLength; iComp++)
+    {
+        component = m_components[iComp].data();
+        otherComponent = other.m_components[iComp].data();
+
+        for (size_t i = 0; i < count; i++)
+        {
+            out[i] += component[i] * otherComponent[i];
+        }
+    }
+}
+
+template <size_t TLength, typename TType>
+inline
+void VectorBatch<TLength, TType>::dot (const GenericVector<TLength, TType>& other, TType* out) const noexcept
+{
+    const size_t count = size();
+    const TType* component = m_components[0].data();
+    TType otherComponent = other[0];
+
+    for (size_t i = 0; i < count; i++)
+    {
+        out[i] = component[i] * otherComponent;
+    }
+
+    for (size_t iComp = 1; iComp < TLength; iComp++)
+    {
+        component = m_components[iComp].data();
+        otherComponent = other[iComp];
+
+        for (size_t i = 0; i < count; i++)
+        {
+            out[i] += component[i] * otherComponent;
+        }
+    }
+}
+
+template <size_t TLength, typename TType>
+inline
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::cross (const VectorBatch& other) noexcept
+{
+    static_assert(TLength == 3, "Cross product of batch is only define for 3 length vector");
+    assert(other.size() == size());
+
+    const size_t count = size();
+    TType* x = m_components[0].data();
+    TType* y = m_components[1].data();
+    TType* z = m_components[2].data();
+    const TType* ox = other.m_components[0].data();
+    const TType* oy = other.m_components[1].data();
+    const TType* oz = other.m_components[2].data();
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const TType cx = y[i] * oz[i] - z[i] * oy[i];
+        const TType cy = z[i] * ox[i] - x[i] * oz[i];
+        const TType cz = x[i] * oy[i] - y[i] * ox[i];
+        x[i] = cx;
+        y[i] = cy;
+        z[i] = cz;
+    }
+
+    return *this;
+}
+
+template <size_t TLength, typename TType>
+inline
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::cross (const GenericVector<TLength, TType>& other) noexcept
+{
+    static_assert(TLength == 3, "Cross product of batch is only define for 3 length vector");
+
+    const size_t count = size();
+    TType* x = m_components[0].data();
+    TType* y = m_components[1].data();
+    TType* z = m_components[2].data();
+    const TType ox = other[0];
+    const TType oy = other[1];
+    const TType oz = other[2];
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const TType cx = y[i] * oz - z[i] * oy;
+        const TType cy = z[i] * ox - x[i] * oz;
+        const TType cz = x[i] * oy - y[i] * ox;
+        x[i] = cx;
+        y[i] = cy;
+        z[i] = cz;
+    }
+
+    return *this;
+}
+
+template <size_t TLength, typename TType>
+inline
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::lerp (const VectorBatch& other, TType t) noexcept
+{
+    assert(other.size() == size());
+
+    const size_t count = size();
+
+    for (size_t iComp = 0; iComp < TLength; iComp++)
+    {
+        TType* component = m_components[iComp].data();
+        const TType* otherComponent = other.m_components[iComp].data();
+
+        for (size_t i = 0; i < count; i++)
+        {
+            component[i] = component[i] + t * (otherComponent[i] - component[i]);
+        }
+    }
+
+    return *this;
+}
+
+template <size_t TLength, typename TType>
+inline
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::reflect (const VectorBatch& normalNormalized) noexcept
+{
+    assert(normalNormalized.size() == size());
+
+    const size_t count = size();
+
+    for (size_t i = 0; i < count; i++)
+    {
+        TType dotRst {static_cast<TType>(0)};
+
+        for (size_t iComp = 0; iComp < TLength; iComp++)
+        {
+            dotRst += m_components[iComp][i] * normalNormalized.m_components[iComp][i];
+        }
+
+        const TType twoDot = static_cast<TType>(2) * dotRst;
+
+        for (size_t iComp = 0; iComp < TLength; iComp++)
+        {
+            m_components[iComp][i] = twoDot * normalNormalized.m_components[iComp][i] - m_components[iComp][i];
+        }
+    }
+
+    return *this;
+}
+
+template <size_t TLength, typename TType>
+inline
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::reflect (const GenericVector<TLength, TType>& normalNormalized) noexcept
+{
+#ifndef DONT_USE_DEBUG_ASSERT_FOR_UNIT_VETOR
+    assert(normalNormalized == static_cast<TType>(1) && "You must use unit generic vector. If you want disable assert for unit generic vector guard, please define DONT_USE_DEBUG_ASSERT_FOR_UNIT_VETOR");
+#endif
+
+    const size_t count = size();
+
+    for (size_t i = 0; i < count; i++)
+    {
+        TType dotRst {static_cast<TType>(0)};
+
+        for (size_t iComp = 0; iComp < TLength; iComp++)
+        {
+            dotRst += m_components[iComp][i] * normalNormalized[iComp];
+        }
+
+        const TType twoDot = static_cast<TType>(2) * dotRst;
+
+        for (size_t iComp = 0; iComp < TLength; iComp++)
+        {
+            m_components[iComp][i] = twoDot * normalNormalized[iComp] - m_components[iComp][i];
+        }
+    }
+
+    return *this;
+}
+
+template <size_t TLength, typename TType>
+inline
+GenericVector<TLength, TType> VectorBatch<TLength, TType>::getVector (size_t index) const noexcept
+{
+    GenericVector<TLength, TType> rst;
+
+    for (size_t iComp = 0; iComp < TLength; iComp++)
+    {
+        rst.setData(iComp, m_components[iComp][index]);
+    }
+
+    return rst;
+}
+
+template <size_t TLength, typename TType>
+inline
+void VectorBatch<TLength, TType>::setVector (size_t index, const GenericVector<TLength, TType>& vec) noexcept
+{
+    for (size_t iComp = 0; iComp < TLength; iComp++)
+    {
+        m_components[iComp][index] = vec[iComp];
+    }
+}
+
+template <size_t TLength, typename TType>
+template<typename TscalarType, IsArithmetic<TscalarType>>
+inline
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::operator+=(TscalarType scalar) noexcept
+{
+    const size_t count = size();
+    const TType value = static_cast<TType>(scalar);
+
+    for (ComponentArray& component : m_components)
+    {
+        TType* data = component.data();
+
+        for (size_t i = 0; i < count; i++)
+        {
+            data[i] += value;
+        }
+    }
+    return *this;
+}
+
+template <size_t TLength, typename TType>
+inline
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::operator+=(const GenericVector<TLength, TType>& vec) noexcept
+{
+    const size_t count = size();
+
+    for (size_t iComp = 0; iComp < TLength; iComp++)
+    {
+        TType* data = m_components[iComp].data();
+        const TType value = vec[iComp];
+
+        for (size_t i = 0; i < count; i++)
+        {
+            data[i] += value;
+        }
+    }
+    return *this;
+}
+
+template <size_t TLength, typename TType>
+inline
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::operator+=(const VectorBatch& other) noexcept
+{
+    assert(other.size() == size());
+
+    const size_t count = size();
+
+    for (size_t iComp = 0; iComp < TLength; iComp++)
+    {
+        TType* data = m_components[iComp].data();
+        const TType* otherData = other.m_components[iComp].data();
+
+        for (size_t i = 0; i < count; i++)
+        {
+            data[i] += otherData[i];
+        }
+    }
+    return *this;
+}
+
+template <size_t TLength, typename TType>
+template<typename TscalarType, IsArithmetic<TscalarType>>
+inline
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::operator-=(TscalarType scalar) noexcept
+{
+    const size_t count = size();
+    const TType value = static_cast<TType>(scalar);
+
+    for (ComponentArray& component : m_components)
+    {
+        TType* data = component.data();
+
+        for (size_t i = 0; i < count; i++)
+        {
+            data[i] -= value;
+        }
+    }
+    return *this;
+}
+
+template <size_t TLength, typename TType>
+inline
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::operator-=(const GenericVector<TLength, TType>& vec) noexcept
+{
+    const size_t count = size();
+
+    for (size_t iComp = 0; iComp < TLength; iComp++)
+    {
+        TType* data = m_components[iComp].data();
+        const TType value = vec[iComp];
+
+        for (size_t i = 0; i < count; i++)
+        {
+            data[i] -= value;
+        }
+    }
+    return *this;
+}
+
+template <size_t TLength, typename TType>
+inline
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::operator-=(const VectorBatch& other) noexcept
+{
+    assert(other.size() == size());
+
+    const size_t count = size();
+
+    for (size_t iComp = 0; iComp < TLength; iComp++)
+    {
+        TType* data = m_components[iComp].data();
+        const TType* otherData = other.m_components[iComp].data();
+
+        for (size_t i = 0; i < count; i++)
+        {
+            data[i] -= otherData[i];
+        }
+    }
+    return *this;
+}
+
+template <size_t TLength, typename TType>
+template<typename TscalarType, IsArithmetic<TscalarType>>
+inline
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::operator*=(TscalarType scalar) noexcept
+{
+    const size_t count = size();
+    const TType value = static_cast<TType>(scalar);
+
+    for (ComponentArray& component : m_components)
+    {
+        TType* data = component.data();
+
+        for (size_t i = 0; i < count; i++)
+        {
+            data[i] *= value;
+        }
+    }
+    return *this;
+}
+
+template <size_t TLength, typename TType>
+inline
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::operator*=(const GenericVector<TLength, TType>& vec) noexcept
+{
+    const size_t count = size();
+
+    for (size_t iComp = 0; iComp < TLength; iComp++)
+    {
+        TType* data = m_components[iComp].data();
+        const TType value = vec[iComp];
+
+        for (size_t i = 0; i < count; i++)
+        {
+            data[i] *= value;
+        }
+    }
+    return *this;
+}
+
+template <size_t TLength, typename TType>
+inline
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::operator*=(const VectorBatch& other) noexcept
+{
+    assert(other.size() == size());
+
+    const size_t count = size();
+
+    for (size_t iComp = 0; iComp < TLength; iComp++)
+    {
+        TType* data = m_components[iComp].data();
+        const TType* otherData = other.m_components[iComp].data();
+
+        for (size_t i = 0; i < count; i++)
+        {
+            data[i] *= otherData[i];
+        }
+    }
+    return *this;
+}
+
+template <size_t TLength, typename TType>
+template<typename TscalarType, IsArithmetic<TscalarType>>
+inline
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::operator/=(TscalarType scalar) noexcept
+{
+    const size_t count = size();
+    const TType value = static_cast<TType>(scalar);
+
+    for (ComponentArray& component : m_components)
+    {
+        TType* data = component.data();
+
+        for (size_t i = 0; i < count; i++)
+        {
+            data[i] /= value;
+        }
+    }
+    return *this;
+}
+
+template <size_t TLength, typename TType>
+inline
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::operator/=(const GenericVector<TLength, TType>& vec) noexcept
+{
+    const size_t count = size();
+
+    for (size_t iComp = 0; iComp < TLength; iComp++)
+    {
+        TType* data = m_components[iComp].data();
+        const TType value = vec[iComp];
+
+        for (size_t i = 0; i < count; i++)
+        {
+            data[i] /= value;
+        }
+    }
+    return *this;
+}
+
+template <size_t TLength, typename TType>
+inline
+VectorBatch<TLength, TType>& VectorBatch<TLength, TType>::operator/=(const VectorBatch& other) noexcept
+{
+    assert(other.size() == size());
+
+    const size_t count = size();
+
+    for (size_t iComp = 0; iComp < TLength; iComp++)
+    {
+        TType* data = m_components[iComp].data();
+        const TType* otherData = other.m_components[iComp].data();
+
+        for (size_t i = 0; i < count; i++)
+        {
+            data[i] /= otherData[i];
+        }
+    }
+    return *this;
+}
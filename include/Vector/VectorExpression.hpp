@@ -0,0 +1,379 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 16 h 55
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include "Vector/GenericVector.hpp" //GenericVector
+#include "SIMD/SIMD.hpp" //SIMDTraits, FOXMATH_SIMD_SSE
+
+#include <stddef.h> //sizt_t
+#include <type_traits> //std::enable_if_t, std::is_base_of_v, std::is_arithmetic_v
+
+/**
+ * Opt-in expression templates : an operand wrapped with lazy() turn the arithmetic operators in nodes of an expression tree
+ * instead of GenericVector temporaries. The whole expression is evaluated in one loop (one SSE pass by 4 floats with
+ * FOXMATH_USE_SIMD) when it construct or is assigned to a GenericVector (or a child class like Vector3).
+ * Expression only reference the vectors : never store it in an auto variable after the end of the full expression.
+ * 
+ * @example `Vec3f out = lazy(vec) * cosAngle + lazy(unitAxis) * ((1.f - cosAngle) * vec.dot(unitAxis)) + unitAxis.getCross(vec) * sinAngle;`
+ */
+
+namespace FoxMath
+{
+    /**
+     * @brief Base of all expression nodes (used to detect them)
+     */
+    struct VectorExpressionTag {};
+
+    /**
+     * @brief CRTP base of the expression nodes. A node compute one element with evaluate(index) and 4 floats with evaluate4(index)
+     * 
+     * @tparam TDerived : node type
+     * @tparam TLength 
+     * @tparam TType 
+     */
+    template <typename TDerived, size_t TLength, typename TType>
+    class VectorExpression : public VectorExpressionTag
+    {
+        public:
+
+        static constexpr size_t length = TLength;
+        using Type = TType;
+
+        #pragma region methods
+
+        [[nodiscard]] constexpr inline
+        const TDerived& derived     () const noexcept { return static_cast<const TDerived&>(*this); }
+
+        [[nodiscard]] constexpr inline
+        TType           operator[]  (size_t index) const noexcept { return derived().evaluate(index); }
+
+        #pragma endregion //!methods
+    };
+
+    /**
+     * @brief Leaf of the expression tree : reference on the storage of a GenericVector
+     */
+    template <size_t TLength, typename TType>
+    class VectorLeaf : public VectorExpression<VectorLeaf<TLength, TType>, TLength, TType>
+    {
+        protected:
+
+        #pragma region attribut
+
+        const GenericVector<TLength, TType>* m_vector;
+
+        #pragma endregion //!attribut
+
+        public:
+
+        #pragma region constructor/destructor
+
+        explicit constexpr inline
+        VectorLeaf (const GenericVector<TLength, TType>& vector) noexcept
+            : m_vector {&vector}
+        {}
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        [[nodiscard]] constexpr inline
+        TType   evaluate    (size_t index) const noexcept { return (*m_vector)[index]; }
+
+#ifdef FOXMATH_SIMD_SSE
+        [[nodiscard]] inline
+        __m128  evaluate4   (size_t index) const noexcept;
+#endif
+
+        #pragma endregion //!methods
+    };
+
+    /**
+     * @brief Scalar broadcasted on all elements
+     */
+    template <size_t TLength, typename TType>
+    class VectorScalar : public VectorExpression<VectorScalar<TLength, TType>, TLength, TType>
+    {
+        protected:
+
+        #pragma region attribut
+
+        TType m_scalar;
+
+        #pragma endregion //!attribut
+
+        public:
+
+        #pragma region constructor/destructor
+
+        explicit constexpr inline
+        VectorScalar (TType scalar) noexcept
+            : m_scalar {scalar}
+        {}
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        [[nodiscard]] constexpr inline
+        TType   evaluate    (size_t) const noexcept { return m_scalar; }
+
+#ifdef FOXMATH_SIMD_SSE
+        [[nodiscard]] inline
+        __m128  evaluate4   (size_t) const noexcept { return _mm_set1_ps(m_scalar); }
+#endif
+
+        #pragma endregion //!methods
+    };
+
+    /**
+     * @brief Element wise operation between two nodes. Children are stored by value (a node is only pointers and scalars)
+     * 
+     * @tparam TOperation : ExpressionAdd, ExpressionSub, ExpressionMul or ExpressionDiv
+     * @tparam TLhs 
+     * @tparam TRhs 
+     */
+    template <typename TOperation, typename TLhs, typename TRhs>
+    class VectorBinary : public VectorExpression<VectorBinary<TOperation, TLhs, TRhs>, TLhs::length, typename TLhs::Type>
+    {
+        static_assert(TLhs::length == TRhs::length && std::is_same_v<typename TLhs::Type, typename TRhs::Type>, "Operands of an expression must have the same length and type");
+
+        protected:
+
+        #pragma region attribut
+
+        TLhs m_lhs;
+        TRhs m_rhs;
+
+        #pragma endregion //!attribut
+
+        public:
+
+        #pragma region constructor/destructor
+
+        constexpr inline
+        VectorBinary (const TLhs& lhs, const TRhs& rhs) noexcept
+            : m_lhs {lhs}, m_rhs {rhs}
+        {}
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        [[nodiscard]] constexpr inline
+        typename TLhs::Type evaluate    (size_t index) const noexcept { return TOperation::apply(m_lhs.evaluate(index), m_rhs.evaluate(index)); }
+
+#ifdef FOXMATH_SIMD_SSE
+        [[nodiscard]] inline
+        __m128              evaluate4   (size_t index) const noexcept { return TOperation::apply(m_lhs.evaluate4(index), m_rhs.evaluate4(index)); }
+#endif
+
+        #pragma endregion //!methods
+    };
+
+    /**
+     * @brief Opposite of a node
+     */
+    template <typename TOperand>
+    class VectorNegate : public VectorExpression<VectorNegate<TOperand>, TOperand::length, typename TOperand::Type>
+    {
+        protected:
+
+        #pragma region attribut
+
+        TOperand m_operand;
+
+        #pragma endregion //!attribut
+
+        public:
+
+        #pragma region constructor/destructor
+
+        explicit constexpr inline
+        VectorNegate (const TOperand& operand) noexcept
+            : m_operand {operand}
+        {}
+
+        #pragma endregion //!constructor/destructor
+
+        #pragma region methods
+
+        [[nodiscard]] constexpr inline
+        typename TOperand::Type evaluate    (size_t index) const noexcept { return -m_operand.evaluate(index); }
+
+#ifdef FOXMATH_SIMD_SSE
+        [[nodiscard]] inline
+        __m128                  evaluate4   (size_t index) const noexcept { return _mm_sub_ps(_mm_setzero_ps(), m_operand.evaluate4(index)); }
+#endif
+
+        #pragma endregion //!methods
+    };
+
+    #pragma region operations
+
+    struct ExpressionAdd
+    {
+        template <typename TType>
+        [[nodiscard]] static constexpr inline
+        TType apply (TType lhs, TType rhs) noexcept { return lhs + rhs; }
+
+#ifdef FOXMATH_SIMD_SSE
+        [[nodiscard]] static inline
+        __m128 apply (__m128 lhs, __m128 rhs) noexcept { return _mm_add_ps(lhs, rhs); }
+#endif
+    };
+
+    struct ExpressionSub
+    {
+        template <typename TType>
+        [[nodiscard]] static constexpr inline
+        TType apply (TType lhs, TType rhs) noexcept { return lhs - rhs; }
+
+#ifdef FOXMATH_SIMD_SSE
+        [[nodiscard]] static inline
+        __m128 apply (__m128 lhs, __m128 rhs) noexcept { return _mm_sub_ps(lhs, rhs); }
+#endif
+    };
+
+    struct ExpressionMul
+    {
+        template <typename TType>
+        [[nodiscard]] static constexpr inline
+        TType apply (TType lhs, TType rhs) noexcept { return lhs * rhs; }
+
+#ifdef FOXMATH_SIMD_SSE
+        [[nodiscard]] static inline
+        __m128 apply (__m128 lhs, __m128 rhs) noexcept { return _mm_mul_ps(lhs, rhs); }
+#endif
+    };
+
+    struct ExpressionDiv
+    {
+        template <typename TType>
+        [[nodiscard]] static constexpr inline
+        TType apply (TType lhs, TType rhs) noexcept { return lhs / rhs; }
+
+#ifdef FOXMATH_SIMD_SSE
+        [[nodiscard]] static inline
+        __m128 apply (__m128 lhs, __m128 rhs) noexcept { return _mm_div_ps(lhs, rhs); }
+#endif
+    };
+
+    #pragma endregion //!operations
+
+    #pragma region traits
+
+    template <typename T>
+    inline constexpr bool isVectorExpression = std::is_base_of_v<VectorExpressionTag, T>;
+
+    /**
+     * @brief True for GenericVector and its child classes (Vector3...)
+     */
+    template <typename T>
+    struct IsGenericVectorType
+    {
+        private:
+
+        template <size_t TLength, typename TType>
+        static std::true_type   test (const GenericVector<TLength, TType>*);
+        static std::false_type  test (...);
+
+        public:
+
+        static constexpr bool value = decltype(test(std::declval<const T*>()))::value;
+    };
+
+    /**
+     * @brief True if one operand is an expression and the other one an expression, a GenericVector or a scalar
+     */
+    template <typename TLhs, typename TRhs>
+    inline constexpr bool isExpressionOperands =    (isVectorExpression<TLhs> && (isVectorExpression<TRhs> || IsGenericVectorType<TRhs>::value || std::is_arithmetic_v<TRhs>)) ||
+                                                    (isVectorExpression<TRhs> && (IsGenericVectorType<TLhs>::value || std::is_arithmetic_v<TLhs>));
+
+    #pragma endregion //!traits
+
+    #pragma region functions
+
+    /**
+     * @brief Start an expression with vector. Following operators with this operand build an expression instead of temporaries
+     * 
+     * @tparam TLength 
+     * @tparam TType 
+     * @param vector 
+     * @return VectorLeaf<TLength, TType> 
+     */
+    template <size_t TLength, typename TType>
+    [[nodiscard]] constexpr inline
+    VectorLeaf<TLength, TType> lazy (const GenericVector<TLength, TType>& vector) noexcept;
+
+    /**
+     * @brief Evaluate expression in out in one loop. Each element only read the same element of its operands so out can be an operand
+     * @note Float expressions with FOXMATH_USE_SIMD are evaluated by 4 elements (Vec3f and Vec4f in one pass, remaining elements in scalar)
+     * 
+     * @tparam TLength 
+     * @tparam TType 
+     * @tparam TDerived 
+     * @param out 
+     * @param expression 
+     * @return GenericVector<TLength, TType>& : out
+     */
+    template <size_t TLength, typename TType, typename TDerived>
+    constexpr inline
+    GenericVector<TLength, TType>& assign (GenericVector<TLength, TType>& out, const VectorExpression<TDerived, TLength, TType>& expression) noexcept;
+
+    #pragma endregion //!functions
+
+    #pragma region arithmetic operators
+
+    template <typename TLhs, typename TRhs, std::enable_if_t<isExpressionOperands<TLhs, TRhs>, bool> = true>
+    [[nodiscard]] constexpr inline
+    auto operator+ (const TLhs& lhs, const TRhs& rhs) noexcept;
+
+    template <typename TLhs, typename TRhs, std::enable_if_t<isExpressionOperands<TLhs, TRhs>, bool> = true>
+    [[nodiscard]] constexpr inline
+    auto operator- (const TLhs& lhs, const TRhs& rhs) noexcept;
+
+    template <typename TLhs, typename TRhs, std::enable_if_t<isExpressionOperands<TLhs, TRhs>, bool> = true>
+    [[nodiscard]] constexpr inline
+    auto operator* (const TLhs& lhs, const TRhs& rhs) noexcept;
+
+    template <typename TLhs, typename TRhs, std::enable_if_t<isExpressionOperands<TLhs, TRhs>, bool> = true>
+    [[nodiscard]] constexpr inline
+    auto operator/ (const TLhs& lhs, const TRhs& rhs) noexcept;
+
+    template <typename TOperand, std::enable_if_t<isVectorExpression<TOperand>, bool> = true>
+    [[nodiscard]] constexpr inline
+    VectorNegate<TOperand> operator- (const TOperand& operand) noexcept;
+
+    #pragma endregion //!arithmetic operators
+
+    #include "VectorExpression.inl"
+
+} /*namespace FoxMath*/
@@ -0,0 +1,178 @@
+/*
+ * Project : FoxMath
+ * Editing by Six Jonathan
+ * Date : 2026-10-17 - 16 h 55
+ *
+ *
+ * MIT License
+ *
+ * Copyright (c) 2020 Six Jonathan
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#ifdef FOXMATH_SIMD_SSE
+template <size_t TLength, typename TType>
+inline
+__m128 VectorLeaf<TLength, TType>::evaluate4 (size_t index) const noexcept
+{
+    const float* data = m_vector->getData();
+
+    /*Vec3f is loaded in one register with a null 4th lane*/
+    if constexpr (SIMDTraits<TLength, TType>::isEnabled)
+        return SIMD::load<TLength>(data);
+    else
+        return _mm_loadu_ps(data + index);
+}
+#endif
+
+/**
+ * @brief Operand of an expression of TLength elements of TType : expression is kept, GenericVector become a leaf and scalar is broadcasted
+ */
+template <size_t TLength, typename TType, typename TOperand>
+[[nodiscard]] constexpr inline
+auto toExpressionOperand (const TOperand& operand) noexcept
+{
+    if constexpr (isVectorExpression<TOperand>)
+        return operand;
+    else if constexpr (IsGenericVectorType<TOperand>::value)
+        return VectorLeaf<TLength, TType>(operand);
+    else
+        return VectorScalar<TLength, TType>(static_cast<TType>(operand));
+}
+
+/**
+ * @brief Create the node TOperation(lhs, rhs). Length and type come from the expression operand
+ */
+template <typename TOperation, typename TLhs, typename TRhs>
+[[nodiscard]] constexpr inline
+auto makeVectorBinary (const TLhs& lhs, const TRhs& rhs) noexcept
+{
+    using TExpression = std::conditional_t<isVectorExpression<TLhs>, TLhs, TRhs>;
+
+    auto lhsOperand = toExpressionOperand<TExpression::length, typename TExpression::Type>(lhs);
+    auto rhsOperand = toExpressionOperand<TExpression::length, typename TExpression::Type>(rhs);
+
+    return VectorBinary<TOperation, decltype(lhsOperand), decltype(rhsOperand)>(lhsOperand, rhsOperand);
+}
+
+template <size_t TLength, typename TType>
+inline constexpr
+VectorLeaf<TLength, TType> lazy (const GenericVector<TLength, TType>& vector) noexcept
+{
+    return VectorLeaf<TLength, TType>(vector);
+}
+
+template <size_t TLength, typename TType, typename TDerived>
+inline constexpr
+GenericVector<TLength, TType>& assign (GenericVector<TLength, TType>& out, const VectorExpression<TDerived, TLength, TType>& expression) noexcept
+{
+    const TDerived& node = expression.derived();
+
+#ifdef FOXMATH_SIMD_SSE
+    if constexpr (std::is_same_v<TType, float> && (SIMDTraits<TLength, TType>::isEnabled || TLength >= 4))
+    {
+        if (!FOXMATH_IS_CONSTANT_EVALUATED())
+        {
+            float* data = out.getData();
+
+            if constexpr (SIMDTraits<TLength, TType>::isEnabled)
+            {
+                SIMD::store<TLength>(data, node.evaluate4(0));
+            }
+            else
+            {
+                constexpr size_t simdLength = TLength - TLength % 4;
+
+                for (size_t index = 0; index < simdLength; index += 4)
+                {
+                    _mm_storeu_ps(data + index, node.evaluate4(index));
+                }
+
+                for (size_t index = simdLength; index < TLength; ++index)
+                {
+                    data[index] = node.evaluate(index);
+                }
+            }
+
+            return out;
+        }
+    }
+#endif
+
+    for (size_t index = 0; index < TLength; ++index)
+    {
+        out.setData(index, node.evaluate(index));
+    }
+
+    return out;
+}
+
+template <typename TLhs, typename TRhs, std::enable_if_t<isExpressionOperands<TLhs, TRhs>, bool>>
+inline constexpr
+auto operator+ (const TLhs& lhs, const TRhs& rhs) noexcept
+{
+    return makeVectorBinary<ExpressionAdd>(lhs, rhs);
+}
+
+template <typename TLhs, typename TRhs, std::enable_if_t<isExpressionOperands<TLhs, TRhs>, bool>>
+inline constexpr
+auto operator- (const TLhs& lhs, const TRhs& rhs) noexcept
+{
+    return makeVectorBinary<ExpressionSub>(lhs, rhs);
+}
+
+template <typename TLhs, typename TRhs, std::enable_if_t<isExpressionOperands<TLhs, TRhs>, bool>>
+inline constexpr
+auto operator* (const TLhs& lhs, const TRhs& rhs) noexcept
+{
+    return makeVectorBinary<ExpressionMul>(lhs, rhs);
+}
+
+template <typename TLhs, typename TRhs, std::enable_if_t<isExpressionOperands<TLhs, TRhs>, bool>>
+inline constexpr
+auto operator/ (const TLhs& lhs, const TRhs& rhs) noexcept
+{
+    return makeVectorBinary<ExpressionDiv>(lhs, rhs);
+}
+
+template <typename TOperand, std::enable_if_t<isVectorExpression<TOperand>, bool>>
+inline constexpr
+VectorNegate<TOperand> operator- (const TOperand& operand) noexcept
+{
+    return VectorNegate<TOperand>(operand);
+}
+
+template <size_t TLength, typename TType>
+template <typename TDerived>
+inline constexpr
+GenericVector<TLength, TType>::GenericVector (const VectorExpression<TDerived, TLength, TType>& expression) noexcept
+{
+    assign(*this, expression);
+}
+
+template <size_t TLength, typename TType>
+template <typename TDerived>
+inline constexpr
+GenericVector<TLength, TType>& GenericVector<TLength, TType>::operator=(const VectorExpression<TDerived, TLength, TType>& expression) noexcept
+{
+    return assign(*this, expression);
+}